@@ -0,0 +1,108 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "kernels/Kernels.hpp"
+#include <array>
+#include <cstring>
+
+namespace gp
+{
+
+namespace
+{
+
+/// @brief Byte-wise lookup table of the reflected CRC-32C polynomial.
+constexpr std::array<UInt32, 256> kCrc32cTable = []()
+{
+    std::array<UInt32, 256> table{};
+    for (UInt32 index = 0; index < 256; ++index)
+    {
+        UInt32 crc = index;
+        for (UInt32 bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ ((crc & 1u) != 0 ? 0x82F63B78u : 0u);
+        }
+        table[index] = crc;
+    }
+    return table;
+}();
+
+void copyMemoryScalar(void* destination, const void* source, USize size) noexcept
+{
+    std::memcpy(destination, source, size);
+}
+
+USize findByteScalar(const void* data, USize size, UInt8 value) noexcept
+{
+    const void* match = std::memchr(data, value, size);
+    return match != nullptr ? static_cast<USize>(static_cast<const UInt8*>(match) - static_cast<const UInt8*>(data))
+                            : size;
+}
+
+UInt32 crc32cScalar(const void* data, USize size, UInt32 seed) noexcept
+{
+    const UInt8* bytes = static_cast<const UInt8*>(data);
+    UInt32 crc = ~seed;
+    for (USize index = 0; index < size; ++index)
+    {
+        crc = kCrc32cTable[(crc ^ bytes[index]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+Float32 dotProductScalar(const Float32* a, const Float32* b, USize count) noexcept
+{
+    Float32 sum = 0.0f;
+    for (USize index = 0; index < count; ++index)
+    {
+        sum += a[index] * b[index];
+    }
+    return sum;
+}
+
+void mixAudioScalar(Float32* destination, const Float32* source, Float32 gain, USize count) noexcept
+{
+    for (USize index = 0; index < count; ++index)
+    {
+        destination[index] += source[index] * gain;
+    }
+}
+
+}   // namespace
+
+namespace detail
+{
+
+const KernelTable kScalarKernelTable = {
+    &copyMemoryScalar, &findByteScalar, &crc32cScalar, &dotProductScalar, &mixAudioScalar, ISALevel::Scalar,
+};
+
+}   // namespace detail
+
+const KernelTable* Kernels::s_table = &detail::kScalarKernelTable;
+
+void Kernels::initialize(ISALevel level) noexcept
+{
+    s_table = &getTable(level);
+}
+
+const KernelTable& Kernels::getTable(ISALevel level) noexcept
+{
+    switch (level)
+    {
+#if GP_ARCHITECTURE_X86 || GP_ARCHITECTURE_X64
+    case ISALevel::AVX2:
+        return detail::kAVX2KernelTable;
+    case ISALevel::SSE4_2:
+        return detail::kSSE42KernelTable;
+#elif GP_ARCHITECTURE_ARM64
+    case ISALevel::NEON:
+        return detail::kNEONKernelTable;
+#endif
+    default:
+        return detail::kScalarKernelTable;
+    }
+}
+
+}   // namespace gp
@@ -0,0 +1,115 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "kernels/Kernels.hpp"
+
+#if GP_ARCHITECTURE_ARM64
+
+    #include <arm_neon.h>
+    #include <cstring>
+    #if defined(__ARM_FEATURE_CRC32)
+        #include <arm_acle.h>
+    #endif
+
+namespace gp
+{
+
+namespace
+{
+
+void copyMemoryNEON(void* destination, const void* source, USize size) noexcept
+{
+    // AArch64 memcpy implementations already use the widest loads and stores available.
+    std::memcpy(destination, source, size);
+}
+
+USize findByteNEON(const void* data, USize size, UInt8 value) noexcept
+{
+    const UInt8* bytes = static_cast<const UInt8*>(data);
+    const uint8x16_t needle = vdupq_n_u8(value);
+    USize index = 0;
+    for (; index + 16 <= size; index += 16)
+    {
+        if (vmaxvq_u8(vceqq_u8(vld1q_u8(bytes + index), needle)) != 0)
+        {
+            break;
+        }
+    }
+    for (; index < size; ++index)
+    {
+        if (bytes[index] == value)
+        {
+            return index;
+        }
+    }
+    return size;
+}
+
+UInt32 crc32cNEON(const void* data, USize size, UInt32 seed) noexcept
+{
+    #if defined(__ARM_FEATURE_CRC32)
+    const UInt8* bytes = static_cast<const UInt8*>(data);
+    UInt32 crc = ~seed;
+    for (; size >= 8; size -= 8, bytes += 8)
+    {
+        UInt64 word;
+        std::memcpy(&word, bytes, sizeof(word));
+        crc = __crc32cd(crc, word);
+    }
+    for (; size > 0; --size, ++bytes)
+    {
+        crc = __crc32cb(crc, *bytes);
+    }
+    return ~crc;
+    #else
+    // The CRC32 extension is optional before ARMv8.1: without it in the build flags, the table-driven version runs.
+    return detail::kScalarKernelTable.crc32c(data, size, seed);
+    #endif
+}
+
+Float32 dotProductNEON(const Float32* a, const Float32* b, USize count) noexcept
+{
+    float32x4_t sum0 = vdupq_n_f32(0.0f);
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+    USize index = 0;
+    for (; index + 8 <= count; index += 8)
+    {
+        sum0 = vfmaq_f32(sum0, vld1q_f32(a + index), vld1q_f32(b + index));
+        sum1 = vfmaq_f32(sum1, vld1q_f32(a + index + 4), vld1q_f32(b + index + 4));
+    }
+    Float32 result = vaddvq_f32(vaddq_f32(sum0, sum1));
+    for (; index < count; ++index)
+    {
+        result += a[index] * b[index];
+    }
+    return result;
+}
+
+void mixAudioNEON(Float32* destination, const Float32* source, Float32 gain, USize count) noexcept
+{
+    USize index = 0;
+    for (; index + 4 <= count; index += 4)
+    {
+        vst1q_f32(destination + index, vfmaq_n_f32(vld1q_f32(destination + index), vld1q_f32(source + index), gain));
+    }
+    for (; index < count; ++index)
+    {
+        destination[index] += source[index] * gain;
+    }
+}
+
+}   // namespace
+
+namespace detail
+{
+
+const KernelTable kNEONKernelTable = {
+    &copyMemoryNEON, &findByteNEON, &crc32cNEON, &dotProductNEON, &mixAudioNEON, ISALevel::NEON,
+};
+
+}   // namespace detail
+
+}   // namespace gp
+
+#endif
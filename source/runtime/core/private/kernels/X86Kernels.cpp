@@ -0,0 +1,255 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "kernels/Kernels.hpp"
+
+#if GP_ARCHITECTURE_X86 || GP_ARCHITECTURE_X64
+
+    #include <bit>
+    #include <cstring>
+    #include <immintrin.h>
+
+namespace gp
+{
+
+namespace
+{
+
+/// @brief Size from which copies use non-temporal stores, so buffers larger than the caches do not evict them.
+constexpr USize kStreamingCopyThreshold = 1024 * 1024;
+
+/// @section SSE4.2 kernels.
+
+GP_TARGET("sse4.2") void copyMemorySSE42(void* destination, const void* source, USize size) noexcept
+{
+    if (size < kStreamingCopyThreshold)
+    {
+        std::memcpy(destination, source, size);
+        return;
+    }
+
+    UInt8* output = static_cast<UInt8*>(destination);
+    const UInt8* input = static_cast<const UInt8*>(source);
+    const USize head = (16 - (reinterpret_cast<UIntPtr>(output) & 15)) & 15;
+    std::memcpy(output, input, head);
+    output += head;
+    input += head;
+    size -= head;
+
+    for (; size >= 64; size -= 64, output += 64, input += 64)
+    {
+        const __m128i block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        const __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16));
+        const __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 32));
+        const __m128i block3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(output), block0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(output + 16), block1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(output + 32), block2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(output + 48), block3);
+    }
+    _mm_sfence();
+    std::memcpy(output, input, size);
+}
+
+GP_TARGET("sse4.2") USize findByteSSE42(const void* data, USize size, UInt8 value) noexcept
+{
+    const UInt8* bytes = static_cast<const UInt8*>(data);
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+    USize index = 0;
+    for (; index + 16 <= size; index += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + index));
+        const UInt32 mask = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+        if (mask != 0)
+        {
+            return index + static_cast<USize>(std::countr_zero(mask));
+        }
+    }
+    for (; index < size; ++index)
+    {
+        if (bytes[index] == value)
+        {
+            return index;
+        }
+    }
+    return size;
+}
+
+GP_TARGET("sse4.2") UInt32 crc32cSSE42(const void* data, USize size, UInt32 seed) noexcept
+{
+    const UInt8* bytes = static_cast<const UInt8*>(data);
+    #if GP_ARCHITECTURE_X64
+    UInt64 crc = ~seed;
+    for (; size >= 8; size -= 8, bytes += 8)
+    {
+        UInt64 word;
+        std::memcpy(&word, bytes, sizeof(word));
+        crc = _mm_crc32_u64(crc, word);
+    }
+    UInt32 crc32 = static_cast<UInt32>(crc);
+    #else
+    UInt32 crc32 = ~seed;
+    for (; size >= 4; size -= 4, bytes += 4)
+    {
+        UInt32 word;
+        std::memcpy(&word, bytes, sizeof(word));
+        crc32 = _mm_crc32_u32(crc32, word);
+    }
+    #endif
+    for (; size > 0; --size, ++bytes)
+    {
+        crc32 = _mm_crc32_u8(crc32, *bytes);
+    }
+    return ~crc32;
+}
+
+GP_TARGET("sse4.2") Float32 dotProductSSE42(const Float32* a, const Float32* b, USize count) noexcept
+{
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    USize index = 0;
+    for (; index + 8 <= count; index += 8)
+    {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + index), _mm_loadu_ps(b + index)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + index + 4), _mm_loadu_ps(b + index + 4)));
+    }
+    __m128 sum = _mm_add_ps(sum0, sum1);
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    Float32 result = _mm_cvtss_f32(sum);
+    for (; index < count; ++index)
+    {
+        result += a[index] * b[index];
+    }
+    return result;
+}
+
+GP_TARGET("sse4.2") void mixAudioSSE42(Float32* destination, const Float32* source, Float32 gain, USize count) noexcept
+{
+    const __m128 gains = _mm_set1_ps(gain);
+    USize index = 0;
+    for (; index + 4 <= count; index += 4)
+    {
+        const __m128 scaled = _mm_mul_ps(_mm_loadu_ps(source + index), gains);
+        _mm_storeu_ps(destination + index, _mm_add_ps(_mm_loadu_ps(destination + index), scaled));
+    }
+    for (; index < count; ++index)
+    {
+        destination[index] += source[index] * gain;
+    }
+}
+
+/// @section AVX2 kernels.
+
+GP_TARGET("avx2,fma") void copyMemoryAVX2(void* destination, const void* source, USize size) noexcept
+{
+    if (size < kStreamingCopyThreshold)
+    {
+        std::memcpy(destination, source, size);
+        return;
+    }
+
+    UInt8* output = static_cast<UInt8*>(destination);
+    const UInt8* input = static_cast<const UInt8*>(source);
+    const USize head = (32 - (reinterpret_cast<UIntPtr>(output) & 31)) & 31;
+    std::memcpy(output, input, head);
+    output += head;
+    input += head;
+    size -= head;
+
+    for (; size >= 128; size -= 128, output += 128, input += 128)
+    {
+        const __m256i block0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+        const __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 32));
+        const __m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 64));
+        const __m256i block3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(output), block0);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(output + 32), block1);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(output + 64), block2);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(output + 96), block3);
+    }
+    _mm_sfence();
+    std::memcpy(output, input, size);
+}
+
+GP_TARGET("avx2,fma") USize findByteAVX2(const void* data, USize size, UInt8 value) noexcept
+{
+    const UInt8* bytes = static_cast<const UInt8*>(data);
+    const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+    USize index = 0;
+    for (; index + 32 <= size; index += 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + index));
+        const UInt32 mask = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+        if (mask != 0)
+        {
+            return index + static_cast<USize>(std::countr_zero(mask));
+        }
+    }
+    for (; index < size; ++index)
+    {
+        if (bytes[index] == value)
+        {
+            return index;
+        }
+    }
+    return size;
+}
+
+GP_TARGET("avx2,fma") Float32 dotProductAVX2(const Float32* a, const Float32* b, USize count) noexcept
+{
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    USize index = 0;
+    for (; index + 16 <= count; index += 16)
+    {
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + index), _mm256_loadu_ps(b + index), sum0);
+        sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + index + 8), _mm256_loadu_ps(b + index + 8), sum1);
+    }
+    const __m256 sum256 = _mm256_add_ps(sum0, sum1);
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(sum256), _mm256_extractf128_ps(sum256, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    Float32 result = _mm_cvtss_f32(sum);
+    for (; index < count; ++index)
+    {
+        result += a[index] * b[index];
+    }
+    return result;
+}
+
+GP_TARGET("avx2,fma") void mixAudioAVX2(Float32* destination, const Float32* source, Float32 gain, USize count) noexcept
+{
+    const __m256 gains = _mm256_set1_ps(gain);
+    USize index = 0;
+    for (; index + 8 <= count; index += 8)
+    {
+        const __m256 mixed = _mm256_loadu_ps(destination + index);
+        _mm256_storeu_ps(destination + index, _mm256_fmadd_ps(_mm256_loadu_ps(source + index), gains, mixed));
+    }
+    for (; index < count; ++index)
+    {
+        destination[index] += source[index] * gain;
+    }
+}
+
+}   // namespace
+
+namespace detail
+{
+
+const KernelTable kSSE42KernelTable = {
+    &copyMemorySSE42, &findByteSSE42, &crc32cSSE42, &dotProductSSE42, &mixAudioSSE42, ISALevel::SSE4_2,
+};
+
+// The CRC32 instruction has no wider form: the AVX2 table keeps the SSE4.2 checksum.
+const KernelTable kAVX2KernelTable = {
+    &copyMemoryAVX2, &findByteAVX2, &crc32cSSE42, &dotProductAVX2, &mixAudioAVX2, ISALevel::AVX2,
+};
+
+}   // namespace detail
+
+}   // namespace gp
+
+#endif
@@ -9,6 +9,14 @@
 namespace gp::platform::generic
 {
 
+namespace
+{
+
+/// @brief Alignment of the blocks returned by allocatePages(), the most common page size.
+constexpr UInt32 kGenericPageSize = 4096u;
+
+}   // namespace
+
 memory::Malloc* Memory::getDefaultAllocator()
 {
     static memory::Malloc* instance = nullptr;
@@ -20,6 +28,24 @@ memory::Malloc* Memory::getDefaultAllocator()
     return instance;
 }
 
+void* Memory::allocatePages(gp::USize numBytes)
+{
+    return getDefaultAllocator()->tryAllocate(numBytes, kGenericPageSize);
+}
+
+void Memory::freePages(void* pointer, gp::USize numBytes)
+{
+    (void)numBytes;
+    getDefaultAllocator()->deallocate(pointer);
+}
+
+bool Memory::guardPages(void* pointer, gp::USize numBytes)
+{
+    (void)pointer;
+    (void)numBytes;
+    return false;
+}
+
 memory::PlatformConstants Memory::getPlatformConstants()
 {
     static memory::PlatformConstants constants{};
@@ -0,0 +1,53 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "platforms/unix/UnixPlatformMemory.hpp"
+#include "maths/base/Convertions.hpp"
+#include "maths/base/Scalar.hpp"
+#include "memory/MemoryConstants.hpp"
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace gp::platform::unix
+{
+
+void* Memory::allocatePages(USize numBytes)
+{
+    void* pointer = ::mmap(nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return pointer != MAP_FAILED ? pointer : nullptr;
+}
+
+void Memory::freePages(void* pointer, USize numBytes)
+{
+    ::munmap(pointer, numBytes);
+}
+
+bool Memory::guardPages(void* pointer, USize numBytes)
+{
+    return ::mprotect(pointer, numBytes, PROT_NONE) == 0;
+}
+
+memory::PlatformConstants Memory::getPlatformConstants()
+{
+    static memory::PlatformConstants constants{};
+
+    if (constants.physicalMemoryBytes == 0ull) [[unlikely]]
+    {
+        const USize pageSize = static_cast<USize>(::sysconf(_SC_PAGESIZE));
+        const UInt64 pageCount = static_cast<UInt64>(::sysconf(_SC_PHYS_PAGES));
+
+        constants.physicalMemoryBytes = pageCount * pageSize;
+        constants.virtualMemoryBytes = constants.physicalMemoryBytes;
+        constants.binnedPageSize = pageSize;
+        constants.binnedAllocationGranularity = pageSize;
+        constants.standardAllocationGranularity = pageSize;
+        constants.standardPageSize = pageSize;
+        constants.addressSpaceStart = math::roundUpToPowerOfTwo<UInt64>(constants.physicalMemoryBytes);
+        constants.totalPhysicalMemoryGB = math::convert::bytesToGigabytes<UInt32>(constants.physicalMemoryBytes);
+    }
+
+    return constants;
+}
+
+}   // namespace gp::platform::unix
@@ -12,6 +12,23 @@
 namespace gp::platform::windows
 {
 
+void* Memory::allocatePages(USize numBytes)
+{
+    return ::VirtualAlloc(nullptr, numBytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+void Memory::freePages(void* pointer, USize numBytes)
+{
+    (void)numBytes;
+    ::VirtualFree(pointer, 0, MEM_RELEASE);
+}
+
+bool Memory::guardPages(void* pointer, USize numBytes)
+{
+    DWORD oldProtection = 0;
+    return ::VirtualProtect(pointer, numBytes, PAGE_NOACCESS, &oldProtection) != 0;
+}
+
 memory::PlatformConstants Memory::getPlatformConstants()
 {
     static memory::PlatformConstants constants{};
@@ -0,0 +1,53 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "threading/Futex.hpp"
+#include <climits>
+
+#if GP_PLATFORM_WINDOWS
+    #include <Windows.h>
+    #pragma comment(lib, "Synchronization.lib")
+#elif GP_PLATFORM_LINUX
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace gp
+{
+
+void Futex::wait(std::atomic<UInt32>& word, UInt32 expectedValue) noexcept
+{
+#if GP_PLATFORM_WINDOWS
+    ::WaitOnAddress(&word, &expectedValue, sizeof(UInt32), INFINITE);
+#elif GP_PLATFORM_LINUX
+    ::syscall(SYS_futex, &word, FUTEX_WAIT_PRIVATE, expectedValue, nullptr, nullptr, 0);
+#else
+    word.wait(expectedValue, std::memory_order_relaxed);
+#endif
+}
+
+void Futex::wakeOne(std::atomic<UInt32>& word) noexcept
+{
+#if GP_PLATFORM_WINDOWS
+    ::WakeByAddressSingle(&word);
+#elif GP_PLATFORM_LINUX
+    ::syscall(SYS_futex, &word, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+    word.notify_one();
+#endif
+}
+
+void Futex::wakeAll(std::atomic<UInt32>& word) noexcept
+{
+#if GP_PLATFORM_WINDOWS
+    ::WakeByAddressAll(&word);
+#elif GP_PLATFORM_LINUX
+    ::syscall(SYS_futex, &word, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+    word.notify_all();
+#endif
+}
+
+}   // namespace gp
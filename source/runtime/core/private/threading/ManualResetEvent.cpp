@@ -0,0 +1,49 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "threading/ManualResetEvent.hpp"
+#include "threading/Futex.hpp"
+
+namespace gp
+{
+
+void ManualResetEvent::set() noexcept
+{
+    UInt32 state = m_state.load(std::memory_order_relaxed);
+    do
+    {
+        if ((state & kSetFlag) != 0)
+        {
+            return;
+        }
+    }
+    while (!m_state.compare_exchange_weak(
+        state, ((state + kGenerationStep) & ~kWaitersFlag) | kSetFlag, std::memory_order_release,
+        std::memory_order_relaxed
+    ));
+
+    if ((state & kWaitersFlag) != 0)
+    {
+        Futex::wakeAll(m_state);
+    }
+}
+
+void ManualResetEvent::waitContended(UInt32 state) noexcept
+{
+    const UInt32 generation = state & ~(kSetFlag | kWaitersFlag);
+    while ((state & kSetFlag) == 0 && (state & ~(kSetFlag | kWaitersFlag)) == generation)
+    {
+        if ((state & kWaitersFlag) == 0 &&
+            !m_state.compare_exchange_weak(
+                state, state | kWaitersFlag, std::memory_order_acquire, std::memory_order_acquire
+            ))
+        {
+            continue;
+        }
+        Futex::wait(m_state, state | kWaitersFlag);
+        state = m_state.load(std::memory_order_acquire);
+    }
+}
+
+}   // namespace gp
@@ -0,0 +1,57 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "threading/Mutex.hpp"
+#include "maths/base/Scalar.hpp"
+#include "threading/Futex.hpp"
+
+namespace gp
+{
+
+void Mutex::lockContended() noexcept
+{
+    const UInt32 estimate = m_spinEstimate.load(std::memory_order_relaxed);
+    const UInt32 maxSpinCount = math::min(kMaxSpinCount, estimate * 2 + 10);
+    UInt32 spinCount = 0;
+    bool isAcquired = false;
+    for (; spinCount < maxSpinCount && !isAcquired; ++spinCount)
+    {
+        UInt32 state = m_state.load(std::memory_order_relaxed);
+        if (state == 0)
+        {
+            isAcquired =
+                m_state.compare_exchange_weak(state, 1, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+        else
+        {
+            GP_PLATFORM_CPU_PAUSE();
+        }
+    }
+
+    // Moves the estimate an eighth of the way towards this acquisition, an approximate but race-free average. A spin
+    // phase that failed counts as zero: it ran into the bound, and feeding that back would only raise the next one.
+    const UInt32 sample = isAcquired ? spinCount : 0;
+    const Int32 delta = static_cast<Int32>(sample) - static_cast<Int32>(estimate);
+    m_spinEstimate.store(static_cast<UInt32>(static_cast<Int32>(estimate) + delta / 8), std::memory_order_relaxed);
+    if (isAcquired)
+    {
+        return;
+    }
+
+    // Marks the mutex as contended before sleeping, so that the owner wakes a thread when releasing it. The thread
+    // may then hold a mutex marked contended with nobody asleep: this only costs a spurious wake.
+    UInt32 state = m_state.exchange(2, std::memory_order_acquire);
+    while (state != 0)
+    {
+        Futex::wait(m_state, 2);
+        state = m_state.exchange(2, std::memory_order_acquire);
+    }
+}
+
+void Mutex::wakeWaiter() noexcept
+{
+    Futex::wakeOne(m_state);
+}
+
+}   // namespace gp
@@ -0,0 +1,48 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "threading/Semaphore.hpp"
+#include "threading/Futex.hpp"
+
+namespace gp
+{
+
+void Semaphore::release(UInt32 count) noexcept
+{
+    // Sequentially consistent with the waiter registration: either the releaser sees the waiter, or the waiter sees
+    // the new units before going to sleep.
+    m_count.fetch_add(count, std::memory_order_seq_cst);
+    if (m_waiterCount.load(std::memory_order_seq_cst) != 0)
+    {
+        if (count == 1)
+        {
+            Futex::wakeOne(m_count);
+        }
+        else
+        {
+            Futex::wakeAll(m_count);
+        }
+    }
+}
+
+void Semaphore::acquireContended() noexcept
+{
+    for (UInt32 spinCount = 0; spinCount < kMaxSpinCount; ++spinCount)
+    {
+        GP_PLATFORM_CPU_PAUSE();
+        if (tryAcquire())
+        {
+            return;
+        }
+    }
+
+    m_waiterCount.fetch_add(1, std::memory_order_seq_cst);
+    while (!tryAcquire())
+    {
+        Futex::wait(m_count, 0);
+    }
+    m_waiterCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+}   // namespace gp
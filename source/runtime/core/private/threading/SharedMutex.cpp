@@ -0,0 +1,107 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "threading/SharedMutex.hpp"
+#include "threading/Futex.hpp"
+
+namespace gp
+{
+
+void SharedMutex::lock() noexcept
+{
+    m_writerMutex.lock();
+
+    // Raising the flag stops new readers, the writer then waits for the ones inside to leave.
+    UInt32 state = m_state.fetch_or(kWriterFlag, std::memory_order_acquire) | kWriterFlag;
+    for (UInt32 spinCount = 0; (state & kReaderMask) != 0 && spinCount < kMaxSpinCount; ++spinCount)
+    {
+        GP_PLATFORM_CPU_PAUSE();
+        state = m_state.load(std::memory_order_acquire);
+    }
+    while ((state & kReaderMask) != 0)
+    {
+        Futex::wait(m_state, state);
+        state = m_state.load(std::memory_order_acquire);
+    }
+}
+
+bool SharedMutex::try_lock() noexcept
+{
+    if (!m_writerMutex.try_lock())
+    {
+        return false;
+    }
+
+    UInt32 expected = 0;
+    if (m_state.compare_exchange_strong(expected, kWriterFlag, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        return true;
+    }
+    m_writerMutex.unlock();
+    return false;
+}
+
+void SharedMutex::unlock() noexcept
+{
+    const UInt32 state = m_state.exchange(0, std::memory_order_release);
+    m_writerMutex.unlock();
+    if ((state & kReadersWaitingFlag) != 0)
+    {
+        Futex::wakeAll(m_state);
+    }
+}
+
+bool SharedMutex::try_lock_shared() noexcept
+{
+    UInt32 state = m_state.load(std::memory_order_relaxed);
+    while ((state & kWriterFlag) == 0)
+    {
+        if (m_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SharedMutex::lockSharedContended() noexcept
+{
+    UInt32 spinCount = 0;
+    for (;;)
+    {
+        UInt32 state = m_state.load(std::memory_order_relaxed);
+        if ((state & kWriterFlag) == 0)
+        {
+            if (m_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return;
+            }
+            continue;
+        }
+
+        if (spinCount < kMaxSpinCount)
+        {
+            ++spinCount;
+            GP_PLATFORM_CPU_PAUSE();
+            continue;
+        }
+
+        // Tells the writer to wake the readers when it leaves, then sleeps unless the state changed meanwhile.
+        const UInt32 waitingState = state | kReadersWaitingFlag;
+        if (state != waitingState &&
+            !m_state.compare_exchange_weak(state, waitingState, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+            continue;
+        }
+        Futex::wait(m_state, waitingState);
+    }
+}
+
+void SharedMutex::wakeWriter() noexcept
+{
+    // Readers may sleep on the same word: waking them all guarantees the writer is among the threads woken.
+    Futex::wakeAll(m_state);
+}
+
+}   // namespace gp
@@ -48,3 +48,9 @@
 
 /// @brief Forces inlining of the function body AND all of its callees (GCC 4.6+).
 #define GP_FLATTEN __attribute__((flatten))
+
+/// @section Code generation.
+
+/// @brief Compiles a function for extra instruction sets, e.g. GP_TARGET("avx2,fma"), without raising the baseline
+///        of the whole translation unit. Such functions must only run once the CPU is known to support them.
+#define GP_TARGET(features) __attribute__((target(features)))
@@ -6,6 +6,7 @@
 
 #include "concepts/Concepts.hpp"
 #include "CoreMinimal.hpp"   // IWYU pragma: keep
+#include "memory/MemoryForward.hpp"
 
 namespace gp::container
 {
@@ -37,6 +38,8 @@ struct TypeTraits;
 
 template <typename T, USize N, USize Alignment = alignof(T)>
 class Array;
+template <typename Allocator = memory::DefaultAllocator>
+class BitArray;
 
 /// @section Vector related forward declarations
 
@@ -52,6 +55,32 @@ template <typename T, typename SizeType = Int32>
 using ConstVectorView = VectorView<const T, SizeType>;
 template <typename T>
 using ConstVectorView64 = VectorView<const T, Int64>;
+template <typename... Fields>
+class SoAVector;
+template <typename T, USize ChunkSize = 64, typename Allocator = memory::DefaultAllocator>
+class ChunkedArray;
+
+/// @section Queue related forward declarations
+
+template <typename T, USize Capacity>
+class SPSCQueue;
+template <typename T, USize Capacity>
+class MPMCQueue;
+template <typename T>
+class MPSCQueue;
+template <typename T, USize Capacity>
+class WorkStealingDeque;
+
+/// @section Pool related forward declarations
+
+template <typename StorageType>
+class SlotMapHandle;
+using SlotMapHandle32 = SlotMapHandle<UInt32>;
+using SlotMapHandle64 = SlotMapHandle<UInt64>;
+template <typename T, typename HandleType = SlotMapHandle32, typename Allocator = memory::DefaultAllocator>
+class SlotMap;
+template <typename T>
+using SlotMap64 = SlotMap<T, SlotMapHandle64>;
 
 /// @section Map related forward declarations
 
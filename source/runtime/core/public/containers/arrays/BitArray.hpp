@@ -0,0 +1,514 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include "containers/details/BitwiseOperations.hpp"
+#include "maths/base/Scalar.hpp"
+#include "memory/allocators/DefaultAllocator.hpp"
+#include "memory/Memory.hpp"
+#include <iterator>
+#include <utility>
+
+namespace gp
+{
+
+/// @brief Dynamically sized, densely packed array of bits.
+/// @details
+/// Bits are stored in 64-bit words, bit `i` living in word `i / 64` at position `i % 64`. The bits of the last word
+/// past size() are always kept cleared, so word-wise operations (population count, searches, bulk bitwise operators)
+/// never need to mask the tail. Bulk operators go through container::BitwiseOperations, which uses 128-bit SIMD
+/// when the architecture provides it.
+/// Set bits can be enumerated with setBits(), which skips empty words and walks each word with countTrailingZeros,
+/// so sparse masks are visited in time proportional to their number of set bits, not their size.
+/// @tparam Allocator Allocator type, providing static allocateArray / reallocateArray / deallocate functions.
+template <typename Allocator>
+class BitArray
+{
+public:
+    using WordType = UInt64;
+    using SizeType = gp::USize;
+
+public:
+    static constexpr SizeType kBitsPerWord = sizeof(WordType) * 8;
+    static constexpr SizeType npos = static_cast<SizeType>(-1);
+
+private:
+    static constexpr SizeType kWordShift = 6;
+    static constexpr SizeType kBitMask = kBitsPerWord - 1;
+
+public:
+    /// @brief Forward iterator over the indices of the set bits, in increasing order.
+    class SetBitIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SizeType;
+        using difference_type = ISize;
+        using pointer = const SizeType*;
+        using reference = SizeType;
+
+    private:
+        const WordType* m_words{ nullptr };
+        SizeType m_wordCount{ 0 };
+        SizeType m_wordIndex{ 0 };
+        WordType m_remaining{ 0 };   //<! Bits of the current word not visited yet.
+
+    public:
+        SetBitIterator() noexcept = default;
+
+        SetBitIterator(const WordType* words, SizeType wordCount, SizeType wordIndex) noexcept
+            : m_words(words)
+            , m_wordCount(wordCount)
+            , m_wordIndex(wordIndex)
+            , m_remaining(wordIndex < wordCount ? words[wordIndex] : 0)
+        {
+            skipEmptyWords();
+        }
+
+    public:
+        [[nodiscard]] SizeType operator*() const noexcept
+        {
+            return (m_wordIndex << kWordShift) + math::countTrailingZeros(m_remaining);
+        }
+
+        SetBitIterator& operator++() noexcept
+        {
+            // Clears the lowest set bit.
+            m_remaining &= m_remaining - 1;
+            skipEmptyWords();
+            return *this;
+        }
+
+        SetBitIterator operator++(int) noexcept
+        {
+            SetBitIterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] bool operator==(const SetBitIterator& other) const noexcept
+        {
+            return m_wordIndex == other.m_wordIndex && m_remaining == other.m_remaining;
+        }
+
+    private:
+        void skipEmptyWords() noexcept
+        {
+            while (m_remaining == 0 && ++m_wordIndex < m_wordCount)
+            {
+                m_remaining = m_words[m_wordIndex];
+            }
+            if (m_wordIndex > m_wordCount)
+            {
+                m_wordIndex = m_wordCount;
+            }
+        }
+    };
+
+    /// @brief Range over the indices of the set bits, see setBits().
+    class SetBitRange
+    {
+    private:
+        const WordType* m_words;
+        SizeType m_wordCount;
+
+    public:
+        SetBitRange(const WordType* words, SizeType wordCount) noexcept
+            : m_words(words)
+            , m_wordCount(wordCount)
+        {}
+
+        [[nodiscard]] SetBitIterator begin() const noexcept
+        {
+            return SetBitIterator(m_words, m_wordCount, 0);
+        }
+
+        [[nodiscard]] SetBitIterator end() const noexcept
+        {
+            return SetBitIterator(m_words, m_wordCount, m_wordCount);
+        }
+    };
+
+private:
+    WordType* m_words{ nullptr };
+    SizeType m_size{ 0 };
+    SizeType m_wordCapacity{ 0 };
+
+public:
+    /// @brief Constructs an empty bit array.
+    BitArray() noexcept = default;
+
+    /// @brief Constructs a bit array of @p size bits, all set to @p value.
+    /// @param[in] size Number of bits.
+    /// @param[in] value Initial value of every bit.
+    explicit BitArray(SizeType size, bool value = false)
+    {
+        resize(size, value);
+    }
+
+    /// @brief Copies another bit array.
+    BitArray(const BitArray& other)
+    {
+        reserve(other.m_size);
+        m_size = other.m_size;
+        memory::copyMemory(m_words, other.m_words, wordCount() * sizeof(WordType));
+    }
+
+    /// @brief Steals the storage of another bit array, which is left empty.
+    BitArray(BitArray&& other) noexcept
+        : m_words(std::exchange(other.m_words, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+        , m_wordCapacity(std::exchange(other.m_wordCapacity, 0))
+    {}
+
+    /// @brief Releases the storage.
+    ~BitArray()
+    {
+        Allocator::deallocate(m_words);
+    }
+
+    BitArray& operator=(const BitArray& other)
+    {
+        if (this != &other)
+        {
+            reserve(other.m_size);
+            m_size = other.m_size;
+            memory::copyMemory(m_words, other.m_words, wordCount() * sizeof(WordType));
+        }
+        return *this;
+    }
+
+    BitArray& operator=(BitArray&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Allocator::deallocate(m_words);
+            m_words = std::exchange(other.m_words, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_wordCapacity = std::exchange(other.m_wordCapacity, 0);
+        }
+        return *this;
+    }
+
+public:
+    /// @brief Returns the value of a bit.
+    /// @param[in] index Index of the bit, in [0, size()).
+    /// @return True if the bit is set, false otherwise.
+    [[nodiscard]] bool test(SizeType index) const noexcept
+    {
+        GP_ASSERT(index < m_size, "BitArray index out of bounds");
+        return (m_words[index >> kWordShift] >> (index & kBitMask)) & 1u;
+    }
+
+    /// @brief Returns the value of a bit.
+    /// @param[in] index Index of the bit, in [0, size()).
+    /// @return True if the bit is set, false otherwise.
+    [[nodiscard]] bool operator[](SizeType index) const noexcept
+    {
+        return test(index);
+    }
+
+    /// @brief Sets a bit to one.
+    /// @param[in] index Index of the bit, in [0, size()).
+    void set(SizeType index) noexcept
+    {
+        GP_ASSERT(index < m_size, "BitArray index out of bounds");
+        m_words[index >> kWordShift] |= WordType{ 1 } << (index & kBitMask);
+    }
+
+    /// @brief Clears a bit to zero.
+    /// @param[in] index Index of the bit, in [0, size()).
+    void reset(SizeType index) noexcept
+    {
+        GP_ASSERT(index < m_size, "BitArray index out of bounds");
+        m_words[index >> kWordShift] &= ~(WordType{ 1 } << (index & kBitMask));
+    }
+
+    /// @brief Toggles a bit.
+    /// @param[in] index Index of the bit, in [0, size()).
+    void flip(SizeType index) noexcept
+    {
+        GP_ASSERT(index < m_size, "BitArray index out of bounds");
+        m_words[index >> kWordShift] ^= WordType{ 1 } << (index & kBitMask);
+    }
+
+    /// @brief Sets a bit to a given value.
+    /// @param[in] index Index of the bit, in [0, size()).
+    /// @param[in] value New value of the bit.
+    void assign(SizeType index, bool value) noexcept
+    {
+        GP_ASSERT(index < m_size, "BitArray index out of bounds");
+        const WordType mask = WordType{ 1 } << (index & kBitMask);
+        WordType& word = m_words[index >> kWordShift];
+        word = (word & ~mask) | ((WordType{ 0 } - static_cast<WordType>(value)) & mask);
+    }
+
+    /// @brief Sets every bit to one.
+    void setAll() noexcept
+    {
+        memory::setMemory(m_words, 0xff, wordCount() * sizeof(WordType));
+        clearTail();
+    }
+
+    /// @brief Clears every bit to zero.
+    void resetAll() noexcept
+    {
+        memory::zeroMemory(m_words, wordCount() * sizeof(WordType));
+    }
+
+    /// @brief Toggles every bit.
+    void flipAll() noexcept
+    {
+        for (SizeType i = 0; i < wordCount(); ++i)
+        {
+            m_words[i] = ~m_words[i];
+        }
+        clearTail();
+    }
+
+public:
+    /// @brief Intersects this array with another one of the same size.
+    BitArray& operator&=(const BitArray& other) noexcept
+    {
+        GP_ASSERT(m_size == other.m_size, "BitArray sizes must match");
+        container::BitwiseOperations::andWords(m_words, other.m_words, wordCount());
+        return *this;
+    }
+
+    /// @brief Unites this array with another one of the same size.
+    BitArray& operator|=(const BitArray& other) noexcept
+    {
+        GP_ASSERT(m_size == other.m_size, "BitArray sizes must match");
+        container::BitwiseOperations::orWords(m_words, other.m_words, wordCount());
+        return *this;
+    }
+
+    /// @brief Computes the symmetric difference of this array and another one of the same size.
+    BitArray& operator^=(const BitArray& other) noexcept
+    {
+        GP_ASSERT(m_size == other.m_size, "BitArray sizes must match");
+        container::BitwiseOperations::xorWords(m_words, other.m_words, wordCount());
+        return *this;
+    }
+
+    /// @brief Clears every bit that is set in another array of the same size.
+    /// @return Reference to this array.
+    BitArray& andNot(const BitArray& other) noexcept
+    {
+        GP_ASSERT(m_size == other.m_size, "BitArray sizes must match");
+        container::BitwiseOperations::andNotWords(m_words, other.m_words, wordCount());
+        return *this;
+    }
+
+    [[nodiscard]] friend BitArray operator&(BitArray lhs, const BitArray& rhs)
+    {
+        return lhs &= rhs;
+    }
+
+    [[nodiscard]] friend BitArray operator|(BitArray lhs, const BitArray& rhs)
+    {
+        return lhs |= rhs;
+    }
+
+    [[nodiscard]] friend BitArray operator^(BitArray lhs, const BitArray& rhs)
+    {
+        return lhs ^= rhs;
+    }
+
+    [[nodiscard]] bool operator==(const BitArray& other) const noexcept
+    {
+        return m_size == other.m_size &&
+               memory::compareMemory(m_words, other.m_words, wordCount() * sizeof(WordType)) == 0;
+    }
+
+public:
+    /// @brief Counts the set bits.
+    [[nodiscard]] SizeType popCount() const noexcept
+    {
+        return container::BitwiseOperations::popCountWords(m_words, wordCount());
+    }
+
+    /// @brief Checks whether at least one bit is set.
+    [[nodiscard]] bool any() const noexcept
+    {
+        return findFirstSet() != npos;
+    }
+
+    /// @brief Checks whether no bit is set.
+    [[nodiscard]] bool none() const noexcept
+    {
+        return !any();
+    }
+
+    /// @brief Checks whether every bit is set. True for an empty array.
+    [[nodiscard]] bool all() const noexcept
+    {
+        return findFirstUnset() == npos;
+    }
+
+    /// @brief Finds the first set bit at or after @p start.
+    /// @param[in] start Index to start searching from.
+    /// @return Index of the first set bit, or npos if there is none.
+    [[nodiscard]] SizeType findFirstSet(SizeType start = 0) const noexcept
+    {
+        if (start >= m_size)
+        {
+            return npos;
+        }
+
+        SizeType wordIndex = start >> kWordShift;
+        WordType word = m_words[wordIndex] & (~WordType{ 0 } << (start & kBitMask));
+        const SizeType count = wordCount();
+        while (word == 0)
+        {
+            if (++wordIndex == count)
+            {
+                return npos;
+            }
+            word = m_words[wordIndex];
+        }
+        return (wordIndex << kWordShift) + math::countTrailingZeros(word);
+    }
+
+    /// @brief Finds the first cleared bit at or after @p start.
+    /// @param[in] start Index to start searching from.
+    /// @return Index of the first cleared bit, or npos if there is none.
+    [[nodiscard]] SizeType findFirstUnset(SizeType start = 0) const noexcept
+    {
+        if (start >= m_size)
+        {
+            return npos;
+        }
+
+        SizeType wordIndex = start >> kWordShift;
+        WordType word = ~m_words[wordIndex] & (~WordType{ 0 } << (start & kBitMask));
+        const SizeType count = wordCount();
+        while (word == 0)
+        {
+            if (++wordIndex == count)
+            {
+                return npos;
+            }
+            word = ~m_words[wordIndex];
+        }
+
+        // The cleared tail of the last word reads as unset bits, filter them out.
+        const SizeType index = (wordIndex << kWordShift) + math::countTrailingZeros(word);
+        return index < m_size ? index : npos;
+    }
+
+    /// @brief Returns a range over the indices of the set bits, in increasing order.
+    /// @note The range is invalidated by any resize of the array.
+    [[nodiscard]] SetBitRange setBits() const noexcept
+    {
+        return SetBitRange(m_words, wordCount());
+    }
+
+    /// @brief Calls @p func with the index of every set bit, in increasing order.
+    /// @tparam Func Callable invocable with a SizeType.
+    /// @param[in] func Callable to invoke.
+    template <typename Func>
+    requires concepts::IsInvocable<Func, SizeType>
+    void forEachSetBit(Func&& func) const
+    {
+        const SizeType count = wordCount();
+        for (SizeType wordIndex = 0; wordIndex < count; ++wordIndex)
+        {
+            WordType word = m_words[wordIndex];
+            while (word != 0)
+            {
+                func((wordIndex << kWordShift) + math::countTrailingZeros(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+public:
+    /// @brief Resizes the array, new bits are set to @p value.
+    /// @param[in] size New number of bits.
+    /// @param[in] value Value of the bits added past the previous size.
+    void resize(SizeType size, bool value = false)
+    {
+        reserve(size);
+        const SizeType oldSize = m_size;
+        const SizeType oldWordCount = wordCount();
+        m_size = size;
+
+        if (size > oldSize)
+        {
+            const SizeType newWordCount = wordCount();
+            if (value)
+            {
+                if ((oldSize & kBitMask) != 0)
+                {
+                    m_words[oldWordCount - 1] |= ~WordType{ 0 } << (oldSize & kBitMask);
+                }
+                memory::setMemory(m_words + oldWordCount, 0xff, (newWordCount - oldWordCount) * sizeof(WordType));
+            }
+            else
+            {
+                memory::zeroMemory(m_words + oldWordCount, (newWordCount - oldWordCount) * sizeof(WordType));
+            }
+        }
+        clearTail();
+    }
+
+    /// @brief Preallocates storage for at least @p size bits.
+    /// @param[in] size Number of bits to make room for.
+    void reserve(SizeType size)
+    {
+        const SizeType words = (size + kBitMask) >> kWordShift;
+        if (words > m_wordCapacity)
+        {
+            const SizeType newCapacity = math::max(words, m_wordCapacity * 2);
+            m_words = Allocator::template reallocateArray<WordType>(m_words, newCapacity);
+            m_wordCapacity = newCapacity;
+        }
+    }
+
+    /// @brief Removes every bit. The storage is kept.
+    void clear() noexcept
+    {
+        m_size = 0;
+    }
+
+    /// @brief Returns the number of bits.
+    [[nodiscard]] SizeType size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @brief Checks whether the array holds no bit.
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /// @brief Returns the number of words in use.
+    [[nodiscard]] SizeType wordCount() const noexcept
+    {
+        return (m_size + kBitMask) >> kWordShift;
+    }
+
+    /// @brief Returns the underlying words. The bits past size() in the last word are always zero.
+    [[nodiscard]] const WordType* data() const noexcept
+    {
+        return m_words;
+    }
+
+private:
+    void clearTail() noexcept
+    {
+        if ((m_size & kBitMask) != 0)
+        {
+            m_words[wordCount() - 1] &= ~(~WordType{ 0 } << (m_size & kBitMask));
+        }
+    }
+};
+
+}   // namespace gp
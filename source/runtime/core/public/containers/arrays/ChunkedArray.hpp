@@ -0,0 +1,455 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include "containers/views/VectorView.hpp"
+#include "maths/base/Scalar.hpp"
+#include "memory/allocators/DefaultAllocator.hpp"
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace gp
+{
+
+/// @brief Growable array made of fixed-size chunks, whose elements never move.
+/// @details
+/// Elements are stored in chunks of ChunkSize elements, each chunk being a separate allocation. A small table of chunk
+/// pointers maps an index to its chunk with a shift and to its position in the chunk with a mask, so indexed access
+/// stays O(1). Growing the array allocates one new chunk and, rarely, grows the pointer table: elements are never
+/// copied nor moved, so pointers and references to them stay valid until they are removed.
+/// Each chunk is contiguous, which makes it a natural unit of work for parallel iteration: forEachChunk() and chunk()
+/// hand out VectorViews that can be dispatched to different workers.
+/// @tparam T Element type.
+/// @tparam ChunkSize Number of elements per chunk, must be a power of two.
+/// @tparam Allocator Allocator type, providing static allocateArray / reallocateArray / deallocate functions.
+template <typename T, USize ChunkSize, typename Allocator>
+class ChunkedArray
+{
+    static_assert(math::isPowerOfTwo(ChunkSize), "ChunkedArray chunk size must be a power of two");
+    static_assert(ChunkSize <= static_cast<USize>(1) << 30, "ChunkedArray chunk size must fit in a VectorView");
+
+public:
+    using ValueType = T;
+    using SizeType = gp::USize;
+    using Reference = T&;
+    using ConstReference = const T&;
+    using ChunkView = VectorView<T>;
+    using ConstChunkView = VectorView<const T>;
+
+public:
+    static constexpr SizeType kChunkSize = ChunkSize;
+
+private:
+    static constexpr SizeType kChunkShift = math::floorLog2(ChunkSize);
+    static constexpr SizeType kChunkMask = ChunkSize - 1;
+    static constexpr SizeType kMinChunkTableCapacity = 4;
+
+public:
+    /// @brief Random access iterator over the elements, in index order.
+    /// @tparam IsConst Whether the iterator yields const references.
+    template <bool IsConst>
+    class BasicIterator
+    {
+        using Owner = std::conditional_t<IsConst, const ChunkedArray, ChunkedArray>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ISize;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+    private:
+        Owner* m_owner{ nullptr };
+        SizeType m_index{ 0 };
+
+    public:
+        BasicIterator() noexcept = default;
+
+        BasicIterator(Owner* owner, SizeType index) noexcept
+            : m_owner(owner)
+            , m_index(index)
+        {}
+
+    public:
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            return (*m_owner)[m_index];
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept
+        {
+            return &(*m_owner)[m_index];
+        }
+
+        [[nodiscard]] reference operator[](difference_type offset) const noexcept
+        {
+            return (*m_owner)[static_cast<SizeType>(static_cast<difference_type>(m_index) + offset)];
+        }
+
+        BasicIterator& operator++() noexcept
+        {
+            ++m_index;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept
+        {
+            BasicIterator copy = *this;
+            ++m_index;
+            return copy;
+        }
+
+        BasicIterator& operator--() noexcept
+        {
+            --m_index;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept
+        {
+            BasicIterator copy = *this;
+            --m_index;
+            return copy;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept
+        {
+            m_index = static_cast<SizeType>(static_cast<difference_type>(m_index) + offset);
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept
+        {
+            m_index = static_cast<SizeType>(static_cast<difference_type>(m_index) - offset);
+            return *this;
+        }
+
+        [[nodiscard]] friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]] friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]] friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept
+        {
+            return it -= offset;
+        }
+
+        [[nodiscard]] friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.m_index) - static_cast<difference_type>(rhs.m_index);
+        }
+
+        [[nodiscard]] bool operator==(const BasicIterator& other) const noexcept
+        {
+            return m_index == other.m_index;
+        }
+
+        [[nodiscard]] auto operator<=>(const BasicIterator& other) const noexcept
+        {
+            return m_index <=> other.m_index;
+        }
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+private:
+    T** m_chunks{ nullptr };
+    SizeType m_chunkCount{ 0 };           //<! Number of allocated chunks, used or not.
+    SizeType m_chunkTableCapacity{ 0 };   //<! Number of entries of m_chunks.
+    SizeType m_size{ 0 };
+
+public:
+    /// @brief Constructs an empty array. No memory is allocated until the first insertion.
+    ChunkedArray() noexcept = default;
+
+    /// @brief Copies another array, element by element.
+    ChunkedArray(const ChunkedArray& other)
+    {
+        reserve(other.m_size);
+        for (SizeType i = 0; i < other.m_size; ++i)
+        {
+            ::new (static_cast<void*>(slot(i))) T(other[i]);
+        }
+        m_size = other.m_size;
+    }
+
+    /// @brief Steals the chunks of another array, which is left empty. Element addresses are preserved.
+    ChunkedArray(ChunkedArray&& other) noexcept
+        : m_chunks(std::exchange(other.m_chunks, nullptr))
+        , m_chunkCount(std::exchange(other.m_chunkCount, 0))
+        , m_chunkTableCapacity(std::exchange(other.m_chunkTableCapacity, 0))
+        , m_size(std::exchange(other.m_size, 0))
+    {}
+
+    /// @brief Destroys every element and releases every chunk.
+    ~ChunkedArray()
+    {
+        clear();
+        releaseChunks();
+    }
+
+    ChunkedArray& operator=(const ChunkedArray& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.m_size);
+            for (SizeType i = 0; i < other.m_size; ++i)
+            {
+                ::new (static_cast<void*>(slot(i))) T(other[i]);
+            }
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+
+    ChunkedArray& operator=(ChunkedArray&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            releaseChunks();
+            m_chunks = std::exchange(other.m_chunks, nullptr);
+            m_chunkCount = std::exchange(other.m_chunkCount, 0);
+            m_chunkTableCapacity = std::exchange(other.m_chunkTableCapacity, 0);
+            m_size = std::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+public:
+    /// @brief Constructs an element in place at the end of the array.
+    /// @param[in] args Arguments forwarded to T's constructor.
+    /// @return A reference to the new element, stable until the element is removed.
+    template <typename... Args>
+    Reference emplaceBack(Args&&... args)
+    {
+        if (m_size == capacity())
+        {
+            addChunk();
+        }
+        T* const element = ::new (static_cast<void*>(slot(m_size))) T(std::forward<Args>(args)...);
+        ++m_size;
+        return *element;
+    }
+
+    /// @brief Copies an element at the end of the array.
+    /// @param[in] value Element to append.
+    /// @return A reference to the new element, stable until the element is removed.
+    Reference pushBack(const T& value)
+    {
+        return emplaceBack(value);
+    }
+
+    /// @brief Moves an element at the end of the array.
+    /// @param[in] value Element to append.
+    /// @return A reference to the new element, stable until the element is removed.
+    Reference pushBack(T&& value)
+    {
+        return emplaceBack(std::move(value));
+    }
+
+    /// @brief Destroys the last element.
+    void popBack() noexcept
+    {
+        GP_ASSERT(m_size > 0, "ChunkedArray is empty");
+        --m_size;
+        std::destroy_at(slot(m_size));
+    }
+
+    /// @brief Destroys every element. The chunks are kept for reuse.
+    void clear() noexcept
+    {
+        if constexpr (!concepts::IsTriviallyDestructible<T>)
+        {
+            for (SizeType i = 0; i < m_size; ++i)
+            {
+                std::destroy_at(slot(i));
+            }
+        }
+        m_size = 0;
+    }
+
+    /// @brief Allocates chunks so that @p capacity elements fit without further allocation.
+    /// @param[in] capacity Number of elements to make room for.
+    void reserve(SizeType capacity)
+    {
+        while (this->capacity() < capacity)
+        {
+            addChunk();
+        }
+    }
+
+    /// @brief Releases the chunks that hold no element.
+    void shrinkToFit() noexcept
+    {
+        const SizeType usedChunks = (m_size + kChunkMask) >> kChunkShift;
+        while (m_chunkCount > usedChunks)
+        {
+            Allocator::deallocate(m_chunks[--m_chunkCount]);
+        }
+    }
+
+public:
+    /// @brief Accesses the element at the specified index.
+    /// @param[in] index Index of the element, in [0, size()).
+    /// @return A reference to the element.
+    [[nodiscard]] Reference operator[](SizeType index) noexcept
+    {
+        GP_ASSERT(index < m_size, "ChunkedArray index out of bounds");
+        return *slot(index);
+    }
+
+    /// @brief Accesses the element at the specified index.
+    /// @param[in] index Index of the element, in [0, size()).
+    /// @return A const reference to the element.
+    [[nodiscard]] ConstReference operator[](SizeType index) const noexcept
+    {
+        GP_ASSERT(index < m_size, "ChunkedArray index out of bounds");
+        return *slot(index);
+    }
+
+    /// @brief Returns a reference to the first element.
+    [[nodiscard]] Reference front() noexcept
+    {
+        return (*this)[0];
+    }
+
+    /// @brief Returns a reference to the last element.
+    [[nodiscard]] Reference back() noexcept
+    {
+        return (*this)[m_size - 1];
+    }
+
+public:
+    /// @brief Returns the number of chunks holding at least one element.
+    [[nodiscard]] SizeType chunkCount() const noexcept
+    {
+        return (m_size + kChunkMask) >> kChunkShift;
+    }
+
+    /// @brief Returns a view over the elements of a chunk.
+    /// @param[in] chunkIndex Index of the chunk, in [0, chunkCount()).
+    /// @return A view over the chunk elements. Every chunk but the last one is full.
+    [[nodiscard]] ChunkView chunk(SizeType chunkIndex) noexcept
+    {
+        GP_ASSERT(chunkIndex < chunkCount(), "ChunkedArray chunk index out of bounds");
+        const auto length = static_cast<typename ChunkView::SizeType>(chunkLength(chunkIndex));
+        return ChunkView(m_chunks[chunkIndex], length);
+    }
+
+    /// @brief Returns a read-only view over the elements of a chunk.
+    /// @param[in] chunkIndex Index of the chunk, in [0, chunkCount()).
+    /// @return A view over the chunk elements. Every chunk but the last one is full.
+    [[nodiscard]] ConstChunkView chunk(SizeType chunkIndex) const noexcept
+    {
+        GP_ASSERT(chunkIndex < chunkCount(), "ChunkedArray chunk index out of bounds");
+        const auto length = static_cast<typename ConstChunkView::SizeType>(chunkLength(chunkIndex));
+        return ConstChunkView(m_chunks[chunkIndex], length);
+    }
+
+    /// @brief Calls @p func once per non-empty chunk, in order.
+    /// @details The chunks are independent, so the calls can be distributed to several threads by indexing chunk()
+    ///          directly; this function is the sequential version.
+    /// @tparam Func Callable invocable with a ChunkView and the index of the first element of the chunk.
+    /// @param[in] func Callable to invoke.
+    template <typename Func>
+    requires concepts::IsInvocable<Func, ChunkView, SizeType>
+    void forEachChunk(Func&& func)
+    {
+        const SizeType count = chunkCount();
+        for (SizeType i = 0; i < count; ++i)
+        {
+            func(chunk(i), i << kChunkShift);
+        }
+    }
+
+public:
+    /// @brief Returns the number of elements.
+    [[nodiscard]] SizeType size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @brief Returns the number of elements the allocated chunks can hold.
+    [[nodiscard]] SizeType capacity() const noexcept
+    {
+        return m_chunkCount << kChunkShift;
+    }
+
+    /// @brief Checks whether the array holds no element.
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    [[nodiscard]] Iterator begin() noexcept
+    {
+        return Iterator(this, 0);
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept
+    {
+        return ConstIterator(this, 0);
+    }
+
+    [[nodiscard]] Iterator end() noexcept
+    {
+        return Iterator(this, m_size);
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept
+    {
+        return ConstIterator(this, m_size);
+    }
+
+private:
+    [[nodiscard]] T* slot(SizeType index) const noexcept
+    {
+        return m_chunks[index >> kChunkShift] + (index & kChunkMask);
+    }
+
+    [[nodiscard]] SizeType chunkLength(SizeType chunkIndex) const noexcept
+    {
+        return math::min(m_size - (chunkIndex << kChunkShift), ChunkSize);
+    }
+
+    void addChunk()
+    {
+        if (m_chunkCount == m_chunkTableCapacity)
+        {
+            const SizeType newCapacity = math::max(m_chunkTableCapacity * 2, kMinChunkTableCapacity);
+            m_chunks = Allocator::template reallocateArray<T*>(m_chunks, newCapacity);
+            m_chunkTableCapacity = newCapacity;
+        }
+        m_chunks[m_chunkCount++] = Allocator::template allocateArray<T>(ChunkSize);
+    }
+
+    void releaseChunks() noexcept
+    {
+        for (SizeType i = 0; i < m_chunkCount; ++i)
+        {
+            Allocator::deallocate(m_chunks[i]);
+        }
+        Allocator::deallocate(m_chunks);
+        m_chunks = nullptr;
+        m_chunkCount = 0;
+        m_chunkTableCapacity = 0;
+    }
+};
+
+}   // namespace gp
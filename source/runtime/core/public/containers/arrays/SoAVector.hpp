@@ -0,0 +1,544 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include "containers/views/VectorView.hpp"
+#include "maths/base/Scalar.hpp"
+#include "memory/allocators/DefaultAllocator.hpp"
+#include "memory/Memory.hpp"
+#include "memory/MemoryBase.hpp"
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <utility>
+
+namespace gp
+{
+
+/// @brief Growable structure-of-arrays container.
+/// @details
+/// Each field is stored in its own contiguous array, so kernels that only touch one or two fields stream over dense
+/// memory instead of striding over whole structures. All the arrays share one size and one capacity, and live in a
+/// single allocation: the arrays are laid out back to back, each one starting on a cache line boundary, which also
+/// satisfies the alignment requirements of every SIMD register width the maths library uses.
+///
+/// Fields are addressed by index, as several of them usually share a type (e.g. the x, y and z coordinates of a
+/// position). field<I>() returns a VectorView over one array, and iterating the container itself zips the fields
+/// together, yielding a `std::tuple` of references that can be unpacked with structured bindings:
+/// @code
+/// SoAVector<Float32, Float32, Float32> positions;
+/// for (auto [x, y, z] : positions) { ... }
+/// @endcode
+/// @tparam Fields Types of the fields, each must be move-constructible.
+template <typename... Fields>
+class SoAVector
+{
+    static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+    static_assert((concepts::IsMoveConstructible<Fields> && ...), "SoAVector fields must be move-constructible");
+
+public:
+    using SizeType = Int32;
+    using Allocator = memory::DefaultAllocator;
+
+    template <USize I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    using Reference = std::tuple<Fields&...>;
+    using ConstReference = std::tuple<const Fields&...>;
+
+public:
+    static constexpr USize kFieldCount = sizeof...(Fields);
+
+    /// @brief Alignment of the start of every field array.
+    static constexpr USize kArrayAlignment = std::max({ USize{ GP_PLATFORM_CACHE_LINE_SIZE }, alignof(Fields)... });
+
+private:
+    static constexpr SizeType kMinCapacity = 16;
+    static constexpr auto kIndices = std::index_sequence_for<Fields...>{};
+
+public:
+    /// @brief Random access iterator zipping every field together.
+    /// @tparam IsConst Whether the iterator yields const references.
+    template <bool IsConst>
+    class ZipIterator
+    {
+        using Owner = std::conditional_t<IsConst, const SoAVector, SoAVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<Fields...>;
+        using difference_type = ISize;
+        using reference = std::conditional_t<IsConst, ConstReference, Reference>;
+
+    private:
+        Owner* m_owner{ nullptr };
+        SizeType m_index{ 0 };
+
+    public:
+        ZipIterator() noexcept = default;
+
+        ZipIterator(Owner* owner, SizeType index) noexcept
+            : m_owner(owner)
+            , m_index(index)
+        {}
+
+    public:
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            return (*m_owner)[m_index];
+        }
+
+        [[nodiscard]] reference operator[](difference_type offset) const noexcept
+        {
+            return (*m_owner)[static_cast<SizeType>(m_index + offset)];
+        }
+
+        ZipIterator& operator++() noexcept
+        {
+            ++m_index;
+            return *this;
+        }
+
+        ZipIterator operator++(int) noexcept
+        {
+            ZipIterator copy = *this;
+            ++m_index;
+            return copy;
+        }
+
+        ZipIterator& operator--() noexcept
+        {
+            --m_index;
+            return *this;
+        }
+
+        ZipIterator operator--(int) noexcept
+        {
+            ZipIterator copy = *this;
+            --m_index;
+            return copy;
+        }
+
+        ZipIterator& operator+=(difference_type offset) noexcept
+        {
+            m_index = static_cast<SizeType>(m_index + offset);
+            return *this;
+        }
+
+        ZipIterator& operator-=(difference_type offset) noexcept
+        {
+            m_index = static_cast<SizeType>(m_index - offset);
+            return *this;
+        }
+
+        [[nodiscard]] friend ZipIterator operator+(ZipIterator it, difference_type offset) noexcept
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]] friend ZipIterator operator+(difference_type offset, ZipIterator it) noexcept
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]] friend ZipIterator operator-(ZipIterator it, difference_type offset) noexcept
+        {
+            return it -= offset;
+        }
+
+        [[nodiscard]] friend difference_type operator-(const ZipIterator& lhs, const ZipIterator& rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.m_index) - static_cast<difference_type>(rhs.m_index);
+        }
+
+        [[nodiscard]] bool operator==(const ZipIterator& other) const noexcept
+        {
+            return m_index == other.m_index;
+        }
+
+        [[nodiscard]] auto operator<=>(const ZipIterator& other) const noexcept
+        {
+            return m_index <=> other.m_index;
+        }
+    };
+
+    using Iterator = ZipIterator<false>;
+    using ConstIterator = ZipIterator<true>;
+
+private:
+    void* m_buffer{ nullptr };
+    std::tuple<Fields*...> m_arrays{};
+    SizeType m_size{ 0 };
+    SizeType m_capacity{ 0 };
+
+public:
+    /// @brief Constructs an empty container.
+    SoAVector() noexcept = default;
+
+    /// @brief Copies another container, field by field.
+    SoAVector(const SoAVector& other)
+    {
+        reserve(other.m_size);
+        copyConstructFrom(other, kIndices);
+        m_size = other.m_size;
+    }
+
+    /// @brief Steals the storage of another container, which is left empty.
+    SoAVector(SoAVector&& other) noexcept
+        : m_buffer(std::exchange(other.m_buffer, nullptr))
+        , m_arrays(std::exchange(other.m_arrays, std::tuple<Fields*...>{}))
+        , m_size(std::exchange(other.m_size, 0))
+        , m_capacity(std::exchange(other.m_capacity, 0))
+    {}
+
+    /// @brief Destroys every element and releases the storage.
+    ~SoAVector()
+    {
+        destroyRange(0, m_size, kIndices);
+        Allocator::deallocate(m_buffer);
+    }
+
+    SoAVector& operator=(const SoAVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.m_size);
+            copyConstructFrom(other, kIndices);
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+
+    SoAVector& operator=(SoAVector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            destroyRange(0, m_size, kIndices);
+            Allocator::deallocate(m_buffer);
+            m_buffer = std::exchange(other.m_buffer, nullptr);
+            m_arrays = std::exchange(other.m_arrays, std::tuple<Fields*...>{});
+            m_size = std::exchange(other.m_size, 0);
+            m_capacity = std::exchange(other.m_capacity, 0);
+        }
+        return *this;
+    }
+
+public:
+    /// @brief Appends an element, one value per field.
+    /// @param[in] values Values of the fields, forwarded to their constructors.
+    /// @return The index of the new element.
+    template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Fields) && (concepts::IsConstructibleWith<Fields, Args> && ...))
+    SizeType pushBack(Args&&... values)
+    {
+        if (m_size == m_capacity)
+        {
+            grow(m_size + 1, std::forward<Args>(values)...);
+        }
+        else
+        {
+            constructAt(m_size, kIndices, std::forward<Args>(values)...);
+        }
+        return m_size++;
+    }
+
+    /// @brief Removes the last element.
+    void popBack() noexcept
+    {
+        GP_ASSERT(m_size > 0, "SoAVector is empty");
+        --m_size;
+        destroyRange(m_size, m_size + 1, kIndices);
+    }
+
+    /// @brief Removes the element at @p index by moving the last element into its place. O(1), does not keep order.
+    /// @param[in] index Index of the element to remove, in [0, size()).
+    void removeAtSwap(SizeType index)
+    {
+        GP_ASSERT(index >= 0 && index < m_size, "SoAVector index out of bounds");
+        const SizeType last = m_size - 1;
+        if (index != last)
+        {
+            moveAssign(index, last, kIndices);
+        }
+        popBack();
+    }
+
+    /// @brief Resizes the container, default-constructing the new elements.
+    /// @param[in] size New number of elements.
+    void resize(SizeType size)
+    requires(concepts::IsDefaultConstructible<Fields> && ...)
+    {
+        if (size < m_size)
+        {
+            destroyRange(size, m_size, kIndices);
+        }
+        else if (size > m_size)
+        {
+            reserve(size);
+            defaultConstructRange(m_size, size, kIndices);
+        }
+        m_size = size;
+    }
+
+    /// @brief Preallocates storage for at least @p capacity elements.
+    /// @param[in] capacity Number of elements to make room for.
+    void reserve(SizeType capacity)
+    {
+        if (capacity > m_capacity)
+        {
+            reallocate(capacity);
+        }
+    }
+
+    /// @brief Destroys every element. The storage is kept.
+    void clear() noexcept
+    {
+        destroyRange(0, m_size, kIndices);
+        m_size = 0;
+    }
+
+public:
+    /// @brief Returns a view over every value of field @p I.
+    /// @tparam I Index of the field.
+    /// @return A view over size() contiguous values, aligned on kArrayAlignment.
+    template <USize I>
+    [[nodiscard]] VectorView<FieldType<I>> field() noexcept
+    {
+        return VectorView<FieldType<I>>(std::get<I>(m_arrays), m_size);
+    }
+
+    /// @brief Returns a read-only view over every value of field @p I.
+    /// @tparam I Index of the field.
+    /// @return A view over size() contiguous values, aligned on kArrayAlignment.
+    template <USize I>
+    [[nodiscard]] VectorView<const FieldType<I>> field() const noexcept
+    {
+        return VectorView<const FieldType<I>>(std::get<I>(m_arrays), m_size);
+    }
+
+    /// @brief Accesses field @p I of the element at @p index.
+    template <USize I>
+    [[nodiscard]] FieldType<I>& get(SizeType index) noexcept
+    {
+        GP_ASSERT(index >= 0 && index < m_size, "SoAVector index out of bounds");
+        return std::get<I>(m_arrays)[index];
+    }
+
+    /// @brief Accesses field @p I of the element at @p index.
+    template <USize I>
+    [[nodiscard]] const FieldType<I>& get(SizeType index) const noexcept
+    {
+        GP_ASSERT(index >= 0 && index < m_size, "SoAVector index out of bounds");
+        return std::get<I>(m_arrays)[index];
+    }
+
+    /// @brief Accesses every field of the element at @p index.
+    /// @return A tuple of references to the fields.
+    [[nodiscard]] Reference operator[](SizeType index) noexcept
+    {
+        GP_ASSERT(index >= 0 && index < m_size, "SoAVector index out of bounds");
+        return std::apply([index](Fields*... arrays) { return Reference(arrays[index]...); }, m_arrays);
+    }
+
+    /// @brief Accesses every field of the element at @p index.
+    /// @return A tuple of const references to the fields.
+    [[nodiscard]] ConstReference operator[](SizeType index) const noexcept
+    {
+        GP_ASSERT(index >= 0 && index < m_size, "SoAVector index out of bounds");
+        return std::apply([index](Fields*... arrays) { return ConstReference(arrays[index]...); }, m_arrays);
+    }
+
+public:
+    /// @brief Returns the number of elements.
+    [[nodiscard]] SizeType size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @brief Returns the number of elements the container can hold without allocating.
+    [[nodiscard]] SizeType capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /// @brief Checks whether the container holds no element.
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    [[nodiscard]] Iterator begin() noexcept
+    {
+        return Iterator(this, 0);
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept
+    {
+        return ConstIterator(this, 0);
+    }
+
+    [[nodiscard]] Iterator end() noexcept
+    {
+        return Iterator(this, m_size);
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept
+    {
+        return ConstIterator(this, m_size);
+    }
+
+private:
+    /// @brief Returns the byte offset of every field array in a buffer holding @p capacity elements, followed by the
+    ///        total size of the buffer.
+    [[nodiscard]] static std::array<USize, kFieldCount + 1> computeLayout(SizeType capacity) noexcept
+    {
+        std::array<USize, kFieldCount + 1> offsets{};
+        constexpr USize sizes[] = { sizeof(Fields)... };
+        USize offset = 0;
+        for (USize i = 0; i < kFieldCount; ++i)
+        {
+            offsets[i] = offset;
+            offset = memory::align(offset + sizes[i] * static_cast<USize>(capacity), kArrayAlignment);
+        }
+        offsets[kFieldCount] = offset;
+        return offsets;
+    }
+
+    /// @brief Grows the storage, and constructs the element at size() from @p values if any are given.
+    template <typename... Args>
+    void grow(SizeType minCapacity, Args&&... values)
+    {
+        const SizeType capacity = math::max(minCapacity, math::max<SizeType>(m_capacity * 2, kMinCapacity));
+        reallocate(capacity, std::forward<Args>(values)...);
+    }
+
+    /// @brief Moves the elements to a buffer of @p capacity, and constructs the element at size() from @p values if
+    ///        any are given.
+    /// @details The values may reference elements of this container: the new element is built in the new buffer
+    ///          while the old one is still alive.
+    template <typename... Args>
+    void reallocate(SizeType capacity, Args&&... values)
+    {
+        const auto layout = computeLayout(capacity);
+        void* const buffer = Allocator::allocate(layout[kFieldCount], static_cast<UInt32>(kArrayAlignment));
+        if constexpr (sizeof...(Args) > 0)
+        {
+            constructIn(static_cast<Byte*>(buffer), layout, kIndices, std::forward<Args>(values)...);
+        }
+        relocateTo(static_cast<Byte*>(buffer), layout, kIndices);
+
+        Allocator::deallocate(m_buffer);
+        m_buffer = buffer;
+        m_capacity = capacity;
+    }
+
+    template <USize... I>
+    void relocateTo(Byte* buffer, const std::array<USize, kFieldCount + 1>& layout, std::index_sequence<I...>)
+    {
+        (relocateField<I>(reinterpret_cast<FieldType<I>*>(buffer + layout[I])), ...);
+    }
+
+    template <USize I>
+    void relocateField(FieldType<I>* destination)
+    {
+        using T = FieldType<I>;
+        T*& source = std::get<I>(m_arrays);
+        if constexpr (concepts::IsTriviallyCopyable<T>)
+        {
+            if (m_size > 0)
+            {
+                memory::copyMemory(destination, source, static_cast<USize>(m_size) * sizeof(T));
+            }
+        }
+        else
+        {
+            for (SizeType i = 0; i < m_size; ++i)
+            {
+                ::new (static_cast<void*>(destination + i)) T(std::move(source[i]));
+                source[i].~T();
+            }
+        }
+        source = destination;
+    }
+
+    template <USize... I, typename... Args>
+    void constructIn(
+        Byte* buffer, const std::array<USize, kFieldCount + 1>& layout, std::index_sequence<I...>, Args&&... values
+    )
+    {
+        (::new (static_cast<void*>(reinterpret_cast<FieldType<I>*>(buffer + layout[I]) + m_size))
+             FieldType<I>(std::forward<Args>(values)),
+         ...);
+    }
+
+    template <USize... I, typename... Args>
+    void constructAt(SizeType index, std::index_sequence<I...>, Args&&... values)
+    {
+        (::new (static_cast<void*>(std::get<I>(m_arrays) + index)) FieldType<I>(std::forward<Args>(values)), ...);
+    }
+
+    template <USize... I>
+    void defaultConstructRange(SizeType first, SizeType last, std::index_sequence<I...>)
+    {
+        (
+            [this, first, last]()
+        {
+            for (SizeType i = first; i < last; ++i)
+            {
+                ::new (static_cast<void*>(std::get<I>(m_arrays) + i)) FieldType<I>();
+            }
+        }(),
+            ...
+        );
+    }
+
+    template <USize... I>
+    void copyConstructFrom(const SoAVector& other, std::index_sequence<I...>)
+    {
+        (
+            [this, &other]()
+        {
+            for (SizeType i = 0; i < other.m_size; ++i)
+            {
+                ::new (static_cast<void*>(std::get<I>(m_arrays) + i)) FieldType<I>(std::get<I>(other.m_arrays)[i]);
+            }
+        }(),
+            ...
+        );
+    }
+
+    template <USize... I>
+    void moveAssign(SizeType destination, SizeType source, std::index_sequence<I...>)
+    {
+        ((std::get<I>(m_arrays)[destination] = std::move(std::get<I>(m_arrays)[source])), ...);
+    }
+
+    template <USize... I>
+    void destroyRange(SizeType first, SizeType last, std::index_sequence<I...>) noexcept
+    {
+        (
+            [this, first, last]()
+        {
+            if constexpr (!concepts::IsTriviallyDestructible<FieldType<I>>)
+            {
+                for (SizeType i = first; i < last; ++i)
+                {
+                    std::destroy_at(std::get<I>(m_arrays) + i);
+                }
+            }
+        }(),
+            ...
+        );
+    }
+};
+
+}   // namespace gp
@@ -0,0 +1,148 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include "maths/base/Scalar.hpp"
+
+#if GP_ARCHITECTURE_X86_FAMILY
+    #include <emmintrin.h>
+#elif GP_ARCHITECTURE_ARM64
+    #include <arm_neon.h>
+#endif
+
+namespace gp::container
+{
+
+/// @brief Bulk bitwise operations over arrays of 64-bit words, used by the bit containers.
+/// @details
+/// Each operation combines @p source into @p destination in place. SSE2 (x86) and NEON (ARM64) are part of the
+/// baseline of their architectures, so the 128-bit paths are selected at compile time and need no runtime dispatch.
+/// Two words are processed per iteration, the odd trailing word (if any) goes through the scalar path.
+struct BitwiseOperations
+{
+public:
+    /// @brief Computes `destination &= source` over @p count words.
+    static void andWords(UInt64* destination, const UInt64* source, USize count) noexcept
+    {
+        USize i = 0;
+#if GP_ARCHITECTURE_X86_FAMILY
+        for (; i + 2 <= count; i += 2)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_and_si128(a, b));
+        }
+#elif GP_ARCHITECTURE_ARM64
+        for (; i + 2 <= count; i += 2)
+        {
+            vst1q_u64(destination + i, vandq_u64(vld1q_u64(destination + i), vld1q_u64(source + i)));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            destination[i] &= source[i];
+        }
+    }
+
+    /// @brief Computes `destination |= source` over @p count words.
+    static void orWords(UInt64* destination, const UInt64* source, USize count) noexcept
+    {
+        USize i = 0;
+#if GP_ARCHITECTURE_X86_FAMILY
+        for (; i + 2 <= count; i += 2)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_or_si128(a, b));
+        }
+#elif GP_ARCHITECTURE_ARM64
+        for (; i + 2 <= count; i += 2)
+        {
+            vst1q_u64(destination + i, vorrq_u64(vld1q_u64(destination + i), vld1q_u64(source + i)));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            destination[i] |= source[i];
+        }
+    }
+
+    /// @brief Computes `destination ^= source` over @p count words.
+    static void xorWords(UInt64* destination, const UInt64* source, USize count) noexcept
+    {
+        USize i = 0;
+#if GP_ARCHITECTURE_X86_FAMILY
+        for (; i + 2 <= count; i += 2)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_xor_si128(a, b));
+        }
+#elif GP_ARCHITECTURE_ARM64
+        for (; i + 2 <= count; i += 2)
+        {
+            vst1q_u64(destination + i, veorq_u64(vld1q_u64(destination + i), vld1q_u64(source + i)));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            destination[i] ^= source[i];
+        }
+    }
+
+    /// @brief Computes `destination &= ~source` over @p count words.
+    static void andNotWords(UInt64* destination, const UInt64* source, USize count) noexcept
+    {
+        USize i = 0;
+#if GP_ARCHITECTURE_X86_FAMILY
+        for (; i + 2 <= count; i += 2)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+            // _mm_andnot_si128 negates its first operand.
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_andnot_si128(b, a));
+        }
+#elif GP_ARCHITECTURE_ARM64
+        for (; i + 2 <= count; i += 2)
+        {
+            vst1q_u64(destination + i, vbicq_u64(vld1q_u64(destination + i), vld1q_u64(source + i)));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            destination[i] &= ~source[i];
+        }
+    }
+
+    /// @brief Counts the set bits over @p count words.
+    /// @return The total number of one bits.
+    [[nodiscard]] static USize popCountWords(const UInt64* words, USize count) noexcept
+    {
+        USize total = 0;
+#if GP_ARCHITECTURE_ARM64
+        // NEON counts bits per byte, the byte counts are then folded with pairwise widening additions.
+        USize i = 0;
+        for (; i + 2 <= count; i += 2)
+        {
+            const uint8x16_t bytes = vcntq_u8(vreinterpretq_u8_u64(vld1q_u64(words + i)));
+            total += static_cast<USize>(vaddvq_u8(bytes));
+        }
+        for (; i < count; ++i)
+        {
+            total += math::popCount(words[i]);
+        }
+#else
+        // On x86 the scalar loop compiles to POPCNT when the target supports it, which beats any SSE2 emulation.
+        for (USize i = 0; i < count; ++i)
+        {
+            total += math::popCount(words[i]);
+        }
+#endif
+        return total;
+    }
+};
+
+}   // namespace gp::container
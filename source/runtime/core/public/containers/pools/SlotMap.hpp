@@ -0,0 +1,587 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Scalar.hpp"
+#include "memory/allocators/DefaultAllocator.hpp"
+#include "templates/traits/NicheTraits.hpp"
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace gp
+{
+
+/// @brief Generation-checked handle to an element of a SlotMap.
+/// @details
+/// A handle packs a slot index in its low bits and the generation of that slot in its high bits. 32-bit handles use
+/// 20 bits of index (about one million live slots) and 12 bits of generation, 64-bit handles split 32 / 32.
+/// Generations start at 1, so a default-constructed handle (all zeroes) never refers to anything.
+/// @tparam StorageType Underlying integer, either UInt32 or UInt64.
+template <typename StorageType>
+class SlotMapHandle
+{
+    static_assert(concepts::IsOneOf<StorageType, UInt32, UInt64>, "SlotMapHandle storage must be UInt32 or UInt64");
+
+public:
+    using ValueType = StorageType;
+
+public:
+    static constexpr UInt32 kIndexBits = sizeof(StorageType) == 4 ? 20u : 32u;
+    static constexpr UInt32 kGenerationBits = sizeof(StorageType) * 8u - kIndexBits;
+    static constexpr UInt32 kIndexMask = static_cast<UInt32>((UInt64{ 1 } << kIndexBits) - 1u);
+    static constexpr UInt32 kMaxGeneration = static_cast<UInt32>((UInt64{ 1 } << kGenerationBits) - 1u);
+
+    /// @brief Maximum number of slots a SlotMap using this handle can address.
+    static constexpr UInt32 kMaxSlots = kIndexMask;
+
+private:
+    StorageType m_value{ 0 };
+
+public:
+    /// @brief Constructs an invalid handle.
+    constexpr SlotMapHandle() noexcept = default;
+
+    /// @brief Constructs a handle from its components.
+    /// @param[in] index Slot index, must be lower than kMaxSlots.
+    /// @param[in] generation Slot generation, in [1, kMaxGeneration].
+    constexpr SlotMapHandle(UInt32 index, UInt32 generation) noexcept
+        : m_value(static_cast<StorageType>(index) | (static_cast<StorageType>(generation) << kIndexBits))
+    {}
+
+public:
+    /// @brief Rebuilds a handle from the raw value returned by value().
+    /// @param[in] value Raw handle value.
+    /// @return The handle.
+    [[nodiscard]] static constexpr SlotMapHandle fromValue(StorageType value) noexcept
+    {
+        SlotMapHandle handle;
+        handle.m_value = value;
+        return handle;
+    }
+
+    /// @brief Returns the slot index of the handle.
+    [[nodiscard]] constexpr UInt32 index() const noexcept
+    {
+        return static_cast<UInt32>(m_value & kIndexMask);
+    }
+
+    /// @brief Returns the generation of the handle.
+    [[nodiscard]] constexpr UInt32 generation() const noexcept
+    {
+        return static_cast<UInt32>(m_value >> kIndexBits);
+    }
+
+    /// @brief Returns the raw value of the handle, suitable for serialization or hashing.
+    [[nodiscard]] constexpr StorageType value() const noexcept
+    {
+        return m_value;
+    }
+
+    /// @brief Checks whether the handle may refer to an element, i.e. it is not default-constructed.
+    /// @note A valid handle may still be stale, use SlotMap::contains() to know if it is alive.
+    [[nodiscard]] constexpr bool isValid() const noexcept
+    {
+        return generation() != 0;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const SlotMapHandle&) const noexcept = default;
+};
+
+/// @brief Container handing out stable, ABA-safe handles to densely stored values.
+/// @details
+/// The container is made of three arrays:
+/// - The slots, indexed by handle, holding the current generation of the slot and the position of its value.
+/// - The dense values, tightly packed so that iterating over them is a linear walk over memory.
+/// - The dense-to-slot back references, used to patch the slot of the value moved by a swap-remove.
+/// Insertion and removal are O(1): freed slot indices are kept on a stack and removal swaps the last value into the
+/// hole. Removing a value bumps the generation of its slot, which invalidates every outstanding handle to it. A slot
+/// whose generation saturates is retired for good instead of wrapping around, so a stale handle can never alias a
+/// newer value.
+///
+/// Handles can also be reserved concurrently from any number of threads with reserveHandle(), e.g. by jobs that
+/// spawn entities or create GPU resources. Reservation never touches the slots or the values, it only claims a free
+/// index (or an index past the end) with an atomic decrement. The owner thread later materializes every reserved
+/// handle with flushReserved(). Until then, reserved handles are not contained in the map.
+/// @note Apart from reserveHandle() and concurrent reads, the container is not thread-safe. In particular no
+///       insertion or removal may happen while handles are being reserved or before they are flushed.
+/// @tparam T Value type. Must be move-constructible.
+/// @tparam HandleType Handle type, SlotMapHandle32 or SlotMapHandle64.
+/// @tparam Allocator Allocator type, providing static allocateArray / reallocateArray / deallocate functions.
+template <typename T, typename HandleType, typename Allocator>
+class SlotMap
+{
+    static_assert(concepts::IsMoveConstructible<T>, "SlotMap values must be move-constructible");
+
+public:
+    using ValueType = T;
+    using SizeType = UInt32;
+    using Handle = HandleType;
+    using Iterator = T*;
+    using ConstIterator = const T*;
+
+private:
+    static constexpr SizeType kFreeSlot = static_cast<SizeType>(-1);
+    static constexpr SizeType kMinCapacity = 8;
+
+    struct Slot
+    {
+        SizeType denseIndex;   //<! Position of the value in the dense arrays, kFreeSlot if the slot is not alive.
+        UInt32 generation;     //<! Generation of the slot, bumped every time its value is removed.
+    };
+
+private:
+    T* m_values{ nullptr };
+    SizeType* m_denseToSlot{ nullptr };
+    SizeType m_size{ 0 };
+    SizeType m_capacity{ 0 };
+
+    Slot* m_slots{ nullptr };
+    SizeType* m_freeIndices{ nullptr };
+    SizeType m_slotCount{ 0 };
+    SizeType m_slotCapacity{ 0 };
+    SizeType m_freeCount{ 0 };
+
+    /// @brief Reservation cursor, equal to m_freeCount when nothing is reserved. Each reservation decrements it: while
+    ///        it is positive it indexes m_freeIndices, once negative it counts the slots reserved past the end.
+    std::atomic<Int64> m_freeCursor{ 0 };
+
+public:
+    /// @brief Constructs an empty slot map.
+    SlotMap() noexcept = default;
+
+    /// @brief Destroys every value and releases the storage.
+    ~SlotMap()
+    {
+        destroyValues();
+        Allocator::deallocate(m_values);
+        Allocator::deallocate(m_denseToSlot);
+        Allocator::deallocate(m_slots);
+        Allocator::deallocate(m_freeIndices);
+    }
+
+    /// @brief Slot maps own their values and are not copyable.
+    SlotMap(const SlotMap&) = delete;
+    SlotMap& operator=(const SlotMap&) = delete;
+
+    /// @brief Steals the storage of another slot map, which is left empty. Handles keep referring to the same values.
+    /// @param[in] other Slot map to move from. No reservation may be pending on it.
+    SlotMap(SlotMap&& other) noexcept
+        : m_values(std::exchange(other.m_values, nullptr))
+        , m_denseToSlot(std::exchange(other.m_denseToSlot, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+        , m_capacity(std::exchange(other.m_capacity, 0))
+        , m_slots(std::exchange(other.m_slots, nullptr))
+        , m_freeIndices(std::exchange(other.m_freeIndices, nullptr))
+        , m_slotCount(std::exchange(other.m_slotCount, 0))
+        , m_slotCapacity(std::exchange(other.m_slotCapacity, 0))
+        , m_freeCount(std::exchange(other.m_freeCount, 0))
+        , m_freeCursor(other.m_freeCursor.exchange(0, std::memory_order_relaxed))
+    {}
+
+    /// @brief Steals the storage of another slot map, which is left empty.
+    /// @param[in] other Slot map to move from. No reservation may be pending on it.
+    /// @return Reference to this slot map.
+    SlotMap& operator=(SlotMap&& other) noexcept
+    {
+        if (this != &other)
+        {
+            this->~SlotMap();
+            ::new (this) SlotMap(std::move(other));
+        }
+        return *this;
+    }
+
+public:
+    /// @brief Constructs a value in place and returns its handle.
+    /// @param[in] args Arguments forwarded to T's constructor.
+    /// @return Handle to the new value, or an invalid handle if the handle index space is exhausted.
+    template <typename... Args>
+    Handle emplace(Args&&... args)
+    {
+        GP_ASSERT(!hasPendingReservations(), "SlotMap::emplace() called with unflushed reservations");
+
+        const SizeType index = acquireSlot();
+        if (index == kFreeSlot) [[unlikely]]
+        {
+            return Handle();
+        }
+
+        growValues(m_size + 1);
+        ::new (static_cast<void*>(m_values + m_size)) T(std::forward<Args>(args)...);
+        m_denseToSlot[m_size] = index;
+        m_slots[index].denseIndex = m_size;
+        ++m_size;
+        return Handle(index, m_slots[index].generation);
+    }
+
+    /// @brief Copies a value into the map and returns its handle.
+    /// @param[in] value Value to insert.
+    /// @return Handle to the new value, or an invalid handle if the handle index space is exhausted.
+    Handle insert(const T& value)
+    {
+        return emplace(value);
+    }
+
+    /// @brief Moves a value into the map and returns its handle.
+    /// @param[in] value Value to insert.
+    /// @return Handle to the new value, or an invalid handle if the handle index space is exhausted.
+    Handle insert(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /// @brief Removes the value referred to by @p handle, invalidating every copy of the handle.
+    /// @note The last dense value is moved into the hole, pointers to it are invalidated but handles are not.
+    /// @param[in] handle Handle to the value to remove.
+    /// @return True if the value was alive and got removed, false if the handle was stale.
+    bool remove(Handle handle)
+    {
+        GP_ASSERT(!hasPendingReservations(), "SlotMap::remove() called with unflushed reservations");
+
+        if (!contains(handle))
+        {
+            return false;
+        }
+
+        const SizeType index = handle.index();
+        const SizeType denseIndex = m_slots[index].denseIndex;
+        const SizeType lastIndex = m_size - 1;
+        if (denseIndex != lastIndex)
+        {
+            m_values[denseIndex] = std::move(m_values[lastIndex]);
+            m_denseToSlot[denseIndex] = m_denseToSlot[lastIndex];
+            m_slots[m_denseToSlot[denseIndex]].denseIndex = denseIndex;
+        }
+        m_values[lastIndex].~T();
+        m_size = lastIndex;
+
+        releaseSlot(index);
+        return true;
+    }
+
+    /// @brief Removes every value, invalidating every outstanding handle. The storage is kept.
+    void clear()
+    {
+        GP_ASSERT(!hasPendingReservations(), "SlotMap::clear() called with unflushed reservations");
+
+        destroyValues();
+        for (SizeType denseIndex = 0; denseIndex < m_size; ++denseIndex)
+        {
+            releaseSlot(m_denseToSlot[denseIndex]);
+        }
+        m_size = 0;
+    }
+
+    /// @brief Preallocates storage so that @p capacity values can be inserted without allocating.
+    /// @param[in] capacity Number of values to make room for.
+    void reserve(SizeType capacity)
+    {
+        growValues(capacity);
+        growSlots(math::min(capacity, Handle::kMaxSlots));
+    }
+
+public:
+    /// @brief Reserves a handle, to be materialized later by flushReserved().
+    /// @note Safe to call from any number of threads concurrently, as long as the owner thread does not modify the
+    ///       map at the same time. Reserved handles are not contained in the map until flushed.
+    /// @return The reserved handle, or an invalid handle if the handle index space is exhausted.
+    [[nodiscard]] Handle reserveHandle() noexcept
+    {
+        const Int64 cursor = m_freeCursor.fetch_sub(1, std::memory_order_relaxed);
+        if (cursor > 0)
+        {
+            const SizeType index = m_freeIndices[cursor - 1];
+            return Handle(index, m_slots[index].generation);
+        }
+
+        const Int64 index = static_cast<Int64>(m_slotCount) - cursor;
+        if (index >= static_cast<Int64>(Handle::kMaxSlots)) [[unlikely]]
+        {
+            return Handle();
+        }
+        return Handle(static_cast<SizeType>(index), 1u);
+    }
+
+    /// @brief Checks whether some handles were reserved and not flushed yet.
+    [[nodiscard]] bool hasPendingReservations() const noexcept
+    {
+        return m_freeCursor.load(std::memory_order_relaxed) != static_cast<Int64>(m_freeCount);
+    }
+
+    /// @brief Materializes every reserved handle, giving each of them a value built by @p func.
+    /// @note Owner thread only, no reservation may race with the flush.
+    /// @tparam Func Callable invocable with a Handle and returning something T is constructible from.
+    /// @param[in] func Callable building the value of each reserved handle.
+    /// @return The number of flushed handles.
+    template <typename Func>
+    requires concepts::IsInvocable<Func, Handle>
+    SizeType flushReserved(Func&& func)
+    {
+        const Int64 cursor = m_freeCursor.load(std::memory_order_relaxed);
+        const SizeType fromFreeList = m_freeCount - static_cast<SizeType>(math::max<Int64>(cursor, 0));
+        const SizeType pastEnd = math::min(
+            static_cast<SizeType>(math::max<Int64>(-cursor, 0)), Handle::kMaxSlots - m_slotCount
+        );
+        const SizeType count = fromFreeList + pastEnd;
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        growValues(m_size + count);
+        growSlots(m_slotCount + pastEnd);
+
+        // Free indices are claimed from the top of the stack down, then past the end in increasing order.
+        for (SizeType i = 0; i < count; ++i)
+        {
+            SizeType index;
+            if (i < fromFreeList)
+            {
+                index = m_freeIndices[--m_freeCount];
+            }
+            else
+            {
+                index = m_slotCount++;
+                m_slots[index].generation = 1u;
+            }
+
+            const Handle handle(index, m_slots[index].generation);
+            ::new (static_cast<void*>(m_values + m_size)) T(func(handle));
+            m_denseToSlot[m_size] = index;
+            m_slots[index].denseIndex = m_size;
+            ++m_size;
+        }
+
+        m_freeCursor.store(static_cast<Int64>(m_freeCount), std::memory_order_relaxed);
+        return count;
+    }
+
+    /// @brief Materializes every reserved handle with a default-constructed value.
+    /// @note Owner thread only, no reservation may race with the flush.
+    /// @return The number of flushed handles.
+    SizeType flushReserved()
+    requires concepts::IsDefaultConstructible<T>
+    {
+        return flushReserved([](Handle) { return T(); });
+    }
+
+public:
+    /// @brief Checks whether @p handle refers to a live value.
+    /// @param[in] handle Handle to check.
+    /// @return True if the value is alive, false if the handle is invalid, stale or reserved but not flushed.
+    [[nodiscard]] bool contains(Handle handle) const noexcept
+    {
+        const SizeType index = handle.index();
+        return index < m_slotCount && m_slots[index].generation == handle.generation() &&
+               m_slots[index].denseIndex != kFreeSlot;
+    }
+
+    /// @brief Resolves a handle to its value.
+    /// @param[in] handle Handle to resolve.
+    /// @return Pointer to the value, or nullptr if the handle is not alive. Invalidated by any insertion or removal.
+    [[nodiscard]] T* tryGet(Handle handle) noexcept
+    {
+        return contains(handle) ? m_values + m_slots[handle.index()].denseIndex : nullptr;
+    }
+
+    /// @brief Resolves a handle to its value.
+    /// @param[in] handle Handle to resolve.
+    /// @return Pointer to the value, or nullptr if the handle is not alive. Invalidated by any insertion or removal.
+    [[nodiscard]] const T* tryGet(Handle handle) const noexcept
+    {
+        return contains(handle) ? m_values + m_slots[handle.index()].denseIndex : nullptr;
+    }
+
+    /// @brief Resolves a handle that is known to be alive.
+    /// @param[in] handle Handle to resolve, must be alive.
+    /// @return Reference to the value.
+    [[nodiscard]] T& operator[](Handle handle) noexcept
+    {
+        GP_ASSERT(contains(handle), "SlotMap accessed with a stale handle");
+        return m_values[m_slots[handle.index()].denseIndex];
+    }
+
+    /// @brief Resolves a handle that is known to be alive.
+    /// @param[in] handle Handle to resolve, must be alive.
+    /// @return Reference to the value.
+    [[nodiscard]] const T& operator[](Handle handle) const noexcept
+    {
+        GP_ASSERT(contains(handle), "SlotMap accessed with a stale handle");
+        return m_values[m_slots[handle.index()].denseIndex];
+    }
+
+    /// @brief Returns the handle of the value at a given dense position, e.g. while iterating.
+    /// @param[in] denseIndex Position of the value, in [0, size()).
+    /// @return Handle to the value.
+    [[nodiscard]] Handle handleAt(SizeType denseIndex) const noexcept
+    {
+        GP_ASSERT(denseIndex < m_size, "SlotMap dense index out of range");
+        const SizeType index = m_denseToSlot[denseIndex];
+        return Handle(index, m_slots[index].generation);
+    }
+
+public:
+    /// @brief Returns the number of live values.
+    [[nodiscard]] SizeType size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @brief Checks whether the map holds no value.
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /// @brief Returns the number of values the map can hold without allocating.
+    [[nodiscard]] SizeType capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /// @brief Returns a pointer to the dense values, in no particular order.
+    [[nodiscard]] T* data() noexcept
+    {
+        return m_values;
+    }
+
+    /// @brief Returns a pointer to the dense values, in no particular order.
+    [[nodiscard]] const T* data() const noexcept
+    {
+        return m_values;
+    }
+
+    [[nodiscard]] Iterator begin() noexcept
+    {
+        return m_values;
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept
+    {
+        return m_values;
+    }
+
+    [[nodiscard]] Iterator end() noexcept
+    {
+        return m_values + m_size;
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept
+    {
+        return m_values + m_size;
+    }
+
+private:
+    /// @brief Pops a free slot index, or appends a new slot. Returns kFreeSlot when the index space is exhausted.
+    [[nodiscard]] SizeType acquireSlot()
+    {
+        SizeType index;
+        if (m_freeCount > 0)
+        {
+            index = m_freeIndices[--m_freeCount];
+        }
+        else
+        {
+            if (m_slotCount == Handle::kMaxSlots) [[unlikely]]
+            {
+                return kFreeSlot;
+            }
+            growSlots(m_slotCount + 1);
+            index = m_slotCount++;
+            m_slots[index].generation = 1u;
+        }
+        m_freeCursor.store(static_cast<Int64>(m_freeCount), std::memory_order_relaxed);
+        return index;
+    }
+
+    /// @brief Kills a slot, bumping its generation and recycling it unless the generation saturated.
+    void releaseSlot(SizeType index) noexcept
+    {
+        Slot& slot = m_slots[index];
+        slot.denseIndex = kFreeSlot;
+        if (slot.generation < Handle::kMaxGeneration)
+        {
+            ++slot.generation;
+            m_freeIndices[m_freeCount++] = index;
+            m_freeCursor.store(static_cast<Int64>(m_freeCount), std::memory_order_relaxed);
+        }
+    }
+
+    void growValues(SizeType minCapacity)
+    {
+        if (minCapacity <= m_capacity)
+        {
+            return;
+        }
+
+        const SizeType newCapacity = math::max(minCapacity, math::max(m_capacity * 2, kMinCapacity));
+        T* const newValues = Allocator::template allocateArray<T>(newCapacity);
+        for (SizeType i = 0; i < m_size; ++i)
+        {
+            ::new (static_cast<void*>(newValues + i)) T(std::move(m_values[i]));
+            m_values[i].~T();
+        }
+        Allocator::deallocate(m_values);
+
+        m_values = newValues;
+        m_denseToSlot = Allocator::template reallocateArray<SizeType>(m_denseToSlot, newCapacity);
+        m_capacity = newCapacity;
+    }
+
+    /// @brief Grows the slots and the free index stack together, so that releasing a slot never allocates.
+    void growSlots(SizeType minCapacity)
+    {
+        if (minCapacity <= m_slotCapacity)
+        {
+            return;
+        }
+
+        const SizeType newCapacity = math::min(
+            math::max(minCapacity, math::max(m_slotCapacity * 2, kMinCapacity)), Handle::kMaxSlots
+        );
+        m_slots = Allocator::template reallocateArray<Slot>(m_slots, newCapacity);
+        m_freeIndices = Allocator::template reallocateArray<SizeType>(m_freeIndices, newCapacity);
+        for (SizeType i = m_slotCapacity; i < newCapacity; ++i)
+        {
+            m_slots[i] = Slot{ kFreeSlot, 0u };
+        }
+        m_slotCapacity = newCapacity;
+    }
+
+    void destroyValues() noexcept
+    {
+        if constexpr (!concepts::IsTriviallyDestructible<T>)
+        {
+            for (SizeType i = 0; i < m_size; ++i)
+            {
+                m_values[i].~T();
+            }
+        }
+    }
+};
+
+}   // namespace gp
+
+namespace gp::trait
+{
+
+/// @brief Specialization for slot map handles: a zero generation with a maximal index is never handed out.
+/// @tparam StorageType Underlying integer of the handle.
+template <typename StorageType>
+struct NicheTraits<SlotMapHandle<StorageType>>
+{
+public:
+    using NicheType = StorageType;
+
+    static constexpr bool kHasNiche = true;
+    static constexpr USize kNicheOffset = 0;
+    static constexpr NicheType kNicheValue = SlotMapHandle<StorageType>::kIndexMask;
+};
+
+}   // namespace gp::trait
@@ -0,0 +1,308 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Scalar.hpp"
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace gp
+{
+
+/// @brief Bounded, lock-free, multi-producer / multi-consumer queue (Dmitry Vyukov's sequence-number design).
+/// @details
+/// Every cell carries a sequence number that encodes who may touch it next. For a cell at position `pos`:
+/// - `sequence == pos`     : the cell is free, the producer that claims `pos` may write it.
+/// - `sequence == pos + 1` : the cell is full, the consumer that claims `pos` may read it.
+/// Producers and consumers claim positions with a CAS on their own cache-line-isolated counter, then publish the cell
+/// with a single release store of its sequence. No thread ever waits on another one: a full or empty queue simply
+/// makes the try operation fail. The batch operations claim a run of consecutive ready cells with a single CAS, which
+/// divides the contention on the shared counters by the batch size.
+/// Elements live in inline storage, no allocation is ever performed.
+/// @tparam T Element type. Must be move-constructible.
+/// @tparam Capacity Maximum number of elements in flight. Must be a power of two, at least 2.
+template <typename T, USize Capacity>
+class MPMCQueue
+{
+    static_assert(math::isPowerOfTwo(Capacity) && Capacity >= 2, "MPMCQueue capacity must be a power of two >= 2");
+    static_assert(concepts::IsMoveConstructible<T>, "MPMCQueue elements must be move-constructible");
+
+public:
+    using ValueType = T;
+    using SizeType = gp::USize;
+
+public:
+    static constexpr SizeType kCapacity = Capacity;
+
+private:
+    static constexpr SizeType kIndexMask = Capacity - 1;
+    static constexpr SizeType kCacheLineSize = GP_PLATFORM_CACHE_LINE_SIZE;
+
+    /// @brief A single slot of the ring: its sequence number followed by raw storage for one element.
+    struct Cell
+    {
+        std::atomic<SizeType> sequence;
+        alignas(T) Byte storage[sizeof(T)];
+
+        [[nodiscard]] T* value() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+private:
+    alignas(kCacheLineSize) std::atomic<SizeType> m_enqueuePos{ 0 };
+    alignas(kCacheLineSize) std::atomic<SizeType> m_dequeuePos{ 0 };
+    alignas(kCacheLineSize) Cell m_cells[Capacity];
+
+public:
+    /// @brief Constructs an empty queue.
+    MPMCQueue() noexcept
+    {
+        for (SizeType i = 0; i < Capacity; ++i)
+        {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Destroys every element still in the queue.
+    /// @note Must not race with any producer or consumer.
+    ~MPMCQueue()
+    {
+        if constexpr (!concepts::IsTriviallyDestructible<T>)
+        {
+            const SizeType end = m_enqueuePos.load(std::memory_order_relaxed);
+            for (SizeType pos = m_dequeuePos.load(std::memory_order_relaxed); pos != end; ++pos)
+            {
+                m_cells[pos & kIndexMask].value()->~T();
+            }
+        }
+    }
+
+    /// @brief Queues are pinned in memory, they are shared between threads by address.
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+    MPMCQueue(MPMCQueue&&) = delete;
+    MPMCQueue& operator=(MPMCQueue&&) = delete;
+
+public:
+    /// @brief Constructs an element in place at the back of the queue.
+    /// @param[in] args Arguments forwarded to T's constructor.
+    /// @return True if the element was pushed, false if the queue was full.
+    template <typename... Args>
+    [[nodiscard]] bool tryEmplace(Args&&... args) noexcept(noexcept(T(std::forward<Args>(args)...)))
+    {
+        SizeType pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;)
+        {
+            cell = &m_cells[pos & kIndexMask];
+            const SizeType sequence = cell->sequence.load(std::memory_order_acquire);
+            const ISize diff = static_cast<ISize>(sequence) - static_cast<ISize>(pos);
+            if (diff == 0)
+            {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        ::new (cell->storage) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Copies an element to the back of the queue.
+    /// @param[in] value Element to push.
+    /// @return True if the element was pushed, false if the queue was full.
+    [[nodiscard]] bool tryPush(const T& value) noexcept(noexcept(T(value)))
+    {
+        return tryEmplace(value);
+    }
+
+    /// @brief Moves an element to the back of the queue.
+    /// @param[in] value Element to push.
+    /// @return True if the element was pushed, false if the queue was full.
+    [[nodiscard]] bool tryPush(T&& value) noexcept(noexcept(T(std::move(value))))
+    {
+        return tryEmplace(std::move(value));
+    }
+
+    /// @brief Pushes a run of elements, claiming all the consecutive free cells it can with a single CAS.
+    /// @param[in] values Pointer to the first element to push.
+    /// @param[in] count Number of elements available at @p values.
+    /// @return The number of elements actually pushed, in [0, @p count]. The pushed elements are the first ones of
+    ///         @p values and appear contiguously, in order, in the queue.
+    [[nodiscard]] SizeType tryPushBatch(const T* values, SizeType count) noexcept(noexcept(T(*values)))
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        SizeType pos = m_enqueuePos.load(std::memory_order_relaxed);
+        SizeType claimed;
+        for (;;)
+        {
+            claimed = countReady(pos, math::min(count, Capacity), 0);
+            if (claimed == 0)
+            {
+                const SizeType sequence = m_cells[pos & kIndexMask].sequence.load(std::memory_order_acquire);
+                if (static_cast<ISize>(sequence) - static_cast<ISize>(pos) < 0)
+                {
+                    return 0;
+                }
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+            else if (m_enqueuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        for (SizeType i = 0; i < claimed; ++i)
+        {
+            Cell& cell = m_cells[(pos + i) & kIndexMask];
+            ::new (cell.storage) T(values[i]);
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    /// @brief Pops the front element.
+    /// @param[out] outValue Receives the popped element by move-assignment.
+    /// @return True if an element was popped, false if the queue was empty.
+    [[nodiscard]] bool tryPop(T& outValue) noexcept(noexcept(outValue = std::move(outValue)))
+    {
+        SizeType pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;)
+        {
+            cell = &m_cells[pos & kIndexMask];
+            const SizeType sequence = cell->sequence.load(std::memory_order_acquire);
+            const ISize diff = static_cast<ISize>(sequence) - static_cast<ISize>(pos + 1);
+            if (diff == 0)
+            {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* const element = cell->value();
+        outValue = std::move(*element);
+        element->~T();
+        cell->sequence.store(pos + Capacity, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Pops a run of elements, claiming all the consecutive full cells it can with a single CAS.
+    /// @param[out] outValues Destination array, receives the popped elements by move-assignment.
+    /// @param[in] maxCount Capacity of @p outValues.
+    /// @return The number of elements actually popped, in [0, @p maxCount].
+    [[nodiscard]] SizeType tryPopBatch(T* outValues, SizeType maxCount) noexcept(
+        noexcept(*outValues = std::move(*outValues))
+    )
+    {
+        if (maxCount == 0)
+        {
+            return 0;
+        }
+
+        SizeType pos = m_dequeuePos.load(std::memory_order_relaxed);
+        SizeType claimed;
+        for (;;)
+        {
+            claimed = countReady(pos, math::min(maxCount, Capacity), 1);
+            if (claimed == 0)
+            {
+                const SizeType sequence = m_cells[pos & kIndexMask].sequence.load(std::memory_order_acquire);
+                if (static_cast<ISize>(sequence) - static_cast<ISize>(pos + 1) < 0)
+                {
+                    return 0;
+                }
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+            else if (m_dequeuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        for (SizeType i = 0; i < claimed; ++i)
+        {
+            Cell& cell = m_cells[(pos + i) & kIndexMask];
+            T* const element = cell.value();
+            outValues[i] = std::move(*element);
+            element->~T();
+            cell.sequence.store(pos + i + Capacity, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+public:
+    /// @brief Returns an approximation of the number of queued elements.
+    /// @return The number of claimed-but-not-yet-dequeued positions at some point during the call.
+    [[nodiscard]] SizeType sizeApprox() const noexcept
+    {
+        const SizeType dequeuePos = m_dequeuePos.load(std::memory_order_relaxed);
+        const SizeType enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+        const ISize size = static_cast<ISize>(enqueuePos - dequeuePos);
+        return size > 0 ? static_cast<SizeType>(size) : 0;
+    }
+
+    /// @brief Checks whether the queue looked empty at some point during the call.
+    /// @return True if the queue is empty, false otherwise.
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return sizeApprox() == 0;
+    }
+
+    /// @brief Returns the maximum number of elements the queue can hold.
+    /// @return The queue capacity.
+    [[nodiscard]] static constexpr SizeType capacity() noexcept
+    {
+        return Capacity;
+    }
+
+private:
+    /// @brief Counts the consecutive cells starting at @p pos whose sequence equals their position plus @p offset.
+    /// @note A ready cell can only stay ready until the owner of its position acts on it, and positions are only
+    ///       handed out through the CAS that follows, so the result is still valid when the CAS succeeds.
+    [[nodiscard]] SizeType countReady(SizeType pos, SizeType maxCount, SizeType offset) noexcept
+    {
+        SizeType count = 0;
+        while (count < maxCount &&
+               m_cells[(pos + count) & kIndexMask].sequence.load(std::memory_order_acquire) == pos + count + offset)
+        {
+            ++count;
+        }
+        return count;
+    }
+};
+
+}   // namespace gp
@@ -0,0 +1,172 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include <atomic>
+
+namespace gp
+{
+
+/// @brief Intrusive hook for MPSCQueue. Derive the queued type from it.
+/// @note A node may be in at most one queue at a time, and must outlive its stay in the queue.
+class MPSCQueueNode
+{
+    template <typename T>
+    friend class MPSCQueue;
+
+private:
+    std::atomic<MPSCQueueNode*> m_next{ nullptr };
+};
+
+/// @brief Unbounded, intrusive, multi-producer / single-consumer queue (Dmitry Vyukov's design).
+/// @details
+/// Producers link nodes they own into the queue with a single atomic exchange, they never loop and never wait on each
+/// other, which makes push wait-free. The consumer walks the list from an embedded stub node. As the queue stores
+/// pointers to caller-owned nodes, it never allocates: typical uses are command buffers handed to the render thread
+/// or IO completions posted from worker threads, where the node is embedded in the command itself.
+/// @note A producer preempted between its exchange and its link store makes the queue briefly look empty to the
+///       consumer; tryPop() returns nullptr in that window and the item becomes visible as soon as the producer
+///       resumes. Pushes are never lost.
+/// @tparam T Queued type, must derive from MPSCQueueNode.
+template <typename T>
+class MPSCQueue
+{
+    static_assert(concepts::IsDerivedFrom<T, MPSCQueueNode>, "MPSCQueue elements must derive from MPSCQueueNode");
+
+public:
+    using ValueType = T;
+
+private:
+    static constexpr USize kCacheLineSize = GP_PLATFORM_CACHE_LINE_SIZE;
+
+private:
+    alignas(kCacheLineSize) std::atomic<MPSCQueueNode*> m_head;   //<! Last pushed node, swapped by producers.
+    alignas(kCacheLineSize) MPSCQueueNode* m_tail;                //<! Next node to pop, owned by the consumer.
+    MPSCQueueNode m_stub;
+
+public:
+    /// @brief Constructs an empty queue.
+    MPSCQueue() noexcept
+        : m_head(&m_stub)
+        , m_tail(&m_stub)
+    {}
+
+    /// @brief Queues are pinned in memory, they are shared between threads by address.
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+    MPSCQueue(MPSCQueue&&) = delete;
+    MPSCQueue& operator=(MPSCQueue&&) = delete;
+
+public:
+    /// @brief Pushes a node at the back of the queue.
+    /// @note Safe to call from any number of threads concurrently.
+    /// @param[in] node Node to push, must not currently be in a queue.
+    void push(T* node) noexcept
+    {
+        pushChain(node, node);
+    }
+
+    /// @brief Pushes a chain of nodes previously linked with link(), in order, with a single atomic exchange.
+    /// @note Safe to call from any number of threads concurrently. The whole chain appears contiguously.
+    /// @param[in] first First node of the chain.
+    /// @param[in] last Last node of the chain.
+    void pushChain(T* first, T* last) noexcept
+    {
+        MPSCQueueNode* const lastNode = last;
+        lastNode->m_next.store(nullptr, std::memory_order_relaxed);
+        MPSCQueueNode* const previous = m_head.exchange(lastNode, std::memory_order_acq_rel);
+        previous->m_next.store(static_cast<MPSCQueueNode*>(first), std::memory_order_release);
+    }
+
+    /// @brief Links @p node after @p previous, building a chain for pushChain().
+    /// @param[in] previous Node that precedes @p node in the chain.
+    /// @param[in] node Node appended to the chain.
+    static void link(T* previous, T* node) noexcept
+    {
+        static_cast<MPSCQueueNode*>(previous)->m_next.store(node, std::memory_order_relaxed);
+    }
+
+    /// @brief Pops the front node.
+    /// @note Consumer thread only.
+    /// @return The front node, or nullptr if the queue is empty (or a push is mid-flight, see the class notes).
+    [[nodiscard]] T* tryPop() noexcept
+    {
+        MPSCQueueNode* tail = m_tail;
+        MPSCQueueNode* next = tail->m_next.load(std::memory_order_acquire);
+
+        if (tail == &m_stub)
+        {
+            if (next == nullptr)
+            {
+                return nullptr;
+            }
+            m_tail = next;
+            tail = next;
+            next = next->m_next.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return static_cast<T*>(tail);
+        }
+
+        if (tail != m_head.load(std::memory_order_acquire))
+        {
+            // A producer swapped the head but has not linked its node yet.
+            return nullptr;
+        }
+
+        // The tail is the only node left: push the stub behind it so the tail can be handed out.
+        pushStub();
+        next = tail->m_next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return static_cast<T*>(tail);
+        }
+        return nullptr;
+    }
+
+    /// @brief Pops nodes until the queue looks empty, handing each one to @p func.
+    /// @note Consumer thread only. Nodes pushed while draining may or may not be visited.
+    /// @tparam Func Callable invocable with a `T*`.
+    /// @param[in] func Callable receiving ownership of each popped node.
+    /// @return The number of nodes popped.
+    template <typename Func>
+    requires concepts::IsInvocable<Func, T*>
+    USize drain(Func&& func)
+    {
+        USize count = 0;
+        while (T* node = tryPop())
+        {
+            func(node);
+            ++count;
+        }
+        return count;
+    }
+
+    /// @brief Checks whether the queue looked empty at some point during the call.
+    /// @note Consumer thread only.
+    /// @return True if no node is ready to be popped, false otherwise.
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        const MPSCQueueNode* const tail = m_tail;
+        return tail == &m_stub && tail->m_next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    void pushStub() noexcept
+    {
+        m_stub.m_next.store(nullptr, std::memory_order_relaxed);
+        MPSCQueueNode* const previous = m_head.exchange(&m_stub, std::memory_order_acq_rel);
+        previous->m_next.store(&m_stub, std::memory_order_release);
+    }
+};
+
+}   // namespace gp
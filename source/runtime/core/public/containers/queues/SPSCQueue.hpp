@@ -0,0 +1,259 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Scalar.hpp"
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace gp
+{
+
+/// @brief Bounded, lock-free, single-producer / single-consumer ring buffer.
+/// @details
+/// Exactly one thread may push and exactly one (other) thread may pop at any given time. The producer owns the tail
+/// index and the consumer owns the head index, each on its own cache line so that the two threads never write to the
+/// same line. Each side additionally keeps a private cached copy of the opposite index, which means the shared index
+/// of the other side is only re-read when the cached value says the queue looks full (producer) or empty (consumer).
+/// In the steady state a push or a pop therefore touches a single shared cache line.
+/// Indices grow monotonically and are wrapped with a mask, so the capacity must be a power of two.
+/// Elements live in inline storage, no allocation is ever performed.
+/// @tparam T Element type. Must be move-constructible.
+/// @tparam Capacity Maximum number of elements in flight. Must be a power of two.
+template <typename T, USize Capacity>
+class SPSCQueue
+{
+    static_assert(math::isPowerOfTwo(Capacity), "SPSCQueue capacity must be a power of two");
+    static_assert(concepts::IsMoveConstructible<T>, "SPSCQueue elements must be move-constructible");
+
+public:
+    using ValueType = T;
+    using SizeType = gp::USize;
+
+public:
+    static constexpr SizeType kCapacity = Capacity;
+
+private:
+    static constexpr SizeType kIndexMask = Capacity - 1;
+    static constexpr SizeType kCacheLineSize = GP_PLATFORM_CACHE_LINE_SIZE;
+
+private:
+    alignas(kCacheLineSize) std::atomic<SizeType> m_head{ 0 };   //<! Next index to pop, written by the consumer.
+    SizeType m_cachedTail{ 0 };                                  //<! Consumer's cached copy of m_tail.
+    alignas(kCacheLineSize) std::atomic<SizeType> m_tail{ 0 };   //<! Next index to push, written by the producer.
+    SizeType m_cachedHead{ 0 };                                  //<! Producer's cached copy of m_head.
+    alignas(kCacheLineSize) alignas(T) Byte m_storage[Capacity * sizeof(T)];
+
+public:
+    /// @brief Constructs an empty queue.
+    SPSCQueue() noexcept = default;
+
+    /// @brief Destroys every element still in the queue.
+    ~SPSCQueue()
+    {
+        if constexpr (!concepts::IsTriviallyDestructible<T>)
+        {
+            const SizeType tail = m_tail.load(std::memory_order_relaxed);
+            for (SizeType index = m_head.load(std::memory_order_relaxed); index != tail; ++index)
+            {
+                slot(index)->~T();
+            }
+        }
+    }
+
+    /// @brief Queues are pinned in memory, they are shared between threads by address.
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+    SPSCQueue(SPSCQueue&&) = delete;
+    SPSCQueue& operator=(SPSCQueue&&) = delete;
+
+public:
+    /// @brief Constructs an element in place at the back of the queue.
+    /// @note Producer thread only.
+    /// @param[in] args Arguments forwarded to T's constructor.
+    /// @return True if the element was pushed, false if the queue was full.
+    template <typename... Args>
+    [[nodiscard]] bool tryEmplace(Args&&... args) noexcept(noexcept(T(std::forward<Args>(args)...)))
+    {
+        const SizeType tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead == Capacity)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead == Capacity) [[unlikely]]
+            {
+                return false;
+            }
+        }
+
+        ::new (slot(tail)) T(std::forward<Args>(args)...);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Copies an element to the back of the queue.
+    /// @note Producer thread only.
+    /// @param[in] value Element to push.
+    /// @return True if the element was pushed, false if the queue was full.
+    [[nodiscard]] bool tryPush(const T& value) noexcept(noexcept(T(value)))
+    {
+        return tryEmplace(value);
+    }
+
+    /// @brief Moves an element to the back of the queue.
+    /// @note Producer thread only.
+    /// @param[in] value Element to push.
+    /// @return True if the element was pushed, false if the queue was full.
+    [[nodiscard]] bool tryPush(T&& value) noexcept(noexcept(T(std::move(value))))
+    {
+        return tryEmplace(std::move(value));
+    }
+
+    /// @brief Copies as many elements as currently fit, publishing them with a single release store.
+    /// @note Producer thread only.
+    /// @param[in] values Pointer to the first element to push.
+    /// @param[in] count Number of elements available at @p values.
+    /// @return The number of elements actually pushed, in [0, @p count].
+    [[nodiscard]] SizeType tryPushBatch(const T* values, SizeType count) noexcept(noexcept(T(*values)))
+    {
+        const SizeType tail = m_tail.load(std::memory_order_relaxed);
+        SizeType freeSlots = Capacity - (tail - m_cachedHead);
+        if (freeSlots < count)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            freeSlots = Capacity - (tail - m_cachedHead);
+        }
+
+        const SizeType pushCount = math::min(count, freeSlots);
+        for (SizeType i = 0; i < pushCount; ++i)
+        {
+            ::new (slot(tail + i)) T(values[i]);
+        }
+
+        if (pushCount > 0)
+        {
+            m_tail.store(tail + pushCount, std::memory_order_release);
+        }
+        return pushCount;
+    }
+
+    /// @brief Pops the front element.
+    /// @note Consumer thread only.
+    /// @param[out] outValue Receives the popped element by move-assignment.
+    /// @return True if an element was popped, false if the queue was empty.
+    [[nodiscard]] bool tryPop(T& outValue) noexcept(noexcept(outValue = std::move(outValue)))
+    {
+        const SizeType head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail) [[unlikely]]
+            {
+                return false;
+            }
+        }
+
+        T* const element = slot(head);
+        outValue = std::move(*element);
+        element->~T();
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Pops up to @p maxCount elements, releasing their slots with a single release store.
+    /// @note Consumer thread only.
+    /// @param[out] outValues Destination array, receives the popped elements by move-assignment.
+    /// @param[in] maxCount Capacity of @p outValues.
+    /// @return The number of elements actually popped, in [0, @p maxCount].
+    [[nodiscard]] SizeType tryPopBatch(T* outValues, SizeType maxCount) noexcept(
+        noexcept(*outValues = std::move(*outValues))
+    )
+    {
+        const SizeType head = m_head.load(std::memory_order_relaxed);
+        SizeType available = m_cachedTail - head;
+        if (available < maxCount)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            available = m_cachedTail - head;
+        }
+
+        const SizeType popCount = math::min(maxCount, available);
+        for (SizeType i = 0; i < popCount; ++i)
+        {
+            T* const element = slot(head + i);
+            outValues[i] = std::move(*element);
+            element->~T();
+        }
+
+        if (popCount > 0)
+        {
+            m_head.store(head + popCount, std::memory_order_release);
+        }
+        return popCount;
+    }
+
+    /// @brief Returns a pointer to the front element without popping it.
+    /// @note Consumer thread only. The pointer stays valid until the next pop.
+    /// @return Pointer to the front element, or nullptr if the queue is empty.
+    [[nodiscard]] T* front() noexcept
+    {
+        const SizeType head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail)
+            {
+                return nullptr;
+            }
+        }
+        return slot(head);
+    }
+
+    /// @brief Destroys the front element, which must exist (see front()).
+    /// @note Consumer thread only.
+    void popFront() noexcept
+    {
+        const SizeType head = m_head.load(std::memory_order_relaxed);
+        GP_ASSERT(head != m_tail.load(std::memory_order_acquire), "popFront() called on an empty SPSCQueue");
+        slot(head)->~T();
+        m_head.store(head + 1, std::memory_order_release);
+    }
+
+public:
+    /// @brief Returns an approximation of the number of queued elements.
+    /// @note Exact only when called from the producer or consumer while the other side is idle.
+    /// @return The number of elements in the queue at some point during the call.
+    [[nodiscard]] SizeType sizeApprox() const noexcept
+    {
+        const SizeType head = m_head.load(std::memory_order_acquire);
+        const SizeType tail = m_tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    /// @brief Checks whether the queue looked empty at some point during the call.
+    /// @return True if the queue is empty, false otherwise.
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return sizeApprox() == 0;
+    }
+
+    /// @brief Returns the maximum number of elements the queue can hold.
+    /// @return The queue capacity.
+    [[nodiscard]] static constexpr SizeType capacity() noexcept
+    {
+        return Capacity;
+    }
+
+private:
+    [[nodiscard]] T* slot(SizeType index) noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(m_storage + (index & kIndexMask) * sizeof(T)));
+    }
+};
+
+}   // namespace gp
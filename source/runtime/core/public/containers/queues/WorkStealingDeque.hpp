@@ -0,0 +1,153 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Scalar.hpp"
+#include <atomic>
+
+namespace gp
+{
+
+/// @brief Bounded, lock-free work-stealing deque (Chase-Lev, with the C11 memory orderings of Lê et al.).
+/// @details
+/// A single owner thread pushes and pops at the bottom in LIFO order, which keeps the most recently spawned and
+/// therefore cache-hot work local. Any number of thief threads steal from the top in FIFO order, taking the oldest and
+/// usually largest pieces of work. The owner only synchronises with thieves when the deque holds a single element;
+/// every other push and pop is a handful of relaxed operations on a cache line no other thread writes to.
+/// The ring does not grow: a full deque makes tryPush() fail, and the caller is expected to fall back to another queue
+/// or to run the work inline.
+/// @tparam T Element type. Must be trivially copyable and lock-free as an atomic, typically a pointer.
+/// @tparam Capacity Maximum number of elements in flight. Must be a power of two.
+template <typename T, USize Capacity>
+class WorkStealingDeque
+{
+    static_assert(math::isPowerOfTwo(Capacity), "WorkStealingDeque capacity must be a power of two");
+    static_assert(concepts::IsTriviallyCopyable<T>, "WorkStealingDeque elements must be trivially copyable");
+    static_assert(std::atomic<T>::is_always_lock_free, "WorkStealingDeque elements must be lock-free atomics");
+
+public:
+    using ValueType = T;
+    using SizeType = gp::USize;
+
+public:
+    static constexpr SizeType kCapacity = Capacity;
+
+private:
+    static constexpr SizeType kIndexMask = Capacity - 1;
+    static constexpr SizeType kCacheLineSize = GP_PLATFORM_CACHE_LINE_SIZE;
+
+private:
+    alignas(kCacheLineSize) std::atomic<ISize> m_top{ 0 };      //<! Next index to steal, advanced by thieves.
+    alignas(kCacheLineSize) std::atomic<ISize> m_bottom{ 0 };   //<! Next index to push, written by the owner.
+    alignas(kCacheLineSize) std::atomic<T> m_slots[Capacity];
+
+public:
+    /// @brief Constructs an empty deque.
+    WorkStealingDeque() noexcept = default;
+
+    /// @brief Deques are pinned in memory, they are shared between threads by address.
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+public:
+    /// @brief Pushes an element at the bottom. Owner thread only.
+    /// @param[in] value Element to push.
+    /// @return True if the element was pushed, false if the deque was full.
+    [[nodiscard]] bool tryPush(T value) noexcept
+    {
+        const ISize bottom = m_bottom.load(std::memory_order_relaxed);
+        const ISize top = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<ISize>(Capacity))
+        {
+            return false;
+        }
+
+        m_slots[static_cast<SizeType>(bottom) & kIndexMask].store(value, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Pops the most recently pushed element. Owner thread only.
+    /// @param[out] outValue Receives the popped element.
+    /// @return True if an element was popped, false if the deque was empty or a thief took the last element.
+    [[nodiscard]] bool tryPop(T& outValue) noexcept
+    {
+        const ISize bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        ISize top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        outValue = m_slots[static_cast<SizeType>(bottom) & kIndexMask].load(std::memory_order_relaxed);
+        if (top != bottom)
+        {
+            return true;
+        }
+
+        // Last element: race the thieves for it through the top index.
+        const bool won =
+            m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+
+    /// @brief Steals the oldest element. Any thread.
+    /// @param[out] outValue Receives the stolen element.
+    /// @return True if an element was stolen, false if the deque was empty or another thread won the race for it.
+    [[nodiscard]] bool trySteal(T& outValue) noexcept
+    {
+        ISize top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const ISize bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+        {
+            return false;
+        }
+
+        const T value = m_slots[static_cast<SizeType>(top) & kIndexMask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+        outValue = value;
+        return true;
+    }
+
+public:
+    /// @brief Returns an approximation of the number of elements in the deque.
+    /// @return The number of pushed-but-not-yet-taken elements at some point during the call.
+    [[nodiscard]] SizeType sizeApprox() const noexcept
+    {
+        const ISize bottom = m_bottom.load(std::memory_order_relaxed);
+        const ISize top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<SizeType>(bottom - top) : 0;
+    }
+
+    /// @brief Checks whether the deque looked empty at some point during the call.
+    /// @return True if the deque is empty, false otherwise.
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return sizeApprox() == 0;
+    }
+
+    /// @brief Returns the maximum number of elements the deque can hold.
+    /// @return The deque capacity.
+    [[nodiscard]] static constexpr SizeType capacity() noexcept
+    {
+        return Capacity;
+    }
+};
+
+}   // namespace gp
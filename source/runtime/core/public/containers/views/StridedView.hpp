@@ -3,3 +3,171 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+#include <type_traits>
+
+namespace gp
+{
+
+/// @brief Non-owning view into elements laid out at a constant distance from each other.
+/// @details
+/// Views one field across an array of structures, such as the positions of an interleaved vertex buffer, without
+/// copying them out. The stride is counted in bytes and may be larger than the element, but not smaller. A view with
+/// a stride of sizeof(T) is equivalent to a VectorView. Boundary checks are performed in debug builds only.
+/// @tparam T Element type, possibly const-qualified.
+/// @tparam InSizeType Integer type used for sizes and indices.
+template <typename T, typename InSizeType>
+class StridedView
+{
+public:
+    using ValueType = T;
+    using SizeType = InSizeType;
+    using Reference = T&;
+    using Pointer = T*;
+
+private:
+    using BytePointer = std::conditional_t<std::is_const_v<T>, const UInt8*, UInt8*>;
+
+public:
+    /// @brief Forward iterator stepping over the elements of a strided view.
+    class Iterator
+    {
+    private:
+        BytePointer m_address{ nullptr };
+        USize m_stride{ 0 };
+
+    public:
+        constexpr Iterator() noexcept = default;
+
+        constexpr Iterator(BytePointer address, USize stride) noexcept
+            : m_address(address)
+            , m_stride(stride)
+        {}
+
+    public:
+        [[nodiscard]] Reference operator*() const noexcept
+        {
+            return *reinterpret_cast<Pointer>(m_address);
+        }
+
+        Iterator& operator++() noexcept
+        {
+            m_address += m_stride;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator previous = *this;
+            m_address += m_stride;
+            return previous;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const Iterator& other) const noexcept
+        {
+            return m_address == other.m_address;
+        }
+    };
+
+private:
+    BytePointer m_data{ nullptr };
+    SizeType m_size{ 0 };
+    USize m_stride{ sizeof(T) };
+
+public:
+    /// @brief Constructs an empty view.
+    [[nodiscard]] constexpr StridedView() noexcept = default;
+
+    /// @brief Constructs a view over @p size elements, the first one at @p first and the next ones @p stride bytes
+    /// apart.
+    /// @param[in] first Pointer to the first element.
+    /// @param[in] size Number of elements.
+    /// @param[in] stride Distance between two consecutive elements, in bytes.
+    [[nodiscard]] StridedView(Pointer first, SizeType size, USize stride) noexcept
+        : m_data(reinterpret_cast<BytePointer>(first))
+        , m_size(size)
+        , m_stride(stride)
+    {
+        GP_ASSERT(size >= 0, "StridedView size must not be negative");
+        GP_ASSERT(stride >= sizeof(T), "StridedView stride must not be smaller than the element");
+    }
+
+    /// @brief Constructs a view over contiguous elements.
+    /// @param[in] view Contiguous elements to view.
+    template <typename U>
+    requires(concepts::IsPointerConvertibleTo<U, T>)
+    [[nodiscard]] StridedView(const VectorView<U, SizeType>& view) noexcept
+        : StridedView(view.data(), view.size(), sizeof(T))
+    {}
+
+    /// @brief Converts a view over mutable elements into a view over const elements.
+    /// @param[in] other View to convert.
+    template <typename U>
+    requires(concepts::IsPointerConvertibleTo<U, T> && !concepts::IsSameAs<U, T>)
+    [[nodiscard]] StridedView(const StridedView<U, SizeType>& other) noexcept
+        : StridedView(other.size() > 0 ? &other[0] : nullptr, other.size(), other.stride())
+    {}
+
+    /// @brief Constructs a view over one field of an array of structures.
+    /// @param[in] structures Structures holding the field.
+    /// @param[in] field Pointer to the viewed field.
+    /// @return The view, with the size of @p structures and a stride of sizeof(S).
+    template <typename S, typename Field>
+    requires(concepts::IsPointerConvertibleTo<Field, T>)
+    [[nodiscard]] static StridedView ofField(const VectorView<S, SizeType>& structures, Field S::*field) noexcept
+    {
+        Pointer first = structures.isEmpty() ? nullptr : &(structures.data()->*field);
+        return StridedView(first, structures.size(), sizeof(S));
+    }
+
+public:
+    /// @brief Accesses the element at the specified index.
+    /// @param[in] index Index of the element, in [0, size()).
+    /// @return A reference to the element.
+    [[nodiscard]] Reference operator[](SizeType index) const noexcept
+    {
+        GP_ASSERT(index >= 0 && index < m_size, "StridedView index out of bounds");
+        return *reinterpret_cast<Pointer>(m_data + static_cast<USize>(index) * m_stride);
+    }
+
+    /// @brief Returns the number of elements in the view.
+    [[nodiscard]] constexpr SizeType size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @brief Returns the distance between two consecutive elements, in bytes.
+    [[nodiscard]] constexpr USize stride() const noexcept
+    {
+        return m_stride;
+    }
+
+    /// @brief Checks whether the elements are contiguous, so the view can be handled as a VectorView.
+    [[nodiscard]] constexpr bool isContiguous() const noexcept
+    {
+        return m_stride == sizeof(T);
+    }
+
+    /// @brief Checks whether the view contains no element.
+    [[nodiscard]] constexpr bool isEmpty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+public:
+    [[nodiscard]] Iterator begin() const noexcept
+    {
+        return Iterator(m_data, m_stride);
+    }
+
+    [[nodiscard]] Iterator end() const noexcept
+    {
+        return Iterator(m_data + static_cast<USize>(m_size) * m_stride, m_stride);
+    }
+};
+
+}   // namespace gp
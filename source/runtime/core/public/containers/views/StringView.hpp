@@ -7,7 +7,9 @@
 #include "concepts/Concepts.hpp"
 #include "CoreMinimal.hpp"
 #include "maths/base/Scalar.hpp"
+#include "templates/traits/NicheTraits.hpp"
 #include <algorithm>
+#include <cstddef>      // For offsetof
 #include <compare>    // For std::strong_ordering
 #include <format>     // For std::formatter
 #include <iterator>   // For std::reverse_iterator
@@ -28,6 +30,8 @@ namespace gp::container
 template <concepts::IsCharacter CharT>
 class BasicStringView
 {
+    friend struct trait::NicheTraits<BasicStringView>;
+
 public:
     using TraitsType = std::char_traits<CharT>;
     using ValueType = CharT;
@@ -749,6 +753,24 @@ public:
 
 }   // namespace gp::container
 
+namespace gp::trait
+{
+
+/// @brief Specialization for string views, whose size is never npos.
+/// @tparam CharT The character type of the string view.
+template <concepts::IsCharacter CharT>
+struct NicheTraits<container::BasicStringView<CharT>>
+{
+public:
+    using NicheType = typename container::BasicStringView<CharT>::SizeType;
+
+    static constexpr bool kHasNiche = true;
+    static constexpr USize kNicheOffset = offsetof(container::BasicStringView<CharT>, m_size);
+    static constexpr NicheType kNicheValue = container::BasicStringView<CharT>::npos;
+};
+
+}   // namespace gp::trait
+
 namespace gp
 {
 
@@ -3,3 +3,196 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include <iterator>
+#include <ranges>
+
+namespace gp
+{
+
+/// @brief Non-owning view into a contiguous sequence of elements.
+/// @details
+/// A pointer and a size, nothing more: views are meant to be passed by value to functions that only need to read or
+/// write existing elements, whatever container owns them. Use `VectorView<const T>` (ConstVectorView) for read-only
+/// access. Boundary checks are performed in debug builds only.
+/// @tparam T Element type, possibly const-qualified.
+/// @tparam InSizeType Integer type used for sizes and indices.
+template <typename T, typename InSizeType>
+class VectorView
+{
+public:
+    using ValueType = T;
+    using SizeType = InSizeType;
+    using DifferenceType = gp::ISize;
+    using Reference = T&;
+    using Pointer = T*;
+    using Iterator = Pointer;
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+
+private:
+    Pointer m_data{ nullptr };
+    SizeType m_size{ 0 };
+
+public:
+    /// @brief Constructs an empty view.
+    [[nodiscard]] constexpr VectorView() noexcept = default;
+
+    /// @brief Constructs a view over @p size elements starting at @p data.
+    /// @param[in] data Pointer to the first element.
+    /// @param[in] size Number of elements.
+    [[nodiscard]] constexpr VectorView(Pointer data, SizeType size) noexcept
+        : m_data(data)
+        , m_size(size)
+    {
+        GP_ASSERT(size >= 0, "VectorView size must not be negative");
+    }
+
+    /// @brief Constructs a view over a C array.
+    /// @param[in] array Array to view.
+    template <USize N>
+    [[nodiscard]] constexpr VectorView(T (&array)[N]) noexcept
+        : m_data(array)
+        , m_size(static_cast<SizeType>(N))
+    {}
+
+    /// @brief Constructs a view over any contiguous, sized range (Array, Vector, SoAVector fields...).
+    /// @param[in] range Range to view, must outlive the view.
+    template <typename Range>
+    requires(
+        concepts::IsContiguousRange<Range> && concepts::IsSizedRange<Range> &&
+        concepts::IsPointerConvertibleTo<std::remove_reference_t<std::ranges::range_reference_t<Range>>, T> &&
+        !concepts::IsSameAs<std::remove_cvref_t<Range>, VectorView>
+    )
+    [[nodiscard]] constexpr VectorView(Range&& range) noexcept
+        : m_data(std::ranges::data(range))
+        , m_size(static_cast<SizeType>(std::ranges::size(range)))
+    {}
+
+    /// @brief Converts a view over mutable elements into a view over const elements.
+    /// @param[in] other View to convert.
+    template <typename U>
+    requires(concepts::IsPointerConvertibleTo<U, T> && !concepts::IsSameAs<U, T>)
+    [[nodiscard]] constexpr VectorView(const VectorView<U, SizeType>& other) noexcept
+        : m_data(other.data())
+        , m_size(other.size())
+    {}
+
+    /// @brief Copy constructor and copy assignment operator.
+    [[nodiscard]] constexpr VectorView(const VectorView&) noexcept = default;
+    constexpr VectorView& operator=(const VectorView&) noexcept = default;
+
+public:
+    /// @brief Accesses the element at the specified index.
+    /// @param[in] index Index of the element, in [0, size()).
+    /// @return A reference to the element.
+    [[nodiscard]] constexpr Reference operator[](SizeType index) const noexcept
+    {
+        GP_ASSERT(index >= 0 && index < m_size, "VectorView index out of bounds");
+        return m_data[index];
+    }
+
+    /// @brief Returns a reference to the first element.
+    [[nodiscard]] constexpr Reference front() const noexcept
+    {
+        GP_ASSERT(m_size > 0, "VectorView is empty");
+        return m_data[0];
+    }
+
+    /// @brief Returns a reference to the last element.
+    [[nodiscard]] constexpr Reference back() const noexcept
+    {
+        GP_ASSERT(m_size > 0, "VectorView is empty");
+        return m_data[m_size - 1];
+    }
+
+    /// @brief Returns a pointer to the first element.
+    [[nodiscard]] constexpr Pointer data() const noexcept
+    {
+        return m_data;
+    }
+
+    /// @brief Returns the number of elements in the view.
+    [[nodiscard]] constexpr SizeType size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @brief Returns the size of the viewed elements in bytes.
+    [[nodiscard]] constexpr USize sizeInBytes() const noexcept
+    {
+        return static_cast<USize>(m_size) * sizeof(T);
+    }
+
+    /// @brief Checks whether the view contains no element.
+    [[nodiscard]] constexpr bool isEmpty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /// @brief Checks whether @p index is a valid index into the view.
+    [[nodiscard]] constexpr bool isValidIndex(SizeType index) const noexcept
+    {
+        return index >= 0 && index < m_size;
+    }
+
+public:
+    /// @brief Returns a view over @p count elements starting at @p offset.
+    /// @param[in] offset Index of the first element of the sub-view.
+    /// @param[in] count Number of elements of the sub-view.
+    /// @return The sub-view.
+    [[nodiscard]] constexpr VectorView slice(SizeType offset, SizeType count) const noexcept
+    {
+        GP_ASSERT(offset >= 0 && count >= 0 && offset + count <= m_size, "VectorView slice out of bounds");
+        return VectorView(m_data + offset, count);
+    }
+
+    /// @brief Returns a view over the first @p count elements.
+    [[nodiscard]] constexpr VectorView first(SizeType count) const noexcept
+    {
+        return slice(0, count);
+    }
+
+    /// @brief Returns a view over the last @p count elements.
+    [[nodiscard]] constexpr VectorView last(SizeType count) const noexcept
+    {
+        return slice(m_size - count, count);
+    }
+
+    /// @brief Returns a view over every element past the first @p count ones.
+    [[nodiscard]] constexpr VectorView dropFirst(SizeType count) const noexcept
+    {
+        return slice(count, m_size - count);
+    }
+
+public:
+    [[nodiscard]] constexpr Iterator begin() const noexcept
+    {
+        return m_data;
+    }
+
+    [[nodiscard]] constexpr Iterator end() const noexcept
+    {
+        return m_data + m_size;
+    }
+
+    [[nodiscard]] constexpr ReverseIterator rbegin() const noexcept
+    {
+        return ReverseIterator(end());
+    }
+
+    [[nodiscard]] constexpr ReverseIterator rend() const noexcept
+    {
+        return ReverseIterator(begin());
+    }
+};
+
+}   // namespace gp
+
+template <typename T, typename SizeType>
+inline constexpr bool std::ranges::enable_borrowed_range<gp::VectorView<T, SizeType>> = true;
+
+template <typename T, typename SizeType>
+inline constexpr bool std::ranges::enable_view<gp::VectorView<T, SizeType>> = true;
@@ -0,0 +1,126 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+
+namespace gp
+{
+
+/// @brief Instruction set levels the hot kernels are compiled for.
+enum class ISALevel : UInt8
+{
+    Scalar,   //<! Portable C++, the baseline of every build.
+    SSE4_2,   //<! x86 with SSE4.2 and its CRC32 instruction.
+    AVX2,     //<! x86 with AVX2 and FMA3, enabled by the OS.
+    NEON      //<! AArch64 Advanced SIMD.
+};
+
+/// @brief Function-pointer table holding one implementation of every hot kernel, all compiled for the same ISA level.
+struct KernelTable
+{
+    /// @brief Copies @p size bytes between non-overlapping buffers. Large copies bypass the caches.
+    void (*copyMemory)(void* destination, const void* source, USize size) noexcept;
+
+    /// @brief Returns the index of the first byte equal to @p value, or @p size when there is none.
+    USize (*findByte)(const void* data, USize size, UInt8 value) noexcept;
+
+    /// @brief Computes the CRC-32C (Castagnoli) checksum of @p size bytes, continuing from @p seed.
+    UInt32 (*crc32c)(const void* data, USize size, UInt32 seed) noexcept;
+
+    /// @brief Computes the dot product of two arrays of @p count floats.
+    Float32 (*dotProduct)(const Float32* a, const Float32* b, USize count) noexcept;
+
+    /// @brief Adds @p source scaled by @p gain to @p destination, over @p count samples.
+    void (*mixAudio)(Float32* destination, const Float32* source, Float32 gain, USize count) noexcept;
+
+    /// @brief Level the kernels of the table are compiled for.
+    ISALevel level;
+};
+
+/// @brief Runtime dispatch of the hot kernels to the best instruction set of the host CPU.
+/// @details
+/// One binary ships every implementation: the x86 kernels are compiled with GP_TARGET for SSE4.2 and AVX2 on top of
+/// the build's baseline, the AArch64 ones for NEON. initialize() selects the table once at startup: the HAL's
+/// HardwareInfo::initialize() calls it with hal::SIMDInfo::getKernelLevel(), until then the scalar kernels run. Calls
+/// go through a single indirect call, so kernels are meant for batches rather than for a handful of elements.
+/// @note initialize() is not synchronised with the calls: invoke it before starting the threads that use kernels.
+class Kernels
+{
+private:
+    static const KernelTable* s_table;
+
+private:
+    /// @brief Deleted constructor prevent instantiation of the Kernels class, as it is intended to be used.
+    Kernels() = delete;
+
+    /// @brief Deleted destructor prevent instantiation of the Kernels class, as it is intended to be used.
+    ~Kernels() = delete;
+
+public:
+    /// @brief Selects the kernels to run for the rest of the program.
+    /// @param[in] level Best level supported by the CPU. Levels this build has no kernels for fall back to the next
+    /// lower one.
+    static void initialize(ISALevel level) noexcept;
+
+    /// @brief Returns the table compiled for @p level, or for the next lower level this build has kernels for.
+    /// @warning Running the kernels of a level the CPU does not support raises an illegal instruction fault.
+    /// @param[in] level Requested level.
+    /// @return The table, which lives for the whole program.
+    [[nodiscard]] static const KernelTable& getTable(ISALevel level) noexcept;
+
+    /// @brief Returns the table selected by initialize().
+    [[nodiscard]] static const KernelTable& getTable() noexcept
+    {
+        return *s_table;
+    }
+
+    /// @brief Returns the level of the selected kernels.
+    [[nodiscard]] static ISALevel getLevel() noexcept
+    {
+        return s_table->level;
+    }
+
+    static void copyMemory(void* destination, const void* source, USize size) noexcept
+    {
+        s_table->copyMemory(destination, source, size);
+    }
+
+    [[nodiscard]] static USize findByte(const void* data, USize size, UInt8 value) noexcept
+    {
+        return s_table->findByte(data, size, value);
+    }
+
+    [[nodiscard]] static UInt32 crc32c(const void* data, USize size, UInt32 seed = 0) noexcept
+    {
+        return s_table->crc32c(data, size, seed);
+    }
+
+    [[nodiscard]] static Float32 dotProduct(const Float32* a, const Float32* b, USize count) noexcept
+    {
+        return s_table->dotProduct(a, b, count);
+    }
+
+    static void mixAudio(Float32* destination, const Float32* source, Float32 gain, USize count) noexcept
+    {
+        s_table->mixAudio(destination, source, gain, count);
+    }
+};
+
+namespace detail
+{
+
+/// @brief Tables of each ISA level, defined by the translation unit compiling its kernels.
+extern const KernelTable kScalarKernelTable;
+#if GP_ARCHITECTURE_X86 || GP_ARCHITECTURE_X64
+extern const KernelTable kSSE42KernelTable;
+extern const KernelTable kAVX2KernelTable;
+#elif GP_ARCHITECTURE_ARM64
+extern const KernelTable kNEONKernelTable;
+#endif
+
+}   // namespace detail
+
+}   // namespace gp
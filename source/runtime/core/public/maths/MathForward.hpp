@@ -32,6 +32,9 @@ template <concepts::IsFloatingPoint T> struct Ray;
 template <concepts::IsFloatingPoint T> struct Sphere;
 template <concepts::IsFloatingPoint T> struct Triangle;
 
+template <concepts::IsFloatingPoint T> class Bvh;
+template <concepts::IsFloatingPoint T, Int32 Width> requires(Width == 4 || Width == 8) class WideBvh;
+
 template <concepts::IsFloatingPoint T> struct Transform;
 template <concepts::IsFloatingPoint T> struct Projection;
 template <concepts::IsFloatingPoint T> struct View;
@@ -0,0 +1,415 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"   // IWYU pragma: keep
+#include "maths/base/Constants.hpp"
+#include "maths/base/Scalar.hpp"
+#include "maths/simd/VectorRegister.hpp"
+#include <bit>
+
+/// @section Approximate functions.
+///
+/// Polynomial approximations of the elementary functions on Float32, for code that trades a few bits of accuracy for
+/// speed, such as animation, audio processing and particles. Every function comes as a scalar and as a register form
+/// over VectorRegister4f and VectorRegister8f, with the same polynomials and without branches in the register forms.
+/// The errors below are the largest found against the standard functions evaluated in double, in units in the last
+/// place of the Float32 result, over the stated domain:
+/// - fastSin, fastCos : 2 ULP for |x| <= 2 pi, the absolute error staying below 2e-7 for |x| <= 8192.
+/// - fastAtan2        : 3 ULP for any finite x and y, the sign of a zero x being ignored.
+/// - fastExp          : 2 ULP for x in [-126 ln 2, 127 ln 2], inputs being clamped to that range.
+/// - fastLog          : 1 ULP for positive normal x, other inputs giving unspecified results.
+/// - fastInverseSqrt  : 4 ULP on x86, the hardware estimate being refined by one Newton step.
+
+namespace gp::math
+{
+
+namespace detail
+{
+
+// Cody-Waite split of pi / 2, whose first two parts have few enough bits for their products to be exact.
+inline constexpr Float32 kHalfPiHigh = 1.5703125f;
+inline constexpr Float32 kHalfPiMiddle = 4.837512969970703125e-4f;
+inline constexpr Float32 kHalfPiLow = 7.54978995489188216e-8f;
+
+// Split of ln 2, the first part having few enough bits for its products to be exact.
+inline constexpr Float32 kLn2High = 0.693359375f;
+inline constexpr Float32 kLn2Low = -2.12194440e-4f;
+
+// Exponential inputs whose power of two is a normal float.
+inline constexpr Float32 kExpMin = -87.3365447f;
+inline constexpr Float32 kExpMax = 88.0296919f;
+
+// Minimax polynomials of the Cephes library, from the highest degree down.
+inline constexpr Float32 kSinCoefficients[] = { -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f };
+inline constexpr Float32 kCosCoefficients[] = { 2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f };
+inline constexpr Float32 kAtanCoefficients[] = { 8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f,
+                                                 -3.33329491539e-1f };
+inline constexpr Float32 kExpCoefficients[] = { 1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f,
+                                                4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f };
+inline constexpr Float32 kLogCoefficients[] = { 7.0376836292e-2f,  -1.1514610310e-1f, 1.1676998740e-1f,
+                                                -1.2420140846e-1f, 1.4249322787e-1f,  -1.6668057665e-1f,
+                                                2.0000714765e-1f,  -2.4999993993e-1f, 3.3333331174e-1f };
+
+/// @brief Returns a register with every lane set to @p value.
+template <typename Register>
+[[nodiscard]] GP_FORCEINLINE Register splatRegister(const Float32 value) noexcept
+{
+    if constexpr (sizeof(Register) == sizeof(simd::VectorRegister4f))
+    {
+        return simd::splat4f(value);
+    }
+    else
+    {
+        return simd::splat8f(value);
+    }
+}
+
+/// @brief Evaluates a polynomial at @p x with Horner's method.
+template <USize Count>
+[[nodiscard]] constexpr Float32 evaluatePolynomial(const Float32 x, const Float32 (&coefficients)[Count]) noexcept
+{
+    Float32 result = coefficients[0];
+    for (USize index = 1; index < Count; ++index)
+    {
+        result = result * x + coefficients[index];
+    }
+    return result;
+}
+
+/// @copydoc evaluatePolynomial(const Float32, const Float32 (&)[Count])
+template <typename Register, USize Count>
+[[nodiscard]] GP_FORCEINLINE Register
+    evaluatePolynomial(const Register x, const Float32 (&coefficients)[Count]) noexcept
+{
+    Register result = splatRegister<Register>(coefficients[0]);
+    for (USize index = 1; index < Count; ++index)
+    {
+        result = simd::madd(result, x, splatRegister<Register>(coefficients[index]));
+    }
+    return result;
+}
+
+/// @brief Rounds to the nearest integer, halfway cases away from zero.
+[[nodiscard]] constexpr Int32 roundToInt(const Float32 value) noexcept
+{
+    return static_cast<Int32>(value < 0.0f ? value - 0.5f : value + 0.5f);
+}
+
+/// @brief Returns the sine of @p value moved by a number of quarter turns, 1 giving the cosine.
+[[nodiscard]] constexpr Float32 evaluateSine(const Float32 value, const Int32 quarterTurns) noexcept
+{
+    // The value is reduced to [-pi / 4, pi / 4], the quadrant picking the polynomial and the sign.
+    const Int32 quadrant = roundToInt(value * (2.0f * constants<Float32>::invPi));
+    const Float32 turns = static_cast<Float32>(quadrant);
+    const Float32 reduced = ((value - turns * kHalfPiHigh) - turns * kHalfPiMiddle) - turns * kHalfPiLow;
+    const Float32 squared = reduced * reduced;
+    const Float32 sine = reduced + reduced * squared * evaluatePolynomial(squared, kSinCoefficients);
+    const Float32 cosine = 1.0f - 0.5f * squared + squared * squared * evaluatePolynomial(squared, kCosCoefficients);
+
+    // The phase is the quadrant modulo 4, odd phases taking the cosine and the last two negating the result.
+    const Int32 phase = quadrant + quarterTurns;
+    const Float32 result = (phase & 1) != 0 ? cosine : sine;
+    return (phase & 2) != 0 ? -result : result;
+}
+
+/// @copydoc evaluateSine(const Float32, const Int32)
+template <typename Register>
+[[nodiscard]] GP_FORCEINLINE Register evaluateSine(const Register value, const Float32 quarterTurns) noexcept
+{
+    // The quadrant stays in floats, so that the same code runs on registers without an integer counterpart.
+    const Register turns =
+        simd::roundNearest(simd::mul(value, splatRegister<Register>(2.0f * constants<Float32>::invPi)));
+    Register reduced = simd::nmadd(turns, splatRegister<Register>(kHalfPiHigh), value);
+    reduced = simd::nmadd(turns, splatRegister<Register>(kHalfPiMiddle), reduced);
+    reduced = simd::nmadd(turns, splatRegister<Register>(kHalfPiLow), reduced);
+    const Register squared = simd::mul(reduced, reduced);
+
+    const Register one = splatRegister<Register>(1.0f);
+    const Register sine = simd::madd(
+        simd::mul(reduced, squared), evaluatePolynomial(squared, kSinCoefficients), reduced
+    );
+    const Register cosine = simd::madd(
+        simd::mul(squared, squared),
+        evaluatePolynomial(squared, kCosCoefficients),
+        simd::nmadd(squared, splatRegister<Register>(0.5f), one)
+    );
+
+    // The phase is the quadrant modulo 4, odd phases taking the cosine and the last two negating the result.
+    const Register quadrant = simd::add(turns, splatRegister<Register>(quarterTurns));
+    const Register phase = simd::nmadd(
+        simd::floor(simd::mul(quadrant, splatRegister<Register>(0.25f))), splatRegister<Register>(4.0f), quadrant
+    );
+    const Register isOdd =
+        simd::bitOr(simd::cmpEq(phase, one), simd::cmpEq(phase, splatRegister<Register>(3.0f)));
+    const Register isNegative = simd::cmpGe(phase, splatRegister<Register>(2.0f));
+    return simd::bitXor(
+        simd::select(isOdd, cosine, sine), simd::bitAnd(isNegative, splatRegister<Register>(-0.0f))
+    );
+}
+
+/// @brief Returns two to the power of integer lanes, which must lie in [-126, 127].
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister4f getPowerOfTwo(const simd::VectorRegister4f exponent) noexcept
+{
+    return simd::castToFloat(simd::shiftLeft<23>(simd::add(simd::convertToInt(exponent), simd::splat4i(127))));
+}
+
+/// @copydoc getPowerOfTwo(const simd::VectorRegister4f)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister8f getPowerOfTwo(const simd::VectorRegister8f exponent) noexcept
+{
+    return simd::combine(getPowerOfTwo(simd::getLow(exponent)), getPowerOfTwo(simd::getHigh(exponent)));
+}
+
+/// @brief Splits positive normal lanes into their exponent and their mantissa in [1, 2).
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister4f
+    splitExponent(const simd::VectorRegister4f value, simd::VectorRegister4f& outMantissa) noexcept
+{
+    const simd::VectorRegister4i bits = simd::castToInt(value);
+    outMantissa = simd::castToFloat(
+        simd::bitOr(simd::bitAnd(bits, simd::splat4i(0x007FFFFF)), simd::splat4i(0x3F800000))
+    );
+    return simd::convertToFloat(simd::sub(simd::shiftRightLogical<23>(bits), simd::splat4i(127)));
+}
+
+/// @copydoc splitExponent(const simd::VectorRegister4f, simd::VectorRegister4f&)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister8f
+    splitExponent(const simd::VectorRegister8f value, simd::VectorRegister8f& outMantissa) noexcept
+{
+    simd::VectorRegister4f lowMantissa;
+    simd::VectorRegister4f highMantissa;
+    const simd::VectorRegister4f lowExponent = splitExponent(simd::getLow(value), lowMantissa);
+    const simd::VectorRegister4f highExponent = splitExponent(simd::getHigh(value), highMantissa);
+    outMantissa = simd::combine(lowMantissa, highMantissa);
+    return simd::combine(lowExponent, highExponent);
+}
+
+/// @brief Returns the natural exponential of the lanes of @p value.
+template <typename Register>
+[[nodiscard]] GP_FORCEINLINE Register evaluateExp(const Register value) noexcept
+{
+    // exp(x) = 2^n * exp(r), with n the nearest integer to x / ln 2 and r in [-ln 2 / 2, ln 2 / 2].
+    const Register clamped = simd::min(
+        simd::max(value, splatRegister<Register>(kExpMin)), splatRegister<Register>(kExpMax)
+    );
+    const Register exponent =
+        simd::roundNearest(simd::mul(clamped, splatRegister<Register>(constants<Float32>::log2E)));
+    Register reduced = simd::nmadd(exponent, splatRegister<Register>(kLn2High), clamped);
+    reduced = simd::nmadd(exponent, splatRegister<Register>(kLn2Low), reduced);
+    const Register result = simd::madd(
+        simd::mul(reduced, reduced),
+        evaluatePolynomial(reduced, kExpCoefficients),
+        simd::add(reduced, splatRegister<Register>(1.0f))
+    );
+    return simd::mul(result, getPowerOfTwo(exponent));
+}
+
+/// @brief Returns the natural logarithm of the lanes of @p value.
+template <typename Register>
+[[nodiscard]] GP_FORCEINLINE Register evaluateLog(const Register value) noexcept
+{
+    // log(x) = e * ln 2 + log(m), with the mantissa m moved to [sqrt(2) / 2, sqrt(2)] around 1.
+    Register mantissa;
+    Register exponent = splitExponent(value, mantissa);
+    const Register isLarge = simd::cmpGt(mantissa, splatRegister<Register>(constants<Float32>::sqrt2));
+    mantissa = simd::select(isLarge, simd::mul(mantissa, splatRegister<Register>(0.5f)), mantissa);
+    exponent = simd::add(exponent, simd::bitAnd(isLarge, splatRegister<Register>(1.0f)));
+
+    const Register reduced = simd::sub(mantissa, splatRegister<Register>(1.0f));
+    const Register squared = simd::mul(reduced, reduced);
+    Register result = simd::mul(simd::mul(reduced, squared), evaluatePolynomial(reduced, kLogCoefficients));
+    result = simd::madd(exponent, splatRegister<Register>(kLn2Low), result);
+    result = simd::nmadd(squared, splatRegister<Register>(0.5f), result);
+    return simd::madd(exponent, splatRegister<Register>(kLn2High), simd::add(reduced, result));
+}
+
+/// @brief Returns the angle of the points (x, y) of the lanes of @p x and @p y.
+template <typename Register>
+[[nodiscard]] GP_FORCEINLINE Register evaluateAtan2(const Register y, const Register x) noexcept
+{
+    // The ratio of the smaller coordinate to the larger one is in [0, 1], folded around tan(pi / 8), and the octant
+    // of the point is restored from the order and the signs of the coordinates.
+    const Register zero = splatRegister<Register>(0.0f);
+    const Register one = splatRegister<Register>(1.0f);
+    const Register absY = simd::abs(y);
+    const Register absX = simd::abs(x);
+    const Register largest = simd::max(absX, absY);
+    Register ratio = simd::select(simd::cmpGt(largest, zero), simd::div(simd::min(absX, absY), largest), zero);
+    const Register isFolded = simd::cmpGt(ratio, splatRegister<Register>(constants<Float32>::sqrt2 - 1.0f));
+    ratio = simd::select(isFolded, simd::div(simd::sub(ratio, one), simd::add(ratio, one)), ratio);
+
+    const Register squared = simd::mul(ratio, ratio);
+    Register angle = simd::madd(simd::mul(ratio, squared), evaluatePolynomial(squared, kAtanCoefficients), ratio);
+    angle = simd::add(angle, simd::bitAnd(isFolded, splatRegister<Register>(constants<Float32>::quarterPi)));
+    angle = simd::select(
+        simd::cmpGt(absY, absX), simd::sub(splatRegister<Register>(constants<Float32>::halfPi), angle), angle
+    );
+    angle = simd::select(
+        simd::cmpLt(x, zero), simd::sub(splatRegister<Register>(constants<Float32>::pi), angle), angle
+    );
+    return simd::bitXor(angle, simd::bitAnd(y, splatRegister<Register>(-0.0f)));
+}
+
+}   // namespace detail
+
+/// @brief Returns an approximation of the sine of an angle.
+/// @param[in] value The angle in radians, best kept within [-8192, 8192].
+/// @return The sine of @p value, within 2 ULP for |value| <= 2 pi.
+[[nodiscard]] constexpr Float32 fastSin(const Float32 value) noexcept
+{
+    return detail::evaluateSine(value, 0);
+}
+
+/// @copydoc fastSin(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister4f fastSin(const simd::VectorRegister4f value) noexcept
+{
+    return detail::evaluateSine(value, 0.0f);
+}
+
+/// @copydoc fastSin(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister8f fastSin(const simd::VectorRegister8f value) noexcept
+{
+    return detail::evaluateSine(value, 0.0f);
+}
+
+/// @brief Returns an approximation of the cosine of an angle.
+/// @param[in] value The angle in radians, best kept within [-8192, 8192].
+/// @return The cosine of @p value, within 2 ULP for |value| <= 2 pi.
+[[nodiscard]] constexpr Float32 fastCos(const Float32 value) noexcept
+{
+    return detail::evaluateSine(value, 1);
+}
+
+/// @copydoc fastCos(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister4f fastCos(const simd::VectorRegister4f value) noexcept
+{
+    return detail::evaluateSine(value, 1.0f);
+}
+
+/// @copydoc fastCos(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister8f fastCos(const simd::VectorRegister8f value) noexcept
+{
+    return detail::evaluateSine(value, 1.0f);
+}
+
+/// @brief Returns an approximation of the angle of the point (x, y), in [-pi, pi].
+/// @param[in] y The ordinate of the point.
+/// @param[in] x The abscissa of the point, a zero being treated as positive.
+/// @return The angle from the x axis to the point, within 3 ULP.
+[[nodiscard]] constexpr Float32 fastAtan2(const Float32 y, const Float32 x) noexcept
+{
+    const Float32 absY = y < 0.0f ? -y : y;
+    const Float32 absX = x < 0.0f ? -x : x;
+    const Float32 largest = absX > absY ? absX : absY;
+    Float32 ratio = largest > 0.0f ? (absX > absY ? absY : absX) / largest : 0.0f;
+    Float32 angle = 0.0f;
+    if (ratio > constants<Float32>::sqrt2 - 1.0f)
+    {
+        ratio = (ratio - 1.0f) / (ratio + 1.0f);
+        angle = constants<Float32>::quarterPi;
+    }
+
+    const Float32 squared = ratio * ratio;
+    angle += ratio + ratio * squared * detail::evaluatePolynomial(squared, detail::kAtanCoefficients);
+    angle = absY > absX ? constants<Float32>::halfPi - angle : angle;
+    angle = x < 0.0f ? constants<Float32>::pi - angle : angle;
+    return std::bit_cast<Float32>(std::bit_cast<UInt32>(angle) ^ (std::bit_cast<UInt32>(y) & 0x80000000u));
+}
+
+/// @copydoc fastAtan2(const Float32, const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister4f
+    fastAtan2(const simd::VectorRegister4f y, const simd::VectorRegister4f x) noexcept
+{
+    return detail::evaluateAtan2(y, x);
+}
+
+/// @copydoc fastAtan2(const Float32, const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister8f
+    fastAtan2(const simd::VectorRegister8f y, const simd::VectorRegister8f x) noexcept
+{
+    return detail::evaluateAtan2(y, x);
+}
+
+/// @brief Returns an approximation of the natural exponential of a value.
+/// @param[in] value The exponent, clamped to [-126 ln 2, 127 ln 2] so that the result is a normal float.
+/// @return e raised to the power @p value, within 2 ULP.
+[[nodiscard]] constexpr Float32 fastExp(const Float32 value) noexcept
+{
+    const Float32 clamped = math::clamp(value, detail::kExpMin, detail::kExpMax);
+    const Int32 exponent = detail::roundToInt(clamped * constants<Float32>::log2E);
+    const Float32 scale = static_cast<Float32>(exponent);
+    const Float32 reduced = (clamped - scale * detail::kLn2High) - scale * detail::kLn2Low;
+    const Float32 result =
+        reduced * reduced * detail::evaluatePolynomial(reduced, detail::kExpCoefficients) + reduced + 1.0f;
+    return result * std::bit_cast<Float32>(static_cast<UInt32>(exponent + 127) << 23);
+}
+
+/// @copydoc fastExp(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister4f fastExp(const simd::VectorRegister4f value) noexcept
+{
+    return detail::evaluateExp(value);
+}
+
+/// @copydoc fastExp(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister8f fastExp(const simd::VectorRegister8f value) noexcept
+{
+    return detail::evaluateExp(value);
+}
+
+/// @brief Returns an approximation of the natural logarithm of a value.
+/// @param[in] value The value, must be positive and normal.
+/// @return The natural logarithm of @p value, within 1 ULP.
+[[nodiscard]] constexpr Float32 fastLog(const Float32 value) noexcept
+{
+    const UInt32 bits = std::bit_cast<UInt32>(value);
+    Float32 exponent = static_cast<Float32>(static_cast<Int32>(bits >> 23) - 127);
+    Float32 mantissa = std::bit_cast<Float32>((bits & 0x007FFFFFu) | 0x3F800000u);
+    if (mantissa > constants<Float32>::sqrt2)
+    {
+        mantissa *= 0.5f;
+        exponent += 1.0f;
+    }
+
+    const Float32 reduced = mantissa - 1.0f;
+    const Float32 squared = reduced * reduced;
+    const Float32 result = reduced * squared * detail::evaluatePolynomial(reduced, detail::kLogCoefficients)
+                         + exponent * detail::kLn2Low - 0.5f * squared;
+    return reduced + result + exponent * detail::kLn2High;
+}
+
+/// @copydoc fastLog(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister4f fastLog(const simd::VectorRegister4f value) noexcept
+{
+    return detail::evaluateLog(value);
+}
+
+/// @copydoc fastLog(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister8f fastLog(const simd::VectorRegister8f value) noexcept
+{
+    return detail::evaluateLog(value);
+}
+
+/// @brief Returns an approximation of the reciprocal of the square root of a value.
+/// @details Goes through simd::rsqrt(): the hardware estimate refined by one Newton step on x86, two on NEON, and
+/// the exact value on the scalar fallback.
+/// @param[in] value The value, must be positive or zero.
+/// @return The reciprocal of the square root of @p value, within 4 ULP, or infinity for zero.
+[[nodiscard]] GP_FORCEINLINE Float32 fastInverseSqrt(const Float32 value) noexcept
+{
+    return simd::getLane<0>(simd::rsqrt(simd::splat4f(value)));
+}
+
+/// @copydoc fastInverseSqrt(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister4f fastInverseSqrt(const simd::VectorRegister4f value) noexcept
+{
+    return simd::rsqrt(value);
+}
+
+/// @copydoc fastInverseSqrt(const Float32)
+[[nodiscard]] GP_FORCEINLINE simd::VectorRegister8f fastInverseSqrt(const simd::VectorRegister8f value) noexcept
+{
+    return simd::rsqrt(value);
+}
+
+}   // namespace gp::math
@@ -291,6 +291,26 @@ template <concepts::IsUnsignedIntegral T>
     return static_cast<T>(std::countl_zero(value));
 }
 
+/// @brief Counts the number of trailing zeros in an unsigned integer value.
+/// @tparam T An unsigned integer type.
+/// @param[in] value The value to count trailing zeros for.
+/// @return The number of trailing zero bits in @p value. Returns the bit width of T if @p value is 0.
+template <concepts::IsUnsignedIntegral T>
+[[nodiscard]] constexpr inline T countTrailingZeros(T value) noexcept
+{
+    return static_cast<T>(std::countr_zero(value));
+}
+
+/// @brief Counts the number of set bits in an unsigned integer value.
+/// @tparam T An unsigned integer type.
+/// @param[in] value The value to count set bits for.
+/// @return The number of one bits in @p value.
+template <concepts::IsUnsignedIntegral T>
+[[nodiscard]] constexpr inline T popCount(T value) noexcept
+{
+    return static_cast<T>(std::popcount(value));
+}
+
 /// @brief Rounds the given number up to the next highest power of two.
 /// @tparam T An unsigned integer type.
 /// @param[in] value The value to round up.
@@ -0,0 +1,204 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/geometry/primitives/BoundingStreams.hpp"
+#include "maths/geometry/primitives/Ray.hpp"
+#include "maths/geometry/primitives/Triangle.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/vector/Vector3.hpp"
+
+namespace gp::math
+{
+
+/// @brief A node of a binary bounding volume hierarchy, 32 bytes for Float32 bounds.
+/// @details
+/// Interior nodes reference their first child, the second one always follows it. Leaves reference a contiguous range
+/// of primitives, in the order of Bvh::getPrimitiveIndices().
+/// @tparam T The floating-point type of the bounds.
+template <concepts::IsFloatingPoint T>
+struct alignas(sizeof(T) * 8) BvhNode
+{
+    Vector3<T> boundsMin;   //<! The minimum corner of the box bounding every primitive below the node.
+    Vector3<T> boundsMax;   //<! The maximum corner of the box bounding every primitive below the node.
+    Int32 index;            //<! The first child of an interior node, or the first primitive of a leaf.
+    Int32 count;            //<! The number of primitives of a leaf, zero for interior nodes.
+
+    /// @brief Checks whether the node is a leaf, which references primitives instead of children.
+    [[nodiscard]] constexpr bool isLeaf() const noexcept
+    {
+        return count > 0;
+    }
+};
+
+static_assert(sizeof(BvhNode<Float32>) == 32, "BvhNode<Float32> must fit two nodes per cache line");
+
+/// @brief A subtree of a bounding volume hierarchy that can be built independently, see Bvh::beginBuild().
+struct BvhBuildTask
+{
+    Int32 node;        //<! The root of the subtree, already allocated and bounded by Bvh::beginBuild().
+    Int32 first;       //<! The first primitive of the subtree, in the order of Bvh::getPrimitiveIndices().
+    Int32 count;       //<! The number of primitives of the subtree.
+    Int32 depth;       //<! The depth of the root of the subtree, zero for the root of the hierarchy.
+    Int32 firstNode;   //<! The first node of the range reserved to the descendants of the root.
+    Int32 nodeCount;   //<! The number of descendants written by Bvh::buildSubtree().
+};
+
+/// @brief A binary bounding volume hierarchy template, built with the binned surface area heuristic.
+/// @details
+/// The hierarchy lives in storage owned by the caller: a node array holding at least getMaxNodeCount() nodes, and a
+/// primitive index array holding one index per primitive. Once built, the primitive indices give the order in which
+/// the leaves reference the primitives: the triangles handed to the queries must be gathered in this order, so that
+/// every leaf tests a contiguous range with the batch queries of Ray. Queries report the original primitive indices.
+///
+/// Nodes are allocated breadth-first within each build task, children always after their parent. Splits only depend
+/// on the primitives: building serially or in parallel gives the same tree and primitive order, only the order of
+/// the nodes differs. Leaves hold at most kMaxLeafSize primitives, except at kMaxDepth where splitting stops, which
+/// bounds the traversal stacks.
+/// @tparam T The floating-point type of the bounds.
+template <concepts::IsFloatingPoint T>
+class Bvh
+{
+public:
+    static constexpr Int32 kBinCount = 16;               //<! Number of bins per axis, candidate splits plus one.
+    static constexpr Int32 kMaxLeafSize = 8;             //<! Number of primitives above which a node is split.
+    static constexpr Int32 kMaxDepth = 64;               //<! Depth at which nodes become leaves whatever their size.
+    static constexpr Int32 kDefaultMinTaskSize = 1024;   //<! Number of primitives under which a task is not split.
+    static constexpr T kTraversalCost = T{ 1 };          //<! Cost of visiting a node, relative to a primitive test.
+
+private:
+    VectorView<BvhNode<T>> m_nodes;   //<! The node storage, the root being the first node.
+    VectorView<Int32> m_primitives;   //<! The original index of each primitive, in the order of the leaves.
+    Int32 m_nodeCount{ 0 };           //<! The number of nodes in use.
+
+public:
+    /// @brief Returns the number of nodes that a hierarchy over @p primitiveCount primitives may need.
+    [[nodiscard]] static constexpr Int32 getMaxNodeCount(const Int32 primitiveCount) noexcept
+    {
+        return primitiveCount > 0 ? 2 * primitiveCount - 1 : 1;
+    }
+
+public:
+    /// @brief Default constructor initializes to a hierarchy without storage.
+    [[nodiscard]] constexpr Bvh() noexcept = default;
+
+    /// @brief Constructor with the storage of the hierarchy, which is empty until built.
+    /// @param[in] nodes The node storage, holding at least getMaxNodeCount() nodes.
+    /// @param[in] primitiveIndices The primitive index storage, holding one index per primitive.
+    [[nodiscard]] constexpr Bvh(VectorView<BvhNode<T>> nodes, VectorView<Int32> primitiveIndices) noexcept
+        : m_nodes(nodes)
+        , m_primitives(primitiveIndices)
+    {
+        GP_ASSERT(nodes.size() >= getMaxNodeCount(primitiveIndices.size()), "Bvh() requires getMaxNodeCount() nodes");
+    }
+
+public:
+    /// @brief Returns the nodes in use, the root being the first one.
+    [[nodiscard]] constexpr ConstVectorView<BvhNode<T>> getNodes() const noexcept
+    {
+        return m_nodes.first(m_nodeCount);
+    }
+
+    /// @brief Returns the original index of each primitive, in the order in which the leaves reference them.
+    [[nodiscard]] constexpr ConstVectorView<Int32> getPrimitiveIndices() const noexcept
+    {
+        return m_primitives;
+    }
+
+    /// @brief Returns the number of nodes in use.
+    [[nodiscard]] constexpr Int32 getNodeCount() const noexcept
+    {
+        return m_nodeCount;
+    }
+
+    /// @brief Returns the number of primitives of the hierarchy.
+    [[nodiscard]] constexpr Int32 getPrimitiveCount() const noexcept
+    {
+        return m_primitives.size();
+    }
+
+public:
+    /// @brief Builds the hierarchy on the calling thread.
+    /// @param[in] bounds The bounding box of each primitive, in their original order.
+    void build(const BoundingBoxStreams<T>& bounds) noexcept;
+
+    /// @brief Builds the upper levels of the hierarchy and splits the rest into independent subtrees.
+    /// @details
+    /// Lets the hierarchy be built across worker threads: once this returns, buildSubtree() can run concurrently on
+    /// every task, as the subtrees share no primitive and write to disjoint node ranges, then endBuild() compacts
+    /// the nodes. Nodes are split breadth-first until the next one is smaller than @p minTaskSize primitives or
+    /// splitting it would give more subtrees than @p outTasks holds.
+    /// @param[in] bounds The bounding box of each primitive, in their original order.
+    /// @param[out] outTasks The subtrees left to build, sized with the number of tasks wanted, such as a few per
+    /// worker thread.
+    /// @param[in] minTaskSize Number of primitives under which a subtree is built by a single task.
+    /// @return The number of tasks written to @p outTasks.
+    Int32 beginBuild(
+        const BoundingBoxStreams<T>& bounds,
+        VectorView<BvhBuildTask> outTasks,
+        const Int32 minTaskSize = kDefaultMinTaskSize
+    ) noexcept;
+
+    /// @brief Builds a subtree returned by beginBuild(), safe to call concurrently for different tasks.
+    /// @param[in] bounds The bounding box of each primitive, in their original order.
+    /// @param[in,out] task The subtree to build, whose node count is written.
+    void buildSubtree(const BoundingBoxStreams<T>& bounds, BvhBuildTask& task) noexcept;
+
+    /// @brief Finishes a parallel build, once every subtree was built.
+    /// @param[in] tasks The tasks returned by beginBuild(), in the same order.
+    void endBuild(ConstVectorView<BvhBuildTask> tasks) noexcept;
+
+    /// @brief Updates the bounds of every node after the primitives moved, keeping the topology.
+    /// @details
+    /// Much cheaper than a rebuild for animated geometry, but the hierarchy gets less efficient as the primitives move
+    /// away from their position at build time: rebuild it when the motion is large. Wide hierarchies collapsed from
+    /// this one must be collapsed again.
+    /// @param[in] bounds The new bounding box of each primitive, in their original order.
+    void refit(const BoundingBoxStreams<T>& bounds) noexcept;
+
+public:
+    /// @brief Finds the closest intersection of a ray with the triangles of the hierarchy.
+    /// @param[in] ray The ray.
+    /// @param[in] triangles The triangles, gathered in the order of getPrimitiveIndices().
+    /// @param[in,out] hit Only intersections closer than its distance are reported. Updated with the closest
+    /// intersection and the original index of its triangle.
+    /// @return True if a triangle was hit, in which case @p hit was updated.
+    bool intersectClosest(const Ray<T>& ray, const TriangleStreams<T>& triangles, RayHit<T>& hit) const noexcept;
+
+    /// @brief Checks whether a ray hits any triangle of the hierarchy, stopping at the first hit found.
+    /// @param[in] ray The ray.
+    /// @param[in] triangles The triangles, gathered in the order of getPrimitiveIndices().
+    /// @param[in] maxDistance Intersections at this distance or farther are ignored.
+    /// @return True if at least one triangle is hit before @p maxDistance.
+    [[nodiscard]] bool
+        intersectsAny(const Ray<T>& ray, const TriangleStreams<T>& triangles, const T maxDistance) const noexcept;
+
+private:
+    /// @brief Computes the box bounding a range of primitives, in the order of the leaves.
+    void computeBounds(
+        const BoundingBoxStreams<T>& bounds,
+        const Int32 first,
+        const Int32 count,
+        Vector3<T>& outMin,
+        Vector3<T>& outMax
+    ) const noexcept;
+
+    /// @brief Splits a node still referencing its primitives, along the plane of lowest surface area heuristic cost.
+    /// @param[in] bounds The bounding box of each primitive, in their original order.
+    /// @param[in] node The node to split.
+    /// @param[in] depth The depth of the node.
+    /// @param[in] firstChild The node where the first child is written, the second one following it.
+    /// @return False if the node stays a leaf.
+    bool splitNode(const BoundingBoxStreams<T>& bounds, const Int32 node, const Int32 depth, const Int32 firstChild)
+        noexcept;
+};
+
+}   // namespace gp::math
+
+// Include the implementation of the Bvh template
+#include "maths/geometry/acceleration/Bvh.inl"
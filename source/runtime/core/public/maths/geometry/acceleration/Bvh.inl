@@ -0,0 +1,560 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "maths/base/Constants.hpp"
+#include "maths/base/Scalar.hpp"
+#include "maths/geometry/acceleration/Bvh.hpp"
+#include <utility>
+
+namespace gp::math
+{
+
+namespace detail
+{
+
+/// @brief The bounds and the number of the primitives whose centroid falls in a bin of the surface area heuristic.
+template <concepts::IsFloatingPoint T>
+struct BvhBin
+{
+    Vector3<T> boundsMin{ constants<T>::infinity };    //<! The minimum corner of the bounds, infinite when empty.
+    Vector3<T> boundsMax{ -constants<T>::infinity };   //<! The maximum corner of the bounds, infinite when empty.
+    Int32 count{ 0 };                                  //<! The number of primitives in the bin.
+
+    constexpr void grow(const Vector3<T>& primitiveMin, const Vector3<T>& primitiveMax) noexcept
+    {
+        boundsMin = math::min(boundsMin, primitiveMin);
+        boundsMax = math::max(boundsMax, primitiveMax);
+        ++count;
+    }
+
+    constexpr void merge(const BvhBin<T>& other) noexcept
+    {
+        boundsMin = math::min(boundsMin, other.boundsMin);
+        boundsMax = math::max(boundsMax, other.boundsMax);
+        count += other.count;
+    }
+};
+
+/// @brief A node left to visit by a traversal, with the distance at which the ray enters it.
+template <concepts::IsFloatingPoint T>
+struct BvhStackEntry
+{
+    Int32 node;
+    T distance;
+};
+
+/// @brief Returns half the surface area of a box, which is proportional to the probability that a ray hits it.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr T getHalfArea(const Vector3<T>& boundsMin, const Vector3<T>& boundsMax) noexcept
+{
+    const Vector3<T> size = boundsMax - boundsMin;
+    return size.x * size.y + size.y * size.z + size.z * size.x;
+}
+
+/// @brief Gathers the vector at @p index from its streams.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Vector3<T> loadVector(const ConstVectorView<T> (&streams)[3], const Int32 index) noexcept
+{
+    return Vector3<T>(streams[0][index], streams[1][index], streams[2][index]);
+}
+
+/// @brief Checks whether every stream of a batch of boxes holds @p count values.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr bool hasStreamsOfSize(const BoundingBoxStreams<T>& boxes, const Int32 count) noexcept
+{
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        if (boxes.centers[axis].size() != count || boxes.extents[axis].size() != count)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Returns the bin of the surface area heuristic where a centroid coordinate falls.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Int32 getBvhBin(const T coordinate, const T centroidMin, const T scale) noexcept
+{
+    return math::min(static_cast<Int32>((coordinate - centroidMin) * scale), Bvh<T>::kBinCount - 1);
+}
+
+/// @brief Returns the inverse of each component of the direction of a ray, infinite for zero components.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Vector3<T> getInverseDirection(const Ray<T>& ray) noexcept
+{
+    return Vector3<T>(T{ 1 } / ray.direction.x, T{ 1 } / ray.direction.y, T{ 1 } / ray.direction.z);
+}
+
+/// @brief Intersects a ray with the bounds of a node, with the slab method.
+/// @param[out] outDistance The distance at which the ray enters the node, zero when it starts inside.
+/// @return True if the ray enters the node before @p maxDistance.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr bool intersectsNode(
+    const Vector3<T>& origin,
+    const Vector3<T>& inverseDirection,
+    const BvhNode<T>& node,
+    const T maxDistance,
+    T& outDistance
+) noexcept
+{
+    const Vector3<T> entries = (node.boundsMin - origin) * inverseDirection;
+    const Vector3<T> exits = (node.boundsMax - origin) * inverseDirection;
+    const T entryDistance = math::max(T{ 0 }, math::min(entries, exits).getMax());
+    const T exitDistance = math::min(maxDistance, math::max(entries, exits).getMin());
+    outDistance = entryDistance;
+    return entryDistance <= exitDistance && entryDistance < maxDistance;
+}
+
+/// @brief Returns the streams of @p count triangles starting at @p first.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr TriangleStreams<T>
+    sliceTriangles(const TriangleStreams<T>& triangles, const Int32 first, const Int32 count) noexcept
+{
+    TriangleStreams<T> slice;
+    for (Int32 vertex = 0; vertex < 3; ++vertex)
+    {
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            slice.vertices[vertex][axis] = triangles.vertices[vertex][axis].slice(first, count);
+        }
+    }
+    return slice;
+}
+
+/// @brief Updates @p hit with the closest intersection of a ray with the triangles of a leaf.
+/// @param[in] primitives The original index of each triangle, in the order of the leaves.
+/// @return True if a triangle of the leaf was hit, in which case @p hit was updated.
+template <concepts::IsFloatingPoint T>
+bool intersectLeaf(
+    const Ray<T>& ray,
+    const TriangleStreams<T>& triangles,
+    ConstVectorView<Int32> primitives,
+    const Int32 first,
+    const Int32 count,
+    RayHit<T>& hit
+) noexcept
+{
+    RayHit<T> leafHit = hit;
+    if (!ray.intersectTriangles(sliceTriangles(triangles, first, count), leafHit))
+    {
+        return false;
+    }
+    hit = leafHit;
+    hit.index = primitives[first + leafHit.index];
+    return true;
+}
+
+}   // namespace detail
+
+template <concepts::IsFloatingPoint T>
+void Bvh<T>::build(const BoundingBoxStreams<T>& bounds) noexcept
+{
+    // A single task covers the whole hierarchy.
+    BvhBuildTask task;
+    beginBuild(bounds, VectorView<BvhBuildTask>(&task, 1));
+    buildSubtree(bounds, task);
+    endBuild(ConstVectorView<BvhBuildTask>(&task, 1));
+}
+
+template <concepts::IsFloatingPoint T>
+Int32 Bvh<T>::beginBuild(
+    const BoundingBoxStreams<T>& bounds, VectorView<BvhBuildTask> outTasks, const Int32 minTaskSize
+) noexcept
+{
+    const Int32 count = m_primitives.size();
+    GP_ASSERT(detail::hasStreamsOfSize(bounds, count), "beginBuild() requires one bounding box per primitive");
+    GP_ASSERT(!outTasks.isEmpty(), "beginBuild() requires room for at least one task");
+
+    for (Int32 index = 0; index < count; ++index)
+    {
+        m_primitives[index] = index;
+    }
+    BvhNode<T>& root = m_nodes[0];
+    computeBounds(bounds, 0, count, root.boundsMin, root.boundsMax);
+    root.index = 0;
+    root.count = count;
+
+    // Nodes still referencing their primitives are split breadth-first, the ones left become the roots of the tasks.
+    Int32 nodeCount = 1;
+    Int32 taskCount = 0;
+    Int32 depth = 0;
+    for (Int32 node = 0, levelEnd = 1; node < nodeCount; ++node)
+    {
+        if (node == levelEnd)
+        {
+            ++depth;
+            levelEnd = nodeCount;
+        }
+
+        const BvhNode<T>& current = m_nodes[node];
+        const Int32 openCount = taskCount + nodeCount - node;
+        if (current.count > minTaskSize && openCount < outTasks.size())
+        {
+            if (splitNode(bounds, node, depth, nodeCount))
+            {
+                nodeCount += 2;
+            }
+            continue;
+        }
+        outTasks[taskCount++] = BvhBuildTask{ node, current.index, current.count, depth, 0, 0 };
+    }
+
+    // A subtree of n primitives has at most 2n - 2 descendants, reserved after the upper levels.
+    Int32 firstNode = nodeCount;
+    for (BvhBuildTask& task : outTasks.first(taskCount))
+    {
+        task.firstNode = firstNode;
+        firstNode += math::max(0, 2 * task.count - 2);
+    }
+    m_nodeCount = nodeCount;
+    return taskCount;
+}
+
+template <concepts::IsFloatingPoint T>
+void Bvh<T>::buildSubtree(const BoundingBoxStreams<T>& bounds, BvhBuildTask& task) noexcept
+{
+    GP_ASSERT(detail::hasStreamsOfSize(bounds, m_primitives.size()), "buildSubtree() requires one box per primitive");
+
+    Int32 nodeCount = task.firstNode;
+    if (splitNode(bounds, task.node, task.depth, nodeCount))
+    {
+        nodeCount += 2;
+    }
+
+    Int32 depth = task.depth + 1;
+    for (Int32 node = task.firstNode, levelEnd = nodeCount; node < nodeCount; ++node)
+    {
+        if (node == levelEnd)
+        {
+            ++depth;
+            levelEnd = nodeCount;
+        }
+        if (splitNode(bounds, node, depth, nodeCount))
+        {
+            nodeCount += 2;
+        }
+    }
+    task.nodeCount = nodeCount - task.firstNode;
+}
+
+template <concepts::IsFloatingPoint T>
+void Bvh<T>::endBuild(ConstVectorView<BvhBuildTask> tasks) noexcept
+{
+    // The ranges reserved to the subtrees are moved down to close the gaps left by their unused nodes.
+    Int32 nodeCount = m_nodeCount;
+    for (const BvhBuildTask& task : tasks)
+    {
+        GP_ASSERT(task.firstNode >= nodeCount, "endBuild() requires the tasks in the order of beginBuild()");
+        const Int32 offset = task.firstNode - nodeCount;
+        if (offset > 0)
+        {
+            for (Int32 node = 0; node < task.nodeCount; ++node)
+            {
+                BvhNode<T>& moved = m_nodes[nodeCount + node];
+                moved = m_nodes[task.firstNode + node];
+                if (!moved.isLeaf())
+                {
+                    moved.index -= offset;
+                }
+            }
+            if (!m_nodes[task.node].isLeaf())
+            {
+                m_nodes[task.node].index -= offset;
+            }
+        }
+        nodeCount += task.nodeCount;
+    }
+    m_nodeCount = nodeCount;
+}
+
+template <concepts::IsFloatingPoint T>
+void Bvh<T>::refit(const BoundingBoxStreams<T>& bounds) noexcept
+{
+    GP_ASSERT(detail::hasStreamsOfSize(bounds, m_primitives.size()), "refit() requires one box per primitive");
+    if (m_primitives.isEmpty())
+    {
+        return;
+    }
+
+    // Children always come after their parent, so a reverse sweep visits them first.
+    for (Int32 node = m_nodeCount - 1; node >= 0; --node)
+    {
+        BvhNode<T>& current = m_nodes[node];
+        if (current.isLeaf())
+        {
+            computeBounds(bounds, current.index, current.count, current.boundsMin, current.boundsMax);
+            continue;
+        }
+        const BvhNode<T>& left = m_nodes[current.index];
+        const BvhNode<T>& right = m_nodes[current.index + 1];
+        current.boundsMin = math::min(left.boundsMin, right.boundsMin);
+        current.boundsMax = math::max(left.boundsMax, right.boundsMax);
+    }
+}
+
+template <concepts::IsFloatingPoint T>
+bool Bvh<T>::intersectClosest(const Ray<T>& ray, const TriangleStreams<T>& triangles, RayHit<T>& hit) const noexcept
+{
+    GP_ASSERT(detail::hasStreamsOfSize(triangles, m_primitives.size()), "intersectClosest() requires every triangle");
+    if (m_primitives.isEmpty())
+    {
+        return false;
+    }
+
+    const Vector3<T> inverseDirection = detail::getInverseDirection(ray);
+    detail::BvhStackEntry<T> stack[kMaxDepth];
+    Int32 stackSize = 0;
+    T distance;
+    if (detail::intersectsNode(ray.origin, inverseDirection, m_nodes[0], hit.distance, distance))
+    {
+        stack[stackSize++] = { 0, distance };
+    }
+
+    bool isHit = false;
+    while (stackSize > 0)
+    {
+        const detail::BvhStackEntry<T> entry = stack[--stackSize];
+        if (entry.distance >= hit.distance)
+        {
+            continue;
+        }
+
+        // Descends towards the nearest child until reaching a leaf, leaving the other child for later.
+        Int32 node = entry.node;
+        for (;;)
+        {
+            const BvhNode<T>& current = m_nodes[node];
+            if (current.isLeaf())
+            {
+                isHit |= detail::intersectLeaf(ray, triangles, m_primitives, current.index, current.count, hit);
+                break;
+            }
+
+            const Int32 left = current.index;
+            T leftDistance;
+            T rightDistance;
+            const bool isLeftHit =
+                detail::intersectsNode(ray.origin, inverseDirection, m_nodes[left], hit.distance, leftDistance);
+            const bool isRightHit =
+                detail::intersectsNode(ray.origin, inverseDirection, m_nodes[left + 1], hit.distance, rightDistance);
+            if (isLeftHit && isRightHit)
+            {
+                const bool isLeftFirst = leftDistance <= rightDistance;
+                stack[stackSize++] = isLeftFirst ? detail::BvhStackEntry<T>{ left + 1, rightDistance }
+                                                 : detail::BvhStackEntry<T>{ left, leftDistance };
+                node = isLeftFirst ? left : left + 1;
+            }
+            else if (isLeftHit || isRightHit)
+            {
+                node = isLeftHit ? left : left + 1;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+    return isHit;
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] bool
+    Bvh<T>::intersectsAny(const Ray<T>& ray, const TriangleStreams<T>& triangles, const T maxDistance) const noexcept
+{
+    GP_ASSERT(detail::hasStreamsOfSize(triangles, m_primitives.size()), "intersectsAny() requires every triangle");
+    if (m_primitives.isEmpty())
+    {
+        return false;
+    }
+
+    const Vector3<T> inverseDirection = detail::getInverseDirection(ray);
+    Int32 stack[kMaxDepth];
+    Int32 stackSize = 0;
+    Int32 node = 0;
+    for (;;)
+    {
+        const BvhNode<T>& current = m_nodes[node];
+        T distance;
+        if (detail::intersectsNode(ray.origin, inverseDirection, current, maxDistance, distance))
+        {
+            if (!current.isLeaf())
+            {
+                stack[stackSize++] = current.index + 1;
+                node = current.index;
+                continue;
+            }
+            if (ray.intersectsAnyTriangle(detail::sliceTriangles(triangles, current.index, current.count), maxDistance))
+            {
+                return true;
+            }
+        }
+        if (stackSize == 0)
+        {
+            return false;
+        }
+        node = stack[--stackSize];
+    }
+}
+
+template <concepts::IsFloatingPoint T>
+void Bvh<T>::computeBounds(
+    const BoundingBoxStreams<T>& bounds, const Int32 first, const Int32 count, Vector3<T>& outMin, Vector3<T>& outMax
+) const noexcept
+{
+    outMin = Vector3<T>(constants<T>::infinity);
+    outMax = Vector3<T>(-constants<T>::infinity);
+    for (Int32 index = first; index < first + count; ++index)
+    {
+        const Int32 primitive = m_primitives[index];
+        const Vector3<T> center = detail::loadVector(bounds.centers, primitive);
+        const Vector3<T> extents = detail::loadVector(bounds.extents, primitive);
+        outMin = math::min(outMin, center - extents);
+        outMax = math::max(outMax, center + extents);
+    }
+}
+
+template <concepts::IsFloatingPoint T>
+bool Bvh<T>::splitNode(
+    const BoundingBoxStreams<T>& bounds, const Int32 node, const Int32 depth, const Int32 firstChild
+) noexcept
+{
+    BvhNode<T>& parent = m_nodes[node];
+    const Int32 first = parent.index;
+    const Int32 count = parent.count;
+    if (count <= 1 || depth >= kMaxDepth - 1)
+    {
+        return false;
+    }
+
+    // Primitives are binned by centroid along every axis, between the extreme centroids.
+    Vector3<T> centroidMin(constants<T>::infinity);
+    Vector3<T> centroidMax(-constants<T>::infinity);
+    for (Int32 index = first; index < first + count; ++index)
+    {
+        const Vector3<T> center = detail::loadVector(bounds.centers, m_primitives[index]);
+        centroidMin = math::min(centroidMin, center);
+        centroidMax = math::max(centroidMax, center);
+    }
+    const Vector3<T> centroidSize = centroidMax - centroidMin;
+    Vector3<T> scales;
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        scales[axis] = centroidSize[axis] > T{ 0 } ? static_cast<T>(kBinCount) / centroidSize[axis] : T{ 0 };
+    }
+
+    detail::BvhBin<T> bins[3][kBinCount];
+    for (Int32 index = first; index < first + count; ++index)
+    {
+        const Int32 primitive = m_primitives[index];
+        const Vector3<T> center = detail::loadVector(bounds.centers, primitive);
+        const Vector3<T> extents = detail::loadVector(bounds.extents, primitive);
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            bins[axis][detail::getBvhBin(center[axis], centroidMin[axis], scales[axis])].grow(
+                center - extents, center + extents
+            );
+        }
+    }
+
+    // Sweeping the bins from both ends gives the cost of every split: the area of each side, relative to the one of
+    // the parent, is the probability of visiting it, weighted by its number of primitives.
+    const T parentArea = detail::getHalfArea(parent.boundsMin, parent.boundsMax);
+    const T inverseArea = parentArea > T{ 0 } ? T{ 1 } / parentArea : T{ 0 };
+    T bestCost = constants<T>::infinity;
+    Int32 bestAxis = -1;
+    Int32 bestSplit = 0;
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        if (scales[axis] == T{ 0 })
+        {
+            continue;
+        }
+
+        T rightCosts[kBinCount];
+        Int32 rightCounts[kBinCount];
+        detail::BvhBin<T> side;
+        for (Int32 split = kBinCount - 1; split > 0; --split)
+        {
+            side.merge(bins[axis][split]);
+            rightCounts[split] = side.count;
+            rightCosts[split] = side.count > 0
+                                    ? detail::getHalfArea(side.boundsMin, side.boundsMax) * static_cast<T>(side.count)
+                                    : T{ 0 };
+        }
+
+        side = detail::BvhBin<T>();
+        for (Int32 split = 1; split < kBinCount; ++split)
+        {
+            side.merge(bins[axis][split - 1]);
+            if (side.count == 0 || rightCounts[split] == 0)
+            {
+                continue;
+            }
+            const T leftCost = detail::getHalfArea(side.boundsMin, side.boundsMax) * static_cast<T>(side.count);
+            const T cost = kTraversalCost + (leftCost + rightCosts[split]) * inverseArea;
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = split;
+            }
+        }
+    }
+
+    if (count <= kMaxLeafSize && (bestAxis < 0 || static_cast<T>(count) <= bestCost))
+    {
+        return false;
+    }
+
+    BvhNode<T>& left = m_nodes[firstChild];
+    BvhNode<T>& right = m_nodes[firstChild + 1];
+    Int32 middle = first + count / 2;
+    if (bestAxis >= 0)
+    {
+        Int32 end = first + count;
+        middle = first;
+        while (middle < end)
+        {
+            const T coordinate = bounds.centers[bestAxis][m_primitives[middle]];
+            if (detail::getBvhBin(coordinate, centroidMin[bestAxis], scales[bestAxis]) < bestSplit)
+            {
+                ++middle;
+            }
+            else
+            {
+                std::swap(m_primitives[middle], m_primitives[--end]);
+            }
+        }
+
+        detail::BvhBin<T> leftBin;
+        detail::BvhBin<T> rightBin;
+        for (Int32 bin = 0; bin < kBinCount; ++bin)
+        {
+            (bin < bestSplit ? leftBin : rightBin).merge(bins[bestAxis][bin]);
+        }
+        left.boundsMin = leftBin.boundsMin;
+        left.boundsMax = leftBin.boundsMax;
+        right.boundsMin = rightBin.boundsMin;
+        right.boundsMax = rightBin.boundsMax;
+    }
+    else
+    {
+        // Every centroid is at the same place: the primitives are split in halves, whatever their order.
+        computeBounds(bounds, first, middle - first, left.boundsMin, left.boundsMax);
+        computeBounds(bounds, middle, first + count - middle, right.boundsMin, right.boundsMax);
+    }
+
+    left.index = first;
+    left.count = middle - first;
+    right.index = middle;
+    right.count = first + count - middle;
+    parent.index = firstChild;
+    parent.count = 0;
+    return true;
+}
+
+}   // namespace gp::math
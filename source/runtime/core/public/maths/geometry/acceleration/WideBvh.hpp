@@ -0,0 +1,117 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/geometry/acceleration/Bvh.hpp"
+#include "maths/geometry/primitives/Ray.hpp"
+#include "maths/geometry/primitives/Triangle.hpp"
+#include "maths/MathForward.hpp"
+
+namespace gp::math
+{
+
+/// @brief A node of a wide bounding volume hierarchy, holding the bounds of its children in structure-of-arrays
+/// form so that a ray is tested against all of them at once.
+/// @tparam T The floating-point type of the bounds.
+/// @tparam Width The maximum number of children.
+template <concepts::IsFloatingPoint T, Int32 Width>
+struct alignas(sizeof(T) * Width) WideBvhNode
+{
+    T centers[3][Width];     //<! The center of the box bounding each child, one array per axis.
+    T extents[3][Width];     //<! The half size of the box bounding each child, one array per axis.
+    Int32 children[Width];   //<! The node of each interior child, or the first primitive of each leaf child.
+    Int32 counts[Width];     //<! The number of primitives of each leaf child, zero for interior children.
+    Int32 childCount;        //<! The number of children, the other lanes being unused.
+};
+
+/// @brief A wide bounding volume hierarchy template, collapsed from a binary one for SIMD traversal.
+/// @details
+/// Every node has up to Width children, tested against a ray in a single packet of Ray::intersectBoxes() lanes for
+/// Float32. Collapsing pulls the grandchildren of the largest interior children up until a node is full, which
+/// removes about two levels out of three for Bvh8 and one out of two for Bvh4. The hierarchy keeps referencing the
+/// primitive indices of its binary hierarchy, with the same leaves: the triangles handed to the queries are the ones
+/// of the binary hierarchy, gathered in the same order.
+/// @tparam T The floating-point type of the bounds.
+/// @tparam Width The maximum number of children per node, 4 or 8.
+template <concepts::IsFloatingPoint T, Int32 Width>
+requires(Width == 4 || Width == 8)
+class WideBvh
+{
+public:
+    /// @brief Number of entries of the traversal stacks, one node per level plus the siblings left on the way.
+    static constexpr Int32 kMaxStackSize = Bvh<T>::kMaxDepth * (Width - 1) + 1;
+
+private:
+    VectorView<WideBvhNode<T, Width>> m_nodes;   //<! The node storage, the root being the first node.
+    ConstVectorView<Int32> m_primitives;         //<! The primitive indices of the binary hierarchy.
+    Int32 m_nodeCount{ 0 };                      //<! The number of nodes in use.
+
+public:
+    /// @brief Returns the number of nodes that the collapse of @p bvh may need.
+    [[nodiscard]] static constexpr Int32 getMaxNodeCount(const Bvh<T>& bvh) noexcept
+    {
+        return math::max(1, (bvh.getNodeCount() - 1) / 2);
+    }
+
+public:
+    /// @brief Default constructor initializes to a hierarchy without storage.
+    [[nodiscard]] constexpr WideBvh() noexcept = default;
+
+    /// @brief Constructor with the node storage of the hierarchy, which is empty until collapsed.
+    /// @param[in] nodes The node storage, holding at least getMaxNodeCount() nodes.
+    [[nodiscard]] explicit constexpr WideBvh(VectorView<WideBvhNode<T, Width>> nodes) noexcept
+        : m_nodes(nodes)
+    {}
+
+public:
+    /// @brief Returns the nodes in use, the root being the first one.
+    [[nodiscard]] constexpr ConstVectorView<WideBvhNode<T, Width>> getNodes() const noexcept
+    {
+        return m_nodes.first(m_nodeCount);
+    }
+
+    /// @brief Returns the number of nodes in use.
+    [[nodiscard]] constexpr Int32 getNodeCount() const noexcept
+    {
+        return m_nodeCount;
+    }
+
+public:
+    /// @brief Builds the hierarchy from a binary one, which must outlive it.
+    /// @param[in] bvh The binary hierarchy, built or refit.
+    void collapse(const Bvh<T>& bvh) noexcept;
+
+    /// @brief Finds the closest intersection of a ray with the triangles of the hierarchy.
+    /// @param[in] ray The ray.
+    /// @param[in] triangles The triangles, gathered in the order of Bvh::getPrimitiveIndices().
+    /// @param[in,out] hit Only intersections closer than its distance are reported. Updated with the closest
+    /// intersection and the original index of its triangle.
+    /// @return True if a triangle was hit, in which case @p hit was updated.
+    bool intersectClosest(const Ray<T>& ray, const TriangleStreams<T>& triangles, RayHit<T>& hit) const noexcept;
+
+    /// @brief Checks whether a ray hits any triangle of the hierarchy, stopping at the first hit found.
+    /// @param[in] ray The ray.
+    /// @param[in] triangles The triangles, gathered in the order of Bvh::getPrimitiveIndices().
+    /// @param[in] maxDistance Intersections at this distance or farther are ignored.
+    /// @return True if at least one triangle is hit before @p maxDistance.
+    [[nodiscard]] bool
+        intersectsAny(const Ray<T>& ray, const TriangleStreams<T>& triangles, const T maxDistance) const noexcept;
+};
+
+/// @brief A wide bounding volume hierarchy with four children per node.
+template <concepts::IsFloatingPoint T>
+using Bvh4 = WideBvh<T, 4>;
+
+/// @brief A wide bounding volume hierarchy with eight children per node.
+template <concepts::IsFloatingPoint T>
+using Bvh8 = WideBvh<T, 8>;
+
+}   // namespace gp::math
+
+// Include the implementation of the WideBvh template
+#include "maths/geometry/acceleration/WideBvh.inl"
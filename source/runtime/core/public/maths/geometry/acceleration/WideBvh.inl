@@ -0,0 +1,250 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "maths/base/Scalar.hpp"
+#include "maths/geometry/acceleration/WideBvh.hpp"
+#include "maths/simd/VectorRegister.hpp"
+
+namespace gp::math
+{
+
+namespace detail
+{
+
+/// @brief A node or a leaf left to visit by a wide traversal, with the distance at which the ray enters it.
+template <concepts::IsFloatingPoint T>
+struct WideBvhStackEntry
+{
+    Int32 index;   //<! The node, or the first primitive of a leaf.
+    Int32 count;   //<! The number of primitives of a leaf, zero for a node.
+    T distance;    //<! The distance at which the ray enters the bounds.
+};
+
+/// @brief The ray of a wide traversal, tested against the children of a node one at a time.
+template <concepts::IsFloatingPoint T, Int32 Width>
+struct WideBvhRay
+{
+    const Ray<T>& ray;
+
+    explicit WideBvhRay(const Ray<T>& inRay) noexcept
+        : ray(inRay)
+    {}
+
+    /// @brief Returns the mask of the children hit before @p maxDistance, writing their entry distances.
+    UInt32 intersectChildren(const WideBvhNode<T, Width>& node, const T maxDistance, T (&outDistances)[Width])
+        const noexcept
+    {
+        UInt32 mask = 0;
+        for (Int32 lane = 0; lane < node.childCount; ++lane)
+        {
+            const Vector3<T> center(node.centers[0][lane], node.centers[1][lane], node.centers[2][lane]);
+            const Vector3<T> extents(node.extents[0][lane], node.extents[1][lane], node.extents[2][lane]);
+            if (ray.intersectsBox(center, extents, outDistances[lane], maxDistance))
+            {
+                mask |= 1u << lane;
+            }
+        }
+        return mask;
+    }
+};
+
+/// @brief The Float32 ray of a wide traversal, broadcast to test every child of a node in a single packet.
+template <Int32 Width>
+struct WideBvhRay<Float32, Width>
+{
+    using Register = typename PacketRegister<Width>::Type;
+
+    RayPacket<Width> packet;
+
+    explicit WideBvhRay(const Ray<Float32>& ray) noexcept
+        : packet(ray)
+    {}
+
+    /// @brief Returns the mask of the children hit before @p maxDistance, writing their entry distances.
+    /// @param[out] outDistances Aligned on simd::kRegister8Alignment.
+    UInt32 intersectChildren(
+        const WideBvhNode<Float32, Width>& node, const Float32 maxDistance, Float32 (&outDistances)[Width]
+    ) const noexcept
+    {
+        BoundingBoxStreams<Float32> boxes;
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            boxes.centers[axis] = ConstVectorView<Float32>(node.centers[axis]);
+            boxes.extents[axis] = ConstVectorView<Float32>(node.extents[axis]);
+        }
+
+        Register distance;
+        const Register mask =
+            intersectBoxPacket<Width>(packet, boxes, 0, PacketRegister<Width>::splat(maxDistance), distance);
+        simd::store(outDistances, distance);
+        return simd::moveMask(mask) & ((1u << node.childCount) - 1u);
+    }
+};
+
+}   // namespace detail
+
+template <concepts::IsFloatingPoint T, Int32 Width>
+requires(Width == 4 || Width == 8)
+void WideBvh<T, Width>::collapse(const Bvh<T>& bvh) noexcept
+{
+    GP_ASSERT(bvh.getNodeCount() > 0, "collapse() requires a built hierarchy");
+    GP_ASSERT(m_nodes.size() >= getMaxNodeCount(bvh), "collapse() requires getMaxNodeCount() nodes");
+
+    const ConstVectorView<BvhNode<T>> nodes = bvh.getNodes();
+    m_primitives = bvh.getPrimitiveIndices();
+    m_nodeCount = 1;
+    m_nodes[0] = WideBvhNode<T, Width>{};
+    if (m_primitives.isEmpty())
+    {
+        return;
+    }
+
+    // Nodes are filled breadth-first, each one waiting in the queue with its binary node stored as its first child.
+    for (Int32 node = 0; node < m_nodeCount; ++node)
+    {
+        // The interior candidate of largest area, the most likely to be visited, is replaced by its children until
+        // the node is full.
+        Int32 candidates[Width] = { m_nodes[node].children[0] };
+        Int32 candidateCount = 1;
+        while (candidateCount < Width)
+        {
+            Int32 largest = -1;
+            T largestArea = T{ -1 };
+            for (Int32 candidate = 0; candidate < candidateCount; ++candidate)
+            {
+                const BvhNode<T>& binary = nodes[candidates[candidate]];
+                const T area = detail::getHalfArea(binary.boundsMin, binary.boundsMax);
+                if (!binary.isLeaf() && area > largestArea)
+                {
+                    largest = candidate;
+                    largestArea = area;
+                }
+            }
+            if (largest < 0)
+            {
+                break;
+            }
+            const Int32 firstChild = nodes[candidates[largest]].index;
+            candidates[largest] = firstChild;
+            candidates[candidateCount++] = firstChild + 1;
+        }
+
+        WideBvhNode<T, Width>& current = m_nodes[node];
+        current = WideBvhNode<T, Width>{};
+        current.childCount = candidateCount;
+        for (Int32 lane = 0; lane < candidateCount; ++lane)
+        {
+            const BvhNode<T>& child = nodes[candidates[lane]];
+            const Vector3<T> center = (child.boundsMin + child.boundsMax) * T{ 0.5 };
+            const Vector3<T> extents = (child.boundsMax - child.boundsMin) * T{ 0.5 };
+            for (Int32 axis = 0; axis < 3; ++axis)
+            {
+                current.centers[axis][lane] = center[axis];
+                current.extents[axis][lane] = extents[axis];
+            }
+
+            if (child.isLeaf())
+            {
+                current.children[lane] = child.index;
+                current.counts[lane] = child.count;
+            }
+            else
+            {
+                current.children[lane] = m_nodeCount;
+                m_nodes[m_nodeCount++].children[0] = candidates[lane];
+            }
+        }
+    }
+}
+
+template <concepts::IsFloatingPoint T, Int32 Width>
+requires(Width == 4 || Width == 8)
+bool WideBvh<T, Width>::intersectClosest(
+    const Ray<T>& ray, const TriangleStreams<T>& triangles, RayHit<T>& hit
+) const noexcept
+{
+    GP_ASSERT(detail::hasStreamsOfSize(triangles, m_primitives.size()), "intersectClosest() requires every triangle");
+    if (m_primitives.isEmpty())
+    {
+        return false;
+    }
+
+    const detail::WideBvhRay<T, Width> wideRay(ray);
+    detail::WideBvhStackEntry<T> stack[kMaxStackSize];
+    stack[0] = { 0, 0, T{ 0 } };
+    Int32 stackSize = 1;
+    bool isHit = false;
+    while (stackSize > 0)
+    {
+        const detail::WideBvhStackEntry<T> entry = stack[--stackSize];
+        if (entry.distance >= hit.distance)
+        {
+            continue;
+        }
+        if (entry.count > 0)
+        {
+            isHit |= detail::intersectLeaf(ray, triangles, m_primitives, entry.index, entry.count, hit);
+            continue;
+        }
+
+        // The children hit are pushed from the farthest to the nearest, which is visited first.
+        const WideBvhNode<T, Width>& node = m_nodes[entry.index];
+        alignas(simd::kRegister8Alignment) T distances[Width];
+        const Int32 first = stackSize;
+        for (UInt32 mask = wideRay.intersectChildren(node, hit.distance, distances); mask != 0; mask &= mask - 1)
+        {
+            const Int32 lane = static_cast<Int32>(math::countTrailingZeros(mask));
+            Int32 slot = stackSize++;
+            for (; slot > first && stack[slot - 1].distance < distances[lane]; --slot)
+            {
+                stack[slot] = stack[slot - 1];
+            }
+            stack[slot] = { node.children[lane], node.counts[lane], distances[lane] };
+        }
+    }
+    return isHit;
+}
+
+template <concepts::IsFloatingPoint T, Int32 Width>
+requires(Width == 4 || Width == 8)
+[[nodiscard]] bool WideBvh<T, Width>::intersectsAny(
+    const Ray<T>& ray, const TriangleStreams<T>& triangles, const T maxDistance
+) const noexcept
+{
+    GP_ASSERT(detail::hasStreamsOfSize(triangles, m_primitives.size()), "intersectsAny() requires every triangle");
+    if (m_primitives.isEmpty())
+    {
+        return false;
+    }
+
+    const detail::WideBvhRay<T, Width> wideRay(ray);
+    detail::WideBvhStackEntry<T> stack[kMaxStackSize];
+    stack[0] = { 0, 0, T{ 0 } };
+    Int32 stackSize = 1;
+    while (stackSize > 0)
+    {
+        const detail::WideBvhStackEntry<T> entry = stack[--stackSize];
+        if (entry.count > 0)
+        {
+            if (ray.intersectsAnyTriangle(detail::sliceTriangles(triangles, entry.index, entry.count), maxDistance))
+            {
+                return true;
+            }
+            continue;
+        }
+
+        const WideBvhNode<T, Width>& node = m_nodes[entry.index];
+        alignas(simd::kRegister8Alignment) T distances[Width];
+        for (UInt32 mask = wideRay.intersectChildren(node, maxDistance, distances); mask != 0; mask &= mask - 1)
+        {
+            const Int32 lane = static_cast<Int32>(math::countTrailingZeros(mask));
+            stack[stackSize++] = { node.children[lane], node.counts[lane], distances[lane] };
+        }
+    }
+    return false;
+}
+
+}   // namespace gp::math
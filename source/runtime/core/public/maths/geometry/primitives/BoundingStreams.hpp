@@ -0,0 +1,35 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+
+namespace gp::math
+{
+
+/// @brief Bounding spheres read by the batch queries, such as Frustum::cullSpheres(), in structure-of-arrays form.
+/// @details Centers have one stream per axis, such as the fields of a SoAVector<T, T, T>, all streams being as long.
+/// @tparam T The floating-point type of the bounding volumes.
+template <concepts::IsFloatingPoint T>
+struct BoundingSphereStreams
+{
+    ConstVectorView<T> centers[3];   //<! Centers of the spheres, one stream per axis.
+    ConstVectorView<T> radii;        //<! Radii of the spheres.
+};
+
+/// @brief Axis-aligned bounding boxes read by the batch queries, such as Frustum::cullBoxes() and
+/// Ray::intersectBoxes(), in structure-of-arrays form.
+/// @details Boxes are given by their center and half size, one stream per axis, all streams being as long.
+/// @tparam T The floating-point type of the bounding volumes.
+template <concepts::IsFloatingPoint T>
+struct BoundingBoxStreams
+{
+    ConstVectorView<T> centers[3];   //<! Centers of the boxes, one stream per axis.
+    ConstVectorView<T> extents[3];   //<! Half sizes of the boxes, one stream per axis.
+};
+
+}   // namespace gp::math
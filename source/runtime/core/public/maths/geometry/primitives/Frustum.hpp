@@ -3,3 +3,143 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/geometry/primitives/BoundingStreams.hpp"
+#include "maths/geometry/primitives/Plane.hpp"
+#include "maths/geometry/primitives/Sphere.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/matrix/Matrix4x4.hpp"
+#include "maths/vector/Vector3.hpp"
+
+namespace gp::math
+{
+
+/// @brief A view frustum template, the convex volume bounded by six planes facing inwards.
+/// @details
+/// A frustum is extracted from a view-projection matrix with the method of Gribb and Hartmann, for clip spaces whose
+/// depth goes from 0 to w as with Vulkan, Direct3D, Metal and WebGPU. Reverse-Z projections swap the near and far
+/// planes, and infinite projections give a far plane with a null normal and a positive distance, which every object
+/// passes. Culling is conservative: objects near a corner of the frustum may be reported visible while outside it.
+/// @tparam T The floating-point type for the frustum planes.
+template <concepts::IsFloatingPoint T>
+struct Frustum
+{
+public:
+    static constexpr Int32 kLeft = 0;            //<! Index of the plane x = -w.
+    static constexpr Int32 kRight = 1;           //<! Index of the plane x = w.
+    static constexpr Int32 kBottom = 2;          //<! Index of the plane y = -w.
+    static constexpr Int32 kTop = 3;             //<! Index of the plane y = w.
+    static constexpr Int32 kNear = 4;            //<! Index of the plane z = 0, the far plane with reverse-Z.
+    static constexpr Int32 kFar = 5;             //<! Index of the plane z = w, the near plane with reverse-Z.
+    static constexpr Int32 kPlaneCount = 6;      //<! Number of planes bounding the frustum.
+    static constexpr Int32 kBlockSize = 8;       //<! Number of objects tested at once by the batch culling.
+    static constexpr Int32 kMaskWordBits = 32;   //<! Number of objects per word of a visibility mask.
+
+public:
+    Plane<T> planes[kPlaneCount];   //<! The normalized planes, facing the inside of the frustum.
+
+public:
+    /// @brief Returns the number of words of the visibility mask of @p count objects.
+    [[nodiscard]] static constexpr Int32 getVisibilityMaskSize(const Int32 count) noexcept
+    {
+        return (count + kMaskWordBits - 1) / kMaskWordBits;
+    }
+
+public:
+    /// @brief Default constructor initializes to the clip volume itself, x and y in [-1, 1] and z in [0, 1].
+    [[nodiscard]] constexpr Frustum() noexcept
+        : Frustum(Matrix4x4<T>())
+    {}
+
+    /// @brief Constructor extracting the planes of a view-projection matrix.
+    /// @param[in] viewProjection The matrix from world space to clip space, transforming column vectors.
+    [[nodiscard]] explicit constexpr Frustum(const Matrix4x4<T>& viewProjection) noexcept;
+
+public:
+    /// @brief Checks whether a point lies inside the frustum or on its boundary.
+    [[nodiscard]] constexpr bool contains(const Vector3<T>& point) const noexcept
+    {
+        for (const Plane<T>& plane : planes)
+        {
+            if (plane.getSignedDistance(point) < T{ 0 })
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Checks whether a sphere may be visible, that is not entirely behind one of the planes.
+    [[nodiscard]] constexpr bool intersects(const Sphere<T>& sphere) const noexcept
+    {
+        for (const Plane<T>& plane : planes)
+        {
+            if (plane.getSignedDistance(sphere.center) < -sphere.radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Checks whether an axis-aligned box may be visible, that is not entirely behind one of the planes.
+    /// @param[in] center The center of the box.
+    /// @param[in] extents The half size of the box along each axis.
+    [[nodiscard]] constexpr bool intersectsBox(const Vector3<T>& center, const Vector3<T>& extents) const noexcept
+    {
+        for (const Plane<T>& plane : planes)
+        {
+            // The projection of the box on the normal is centered on the center, with this half length.
+            if (plane.getSignedDistance(center) < -plane.normal.getAbsolute().dot(extents))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    /// @brief Culls a batch of bounding spheres, writing one visibility bit per sphere.
+    /// @details
+    /// Float32 batches are tested kBlockSize spheres at a time against each plane with the maths/simd register layer,
+    /// and skip the remaining planes as soon as the whole block is culled. Other types call intersects() for each
+    /// sphere.
+    /// @param[in] spheres The bounding spheres.
+    /// @param[out] visibilityMask Bit i % 32 of word i / 32 is set when sphere i may be visible. Must hold at least
+    /// getVisibilityMaskSize() words, the bits past the last sphere are cleared.
+    void cullSpheres(const BoundingSphereStreams<T>& spheres, VectorView<UInt32> visibilityMask) const noexcept;
+
+    /// @brief Culls a batch of bounding spheres, writing the indices of the visible ones in order.
+    /// @copydetails cullSpheres(const BoundingSphereStreams<T>&, VectorView<UInt32>) const
+    /// @param[in] spheres The bounding spheres.
+    /// @param[out] visibleIndices The indices of the spheres that may be visible. Must hold as many indices as there
+    /// are spheres.
+    /// @return The number of indices written.
+    Int32 cullSpheres(const BoundingSphereStreams<T>& spheres, VectorView<Int32> visibleIndices) const noexcept;
+
+    /// @brief Culls a batch of axis-aligned bounding boxes, writing one visibility bit per box.
+    /// @details
+    /// Float32 batches are tested kBlockSize boxes at a time against each plane with the maths/simd register layer,
+    /// and skip the remaining planes as soon as the whole block is culled. Other types call intersectsBox() for each
+    /// box.
+    /// @param[in] boxes The bounding boxes.
+    /// @param[out] visibilityMask Bit i % 32 of word i / 32 is set when box i may be visible. Must hold at least
+    /// getVisibilityMaskSize() words, the bits past the last box are cleared.
+    void cullBoxes(const BoundingBoxStreams<T>& boxes, VectorView<UInt32> visibilityMask) const noexcept;
+
+    /// @brief Culls a batch of axis-aligned bounding boxes, writing the indices of the visible ones in order.
+    /// @copydetails cullBoxes(const BoundingBoxStreams<T>&, VectorView<UInt32>) const
+    /// @param[in] boxes The bounding boxes.
+    /// @param[out] visibleIndices The indices of the boxes that may be visible. Must hold as many indices as there are
+    /// boxes.
+    /// @return The number of indices written.
+    Int32 cullBoxes(const BoundingBoxStreams<T>& boxes, VectorView<Int32> visibleIndices) const noexcept;
+};
+
+}   // namespace gp::math
+
+// Include the implementation of the Frustum template
+#include "maths/geometry/primitives/Frustum.inl"
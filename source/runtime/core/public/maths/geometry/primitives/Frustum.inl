@@ -0,0 +1,272 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "maths/base/Scalar.hpp"
+#include "maths/geometry/primitives/Frustum.hpp"
+#include "maths/simd/VectorRegister.hpp"
+#include <type_traits>
+
+namespace gp::math
+{
+
+namespace detail
+{
+
+/// @brief Whether frustums of T cull through the SIMD register layer, which handles eight Float32 lanes.
+template <typename T>
+inline constexpr bool kIsSimdFrustum = std::is_same_v<T, Float32>;
+
+/// @brief Returns the normalized plane wWeight * row3 + rowSign * row of a view-projection matrix.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Plane<T>
+    makeClipPlane(const Matrix4x4<T>& matrix, const Int32 row, const T rowSign, const T wWeight) noexcept
+{
+    // A point p = (x, y, z, 1) is inside when the clip coordinate of the row is within [-w, w], or [0, w] for the
+    // depth: each bound is the half-space (wWeight * row3 + rowSign * row) . p >= 0.
+    return Plane<T>(
+               Vector3<T>(
+                   wWeight * matrix.m[3][0] + rowSign * matrix.m[row][0],
+                   wWeight * matrix.m[3][1] + rowSign * matrix.m[row][1],
+                   wWeight * matrix.m[3][2] + rowSign * matrix.m[row][2]
+               ),
+               wWeight * matrix.m[3][3] + rowSign * matrix.m[row][3]
+    )
+        .normalized();
+}
+
+/// @brief The planes of a frustum with each component in its own register, to test eight objects per plane at once.
+struct FrustumRegisters
+{
+    simd::VectorRegister8f normals[Frustum<Float32>::kPlaneCount][3];           //<! The normal of each plane.
+    simd::VectorRegister8f absoluteNormals[Frustum<Float32>::kPlaneCount][3];   //<! The absolute normal of each plane.
+    simd::VectorRegister8f distances[Frustum<Float32>::kPlaneCount];            //<! The distance of each plane.
+};
+
+/// @brief Broadcasts the planes of a Float32 frustum to registers.
+GP_FORCEINLINE FrustumRegisters splatPlanes(const Frustum<Float32>& frustum) noexcept
+{
+    FrustumRegisters registers;
+    for (Int32 plane = 0; plane < Frustum<Float32>::kPlaneCount; ++plane)
+    {
+        const Plane<Float32>& source = frustum.planes[plane];
+        const Float32 normal[3] = { source.normal.x, source.normal.y, source.normal.z };
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            registers.normals[plane][axis] = simd::splat8f(normal[axis]);
+            registers.absoluteNormals[plane][axis] = simd::splat8f(math::abs(normal[axis]));
+        }
+        registers.distances[plane] = simd::splat8f(source.distance);
+    }
+    return registers;
+}
+
+/// @brief Tests eight objects against the planes of a frustum, given their centers and radii along each normal.
+/// @tparam IsBox Whether the objects are boxes, whose radius along a normal comes from their extents.
+/// @return The visibility mask of the eight objects, bit i being set when object i may be visible.
+template <bool IsBox>
+GP_FORCEINLINE UInt32 cullBlock(
+    const FrustumRegisters& registers,
+    const simd::VectorRegister8f (&centers)[3],
+    const simd::VectorRegister8f (&sizes)[3]
+) noexcept
+{
+    simd::VectorRegister8f visible = simd::cmpEq(simd::zero8f(), simd::zero8f());
+    for (Int32 plane = 0; plane < Frustum<Float32>::kPlaneCount; ++plane)
+    {
+        const simd::VectorRegister8f(&normal)[3] = registers.normals[plane];
+        simd::VectorRegister8f distance = simd::madd(normal[0], centers[0], registers.distances[plane]);
+        distance = simd::madd(normal[1], centers[1], distance);
+        distance = simd::madd(normal[2], centers[2], distance);
+
+        simd::VectorRegister8f radius = sizes[0];
+        if constexpr (IsBox)
+        {
+            const simd::VectorRegister8f(&absoluteNormal)[3] = registers.absoluteNormals[plane];
+            radius = simd::mul(absoluteNormal[0], sizes[0]);
+            radius = simd::madd(absoluteNormal[1], sizes[1], radius);
+            radius = simd::madd(absoluteNormal[2], sizes[2], radius);
+        }
+
+        visible = simd::bitAnd(visible, simd::cmpGe(distance, simd::negate(radius)));
+        if (!simd::anyTrue(visible))
+        {
+            return 0;
+        }
+    }
+    return simd::moveMask(visible);
+}
+
+/// @brief Culls a batch of spheres block by block, passing the visibility mask of each block to @p sink.
+/// @param[in] sink Called with the index of the first sphere of each block and its visibility mask, in order.
+template <concepts::IsFloatingPoint T, typename Sink>
+void cullSphereBlocks(const Frustum<T>& frustum, const BoundingSphereStreams<T>& spheres, Sink&& sink) noexcept
+{
+    const Int32 count = spheres.radii.size();
+    GP_ASSERT(
+        spheres.centers[0].size() == count && spheres.centers[1].size() == count && spheres.centers[2].size() == count,
+        "cullSpheres() requires streams of the same size"
+    );
+
+    Int32 first = 0;
+    if constexpr (kIsSimdFrustum<T>)
+    {
+        const FrustumRegisters registers = splatPlanes(frustum);
+        for (; first + Frustum<T>::kBlockSize <= count; first += Frustum<T>::kBlockSize)
+        {
+            const simd::VectorRegister8f centers[3] = { simd::loadUnaligned8f(spheres.centers[0].data() + first),
+                                                        simd::loadUnaligned8f(spheres.centers[1].data() + first),
+                                                        simd::loadUnaligned8f(spheres.centers[2].data() + first) };
+            const simd::VectorRegister8f radius = simd::loadUnaligned8f(spheres.radii.data() + first);
+            const simd::VectorRegister8f sizes[3] = { radius, radius, radius };
+            sink(first, cullBlock<false>(registers, centers, sizes));
+        }
+    }
+
+    for (; first < count; first += Frustum<T>::kBlockSize)
+    {
+        UInt32 mask = 0;
+        const Int32 blockSize = math::min(Frustum<T>::kBlockSize, count - first);
+        for (Int32 lane = 0; lane < blockSize; ++lane)
+        {
+            const Int32 index = first + lane;
+            const Vector3<T> center(spheres.centers[0][index], spheres.centers[1][index], spheres.centers[2][index]);
+            if (frustum.intersects(Sphere<T>(center, spheres.radii[index])))
+            {
+                mask |= 1u << lane;
+            }
+        }
+        sink(first, mask);
+    }
+}
+
+/// @brief Culls a batch of boxes block by block, passing the visibility mask of each block to @p sink.
+/// @param[in] sink Called with the index of the first box of each block and its visibility mask, in order.
+template <concepts::IsFloatingPoint T, typename Sink>
+void cullBoxBlocks(const Frustum<T>& frustum, const BoundingBoxStreams<T>& boxes, Sink&& sink) noexcept
+{
+    const Int32 count = boxes.centers[0].size();
+    GP_ASSERT(
+        boxes.centers[1].size() == count && boxes.centers[2].size() == count && boxes.extents[0].size() == count &&
+            boxes.extents[1].size() == count && boxes.extents[2].size() == count,
+        "cullBoxes() requires streams of the same size"
+    );
+
+    Int32 first = 0;
+    if constexpr (kIsSimdFrustum<T>)
+    {
+        const FrustumRegisters registers = splatPlanes(frustum);
+        for (; first + Frustum<T>::kBlockSize <= count; first += Frustum<T>::kBlockSize)
+        {
+            const simd::VectorRegister8f centers[3] = { simd::loadUnaligned8f(boxes.centers[0].data() + first),
+                                                        simd::loadUnaligned8f(boxes.centers[1].data() + first),
+                                                        simd::loadUnaligned8f(boxes.centers[2].data() + first) };
+            const simd::VectorRegister8f extents[3] = { simd::loadUnaligned8f(boxes.extents[0].data() + first),
+                                                        simd::loadUnaligned8f(boxes.extents[1].data() + first),
+                                                        simd::loadUnaligned8f(boxes.extents[2].data() + first) };
+            sink(first, cullBlock<true>(registers, centers, extents));
+        }
+    }
+
+    for (; first < count; first += Frustum<T>::kBlockSize)
+    {
+        UInt32 mask = 0;
+        const Int32 blockSize = math::min(Frustum<T>::kBlockSize, count - first);
+        for (Int32 lane = 0; lane < blockSize; ++lane)
+        {
+            const Int32 index = first + lane;
+            const Vector3<T> center(boxes.centers[0][index], boxes.centers[1][index], boxes.centers[2][index]);
+            const Vector3<T> extents(boxes.extents[0][index], boxes.extents[1][index], boxes.extents[2][index]);
+            if (frustum.intersectsBox(center, extents))
+            {
+                mask |= 1u << lane;
+            }
+        }
+        sink(first, mask);
+    }
+}
+
+/// @brief A sink writing the visibility masks of consecutive blocks to the words of a visibility mask.
+struct VisibilityMaskSink
+{
+    VectorView<UInt32> words;   //<! The visibility mask, one bit per object.
+
+    GP_FORCEINLINE void operator()(const Int32 first, const UInt32 mask) const noexcept
+    {
+        // Blocks come in order and never straddle two words, the first block of a word overwrites it.
+        constexpr Int32 kWordBits = Frustum<Float32>::kMaskWordBits;
+        UInt32& word = words[first / kWordBits];
+        const Int32 shift = first % kWordBits;
+        word = shift == 0 ? mask : word | (mask << shift);
+    }
+};
+
+/// @brief A sink appending the indices of the visible objects of consecutive blocks to a list.
+struct VisibleIndicesSink
+{
+    VectorView<Int32> indices;   //<! The indices of the visible objects.
+    Int32 count{ 0 };            //<! The number of indices written so far.
+
+    GP_FORCEINLINE void operator()(const Int32 first, UInt32 mask) noexcept
+    {
+        while (mask != 0)
+        {
+            indices[count++] = first + static_cast<Int32>(math::countTrailingZeros(mask));
+            mask &= mask - 1;
+        }
+    }
+};
+
+}   // namespace detail
+
+template <concepts::IsFloatingPoint T>
+constexpr Frustum<T>::Frustum(const Matrix4x4<T>& viewProjection) noexcept
+    : planes{ detail::makeClipPlane(viewProjection, 0, T{ 1 }, T{ 1 }),
+              detail::makeClipPlane(viewProjection, 0, T{ -1 }, T{ 1 }),
+              detail::makeClipPlane(viewProjection, 1, T{ 1 }, T{ 1 }),
+              detail::makeClipPlane(viewProjection, 1, T{ -1 }, T{ 1 }),
+              detail::makeClipPlane(viewProjection, 2, T{ 1 }, T{ 0 }),
+              detail::makeClipPlane(viewProjection, 2, T{ -1 }, T{ 1 }) }
+{}
+
+template <concepts::IsFloatingPoint T>
+void Frustum<T>::cullSpheres(const BoundingSphereStreams<T>& spheres, VectorView<UInt32> visibilityMask) const noexcept
+{
+    GP_ASSERT(
+        visibilityMask.size() >= getVisibilityMaskSize(spheres.radii.size()),
+        "cullSpheres() requires one mask bit per sphere"
+    );
+    detail::cullSphereBlocks(*this, spheres, detail::VisibilityMaskSink{ visibilityMask });
+}
+
+template <concepts::IsFloatingPoint T>
+Int32 Frustum<T>::cullSpheres(const BoundingSphereStreams<T>& spheres, VectorView<Int32> visibleIndices) const noexcept
+{
+    GP_ASSERT(visibleIndices.size() >= spheres.radii.size(), "cullSpheres() requires room for one index per sphere");
+    detail::VisibleIndicesSink sink{ visibleIndices };
+    detail::cullSphereBlocks(*this, spheres, sink);
+    return sink.count;
+}
+
+template <concepts::IsFloatingPoint T>
+void Frustum<T>::cullBoxes(const BoundingBoxStreams<T>& boxes, VectorView<UInt32> visibilityMask) const noexcept
+{
+    GP_ASSERT(
+        visibilityMask.size() >= getVisibilityMaskSize(boxes.centers[0].size()),
+        "cullBoxes() requires one mask bit per box"
+    );
+    detail::cullBoxBlocks(*this, boxes, detail::VisibilityMaskSink{ visibilityMask });
+}
+
+template <concepts::IsFloatingPoint T>
+Int32 Frustum<T>::cullBoxes(const BoundingBoxStreams<T>& boxes, VectorView<Int32> visibleIndices) const noexcept
+{
+    GP_ASSERT(visibleIndices.size() >= boxes.centers[0].size(), "cullBoxes() requires room for one index per box");
+    detail::VisibleIndicesSink sink{ visibleIndices };
+    detail::cullBoxBlocks(*this, boxes, sink);
+    return sink.count;
+}
+
+}   // namespace gp::math
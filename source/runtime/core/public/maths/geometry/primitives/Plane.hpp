@@ -3,3 +3,111 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Constants.hpp"
+#include "maths/base/Scalar.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/vector/Vector3.hpp"
+#include "maths/vector/Vector4.hpp"
+
+namespace gp::math
+{
+
+/// @brief A plane template, the set of points p such that dot(normal, p) + distance = 0.
+/// @details
+/// The normal points towards the positive half-space, and the signed distance of a point is only a true distance
+/// when the normal is normalized. Components are aligned like Vector4, so a Float32 plane is one SIMD register.
+/// @tparam T The floating-point type for the plane components.
+template <concepts::IsFloatingPoint T>
+struct alignas(sizeof(T) * 4) Plane
+{
+public:
+    Vector3<T> normal;   //<! The normal of the plane, pointing towards the positive half-space.
+    T distance;          //<! The signed distance of the origin to the plane, along the normal.
+
+public:
+    /// @brief Default constructor initializes to the plane z = 0, facing +z.
+    [[nodiscard]] constexpr Plane() noexcept
+        : normal(T{ 0 }, T{ 0 }, T{ 1 })
+        , distance(T{ 0 })
+    {}
+
+    /// @brief Constructor with individual components.
+    /// @param[in] inNormal The normal of the plane.
+    /// @param[in] inDistance The signed distance of the origin to the plane.
+    [[nodiscard]] constexpr Plane(const Vector3<T>& inNormal, const T inDistance) noexcept
+        : normal(inNormal)
+        , distance(inDistance)
+    {}
+
+    /// @brief Constructor from a normal and a point lying on the plane.
+    /// @param[in] inNormal The normal of the plane.
+    /// @param[in] point A point on the plane.
+    [[nodiscard]] constexpr Plane(const Vector3<T>& inNormal, const Vector3<T>& point) noexcept
+        : normal(inNormal)
+        , distance(-inNormal.dot(point))
+    {}
+
+    /// @brief Constructor from the coefficients (a, b, c, d) of the equation ax + by + cz + d = 0.
+    /// @param[in] coefficients The coefficients of the plane equation.
+    [[nodiscard]] explicit constexpr Plane(const Vector4<T>& coefficients) noexcept
+        : normal(coefficients.x, coefficients.y, coefficients.z)
+        , distance(coefficients.w)
+    {}
+
+public:
+    /// @brief Checks whether every component is exactly equal to the one of another plane.
+    [[nodiscard]] constexpr bool operator==(const Plane<T>& other) const noexcept
+    {
+        return normal == other.normal && distance == other.distance;
+    }
+
+    /// @brief Checks whether at least one component differs from the one of another plane.
+    [[nodiscard]] constexpr bool operator!=(const Plane<T>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+public:
+    /// @brief Returns the signed distance of a point to the plane, positive on the side the normal points to.
+    [[nodiscard]] constexpr T getSignedDistance(const Vector3<T>& point) const noexcept
+    {
+        return normal.dot(point) + distance;
+    }
+
+    /// @brief Returns the projection of a point on the plane, which must be normalized.
+    [[nodiscard]] constexpr Vector3<T> projectPoint(const Vector3<T>& point) const noexcept
+    {
+        return point - normal * getSignedDistance(point);
+    }
+
+    /// @brief Returns the plane scaled so that its normal has a unit length.
+    /// @details The set of points is unchanged. A plane whose normal is close to zero is returned as is.
+    [[nodiscard]] constexpr Plane<T> normalized(const T tolerance = constants<T>::smallNumber) const noexcept
+    {
+        const T squared = normal.lengthSquared();
+        if (squared <= tolerance)
+        {
+            return *this;
+        }
+        const T scale = math::inverseSqrt(squared);
+        return Plane<T>(normal * scale, distance * scale);
+    }
+
+    /// @brief Returns the plane facing the other way, made of the same points.
+    [[nodiscard]] constexpr Plane<T> flipped() const noexcept
+    {
+        return Plane<T>(-normal, -distance);
+    }
+
+    /// @brief Checks whether this plane is equal to another one within a given tolerance.
+    [[nodiscard]] constexpr bool
+        equals(const Plane<T>& other, const T tolerance = constants<T>::kindaSmallNumber) const noexcept
+    {
+        return normal.equals(other.normal, tolerance) && math::abs(distance - other.distance) <= tolerance;
+    }
+};
+
+}   // namespace gp::math
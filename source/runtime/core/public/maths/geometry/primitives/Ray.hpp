@@ -3,3 +3,124 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Constants.hpp"
+#include "maths/base/Scalar.hpp"
+#include "maths/geometry/primitives/BoundingStreams.hpp"
+#include "maths/geometry/primitives/Triangle.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/vector/Vector3.hpp"
+
+namespace gp::math
+{
+
+/// @brief The closest intersection of a ray with triangles found so far.
+/// @tparam T The floating-point type of the hit.
+template <concepts::IsFloatingPoint T>
+struct RayHit
+{
+    T distance{ constants<T>::infinity };   //<! Distance along the ray, in units of its direction length.
+    T u{ 0 };                               //<! Barycentric weight of the second vertex of the hit triangle.
+    T v{ 0 };                               //<! Barycentric weight of the third vertex of the hit triangle.
+    Int32 index{ -1 };                      //<! Index of the hit triangle in its batch, or -1 when nothing was hit.
+};
+
+/// @brief A ray template, the half-line starting at an origin and going along a direction.
+/// @details
+/// Distances along the ray are in units of the length of its direction, which does not need to be normalized. Ray
+/// queries are two-sided and only report intersections at a distance in [0, max distance). The batch queries test
+/// Float32 rays against Ray::kPacketWidth triangles or boxes at once with the maths/simd register layer, then
+/// against half as many for the remainder; other types use the single queries.
+/// @tparam T The floating-point type for the ray components.
+template <concepts::IsFloatingPoint T>
+struct Ray
+{
+public:
+    static constexpr Int32 kPacketWidth = 8;   //<! Number of primitives tested at once by the batch queries.
+
+public:
+    Vector3<T> origin;      //<! The point the ray starts from.
+    Vector3<T> direction;   //<! The direction of the ray, not necessarily normalized.
+
+public:
+    /// @brief Default constructor initializes to the ray starting at the origin and going along +z.
+    [[nodiscard]] constexpr Ray() noexcept
+        : origin(T{ 0 })
+        , direction(T{ 0 }, T{ 0 }, T{ 1 })
+    {}
+
+    /// @brief Constructor with individual components.
+    /// @param[in] inOrigin The point the ray starts from.
+    /// @param[in] inDirection The direction of the ray, must not be zero.
+    [[nodiscard]] constexpr Ray(const Vector3<T>& inOrigin, const Vector3<T>& inDirection) noexcept
+        : origin(inOrigin)
+        , direction(inDirection)
+    {}
+
+public:
+    /// @brief Returns the point at @p distance along the ray.
+    [[nodiscard]] constexpr Vector3<T> getPoint(const T distance) const noexcept
+    {
+        return origin + direction * distance;
+    }
+
+    /// @brief Intersects the ray with a triangle, with the algorithm of Moller and Trumbore.
+    /// @param[in] triangle The triangle, hit from either side.
+    /// @param[out] outHit The distance and barycentric coordinates of the intersection, left as is on a miss. The
+    /// index is never written.
+    /// @param[in] maxDistance Intersections at this distance or farther are ignored.
+    /// @return True if the ray hits the triangle before @p maxDistance.
+    [[nodiscard]] constexpr bool intersectsTriangle(
+        const Triangle<T>& triangle, RayHit<T>& outHit, const T maxDistance = constants<T>::infinity
+    ) const noexcept;
+
+    /// @brief Intersects the ray with an axis-aligned box, with the slab method.
+    /// @param[in] center The center of the box.
+    /// @param[in] extents The half size of the box along each axis.
+    /// @param[out] outDistance The distance at which the ray enters the box, zero when it starts inside.
+    /// @param[in] maxDistance Intersections at this distance or farther are ignored.
+    /// @return True if the ray enters the box before @p maxDistance.
+    /// @note A ray parallel to a face and starting exactly in its plane may miss the box.
+    [[nodiscard]] constexpr bool intersectsBox(
+        const Vector3<T>& center,
+        const Vector3<T>& extents,
+        T& outDistance,
+        const T maxDistance = constants<T>::infinity
+    ) const noexcept;
+
+public:
+    /// @brief Finds the closest intersection of the ray with a batch of triangles.
+    /// @param[in] triangles The triangles, hit from either side.
+    /// @param[in,out] hit Only intersections closer than its distance are reported, so that a hit can be carried
+    /// across several batches. Updated with the closest intersection and the index of its triangle in the batch.
+    /// @return True if a triangle of this batch was hit, in which case @p hit was updated.
+    bool intersectTriangles(const TriangleStreams<T>& triangles, RayHit<T>& hit) const noexcept;
+
+    /// @brief Checks whether the ray hits any triangle of a batch, stopping at the first packet that has a hit.
+    /// @details Cheaper than intersectTriangles() for occlusion and shadow queries, which do not need the closest hit.
+    /// @param[in] triangles The triangles, hit from either side.
+    /// @param[in] maxDistance Intersections at this distance or farther are ignored.
+    /// @return True if at least one triangle is hit before @p maxDistance.
+    [[nodiscard]] bool
+        intersectsAnyTriangle(const TriangleStreams<T>& triangles, const T maxDistance) const noexcept;
+
+    /// @brief Intersects the ray with a batch of axis-aligned boxes.
+    /// @param[in] boxes The boxes.
+    /// @param[out] outDistances The distance at which the ray enters each box, or infinity when it misses it. Must
+    /// hold as many distances as there are boxes.
+    /// @param[in] maxDistance Intersections at this distance or farther are ignored.
+    /// @return The number of boxes hit.
+    Int32 intersectBoxes(
+        const BoundingBoxStreams<T>& boxes,
+        VectorView<T> outDistances,
+        const T maxDistance = constants<T>::infinity
+    ) const noexcept;
+};
+
+}   // namespace gp::math
+
+// Include the implementation of the Ray template
+#include "maths/geometry/primitives/Ray.inl"
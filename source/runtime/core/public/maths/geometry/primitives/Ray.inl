@@ -0,0 +1,484 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "maths/geometry/primitives/Ray.hpp"
+#include "maths/simd/VectorRegister.hpp"
+#include <type_traits>
+
+namespace gp::math
+{
+
+namespace detail
+{
+
+/// @brief Whether rays of T are tested in packets through the SIMD register layer, which handles Float32 lanes.
+template <typename T>
+inline constexpr bool kIsSimdRay = std::is_same_v<T, Float32>;
+
+/// @brief The register holding Width Float32 lanes, and the operations whose name depends on the width.
+template <Int32 Width>
+struct PacketRegister;
+
+template <>
+struct PacketRegister<4>
+{
+    using Type = simd::VectorRegister4f;
+
+    GP_FORCEINLINE static Type splat(const Float32 value) noexcept
+    {
+        return simd::splat4f(value);
+    }
+
+    GP_FORCEINLINE static Type load(const Float32* source) noexcept
+    {
+        return simd::loadUnaligned4f(source);
+    }
+};
+
+template <>
+struct PacketRegister<8>
+{
+    using Type = simd::VectorRegister8f;
+
+    GP_FORCEINLINE static Type splat(const Float32 value) noexcept
+    {
+        return simd::splat8f(value);
+    }
+
+    GP_FORCEINLINE static Type load(const Float32* source) noexcept
+    {
+        return simd::loadUnaligned8f(source);
+    }
+};
+
+/// @brief A Float32 ray broadcast to every lane, to test it against Width primitives at once.
+template <Int32 Width>
+struct RayPacket
+{
+    using Register = typename PacketRegister<Width>::Type;
+
+    Register origin[3];             //<! The origin of the ray, one register per axis.
+    Register direction[3];          //<! The direction of the ray, one register per axis.
+    Register inverseDirection[3];   //<! The inverse of each direction component, infinite for zero components.
+
+    GP_FORCEINLINE explicit RayPacket(const Ray<Float32>& ray) noexcept
+    {
+        const Float32 origins[3] = { ray.origin.x, ray.origin.y, ray.origin.z };
+        const Float32 directions[3] = { ray.direction.x, ray.direction.y, ray.direction.z };
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            origin[axis] = PacketRegister<Width>::splat(origins[axis]);
+            direction[axis] = PacketRegister<Width>::splat(directions[axis]);
+            inverseDirection[axis] = PacketRegister<Width>::splat(1.0f / directions[axis]);
+        }
+    }
+};
+
+/// @brief Gathers the triangle at @p index from its streams.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Triangle<T> loadTriangle(const TriangleStreams<T>& triangles, const Int32 index) noexcept
+{
+    Vector3<T> vertices[3];
+    for (Int32 vertex = 0; vertex < 3; ++vertex)
+    {
+        const ConstVectorView<T>(&axes)[3] = triangles.vertices[vertex];
+        vertices[vertex] = Vector3<T>(axes[0][index], axes[1][index], axes[2][index]);
+    }
+    return Triangle<T>(vertices[0], vertices[1], vertices[2]);
+}
+
+/// @brief Checks whether every stream of a batch of triangles holds @p count values.
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr bool hasStreamsOfSize(const TriangleStreams<T>& triangles, const Int32 count) noexcept
+{
+    for (const ConstVectorView<T>(&axes)[3] : triangles.vertices)
+    {
+        if (axes[0].size() != count || axes[1].size() != count || axes[2].size() != count)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Computes the dot products of vectors held as one register per axis.
+template <typename Register>
+GP_FORCEINLINE Register dotLanes(const Register (&a)[3], const Register (&b)[3]) noexcept
+{
+    return simd::madd(a[0], b[0], simd::madd(a[1], b[1], simd::mul(a[2], b[2])));
+}
+
+/// @brief Computes the cross products of vectors held as one register per axis.
+template <typename Register>
+GP_FORCEINLINE void crossLanes(const Register (&a)[3], const Register (&b)[3], Register (&result)[3]) noexcept
+{
+    result[0] = simd::sub(simd::mul(a[1], b[2]), simd::mul(a[2], b[1]));
+    result[1] = simd::sub(simd::mul(a[2], b[0]), simd::mul(a[0], b[2]));
+    result[2] = simd::sub(simd::mul(a[0], b[1]), simd::mul(a[1], b[0]));
+}
+
+/// @brief Intersects a ray with Width triangles with the algorithm of Moller and Trumbore.
+/// @details Returns as soon as every lane has missed, before computing the distances.
+/// @param[out] outDistance The distance of the intersection in each lane, only meaningful for the hit lanes.
+/// @param[out] outU The barycentric weight of the second vertex in each lane, only meaningful for the hit lanes.
+/// @param[out] outV The barycentric weight of the third vertex in each lane, only meaningful for the hit lanes.
+/// @return The mask of the lanes hit before @p maxDistance.
+template <Int32 Width, typename Register = typename PacketRegister<Width>::Type>
+GP_FORCEINLINE Register intersectTrianglePacket(
+    const RayPacket<Width>& ray,
+    const TriangleStreams<Float32>& triangles,
+    const Int32 first,
+    const Register maxDistance,
+    Register& outDistance,
+    Register& outU,
+    Register& outV
+) noexcept
+{
+    Register v0[3];
+    Register edge1[3];
+    Register edge2[3];
+    Register offset[3];
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        v0[axis] = PacketRegister<Width>::load(triangles.vertices[0][axis].data() + first);
+        edge1[axis] = simd::sub(PacketRegister<Width>::load(triangles.vertices[1][axis].data() + first), v0[axis]);
+        edge2[axis] = simd::sub(PacketRegister<Width>::load(triangles.vertices[2][axis].data() + first), v0[axis]);
+        offset[axis] = simd::sub(ray.origin[axis], v0[axis]);
+    }
+
+    const Register zero = PacketRegister<Width>::splat(0.0f);
+    const Register one = PacketRegister<Width>::splat(1.0f);
+
+    // Rays parallel to the plane of the triangle have a null determinant, their lanes are masked out before the
+    // infinite or NaN coordinates of the division are used. The determinant scales with the area of the triangle: no
+    // absolute threshold, which would miss small triangles, only the determinants that do not invert to a finite value.
+    Register p[3];
+    crossLanes(ray.direction, edge2, p);
+    const Register determinant = dotLanes(edge1, p);
+    const Register inverseDeterminant = simd::div(one, determinant);
+    outU = simd::mul(dotLanes(offset, p), inverseDeterminant);
+    Register mask =
+        simd::cmpLt(simd::abs(inverseDeterminant), PacketRegister<Width>::splat(constants<Float32>::infinity));
+    mask = simd::bitAnd(mask, simd::bitAnd(simd::cmpGe(outU, zero), simd::cmpLe(outU, one)));
+    if (!simd::anyTrue(mask))
+    {
+        return mask;
+    }
+
+    Register q[3];
+    crossLanes(offset, edge1, q);
+    outV = simd::mul(dotLanes(ray.direction, q), inverseDeterminant);
+    mask = simd::bitAnd(mask, simd::bitAnd(simd::cmpGe(outV, zero), simd::cmpLe(simd::add(outU, outV), one)));
+    if (!simd::anyTrue(mask))
+    {
+        return mask;
+    }
+
+    outDistance = simd::mul(dotLanes(edge2, q), inverseDeterminant);
+    return simd::bitAnd(mask, simd::bitAnd(simd::cmpGe(outDistance, zero), simd::cmpLt(outDistance, maxDistance)));
+}
+
+/// @brief Intersects a ray with Width axis-aligned boxes with the slab method.
+/// @param[out] outDistance The distance at which the ray enters the box in each lane, only meaningful for the hit
+/// lanes.
+/// @return The mask of the lanes hit before @p maxDistance.
+template <Int32 Width, typename Register = typename PacketRegister<Width>::Type>
+GP_FORCEINLINE Register intersectBoxPacket(
+    const RayPacket<Width>& ray,
+    const BoundingBoxStreams<Float32>& boxes,
+    const Int32 first,
+    const Register maxDistance,
+    Register& outDistance
+) noexcept
+{
+    Register entryDistance = PacketRegister<Width>::splat(0.0f);
+    Register exitDistance = maxDistance;
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        const Register offset =
+            simd::sub(PacketRegister<Width>::load(boxes.centers[axis].data() + first), ray.origin[axis]);
+        const Register extent = PacketRegister<Width>::load(boxes.extents[axis].data() + first);
+        const Register slabEntry = simd::mul(simd::sub(offset, extent), ray.inverseDirection[axis]);
+        const Register slabExit = simd::mul(simd::add(offset, extent), ray.inverseDirection[axis]);
+        entryDistance = simd::max(entryDistance, simd::min(slabEntry, slabExit));
+        exitDistance = simd::min(exitDistance, simd::max(slabEntry, slabExit));
+    }
+    outDistance = entryDistance;
+    return simd::bitAnd(simd::cmpLe(entryDistance, exitDistance), simd::cmpLt(entryDistance, maxDistance));
+}
+
+/// @brief Updates @p hit with the closest intersection of the packets of Width triangles starting at @p first.
+/// @return The index of the first triangle left, past the last whole packet.
+template <Int32 Width>
+Int32 intersectTrianglePackets(
+    const Ray<Float32>& ray, const TriangleStreams<Float32>& triangles, Int32 first, RayHit<Float32>& hit
+) noexcept
+{
+    using Register = typename PacketRegister<Width>::Type;
+
+    const RayPacket<Width> packet(ray);
+    const Int32 count = triangles.vertices[0][0].size();
+    for (; first + Width <= count; first += Width)
+    {
+        Register distance;
+        Register u;
+        Register v;
+        const Register maxDistance = PacketRegister<Width>::splat(hit.distance);
+        UInt32 mask =
+            simd::moveMask(intersectTrianglePacket<Width>(packet, triangles, first, maxDistance, distance, u, v));
+        if (mask == 0)
+        {
+            continue;
+        }
+
+        alignas(simd::kRegister8Alignment) Float32 distances[Width];
+        alignas(simd::kRegister8Alignment) Float32 us[Width];
+        alignas(simd::kRegister8Alignment) Float32 vs[Width];
+        simd::store(distances, distance);
+        simd::store(us, u);
+        simd::store(vs, v);
+        for (; mask != 0; mask &= mask - 1)
+        {
+            const Int32 lane = static_cast<Int32>(math::countTrailingZeros(mask));
+            if (distances[lane] < hit.distance)
+            {
+                hit.distance = distances[lane];
+                hit.u = us[lane];
+                hit.v = vs[lane];
+                hit.index = first + lane;
+            }
+        }
+    }
+    return first;
+}
+
+/// @brief Checks whether the packets of Width triangles starting at @p first have any intersection.
+/// @param[in,out] first The index of the first triangle to test, set past the last whole packet tested.
+template <Int32 Width>
+bool intersectsAnyTrianglePacket(
+    const Ray<Float32>& ray, const TriangleStreams<Float32>& triangles, Int32& first, const Float32 maxDistance
+) noexcept
+{
+    using Register = typename PacketRegister<Width>::Type;
+
+    const RayPacket<Width> packet(ray);
+    const Register maxDistances = PacketRegister<Width>::splat(maxDistance);
+    const Int32 count = triangles.vertices[0][0].size();
+    for (; first + Width <= count; first += Width)
+    {
+        Register distance;
+        Register u;
+        Register v;
+        if (simd::anyTrue(intersectTrianglePacket<Width>(packet, triangles, first, maxDistances, distance, u, v)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief Intersects the packets of Width boxes starting at @p first, writing their entry distances.
+/// @param[in,out] first The index of the first box to test, set past the last whole packet tested.
+/// @return The number of boxes hit.
+template <Int32 Width>
+Int32 intersectBoxPackets(
+    const Ray<Float32>& ray,
+    const BoundingBoxStreams<Float32>& boxes,
+    Int32& first,
+    VectorView<Float32> outDistances,
+    const Float32 maxDistance
+) noexcept
+{
+    using Register = typename PacketRegister<Width>::Type;
+
+    const RayPacket<Width> packet(ray);
+    const Register maxDistances = PacketRegister<Width>::splat(maxDistance);
+    const Register misses = PacketRegister<Width>::splat(constants<Float32>::infinity);
+    const Int32 count = boxes.centers[0].size();
+    Int32 hitCount = 0;
+    for (; first + Width <= count; first += Width)
+    {
+        Register distance;
+        const Register mask = intersectBoxPacket<Width>(packet, boxes, first, maxDistances, distance);
+        simd::storeUnaligned(outDistances.data() + first, simd::select(mask, distance, misses));
+        hitCount += static_cast<Int32>(math::popCount(simd::moveMask(mask)));
+    }
+    return hitCount;
+}
+
+}   // namespace detail
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr bool
+    Ray<T>::intersectsTriangle(const Triangle<T>& triangle, RayHit<T>& outHit, const T maxDistance) const noexcept
+{
+    const Vector3<T> edge1 = triangle.v1 - triangle.v0;
+    const Vector3<T> edge2 = triangle.v2 - triangle.v0;
+    const Vector3<T> p = direction.cross(edge2);
+    const T determinant = edge1.dot(p);
+    if (determinant == T{ 0 })
+    {
+        return false;
+    }
+
+    // Cramer's rule on origin + t * direction = v0 + u * edge1 + v * edge2, one coordinate at a time. The determinant
+    // scales with the area of the triangle: no absolute threshold, which would miss small triangles, only the
+    // determinants that do not invert to a finite value.
+    const T inverseDeterminant = T{ 1 } / determinant;
+    if (!(math::abs(inverseDeterminant) < constants<T>::infinity))
+    {
+        return false;
+    }
+    const Vector3<T> offset = origin - triangle.v0;
+    const T u = offset.dot(p) * inverseDeterminant;
+    if (u < T{ 0 } || u > T{ 1 })
+    {
+        return false;
+    }
+
+    const Vector3<T> q = offset.cross(edge1);
+    const T v = direction.dot(q) * inverseDeterminant;
+    if (v < T{ 0 } || u + v > T{ 1 })
+    {
+        return false;
+    }
+
+    const T distance = edge2.dot(q) * inverseDeterminant;
+    if (distance < T{ 0 } || distance >= maxDistance)
+    {
+        return false;
+    }
+
+    outHit.distance = distance;
+    outHit.u = u;
+    outHit.v = v;
+    return true;
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr bool Ray<T>::intersectsBox(
+    const Vector3<T>& center, const Vector3<T>& extents, T& outDistance, const T maxDistance
+) const noexcept
+{
+    // The ray is inside the box on the intersection of the three intervals where it is between two opposite faces.
+    const Vector3<T> offset = center - origin;
+    const T offsets[3] = { offset.x, offset.y, offset.z };
+    const T halfSizes[3] = { extents.x, extents.y, extents.z };
+    const T directions[3] = { direction.x, direction.y, direction.z };
+
+    T entryDistance = T{ 0 };
+    T exitDistance = maxDistance;
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        const T inverseDirection = T{ 1 } / directions[axis];
+        const T slabEntry = (offsets[axis] - halfSizes[axis]) * inverseDirection;
+        const T slabExit = (offsets[axis] + halfSizes[axis]) * inverseDirection;
+        entryDistance = math::max(entryDistance, math::min(slabEntry, slabExit));
+        exitDistance = math::min(exitDistance, math::max(slabEntry, slabExit));
+    }
+
+    if (entryDistance > exitDistance || entryDistance >= maxDistance)
+    {
+        return false;
+    }
+    outDistance = entryDistance;
+    return true;
+}
+
+template <concepts::IsFloatingPoint T>
+bool Ray<T>::intersectTriangles(const TriangleStreams<T>& triangles, RayHit<T>& hit) const noexcept
+{
+    const Int32 count = triangles.vertices[0][0].size();
+    GP_ASSERT(detail::hasStreamsOfSize(triangles, count), "intersectTriangles() requires streams of the same size");
+
+    const Int32 previousIndex = hit.index;
+    hit.index = -1;
+    Int32 first = 0;
+    if constexpr (detail::kIsSimdRay<T>)
+    {
+        first = detail::intersectTrianglePackets<kPacketWidth>(*this, triangles, first, hit);
+        first = detail::intersectTrianglePackets<kPacketWidth / 2>(*this, triangles, first, hit);
+    }
+
+    for (; first < count; ++first)
+    {
+        if (intersectsTriangle(detail::loadTriangle(triangles, first), hit, hit.distance))
+        {
+            hit.index = first;
+        }
+    }
+
+    if (hit.index < 0)
+    {
+        hit.index = previousIndex;
+        return false;
+    }
+    return true;
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] bool
+    Ray<T>::intersectsAnyTriangle(const TriangleStreams<T>& triangles, const T maxDistance) const noexcept
+{
+    const Int32 count = triangles.vertices[0][0].size();
+    GP_ASSERT(detail::hasStreamsOfSize(triangles, count), "intersectsAnyTriangle() requires streams of the same size");
+
+    Int32 first = 0;
+    if constexpr (detail::kIsSimdRay<T>)
+    {
+        if (detail::intersectsAnyTrianglePacket<kPacketWidth>(*this, triangles, first, maxDistance) ||
+            detail::intersectsAnyTrianglePacket<kPacketWidth / 2>(*this, triangles, first, maxDistance))
+        {
+            return true;
+        }
+    }
+
+    RayHit<T> hit;
+    for (; first < count; ++first)
+    {
+        if (intersectsTriangle(detail::loadTriangle(triangles, first), hit, maxDistance))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <concepts::IsFloatingPoint T>
+Int32 Ray<T>::intersectBoxes(
+    const BoundingBoxStreams<T>& boxes, VectorView<T> outDistances, const T maxDistance
+) const noexcept
+{
+    const Int32 count = boxes.centers[0].size();
+    GP_ASSERT(
+        boxes.centers[1].size() == count && boxes.centers[2].size() == count && boxes.extents[0].size() == count &&
+            boxes.extents[1].size() == count && boxes.extents[2].size() == count,
+        "intersectBoxes() requires streams of the same size"
+    );
+    GP_ASSERT(outDistances.size() >= count, "intersectBoxes() requires one distance per box");
+
+    Int32 first = 0;
+    Int32 hitCount = 0;
+    if constexpr (detail::kIsSimdRay<T>)
+    {
+        hitCount += detail::intersectBoxPackets<kPacketWidth>(*this, boxes, first, outDistances, maxDistance);
+        hitCount += detail::intersectBoxPackets<kPacketWidth / 2>(*this, boxes, first, outDistances, maxDistance);
+    }
+
+    for (; first < count; ++first)
+    {
+        const Vector3<T> center(boxes.centers[0][first], boxes.centers[1][first], boxes.centers[2][first]);
+        const Vector3<T> extents(boxes.extents[0][first], boxes.extents[1][first], boxes.extents[2][first]);
+        outDistances[first] = constants<T>::infinity;
+        if (intersectsBox(center, extents, outDistances[first], maxDistance))
+        {
+            ++hitCount;
+        }
+    }
+    return hitCount;
+}
+
+}   // namespace gp::math
@@ -3,3 +3,92 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Constants.hpp"
+#include "maths/base/Scalar.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/vector/Vector3.hpp"
+
+namespace gp::math
+{
+
+/// @brief A sphere template, such as the bounding sphere of an object.
+/// @details Components are aligned like Vector4, so a Float32 sphere is one SIMD register.
+/// @tparam T The floating-point type for the sphere components.
+template <concepts::IsFloatingPoint T>
+struct alignas(sizeof(T) * 4) Sphere
+{
+public:
+    Vector3<T> center;   //<! The center of the sphere.
+    T radius;            //<! The radius of the sphere, non-negative.
+
+public:
+    /// @brief Default constructor initializes to a sphere of radius zero at the origin.
+    [[nodiscard]] constexpr Sphere() noexcept
+        : center(T{ 0 })
+        , radius(T{ 0 })
+    {}
+
+    /// @brief Constructor with individual components.
+    /// @param[in] inCenter The center of the sphere.
+    /// @param[in] inRadius The radius of the sphere, non-negative.
+    [[nodiscard]] constexpr Sphere(const Vector3<T>& inCenter, const T inRadius) noexcept
+        : center(inCenter)
+        , radius(inRadius)
+    {}
+
+public:
+    /// @brief Checks whether every component is exactly equal to the one of another sphere.
+    [[nodiscard]] constexpr bool operator==(const Sphere<T>& other) const noexcept
+    {
+        return center == other.center && radius == other.radius;
+    }
+
+    /// @brief Checks whether at least one component differs from the one of another sphere.
+    [[nodiscard]] constexpr bool operator!=(const Sphere<T>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+public:
+    /// @brief Checks whether a point lies inside the sphere or on its surface.
+    [[nodiscard]] constexpr bool contains(const Vector3<T>& point) const noexcept
+    {
+        return (point - center).lengthSquared() <= radius * radius;
+    }
+
+    /// @brief Checks whether two spheres overlap or touch.
+    [[nodiscard]] constexpr bool intersects(const Sphere<T>& other) const noexcept
+    {
+        const T radiusSum = radius + other.radius;
+        return (other.center - center).lengthSquared() <= radiusSum * radiusSum;
+    }
+
+    /// @brief Returns the smallest sphere enclosing this sphere and another one.
+    [[nodiscard]] constexpr Sphere<T> merged(const Sphere<T>& other) const noexcept
+    {
+        const Vector3<T> offset = other.center - center;
+        const T centerDistance = offset.length();
+        if (centerDistance + other.radius <= radius)
+        {
+            return *this;
+        }
+        if (centerDistance + radius <= other.radius)
+        {
+            return other;
+        }
+        const T mergedRadius = (centerDistance + radius + other.radius) * T{ 0.5 };
+        return Sphere<T>(center + offset * ((mergedRadius - radius) / centerDistance), mergedRadius);
+    }
+
+    /// @brief Checks whether this sphere is equal to another one within a given tolerance.
+    [[nodiscard]] constexpr bool
+        equals(const Sphere<T>& other, const T tolerance = constants<T>::kindaSmallNumber) const noexcept
+    {
+        return center.equals(other.center, tolerance) && math::abs(radius - other.radius) <= tolerance;
+    }
+};
+
+}   // namespace gp::math
@@ -3,3 +3,103 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Constants.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/vector/Vector3.hpp"
+
+namespace gp::math
+{
+
+/// @brief Triangles read by the batch queries, such as Ray::intersectTriangles(), in structure-of-arrays form.
+/// @details
+/// Each vertex of the triangles has one stream per axis, such as the fields of a SoAVector<T, T, T>, all streams
+/// being as long. Meshes are usually gathered in this form once, when their acceleration structure is built.
+/// @tparam T The floating-point type of the vertices.
+template <concepts::IsFloatingPoint T>
+struct TriangleStreams
+{
+    ConstVectorView<T> vertices[3][3];   //<! The vertices of the triangles, as vertices[vertex][axis].
+};
+
+/// @brief A triangle template, given by its three vertices.
+/// @details The front face is the one from which the vertices are seen counter-clockwise, as given by getNormal().
+/// @tparam T The floating-point type for the vertex components.
+template <concepts::IsFloatingPoint T>
+struct Triangle
+{
+public:
+    Vector3<T> v0;   //<! The first vertex.
+    Vector3<T> v1;   //<! The second vertex.
+    Vector3<T> v2;   //<! The third vertex.
+
+public:
+    /// @brief Default constructor initializes every vertex to the origin.
+    [[nodiscard]] constexpr Triangle() noexcept
+        : v0(T{ 0 })
+        , v1(T{ 0 })
+        , v2(T{ 0 })
+    {}
+
+    /// @brief Constructor with individual vertices.
+    /// @param[in] inV0 The first vertex.
+    /// @param[in] inV1 The second vertex.
+    /// @param[in] inV2 The third vertex.
+    [[nodiscard]] constexpr Triangle(const Vector3<T>& inV0, const Vector3<T>& inV1, const Vector3<T>& inV2) noexcept
+        : v0(inV0)
+        , v1(inV1)
+        , v2(inV2)
+    {}
+
+public:
+    /// @brief Checks whether every vertex is exactly equal to the one of another triangle.
+    [[nodiscard]] constexpr bool operator==(const Triangle<T>& other) const noexcept
+    {
+        return v0 == other.v0 && v1 == other.v1 && v2 == other.v2;
+    }
+
+    /// @brief Checks whether at least one vertex differs from the one of another triangle.
+    [[nodiscard]] constexpr bool operator!=(const Triangle<T>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+public:
+    /// @brief Returns the normal of the front face, of unit length, or zero for a degenerate triangle.
+    [[nodiscard]] constexpr Vector3<T> getNormal() const noexcept
+    {
+        return (v1 - v0).cross(v2 - v0).getSafeNormal();
+    }
+
+    /// @brief Returns the area of the triangle.
+    [[nodiscard]] constexpr T getArea() const noexcept
+    {
+        return (v1 - v0).cross(v2 - v0).length() * T{ 0.5 };
+    }
+
+    /// @brief Returns the center of mass of the triangle.
+    [[nodiscard]] constexpr Vector3<T> getCentroid() const noexcept
+    {
+        return (v0 + v1 + v2) / T{ 3 };
+    }
+
+    /// @brief Returns the point of barycentric coordinates (1 - u - v, u, v).
+    /// @param[in] u The weight of v1, as reported by Ray::intersectsTriangle().
+    /// @param[in] v The weight of v2, as reported by Ray::intersectsTriangle().
+    [[nodiscard]] constexpr Vector3<T> getPoint(const T u, const T v) const noexcept
+    {
+        return v0 * (T{ 1 } - u - v) + v1 * u + v2 * v;
+    }
+
+    /// @brief Checks whether this triangle is equal to another one within a given tolerance.
+    [[nodiscard]] constexpr bool
+        equals(const Triangle<T>& other, const T tolerance = constants<T>::kindaSmallNumber) const noexcept
+    {
+        return v0.equals(other.v0, tolerance) && v1.equals(other.v1, tolerance) && v2.equals(other.v2, tolerance);
+    }
+};
+
+}   // namespace gp::math
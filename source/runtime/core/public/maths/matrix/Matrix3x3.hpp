@@ -6,20 +6,161 @@
 
 #include "concepts/Concepts.hpp"
 #include "CoreMinimal.hpp"
+#include "maths/base/Constants.hpp"
+#include "maths/base/Scalar.hpp"
 #include "maths/MathForward.hpp"
+#include "maths/vector/Vector3.hpp"
 
 namespace gp::math
 {
 
-/// @brief
-/// @tparam T
+/// @brief A 3x3 matrix template, stored row by row.
+/// @details
+/// Follows the conventions of Matrix4x4: matrices transform column vectors, so a vector v becomes M * v and A * B
+/// applies B first. Mostly used to hold rotations and scales, e.g. when converting from and to quaternions.
+/// @tparam T The floating-point type for the matrix elements.
 template <concepts::IsFloatingPoint T>
 struct Matrix3x3
 {
 public:
-    T m00, m01, m02;
-    T m10, m11, m12;
-    T m20, m21, m22;
+    T m[3][3];   //<! The elements of the matrix, as m[row][column].
+
+public:
+    /// @brief Returns the identity matrix.
+    [[nodiscard]] static constexpr Matrix3x3<T> identity() noexcept
+    {
+        return Matrix3x3<T>();
+    }
+
+public:
+    /// @brief Default constructor initializes to the identity matrix.
+    [[nodiscard]] constexpr Matrix3x3() noexcept
+        : m{ { T{ 1 }, T{ 0 }, T{ 0 } }, { T{ 0 }, T{ 1 }, T{ 0 } }, { T{ 0 }, T{ 0 }, T{ 1 } } }
+    {}
+
+    /// @brief Constructor with individual elements, given row by row.
+    [[nodiscard]] constexpr Matrix3x3(
+        const T m00,
+        const T m01,
+        const T m02,
+        const T m10,
+        const T m11,
+        const T m12,
+        const T m20,
+        const T m21,
+        const T m22
+    ) noexcept
+        : m{ { m00, m01, m02 }, { m10, m11, m12 }, { m20, m21, m22 } }
+    {}
+
+    /// @brief Constructor from the three rows of the matrix.
+    [[nodiscard]] constexpr Matrix3x3(const Vector3<T>& row0, const Vector3<T>& row1, const Vector3<T>& row2) noexcept
+        : m{ { row0.x, row0.y, row0.z }, { row1.x, row1.y, row1.z }, { row2.x, row2.y, row2.z } }
+    {}
+
+public:
+    /// @brief Multiplies two matrices, the result applies @p other first and this matrix second.
+    [[nodiscard]] constexpr Matrix3x3<T> operator*(const Matrix3x3<T>& other) const noexcept
+    {
+        Matrix3x3<T> result;
+        for (Int32 row = 0; row < 3; ++row)
+        {
+            for (Int32 column = 0; column < 3; ++column)
+            {
+                result.m[row][column] =
+                    m[row][0] * other.m[0][column] + m[row][1] * other.m[1][column] + m[row][2] * other.m[2][column];
+            }
+        }
+        return result;
+    }
+
+    /// @brief Transforms a 3D column vector.
+    [[nodiscard]] constexpr Vector3<T> operator*(const Vector3<T>& vec) const noexcept
+    {
+        return Vector3<T>(
+            m[0][0] * vec.x + m[0][1] * vec.y + m[0][2] * vec.z,
+            m[1][0] * vec.x + m[1][1] * vec.y + m[1][2] * vec.z,
+            m[2][0] * vec.x + m[2][1] * vec.y + m[2][2] * vec.z
+        );
+    }
+
+    /// @brief Checks whether every element is exactly equal to the one of another matrix.
+    [[nodiscard]] constexpr bool operator==(const Matrix3x3<T>& other) const noexcept
+    {
+        for (Int32 row = 0; row < 3; ++row)
+        {
+            for (Int32 column = 0; column < 3; ++column)
+            {
+                if (m[row][column] != other.m[row][column])
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// @brief Checks whether at least one element differs from the one of another matrix.
+    [[nodiscard]] constexpr bool operator!=(const Matrix3x3<T>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    /// @brief Accesses the element at @p row and @p column.
+    [[nodiscard]] constexpr T& operator()(const Int32 row, const Int32 column) noexcept
+    {
+        GP_ASSERT(row >= 0 && row < 3 && column >= 0 && column < 3, "Matrix3x3 index out of range");
+        return m[row][column];
+    }
+
+    /// @brief Accesses the element at @p row and @p column.
+    [[nodiscard]] constexpr const T& operator()(const Int32 row, const Int32 column) const noexcept
+    {
+        GP_ASSERT(row >= 0 && row < 3 && column >= 0 && column < 3, "Matrix3x3 index out of range");
+        return m[row][column];
+    }
+
+public:
+    /// @brief Returns the row at @p index.
+    [[nodiscard]] constexpr Vector3<T> getRow(const Int32 index) const noexcept
+    {
+        return Vector3<T>(m[index][0], m[index][1], m[index][2]);
+    }
+
+    /// @brief Returns the column at @p index.
+    [[nodiscard]] constexpr Vector3<T> getColumn(const Int32 index) const noexcept
+    {
+        return Vector3<T>(m[0][index], m[1][index], m[2][index]);
+    }
+
+    /// @brief Checks whether this matrix is equal to another one within a given tolerance.
+    [[nodiscard]] constexpr bool
+        equals(const Matrix3x3<T>& other, const T tolerance = constants<T>::kindaSmallNumber) const noexcept
+    {
+        for (Int32 row = 0; row < 3; ++row)
+        {
+            for (Int32 column = 0; column < 3; ++column)
+            {
+                if (math::abs(m[row][column] - other.m[row][column]) > tolerance)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// @brief Computes the determinant of the matrix.
+    [[nodiscard]] constexpr T determinant() const noexcept
+    {
+        return getRow(0).dot(getRow(1).cross(getRow(2)));
+    }
+
+    /// @brief Returns the transpose of the matrix, which is also the inverse of a rotation.
+    [[nodiscard]] constexpr Matrix3x3<T> transposed() const noexcept
+    {
+        return Matrix3x3<T>(getColumn(0), getColumn(1), getColumn(2));
+    }
 };
 
 }   // namespace gp::math
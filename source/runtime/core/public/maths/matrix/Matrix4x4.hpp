@@ -5,22 +5,259 @@
 #pragma once
 
 #include "concepts/Concepts.hpp"
+#include "containers/views/StridedView.hpp"
+#include "containers/views/VectorView.hpp"
 #include "CoreMinimal.hpp"
+#include "maths/base/Constants.hpp"
+#include "maths/base/Scalar.hpp"
 #include "maths/MathForward.hpp"
+#include "maths/vector/Vector3.hpp"
+#include "maths/vector/Vector4.hpp"
 
 namespace gp::math
 {
 
-/// @brief
-/// @tparam T
+/// @brief A 4x4 matrix template, stored row by row.
+/// @details
+/// Matrices transform column vectors: a point p becomes M * p, the translation lives in the last column, and A * B
+/// applies B first. Rows are aligned like Vector4, so each row of a Float32 matrix is one SIMD register: multiplies,
+/// inverses, transposes and batch transforms use the maths/simd register layer, other types and constant evaluation
+/// use the scalar code.
+/// @tparam T The floating-point type for the matrix elements.
 template <concepts::IsFloatingPoint T>
-struct Matrix4x4
+struct alignas(sizeof(T) * 4) Matrix4x4
 {
 public:
-    T m00, m01, m02, m03;
-    T m10, m11, m12, m13;
-    T m20, m21, m22, m23;
-    T m30, m31, m32, m33;
+    T m[4][4];   //<! The elements of the matrix, as m[row][column].
+
+public:
+    /// @brief Returns the identity matrix.
+    [[nodiscard]] static constexpr Matrix4x4<T> identity() noexcept
+    {
+        return Matrix4x4<T>();
+    }
+
+    /// @brief Returns a matrix translating by @p offset.
+    /// @param[in] offset The translation.
+    [[nodiscard]] static constexpr Matrix4x4<T> makeTranslation(const Vector3<T>& offset) noexcept
+    {
+        Matrix4x4<T> result;
+        result.setTranslation(offset);
+        return result;
+    }
+
+    /// @brief Returns a matrix scaling each axis by the matching component of @p factors.
+    /// @param[in] factors The scale along x, y and z.
+    [[nodiscard]] static constexpr Matrix4x4<T> makeScale(const Vector3<T>& factors) noexcept
+    {
+        Matrix4x4<T> result;
+        result.m[0][0] = factors.x;
+        result.m[1][1] = factors.y;
+        result.m[2][2] = factors.z;
+        return result;
+    }
+
+public:
+    /// @brief Default constructor initializes to the identity matrix.
+    [[nodiscard]] constexpr Matrix4x4() noexcept
+        : m{ { T{ 1 }, T{ 0 }, T{ 0 }, T{ 0 } },
+             { T{ 0 }, T{ 1 }, T{ 0 }, T{ 0 } },
+             { T{ 0 }, T{ 0 }, T{ 1 }, T{ 0 } },
+             { T{ 0 }, T{ 0 }, T{ 0 }, T{ 1 } } }
+    {}
+
+    /// @brief Constructor with individual elements, given row by row.
+    [[nodiscard]] constexpr Matrix4x4(
+        const T m00,
+        const T m01,
+        const T m02,
+        const T m03,
+        const T m10,
+        const T m11,
+        const T m12,
+        const T m13,
+        const T m20,
+        const T m21,
+        const T m22,
+        const T m23,
+        const T m30,
+        const T m31,
+        const T m32,
+        const T m33
+    ) noexcept
+        : m{ { m00, m01, m02, m03 }, { m10, m11, m12, m13 }, { m20, m21, m22, m23 }, { m30, m31, m32, m33 } }
+    {}
+
+    /// @brief Constructor from the four rows of the matrix.
+    [[nodiscard]] constexpr Matrix4x4(
+        const Vector4<T>& row0, const Vector4<T>& row1, const Vector4<T>& row2, const Vector4<T>& row3
+    ) noexcept
+        : m{ { row0.x, row0.y, row0.z, row0.w },
+             { row1.x, row1.y, row1.z, row1.w },
+             { row2.x, row2.y, row2.z, row2.w },
+             { row3.x, row3.y, row3.z, row3.w } }
+    {}
+
+public:
+    /// @brief Multiplies two matrices, the result applies @p other first and this matrix second.
+    [[nodiscard]] constexpr Matrix4x4<T> operator*(const Matrix4x4<T>& other) const noexcept;
+
+    /// @brief Transforms a 4D column vector.
+    [[nodiscard]] constexpr Vector4<T> operator*(const Vector4<T>& vec) const noexcept;
+
+    /// @brief Multiplies this matrix by another one, this = this * other.
+    constexpr Matrix4x4<T>& operator*=(const Matrix4x4<T>& other) noexcept
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    /// @brief Checks whether every element is exactly equal to the one of another matrix.
+    [[nodiscard]] constexpr bool operator==(const Matrix4x4<T>& other) const noexcept
+    {
+        for (Int32 row = 0; row < 4; ++row)
+        {
+            for (Int32 column = 0; column < 4; ++column)
+            {
+                if (m[row][column] != other.m[row][column])
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// @brief Checks whether at least one element differs from the one of another matrix.
+    [[nodiscard]] constexpr bool operator!=(const Matrix4x4<T>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    /// @brief Accesses the element at @p row and @p column.
+    [[nodiscard]] constexpr T& operator()(const Int32 row, const Int32 column) noexcept
+    {
+        GP_ASSERT(row >= 0 && row < 4 && column >= 0 && column < 4, "Matrix4x4 index out of range");
+        return m[row][column];
+    }
+
+    /// @brief Accesses the element at @p row and @p column.
+    [[nodiscard]] constexpr const T& operator()(const Int32 row, const Int32 column) const noexcept
+    {
+        GP_ASSERT(row >= 0 && row < 4 && column >= 0 && column < 4, "Matrix4x4 index out of range");
+        return m[row][column];
+    }
+
+public:
+    /// @brief Returns the row at @p index.
+    [[nodiscard]] constexpr Vector4<T> getRow(const Int32 index) const noexcept
+    {
+        return Vector4<T>(m[index][0], m[index][1], m[index][2], m[index][3]);
+    }
+
+    /// @brief Returns the column at @p index.
+    [[nodiscard]] constexpr Vector4<T> getColumn(const Int32 index) const noexcept
+    {
+        return Vector4<T>(m[0][index], m[1][index], m[2][index], m[3][index]);
+    }
+
+    /// @brief Returns the translation held by the last column.
+    [[nodiscard]] constexpr Vector3<T> getTranslation() const noexcept
+    {
+        return Vector3<T>(m[0][3], m[1][3], m[2][3]);
+    }
+
+    /// @brief Replaces the translation held by the last column.
+    constexpr void setTranslation(const Vector3<T>& offset) noexcept
+    {
+        m[0][3] = offset.x;
+        m[1][3] = offset.y;
+        m[2][3] = offset.z;
+    }
+
+    /// @brief Checks whether the last row is (0, 0, 0, 1), the precondition of inverseAffine().
+    /// @note transformPoint() and the batch transforms do not require it: they ignore the last row.
+    [[nodiscard]] constexpr bool isAffine() const noexcept
+    {
+        return m[3][0] == T{ 0 } && m[3][1] == T{ 0 } && m[3][2] == T{ 0 } && m[3][3] == T{ 1 };
+    }
+
+    /// @brief Checks whether this matrix is equal to another one within a given tolerance.
+    [[nodiscard]] constexpr bool
+        equals(const Matrix4x4<T>& other, const T tolerance = constants<T>::kindaSmallNumber) const noexcept
+    {
+        for (Int32 row = 0; row < 4; ++row)
+        {
+            for (Int32 column = 0; column < 4; ++column)
+            {
+                if (math::abs(m[row][column] - other.m[row][column]) > tolerance)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// @brief Computes the determinant of the matrix.
+    [[nodiscard]] constexpr T determinant() const noexcept;
+
+    /// @brief Returns the transpose of the matrix.
+    [[nodiscard]] constexpr Matrix4x4<T> transposed() const noexcept;
+
+    /// @brief Returns the inverse of the matrix.
+    /// @note A singular matrix gives non-finite elements: check determinant() first when the input is not trusted.
+    [[nodiscard]] constexpr Matrix4x4<T> inverse() const noexcept;
+
+    /// @brief Returns the inverse of an affine matrix, about three times cheaper than inverse().
+    /// @details Inverts the upper 3x3 block and applies it to the opposite translation. The last row must be
+    /// (0, 0, 0, 1), see isAffine().
+    [[nodiscard]] constexpr Matrix4x4<T> inverseAffine() const noexcept;
+
+    /// @brief Transforms a point, applying the translation.
+    [[nodiscard]] constexpr Vector3<T> transformPoint(const Vector3<T>& point) const noexcept
+    {
+        return Vector3<T>(
+            m[0][0] * point.x + m[0][1] * point.y + m[0][2] * point.z + m[0][3],
+            m[1][0] * point.x + m[1][1] * point.y + m[1][2] * point.z + m[1][3],
+            m[2][0] * point.x + m[2][1] * point.y + m[2][2] * point.z + m[2][3]
+        );
+    }
+
+    /// @brief Transforms a direction, ignoring the translation.
+    [[nodiscard]] constexpr Vector3<T> transformVector(const Vector3<T>& vec) const noexcept
+    {
+        return Vector3<T>(
+            m[0][0] * vec.x + m[0][1] * vec.y + m[0][2] * vec.z,
+            m[1][0] * vec.x + m[1][1] * vec.y + m[1][2] * vec.z,
+            m[2][0] * vec.x + m[2][1] * vec.y + m[2][2] * vec.z
+        );
+    }
+
+    /// @brief Transforms a batch of points, applying the translation.
+    /// @details Float32 batches are processed four points at a time. The last row of the matrix is ignored, as by
+    /// transformPoint(), so the matrix does not need to pass isAffine(): use operator* on Vector4 for projections.
+    /// @param[in] input Points to transform.
+    /// @param[out] output Transformed points, as many as @p input. May be the same memory as @p input, but must not
+    /// partially overlap it.
+    void transformPoints(ConstVectorView<Vector3<T>> input, VectorView<Vector3<T>> output) const noexcept;
+
+    /// @brief Transforms a batch of points read from and written to interleaved buffers.
+    /// @copydetails transformPoints(ConstVectorView<Vector3<T>>, VectorView<Vector3<T>>) const
+    void transformPoints(ConstStridedView<Vector3<T>> input, StridedView<Vector3<T>> output) const noexcept;
+
+    /// @brief Transforms a batch of directions, ignoring the translation.
+    /// @param[in] input Directions to transform.
+    /// @param[out] output Transformed directions, as many as @p input. May be the same memory as @p input, but must
+    /// not partially overlap it.
+    void transformVectors(ConstVectorView<Vector3<T>> input, VectorView<Vector3<T>> output) const noexcept;
+
+    /// @brief Transforms a batch of directions read from and written to interleaved buffers.
+    /// @copydetails transformVectors(ConstVectorView<Vector3<T>>, VectorView<Vector3<T>>) const
+    void transformVectors(ConstStridedView<Vector3<T>> input, StridedView<Vector3<T>> output) const noexcept;
 };
 
 }   // namespace gp::math
+
+// Include the implementation of the Matrix4x4 template
+#include "maths/matrix/Matrix4x4.inl"
@@ -0,0 +1,495 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "maths/matrix/Matrix4x4.hpp"
+#include "maths/simd/VectorRegister.hpp"
+#include <type_traits>
+
+namespace gp::math
+{
+
+namespace detail
+{
+
+/// @brief Whether matrices of T go through the SIMD register layer, which handles four Float32 lanes.
+template <typename T>
+inline constexpr bool kIsSimdMatrix = std::is_same_v<T, Float32>;
+
+/// @brief Transposes the 4x4 block held by four registers, in place.
+GP_FORCEINLINE void transpose(
+    simd::VectorRegister4f& row0,
+    simd::VectorRegister4f& row1,
+    simd::VectorRegister4f& row2,
+    simd::VectorRegister4f& row3
+) noexcept
+{
+    const simd::VectorRegister4f low01 = simd::interleaveLow(row0, row1);
+    const simd::VectorRegister4f low23 = simd::interleaveLow(row2, row3);
+    const simd::VectorRegister4f high01 = simd::interleaveHigh(row0, row1);
+    const simd::VectorRegister4f high23 = simd::interleaveHigh(row2, row3);
+    row0 = simd::shuffle<0, 1, 0, 1>(low01, low23);
+    row1 = simd::shuffle<2, 3, 2, 3>(low01, low23);
+    row2 = simd::shuffle<0, 1, 0, 1>(high01, high23);
+    row3 = simd::shuffle<2, 3, 2, 3>(high01, high23);
+}
+
+/// @brief Multiplies two 2x2 matrices packed row by row in one register each: a * b.
+GP_FORCEINLINE simd::VectorRegister4f multiply2x2(simd::VectorRegister4f a, simd::VectorRegister4f b) noexcept
+{
+    return simd::madd(
+        a, simd::swizzle<0, 3, 0, 3>(b), simd::mul(simd::swizzle<1, 0, 3, 2>(a), simd::swizzle<2, 1, 2, 1>(b))
+    );
+}
+
+/// @brief Multiplies the adjugate of a packed 2x2 matrix by another one: adj(a) * b.
+GP_FORCEINLINE simd::VectorRegister4f adjugateMultiply2x2(simd::VectorRegister4f a, simd::VectorRegister4f b) noexcept
+{
+    return simd::sub(
+        simd::mul(simd::swizzle<3, 3, 0, 0>(a), b),
+        simd::mul(simd::swizzle<1, 1, 2, 2>(a), simd::swizzle<2, 3, 0, 1>(b))
+    );
+}
+
+/// @brief Multiplies a packed 2x2 matrix by the adjugate of another one: a * adj(b).
+GP_FORCEINLINE simd::VectorRegister4f multiplyAdjugate2x2(simd::VectorRegister4f a, simd::VectorRegister4f b) noexcept
+{
+    return simd::sub(
+        simd::mul(a, simd::swizzle<3, 0, 3, 0>(b)),
+        simd::mul(simd::swizzle<1, 0, 3, 2>(a), simd::swizzle<2, 1, 2, 1>(b))
+    );
+}
+
+/// @brief Transforms four points or directions held as x, y and z registers, by the upper 3x4 block of a matrix.
+template <bool IsPoint>
+GP_FORCEINLINE void transform4(
+    const simd::VectorRegister4f (&elements)[3][4],
+    simd::VectorRegister4f& x,
+    simd::VectorRegister4f& y,
+    simd::VectorRegister4f& z
+) noexcept
+{
+    simd::VectorRegister4f results[3];
+    for (Int32 row = 0; row < 3; ++row)
+    {
+        simd::VectorRegister4f result = simd::mul(elements[row][0], x);
+        result = simd::madd(elements[row][1], y, result);
+        result = simd::madd(elements[row][2], z, result);
+        if constexpr (IsPoint)
+        {
+            result = simd::add(result, elements[row][3]);
+        }
+        results[row] = result;
+    }
+    x = results[0];
+    y = results[1];
+    z = results[2];
+}
+
+/// @brief Transforms contiguous Float32 points or directions, four at a time.
+template <bool IsPoint>
+void transformBatch(
+    const Matrix4x4<Float32>& matrix, const Vector3<Float32>* input, Vector3<Float32>* output, USize count
+) noexcept
+{
+    static_assert(sizeof(Vector3<Float32>) == 3 * sizeof(Float32), "Vector3 must be tightly packed");
+
+    simd::VectorRegister4f elements[3][4];
+    for (Int32 row = 0; row < 3; ++row)
+    {
+        for (Int32 column = 0; column < 4; ++column)
+        {
+            elements[row][column] = simd::splat4f(matrix.m[row][column]);
+        }
+    }
+
+    const Float32* source = reinterpret_cast<const Float32*>(input);
+    Float32* destination = reinterpret_cast<Float32*>(output);
+    USize index = 0;
+    for (; index + 4 <= count; index += 4, source += 12, destination += 12)
+    {
+        // Deinterleave x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 into one register per component.
+        const simd::VectorRegister4f block0 = simd::loadUnaligned4f(source);
+        const simd::VectorRegister4f block1 = simd::loadUnaligned4f(source + 4);
+        const simd::VectorRegister4f block2 = simd::loadUnaligned4f(source + 8);
+        simd::VectorRegister4f x = simd::shuffle<0, 3, 0, 2>(block0, simd::shuffle<2, 2, 1, 1>(block1, block2));
+        simd::VectorRegister4f y = simd::shuffle<0, 2, 0, 2>(
+            simd::shuffle<1, 1, 0, 0>(block0, block1), simd::shuffle<3, 3, 2, 2>(block1, block2)
+        );
+        simd::VectorRegister4f z = simd::shuffle<0, 2, 0, 2>(
+            simd::shuffle<2, 2, 1, 1>(block0, block1), simd::shuffle<0, 0, 3, 3>(block2, block2)
+        );
+
+        transform4<IsPoint>(elements, x, y, z);
+
+        simd::storeUnaligned(
+            destination, simd::shuffle<0, 2, 0, 2>(simd::shuffle<0, 0, 0, 0>(x, y), simd::shuffle<0, 0, 1, 1>(z, x))
+        );
+        simd::storeUnaligned(
+            destination + 4, simd::shuffle<0, 2, 0, 2>(simd::shuffle<1, 1, 1, 1>(y, z), simd::shuffle<2, 2, 2, 2>(x, y))
+        );
+        simd::storeUnaligned(
+            destination + 8, simd::shuffle<0, 2, 0, 2>(simd::shuffle<2, 2, 3, 3>(z, x), simd::shuffle<3, 3, 3, 3>(y, z))
+        );
+    }
+
+    for (; index < count; ++index)
+    {
+        output[index] = IsPoint ? matrix.transformPoint(input[index]) : matrix.transformVector(input[index]);
+    }
+}
+
+/// @brief Transforms strided Float32 points or directions, gathering four of them at a time.
+template <bool IsPoint>
+void transformBatch(
+    const Matrix4x4<Float32>& matrix, ConstStridedView<Vector3<Float32>> input, StridedView<Vector3<Float32>> output
+) noexcept
+{
+    simd::VectorRegister4f elements[3][4];
+    for (Int32 row = 0; row < 3; ++row)
+    {
+        for (Int32 column = 0; column < 4; ++column)
+        {
+            elements[row][column] = simd::splat4f(matrix.m[row][column]);
+        }
+    }
+
+    const Int32 count = input.size();
+    Int32 index = 0;
+    for (; index + 4 <= count; index += 4)
+    {
+        const Vector3<Float32>& point0 = input[index];
+        const Vector3<Float32>& point1 = input[index + 1];
+        const Vector3<Float32>& point2 = input[index + 2];
+        const Vector3<Float32>& point3 = input[index + 3];
+        simd::VectorRegister4f x = simd::set4f(point0.x, point1.x, point2.x, point3.x);
+        simd::VectorRegister4f y = simd::set4f(point0.y, point1.y, point2.y, point3.y);
+        simd::VectorRegister4f z = simd::set4f(point0.z, point1.z, point2.z, point3.z);
+
+        transform4<IsPoint>(elements, x, y, z);
+
+        alignas(simd::kRegister4Alignment) Float32 lanes[3][4];
+        simd::store(lanes[0], x);
+        simd::store(lanes[1], y);
+        simd::store(lanes[2], z);
+        for (Int32 lane = 0; lane < 4; ++lane)
+        {
+            output[index + lane] = Vector3<Float32>(lanes[0][lane], lanes[1][lane], lanes[2][lane]);
+        }
+    }
+
+    for (; index < count; ++index)
+    {
+        output[index] = IsPoint ? matrix.transformPoint(input[index]) : matrix.transformVector(input[index]);
+    }
+}
+
+}   // namespace detail
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Matrix4x4<T> Matrix4x4<T>::operator*(const Matrix4x4<T>& other) const noexcept
+{
+    Matrix4x4<T> result;
+    if !consteval
+    {
+        if constexpr (detail::kIsSimdMatrix<T>)
+        {
+            // Each row of the result is the rows of other weighted by the elements of the matching row of this.
+            const simd::VectorRegister4f otherRows[4] = {
+                simd::load4f(other.m[0]), simd::load4f(other.m[1]), simd::load4f(other.m[2]), simd::load4f(other.m[3])
+            };
+            for (Int32 row = 0; row < 4; ++row)
+            {
+                const simd::VectorRegister4f thisRow = simd::load4f(m[row]);
+                simd::VectorRegister4f sum = simd::mul(simd::swizzle<0, 0, 0, 0>(thisRow), otherRows[0]);
+                sum = simd::madd(simd::swizzle<1, 1, 1, 1>(thisRow), otherRows[1], sum);
+                sum = simd::madd(simd::swizzle<2, 2, 2, 2>(thisRow), otherRows[2], sum);
+                sum = simd::madd(simd::swizzle<3, 3, 3, 3>(thisRow), otherRows[3], sum);
+                simd::store(result.m[row], sum);
+            }
+            return result;
+        }
+    }
+
+    for (Int32 row = 0; row < 4; ++row)
+    {
+        for (Int32 column = 0; column < 4; ++column)
+        {
+            result.m[row][column] = m[row][0] * other.m[0][column] + m[row][1] * other.m[1][column] +
+                                    m[row][2] * other.m[2][column] + m[row][3] * other.m[3][column];
+        }
+    }
+    return result;
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Vector4<T> Matrix4x4<T>::operator*(const Vector4<T>& vec) const noexcept
+{
+    return Vector4<T>(
+        m[0][0] * vec.x + m[0][1] * vec.y + m[0][2] * vec.z + m[0][3] * vec.w,
+        m[1][0] * vec.x + m[1][1] * vec.y + m[1][2] * vec.z + m[1][3] * vec.w,
+        m[2][0] * vec.x + m[2][1] * vec.y + m[2][2] * vec.z + m[2][3] * vec.w,
+        m[3][0] * vec.x + m[3][1] * vec.y + m[3][2] * vec.z + m[3][3] * vec.w
+    );
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr T Matrix4x4<T>::determinant() const noexcept
+{
+    const T s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+    const T s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+    const T s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+    const T s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+    const T s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+    const T s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+    const T c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+    const T c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+    const T c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+    const T c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+    const T c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+    const T c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Matrix4x4<T> Matrix4x4<T>::transposed() const noexcept
+{
+    Matrix4x4<T> result;
+    if !consteval
+    {
+        if constexpr (detail::kIsSimdMatrix<T>)
+        {
+            simd::VectorRegister4f row0 = simd::load4f(m[0]);
+            simd::VectorRegister4f row1 = simd::load4f(m[1]);
+            simd::VectorRegister4f row2 = simd::load4f(m[2]);
+            simd::VectorRegister4f row3 = simd::load4f(m[3]);
+            detail::transpose(row0, row1, row2, row3);
+            simd::store(result.m[0], row0);
+            simd::store(result.m[1], row1);
+            simd::store(result.m[2], row2);
+            simd::store(result.m[3], row3);
+            return result;
+        }
+    }
+
+    for (Int32 row = 0; row < 4; ++row)
+    {
+        for (Int32 column = 0; column < 4; ++column)
+        {
+            result.m[row][column] = m[column][row];
+        }
+    }
+    return result;
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Matrix4x4<T> Matrix4x4<T>::inverse() const noexcept
+{
+    Matrix4x4<T> result;
+    if !consteval
+    {
+        if constexpr (detail::kIsSimdMatrix<T>)
+        {
+            // Block-wise inversion on the four 2x2 sub-matrices | A B |
+            //                                                  | C D |, each packed in one register.
+            const simd::VectorRegister4f row0 = simd::load4f(m[0]);
+            const simd::VectorRegister4f row1 = simd::load4f(m[1]);
+            const simd::VectorRegister4f row2 = simd::load4f(m[2]);
+            const simd::VectorRegister4f row3 = simd::load4f(m[3]);
+            const simd::VectorRegister4f a = simd::shuffle<0, 1, 0, 1>(row0, row1);
+            const simd::VectorRegister4f b = simd::shuffle<2, 3, 2, 3>(row0, row1);
+            const simd::VectorRegister4f c = simd::shuffle<0, 1, 0, 1>(row2, row3);
+            const simd::VectorRegister4f d = simd::shuffle<2, 3, 2, 3>(row2, row3);
+
+            // Determinants of the sub-matrices, as (|A|, |B|, |C|, |D|).
+            const simd::VectorRegister4f subDeterminants = simd::sub(
+                simd::mul(simd::shuffle<0, 2, 0, 2>(row0, row2), simd::shuffle<1, 3, 1, 3>(row1, row3)),
+                simd::mul(simd::shuffle<1, 3, 1, 3>(row0, row2), simd::shuffle<0, 2, 0, 2>(row1, row3))
+            );
+            const simd::VectorRegister4f detA = simd::swizzle<0, 0, 0, 0>(subDeterminants);
+            const simd::VectorRegister4f detB = simd::swizzle<1, 1, 1, 1>(subDeterminants);
+            const simd::VectorRegister4f detC = simd::swizzle<2, 2, 2, 2>(subDeterminants);
+            const simd::VectorRegister4f detD = simd::swizzle<3, 3, 3, 3>(subDeterminants);
+
+            const simd::VectorRegister4f adjDTimesC = detail::adjugateMultiply2x2(d, c);
+            const simd::VectorRegister4f adjATimesB = detail::adjugateMultiply2x2(a, b);
+            simd::VectorRegister4f x = simd::sub(simd::mul(detD, a), detail::multiply2x2(b, adjDTimesC));
+            simd::VectorRegister4f w = simd::sub(simd::mul(detA, d), detail::multiply2x2(c, adjATimesB));
+            simd::VectorRegister4f y = simd::sub(simd::mul(detB, c), detail::multiplyAdjugate2x2(d, adjATimesB));
+            simd::VectorRegister4f z = simd::sub(simd::mul(detC, b), detail::multiplyAdjugate2x2(a, adjDTimesC));
+
+            // |M| = |A| |D| + |B| |C| - tr(adj(A) B adj(D) C).
+            const Float32 trace = simd::reduceAdd(simd::mul(adjATimesB, simd::swizzle<0, 2, 1, 3>(adjDTimesC)));
+            const simd::VectorRegister4f determinant =
+                simd::sub(simd::madd(detA, detD, simd::mul(detB, detC)), simd::splat4f(trace));
+            const simd::VectorRegister4f inverseDeterminant =
+                simd::div(simd::set4f(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+
+            x = simd::mul(x, inverseDeterminant);
+            y = simd::mul(y, inverseDeterminant);
+            z = simd::mul(z, inverseDeterminant);
+            w = simd::mul(w, inverseDeterminant);
+
+            // The shuffles apply the adjugate of the blocks and put them back in place.
+            simd::store(result.m[0], simd::shuffle<3, 1, 3, 1>(x, y));
+            simd::store(result.m[1], simd::shuffle<2, 0, 2, 0>(x, y));
+            simd::store(result.m[2], simd::shuffle<3, 1, 3, 1>(z, w));
+            simd::store(result.m[3], simd::shuffle<2, 0, 2, 0>(z, w));
+            return result;
+        }
+    }
+
+    const T s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+    const T s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+    const T s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+    const T s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+    const T s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+    const T s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+    const T c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+    const T c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+    const T c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+    const T c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+    const T c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+    const T c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+    const T inverseDeterminant = T{ 1 } / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+    result.m[0][0] = (m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * inverseDeterminant;
+    result.m[0][1] = (-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * inverseDeterminant;
+    result.m[0][2] = (m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * inverseDeterminant;
+    result.m[0][3] = (-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * inverseDeterminant;
+    result.m[1][0] = (-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * inverseDeterminant;
+    result.m[1][1] = (m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * inverseDeterminant;
+    result.m[1][2] = (-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * inverseDeterminant;
+    result.m[1][3] = (m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * inverseDeterminant;
+    result.m[2][0] = (m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * inverseDeterminant;
+    result.m[2][1] = (-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * inverseDeterminant;
+    result.m[2][2] = (m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * inverseDeterminant;
+    result.m[2][3] = (-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * inverseDeterminant;
+    result.m[3][0] = (-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * inverseDeterminant;
+    result.m[3][1] = (m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * inverseDeterminant;
+    result.m[3][2] = (-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * inverseDeterminant;
+    result.m[3][3] = (m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * inverseDeterminant;
+    return result;
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Matrix4x4<T> Matrix4x4<T>::inverseAffine() const noexcept
+{
+    GP_ASSERT(isAffine(), "inverseAffine() requires a (0, 0, 0, 1) last row");
+
+    // The inverse of the 3x3 block has the cross products of its rows as columns, divided by the determinant.
+    const Vector3<T> row0(m[0][0], m[0][1], m[0][2]);
+    const Vector3<T> row1(m[1][0], m[1][1], m[1][2]);
+    const Vector3<T> row2(m[2][0], m[2][1], m[2][2]);
+    const Vector3<T> column0 = row1.cross(row2);
+    const Vector3<T> column1 = row2.cross(row0);
+    const Vector3<T> column2 = row0.cross(row1);
+    const T inverseDeterminant = T{ 1 } / row0.dot(column0);
+
+    Matrix4x4<T> result(
+        column0.x * inverseDeterminant,
+        column1.x * inverseDeterminant,
+        column2.x * inverseDeterminant,
+        T{ 0 },
+        column0.y * inverseDeterminant,
+        column1.y * inverseDeterminant,
+        column2.y * inverseDeterminant,
+        T{ 0 },
+        column0.z * inverseDeterminant,
+        column1.z * inverseDeterminant,
+        column2.z * inverseDeterminant,
+        T{ 0 },
+        T{ 0 },
+        T{ 0 },
+        T{ 0 },
+        T{ 1 }
+    );
+    result.setTranslation(-result.transformVector(getTranslation()));
+    return result;
+}
+
+template <concepts::IsFloatingPoint T>
+void Matrix4x4<T>::transformPoints(ConstVectorView<Vector3<T>> input, VectorView<Vector3<T>> output) const noexcept
+{
+    GP_ASSERT(input.size() == output.size(), "transformPoints() requires as many outputs as inputs");
+    if constexpr (detail::kIsSimdMatrix<T>)
+    {
+        detail::transformBatch<true>(*this, input.data(), output.data(), static_cast<USize>(input.size()));
+    }
+    else
+    {
+        for (Int32 index = 0; index < input.size(); ++index)
+        {
+            output[index] = transformPoint(input[index]);
+        }
+    }
+}
+
+template <concepts::IsFloatingPoint T>
+void Matrix4x4<T>::transformPoints(ConstStridedView<Vector3<T>> input, StridedView<Vector3<T>> output) const noexcept
+{
+    GP_ASSERT(input.size() == output.size(), "transformPoints() requires as many outputs as inputs");
+    if constexpr (detail::kIsSimdMatrix<T>)
+    {
+        if (input.isContiguous() && output.isContiguous() && !input.isEmpty())
+        {
+            detail::transformBatch<true>(*this, &input[0], &output[0], static_cast<USize>(input.size()));
+        }
+        else
+        {
+            detail::transformBatch<true>(*this, input, output);
+        }
+    }
+    else
+    {
+        for (Int32 index = 0; index < input.size(); ++index)
+        {
+            output[index] = transformPoint(input[index]);
+        }
+    }
+}
+
+template <concepts::IsFloatingPoint T>
+void Matrix4x4<T>::transformVectors(ConstVectorView<Vector3<T>> input, VectorView<Vector3<T>> output) const noexcept
+{
+    GP_ASSERT(input.size() == output.size(), "transformVectors() requires as many outputs as inputs");
+    if constexpr (detail::kIsSimdMatrix<T>)
+    {
+        detail::transformBatch<false>(*this, input.data(), output.data(), static_cast<USize>(input.size()));
+    }
+    else
+    {
+        for (Int32 index = 0; index < input.size(); ++index)
+        {
+            output[index] = transformVector(input[index]);
+        }
+    }
+}
+
+template <concepts::IsFloatingPoint T>
+void Matrix4x4<T>::transformVectors(ConstStridedView<Vector3<T>> input, StridedView<Vector3<T>> output) const noexcept
+{
+    GP_ASSERT(input.size() == output.size(), "transformVectors() requires as many outputs as inputs");
+    if constexpr (detail::kIsSimdMatrix<T>)
+    {
+        if (input.isContiguous() && output.isContiguous() && !input.isEmpty())
+        {
+            detail::transformBatch<false>(*this, &input[0], &output[0], static_cast<USize>(input.size()));
+        }
+        else
+        {
+            detail::transformBatch<false>(*this, input, output);
+        }
+    }
+    else
+    {
+        for (Int32 index = 0; index < input.size(); ++index)
+        {
+            output[index] = transformVector(input[index]);
+        }
+    }
+}
+
+}   // namespace gp::math
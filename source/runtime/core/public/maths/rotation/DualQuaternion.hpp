@@ -3,3 +3,211 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Constants.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/matrix/Matrix4x4.hpp"
+#include "maths/rotation/Quaternion.hpp"
+#include "maths/vector/Vector3.hpp"
+
+namespace gp::math
+{
+
+/// @brief Vertex streams read and written by DualQuaternion::skin(), in structure-of-arrays form.
+/// @details
+/// Every vertex is influenced by the same number of bones: its indices and weights are stored contiguously, vertex
+/// after vertex, and unused influences carry a weight of zero. Positions and normals have one stream per axis, such as
+/// the fields of a SoAVector<T, T, T>. The normal streams may be left empty to skin positions only.
+/// @tparam T The floating-point type of the vertex data.
+template <concepts::IsFloatingPoint T>
+struct SkinningStreams
+{
+    ConstVectorView<UInt16> boneIndices;   //<! Indices of the influencing bones, influences per vertex.
+    ConstVectorView<T> boneWeights;        //<! Weights of the influencing bones, summing to one for each vertex.
+    Int32 influences{ 4 };                 //<! Number of bones influencing each vertex.
+    ConstVectorView<T> positions[3];       //<! Bind pose positions, one stream per axis.
+    ConstVectorView<T> normals[3];         //<! Bind pose normals, one stream per axis, or empty.
+    VectorView<T> skinnedPositions[3];     //<! Skinned positions, one stream per axis.
+    VectorView<T> skinnedNormals[3];       //<! Skinned normals, one stream per axis, or empty.
+};
+
+/// @brief A dual quaternion template, representing a rigid transformation when normalized.
+/// @details
+/// The real part holds the rotation r and the dual part holds t * r / 2, t being the translation as a pure
+/// quaternion. Dual quaternions compose like matrices, A * B applies B first, and blend without the volume loss of
+/// linear matrix blending, which makes them the transforms of choice for skinning.
+/// @tparam T The floating-point type for the dual quaternion components.
+template <concepts::IsFloatingPoint T>
+struct DualQuaternion
+{
+public:
+    Quaternion<T> real;   //<! The rotation part.
+    Quaternion<T> dual;   //<! The translation part, half the translation multiplied by the rotation.
+
+public:
+    /// @brief Returns the identity transformation.
+    [[nodiscard]] static constexpr DualQuaternion<T> identity() noexcept
+    {
+        return DualQuaternion<T>();
+    }
+
+public:
+    /// @brief Default constructor initializes to the identity transformation.
+    [[nodiscard]] constexpr DualQuaternion() noexcept
+        : real()
+        , dual(T{ 0 }, T{ 0 }, T{ 0 }, T{ 0 })
+    {}
+
+    /// @brief Constructor with individual parts.
+    /// @param[in] inReal The real part.
+    /// @param[in] inDual The dual part.
+    [[nodiscard]] constexpr DualQuaternion(const Quaternion<T>& inReal, const Quaternion<T>& inDual) noexcept
+        : real(inReal)
+        , dual(inDual)
+    {}
+
+    /// @brief Constructor from a rotation followed by a translation.
+    /// @param[in] rotation The rotation, must be normalized.
+    /// @param[in] translation The translation, applied after the rotation.
+    [[nodiscard]] constexpr DualQuaternion(const Quaternion<T>& rotation, const Vector3<T>& translation) noexcept
+        : real(rotation)
+        , dual(Quaternion<T>(translation.x, translation.y, translation.z, T{ 0 }) * rotation * T{ 0.5 })
+    {}
+
+public:
+    /// @brief Composes two transformations, the result applies @p other first and this transformation second.
+    [[nodiscard]] constexpr DualQuaternion<T> operator*(const DualQuaternion<T>& other) const noexcept
+    {
+        return DualQuaternion<T>(real * other.real, real * other.dual + dual * other.real);
+    }
+
+    /// @brief Composes this transformation with another one, this = this * other.
+    constexpr DualQuaternion<T>& operator*=(const DualQuaternion<T>& other) noexcept
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    /// @brief Scales both parts, as used to blend dual quaternions.
+    [[nodiscard]] constexpr DualQuaternion<T> operator*(const T scale) const noexcept
+    {
+        return DualQuaternion<T>(real * scale, dual * scale);
+    }
+
+    /// @brief Adds two dual quaternions part by part, as used to blend them.
+    [[nodiscard]] constexpr DualQuaternion<T> operator+(const DualQuaternion<T>& other) const noexcept
+    {
+        return DualQuaternion<T>(real + other.real, dual + other.dual);
+    }
+
+    /// @brief Checks whether both parts are exactly equal to the ones of another dual quaternion.
+    [[nodiscard]] constexpr bool operator==(const DualQuaternion<T>& other) const noexcept
+    {
+        return real == other.real && dual == other.dual;
+    }
+
+    /// @brief Checks whether at least one part differs from the one of another dual quaternion.
+    [[nodiscard]] constexpr bool operator!=(const DualQuaternion<T>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+public:
+    /// @brief Returns the rotation of a normalized dual quaternion.
+    [[nodiscard]] constexpr Quaternion<T> getRotation() const noexcept
+    {
+        return real;
+    }
+
+    /// @brief Returns the translation of a normalized dual quaternion, the vector part of 2 * dual * conj(real).
+    [[nodiscard]] constexpr Vector3<T> getTranslation() const noexcept
+    {
+        const Vector3<T> realVector = real.getVector();
+        const Vector3<T> dualVector = dual.getVector();
+        return (dualVector * real.w - realVector * dual.w + realVector.cross(dualVector)) * T{ 2 };
+    }
+
+    /// @brief Returns the dual quaternion with both parts divided by the length of the real part.
+    /// @note The real part must not be zero, which holds for any blend of rotations sharing a hemisphere.
+    [[nodiscard]] constexpr DualQuaternion<T> normalized() const noexcept
+    {
+        return *this * math::inverseSqrt(real.lengthSquared());
+    }
+
+    /// @brief Returns the quaternion conjugate of both parts, which is the inverse of a normalized dual quaternion.
+    [[nodiscard]] constexpr DualQuaternion<T> conjugate() const noexcept
+    {
+        return DualQuaternion<T>(real.conjugate(), dual.conjugate());
+    }
+
+    /// @brief Checks whether this dual quaternion is equal to another one within a given tolerance.
+    [[nodiscard]] constexpr bool
+        equals(const DualQuaternion<T>& other, const T tolerance = constants<T>::kindaSmallNumber) const noexcept
+    {
+        return real.equals(other.real, tolerance) && dual.equals(other.dual, tolerance);
+    }
+
+    /// @brief Transforms a point by a normalized dual quaternion: rotation, then translation.
+    [[nodiscard]] constexpr Vector3<T> transformPoint(const Vector3<T>& point) const noexcept
+    {
+        return real.rotateVector(point) + getTranslation();
+    }
+
+    /// @brief Transforms a direction by a normalized dual quaternion, which only rotates it.
+    [[nodiscard]] constexpr Vector3<T> transformVector(const Vector3<T>& vec) const noexcept
+    {
+        return real.rotateVector(vec);
+    }
+
+    /// @brief Converts a normalized dual quaternion to an affine matrix.
+    [[nodiscard]] constexpr Matrix4x4<T> toMatrix() const noexcept
+    {
+        const Matrix3x3<T> rotation = real.toMatrix();
+        Matrix4x4<T> result;
+        for (Int32 row = 0; row < 3; ++row)
+        {
+            for (Int32 column = 0; column < 3; ++column)
+            {
+                result.m[row][column] = rotation.m[row][column];
+            }
+        }
+        result.setTranslation(getTranslation());
+        return result;
+    }
+
+public:
+    /// @brief Blends the bones influencing each vertex, with dual quaternion linear blending.
+    /// @details
+    /// Each influence is weighted into the sum, negated when its rotation lies in the opposite hemisphere of the
+    /// first influence, and the sum is normalized. Float32 bones are accumulated as SIMD registers.
+    /// @param[in] bones Normalized transformations of the bones.
+    /// @param[in] boneIndices Indices into @p bones, @p influences per vertex.
+    /// @param[in] boneWeights Weights matching @p boneIndices, summing to one for each vertex.
+    /// @param[in] influences Number of bones influencing each vertex, at least one.
+    /// @param[out] output The normalized blended transformation of each vertex.
+    static void blend(
+        ConstVectorView<DualQuaternion<T>> bones,
+        ConstVectorView<UInt16> boneIndices,
+        ConstVectorView<T> boneWeights,
+        const Int32 influences,
+        VectorView<DualQuaternion<T>> output
+    ) noexcept;
+
+    /// @brief Skins vertex positions and normals by their blended bones.
+    /// @details
+    /// Blends the bones like blend() and applies the result without storing it. Float32 vertices are skinned four at
+    /// a time: their blended transformations are transposed to one register per component, so positions and normals
+    /// are loaded and stored straight from the streams. Normals are only rotated, which keeps them unit length.
+    /// @param[in] bones Normalized transformations of the bones.
+    /// @param[in] streams Bone influences and vertex streams. Each output stream holds as many values as the matching
+    /// input stream, and may be the same memory.
+    static void skin(ConstVectorView<DualQuaternion<T>> bones, const SkinningStreams<T>& streams) noexcept;
+};
+
+}   // namespace gp::math
+
+// Include the implementation of the DualQuaternion template
+#include "maths/rotation/DualQuaternion.inl"
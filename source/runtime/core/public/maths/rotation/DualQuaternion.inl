@@ -0,0 +1,247 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "maths/rotation/DualQuaternion.hpp"
+#include "maths/simd/VectorRegister.hpp"
+
+namespace gp::math
+{
+
+namespace detail
+{
+
+/// @brief Sums the weighted bones influencing one vertex, flipping those in the opposite hemisphere of the first one.
+/// @return The blended transformation, not normalized.
+template <concepts::IsFloatingPoint T>
+DualQuaternion<T> blendInfluences(
+    ConstVectorView<DualQuaternion<T>> bones, const UInt16* indices, const T* weights, const Int32 influences
+) noexcept
+{
+    const DualQuaternion<T>& pivot = bones[indices[0]];
+    DualQuaternion<T> sum = pivot * weights[0];
+    for (Int32 influence = 1; influence < influences; ++influence)
+    {
+        const DualQuaternion<T>& bone = bones[indices[influence]];
+        const T weight = bone.real.dot(pivot.real) < T{ 0 } ? -weights[influence] : weights[influence];
+        sum = sum + bone * weight;
+    }
+    return sum;
+}
+
+/// @brief Sums the weighted Float32 bones influencing one vertex, one register per part.
+GP_FORCEINLINE void blendInfluences(
+    ConstVectorView<DualQuaternion<Float32>> bones,
+    const UInt16* indices,
+    const Float32* weights,
+    const Int32 influences,
+    simd::VectorRegister4f& real,
+    simd::VectorRegister4f& dual
+) noexcept
+{
+    const DualQuaternion<Float32>& pivot = bones[indices[0]];
+    const simd::VectorRegister4f pivotReal = simd::load4f(&pivot.real.x);
+    real = simd::mul(pivotReal, simd::splat4f(weights[0]));
+    dual = simd::mul(simd::load4f(&pivot.dual.x), simd::splat4f(weights[0]));
+    for (Int32 influence = 1; influence < influences; ++influence)
+    {
+        const DualQuaternion<Float32>& bone = bones[indices[influence]];
+        const simd::VectorRegister4f boneReal = simd::load4f(&bone.real.x);
+        const Float32 weight = simd::dot4(boneReal, pivotReal) < 0.0f ? -weights[influence] : weights[influence];
+        real = simd::madd(boneReal, simd::splat4f(weight), real);
+        dual = simd::madd(simd::load4f(&bone.dual.x), simd::splat4f(weight), dual);
+    }
+}
+
+/// @brief Computes the cross product of four pairs of vectors held one register per component.
+GP_FORCEINLINE void cross4(
+    simd::VectorRegister4f ax,
+    simd::VectorRegister4f ay,
+    simd::VectorRegister4f az,
+    simd::VectorRegister4f bx,
+    simd::VectorRegister4f by,
+    simd::VectorRegister4f bz,
+    simd::VectorRegister4f& x,
+    simd::VectorRegister4f& y,
+    simd::VectorRegister4f& z
+) noexcept
+{
+    x = simd::sub(simd::mul(ay, bz), simd::mul(az, by));
+    y = simd::sub(simd::mul(az, bx), simd::mul(ax, bz));
+    z = simd::sub(simd::mul(ax, by), simd::mul(ay, bx));
+}
+
+/// @brief Rotates four vectors held one register per component by four rotations, and scales the change.
+/// @details Computes v + scale * (r x (r x v + w v)), which rotates v by r when r is normalized and scale is 2. Passing
+/// 2 / |r|^2 as scale rotates by the normalized r without normalizing it first.
+GP_FORCEINLINE void rotate4(
+    const QuaternionLanes& rotation,
+    simd::VectorRegister4f scale,
+    simd::VectorRegister4f& x,
+    simd::VectorRegister4f& y,
+    simd::VectorRegister4f& z
+) noexcept
+{
+    simd::VectorRegister4f crossX;
+    simd::VectorRegister4f crossY;
+    simd::VectorRegister4f crossZ;
+    cross4(rotation.x, rotation.y, rotation.z, x, y, z, crossX, crossY, crossZ);
+    crossX = simd::madd(rotation.w, x, crossX);
+    crossY = simd::madd(rotation.w, y, crossY);
+    crossZ = simd::madd(rotation.w, z, crossZ);
+
+    simd::VectorRegister4f changeX;
+    simd::VectorRegister4f changeY;
+    simd::VectorRegister4f changeZ;
+    cross4(rotation.x, rotation.y, rotation.z, crossX, crossY, crossZ, changeX, changeY, changeZ);
+    x = simd::madd(changeX, scale, x);
+    y = simd::madd(changeY, scale, y);
+    z = simd::madd(changeZ, scale, z);
+}
+
+/// @brief Skins four Float32 vertices starting at @p first.
+GP_FORCEINLINE void skin4(
+    ConstVectorView<DualQuaternion<Float32>> bones, const SkinningStreams<Float32>& streams, const Int32 first
+) noexcept
+{
+    QuaternionLanes real;
+    QuaternionLanes dual;
+    const UInt16* indices = streams.boneIndices.data() + first * streams.influences;
+    const Float32* weights = streams.boneWeights.data() + first * streams.influences;
+    blendInfluences(bones, indices, weights, streams.influences, real.x, dual.x);
+    indices += streams.influences;
+    weights += streams.influences;
+    blendInfluences(bones, indices, weights, streams.influences, real.y, dual.y);
+    indices += streams.influences;
+    weights += streams.influences;
+    blendInfluences(bones, indices, weights, streams.influences, real.z, dual.z);
+    indices += streams.influences;
+    weights += streams.influences;
+    blendInfluences(bones, indices, weights, streams.influences, real.w, dual.w);
+    transposeLanes(real);
+    transposeLanes(dual);
+
+    // The blend is not normalized: 2 / |real|^2 folds the normalization of both parts into the rotation and the
+    // translation, t = 2 (real.w dual.xyz - dual.w real.xyz + real.xyz x dual.xyz) / |real|^2.
+    simd::VectorRegister4f lengthSquared = simd::mul(real.x, real.x);
+    lengthSquared = simd::madd(real.y, real.y, lengthSquared);
+    lengthSquared = simd::madd(real.z, real.z, lengthSquared);
+    lengthSquared = simd::madd(real.w, real.w, lengthSquared);
+    const simd::VectorRegister4f scale = simd::div(simd::splat4f(2.0f), lengthSquared);
+
+    simd::VectorRegister4f translationX;
+    simd::VectorRegister4f translationY;
+    simd::VectorRegister4f translationZ;
+    cross4(real.x, real.y, real.z, dual.x, dual.y, dual.z, translationX, translationY, translationZ);
+    translationX = simd::nmadd(dual.w, real.x, simd::madd(real.w, dual.x, translationX));
+    translationY = simd::nmadd(dual.w, real.y, simd::madd(real.w, dual.y, translationY));
+    translationZ = simd::nmadd(dual.w, real.z, simd::madd(real.w, dual.z, translationZ));
+
+    simd::VectorRegister4f x = simd::loadUnaligned4f(streams.positions[0].data() + first);
+    simd::VectorRegister4f y = simd::loadUnaligned4f(streams.positions[1].data() + first);
+    simd::VectorRegister4f z = simd::loadUnaligned4f(streams.positions[2].data() + first);
+    rotate4(real, scale, x, y, z);
+    simd::storeUnaligned(streams.skinnedPositions[0].data() + first, simd::madd(translationX, scale, x));
+    simd::storeUnaligned(streams.skinnedPositions[1].data() + first, simd::madd(translationY, scale, y));
+    simd::storeUnaligned(streams.skinnedPositions[2].data() + first, simd::madd(translationZ, scale, z));
+
+    if (!streams.normals[0].isEmpty())
+    {
+        x = simd::loadUnaligned4f(streams.normals[0].data() + first);
+        y = simd::loadUnaligned4f(streams.normals[1].data() + first);
+        z = simd::loadUnaligned4f(streams.normals[2].data() + first);
+        rotate4(real, scale, x, y, z);
+        simd::storeUnaligned(streams.skinnedNormals[0].data() + first, x);
+        simd::storeUnaligned(streams.skinnedNormals[1].data() + first, y);
+        simd::storeUnaligned(streams.skinnedNormals[2].data() + first, z);
+    }
+}
+
+}   // namespace detail
+
+template <concepts::IsFloatingPoint T>
+void DualQuaternion<T>::blend(
+    ConstVectorView<DualQuaternion<T>> bones,
+    ConstVectorView<UInt16> boneIndices,
+    ConstVectorView<T> boneWeights,
+    const Int32 influences,
+    VectorView<DualQuaternion<T>> output
+) noexcept
+{
+    GP_ASSERT(influences > 0, "blend() requires at least one influence per vertex");
+    GP_ASSERT(boneIndices.size() == output.size() * influences, "blend() requires influences indices per vertex");
+    GP_ASSERT(boneWeights.size() == boneIndices.size(), "blend() requires one weight per bone index");
+
+    for (Int32 vertex = 0; vertex < output.size(); ++vertex)
+    {
+        const UInt16* indices = boneIndices.data() + vertex * influences;
+        const T* weights = boneWeights.data() + vertex * influences;
+        if constexpr (detail::kIsSimdQuaternion<T>)
+        {
+            simd::VectorRegister4f real;
+            simd::VectorRegister4f dual;
+            detail::blendInfluences(bones, indices, weights, influences, real, dual);
+            const simd::VectorRegister4f inverseLength = simd::splat4f(1.0f / std::sqrt(simd::dot4(real, real)));
+            simd::store(&output[vertex].real.x, simd::mul(real, inverseLength));
+            simd::store(&output[vertex].dual.x, simd::mul(dual, inverseLength));
+        }
+        else
+        {
+            output[vertex] = detail::blendInfluences(bones, indices, weights, influences).normalized();
+        }
+    }
+}
+
+template <concepts::IsFloatingPoint T>
+void DualQuaternion<T>::skin(ConstVectorView<DualQuaternion<T>> bones, const SkinningStreams<T>& streams) noexcept
+{
+    const Int32 count = streams.positions[0].size();
+    const bool hasNormals = !streams.normals[0].isEmpty();
+    GP_ASSERT(streams.influences > 0, "skin() requires at least one influence per vertex");
+    GP_ASSERT(
+        streams.boneIndices.size() == count * streams.influences, "skin() requires influences indices per vertex"
+    );
+    GP_ASSERT(streams.boneWeights.size() == streams.boneIndices.size(), "skin() requires one weight per bone index");
+
+    Int32 vertex = 0;
+    if constexpr (detail::kIsSimdQuaternion<T>)
+    {
+        for (; vertex + 4 <= count; vertex += 4)
+        {
+            detail::skin4(bones, streams, vertex);
+        }
+    }
+
+    for (; vertex < count; ++vertex)
+    {
+        const DualQuaternion<T> transform =
+            detail::blendInfluences(
+                bones,
+                streams.boneIndices.data() + vertex * streams.influences,
+                streams.boneWeights.data() + vertex * streams.influences,
+                streams.influences
+            )
+                .normalized();
+
+        const Vector3<T> position(
+            streams.positions[0][vertex], streams.positions[1][vertex], streams.positions[2][vertex]
+        );
+        const Vector3<T> skinnedPosition = transform.transformPoint(position);
+        streams.skinnedPositions[0][vertex] = skinnedPosition.x;
+        streams.skinnedPositions[1][vertex] = skinnedPosition.y;
+        streams.skinnedPositions[2][vertex] = skinnedPosition.z;
+
+        if (hasNormals)
+        {
+            const Vector3<T> normal(streams.normals[0][vertex], streams.normals[1][vertex], streams.normals[2][vertex]);
+            const Vector3<T> skinnedNormal = transform.transformVector(normal);
+            streams.skinnedNormals[0][vertex] = skinnedNormal.x;
+            streams.skinnedNormals[1][vertex] = skinnedNormal.y;
+            streams.skinnedNormals[2][vertex] = skinnedNormal.z;
+        }
+    }
+}
+
+}   // namespace gp::math
@@ -3,3 +3,252 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Constants.hpp"
+#include "maths/base/Scalar.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/matrix/Matrix3x3.hpp"
+#include "maths/vector/Vector3.hpp"
+
+namespace gp::math
+{
+
+/// @brief A quaternion template, representing a rotation when normalized.
+/// @details
+/// Quaternions follow the Hamilton convention and compose like matrices: A * B applies B first. Components are
+/// aligned like Vector4, so a Float32 quaternion is one SIMD register: products and the batch interpolations go
+/// through the maths/simd register layer, other types and constant evaluation use the scalar code.
+/// @tparam T The floating-point type for the quaternion components.
+template <concepts::IsFloatingPoint T>
+struct alignas(sizeof(T) * 4) Quaternion
+{
+public:
+    T x;   //<! The x component of the vector part.
+    T y;   //<! The y component of the vector part.
+    T z;   //<! The z component of the vector part.
+    T w;   //<! The scalar part.
+
+public:
+    /// @brief Returns the identity rotation.
+    [[nodiscard]] static constexpr Quaternion<T> identity() noexcept
+    {
+        return Quaternion<T>();
+    }
+
+    /// @brief Returns the rotation of @p angle radians around @p axis.
+    /// @param[in] axis The rotation axis, must be normalized.
+    /// @param[in] angle The rotation angle, in radians, counter-clockwise when looking down the axis.
+    [[nodiscard]] static Quaternion<T> makeFromAxisAngle(const Vector3<T>& axis, const T angle) noexcept
+    {
+        const T halfAngle = angle * T{ 0.5 };
+        const T sine = std::sin(halfAngle);
+        return Quaternion<T>(axis.x * sine, axis.y * sine, axis.z * sine, std::cos(halfAngle));
+    }
+
+public:
+    /// @brief Default constructor initializes to the identity rotation (0, 0, 0, 1).
+    [[nodiscard]] constexpr Quaternion() noexcept
+        : x(T{ 0 })
+        , y(T{ 0 })
+        , z(T{ 0 })
+        , w(T{ 1 })
+    {}
+
+    /// @brief Constructor with individual components.
+    /// @param[in] inX The x component of the vector part.
+    /// @param[in] inY The y component of the vector part.
+    /// @param[in] inZ The z component of the vector part.
+    /// @param[in] inW The scalar part.
+    [[nodiscard]] constexpr Quaternion(const T inX, const T inY, const T inZ, const T inW) noexcept
+        : x(inX)
+        , y(inY)
+        , z(inZ)
+        , w(inW)
+    {}
+
+    /// @brief Constructor from a rotation matrix.
+    /// @param[in] rotation The rotation, must be orthonormal with a determinant of 1.
+    [[nodiscard]] explicit constexpr Quaternion(const Matrix3x3<T>& rotation) noexcept;
+
+public:
+    /// @brief Composes two rotations, the result applies @p other first and this rotation second.
+    [[nodiscard]] constexpr Quaternion<T> operator*(const Quaternion<T>& other) const noexcept;
+
+    /// @brief Composes this rotation with another one, this = this * other.
+    constexpr Quaternion<T>& operator*=(const Quaternion<T>& other) noexcept
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    /// @brief Scales every component, as used to blend quaternions.
+    [[nodiscard]] constexpr Quaternion<T> operator*(const T scale) const noexcept
+    {
+        return Quaternion<T>(x * scale, y * scale, z * scale, w * scale);
+    }
+
+    /// @brief Adds two quaternions component by component, as used to blend them.
+    [[nodiscard]] constexpr Quaternion<T> operator+(const Quaternion<T>& other) const noexcept
+    {
+        return Quaternion<T>(x + other.x, y + other.y, z + other.z, w + other.w);
+    }
+
+    /// @brief Subtracts two quaternions component by component.
+    [[nodiscard]] constexpr Quaternion<T> operator-(const Quaternion<T>& other) const noexcept
+    {
+        return Quaternion<T>(x - other.x, y - other.y, z - other.z, w - other.w);
+    }
+
+    /// @brief Negates every component, which gives the same rotation.
+    [[nodiscard]] constexpr Quaternion<T> operator-() const noexcept
+    {
+        return Quaternion<T>(-x, -y, -z, -w);
+    }
+
+    /// @brief Checks whether every component is exactly equal to the one of another quaternion.
+    [[nodiscard]] constexpr bool operator==(const Quaternion<T>& other) const noexcept
+    {
+        return x == other.x && y == other.y && z == other.z && w == other.w;
+    }
+
+    /// @brief Checks whether at least one component differs from the one of another quaternion.
+    [[nodiscard]] constexpr bool operator!=(const Quaternion<T>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+public:
+    /// @brief Returns the vector part (x, y, z).
+    [[nodiscard]] constexpr Vector3<T> getVector() const noexcept
+    {
+        return Vector3<T>(x, y, z);
+    }
+
+    /// @brief Computes the four-dimensional dot product with another quaternion.
+    [[nodiscard]] constexpr T dot(const Quaternion<T>& other) const noexcept
+    {
+        return x * other.x + y * other.y + z * other.z + w * other.w;
+    }
+
+    /// @brief Returns the squared length of the quaternion.
+    [[nodiscard]] constexpr T lengthSquared() const noexcept
+    {
+        return dot(*this);
+    }
+
+    /// @brief Returns the length of the quaternion.
+    [[nodiscard]] constexpr T length() const noexcept
+    {
+        return math::sqrt(lengthSquared());
+    }
+
+    /// @brief Checks whether the quaternion has a unit length, within a given tolerance.
+    [[nodiscard]] constexpr bool isNormalized(const T tolerance = constants<T>::kindaSmallNumber) const noexcept
+    {
+        return math::abs(lengthSquared() - T{ 1 }) <= tolerance;
+    }
+
+    /// @brief Returns the quaternion scaled to a unit length, or the identity when its length is close to zero.
+    [[nodiscard]] constexpr Quaternion<T> normalized(const T tolerance = constants<T>::smallNumber) const noexcept
+    {
+        const T squared = lengthSquared();
+        return squared > tolerance ? *this * math::inverseSqrt(squared) : Quaternion<T>();
+    }
+
+    /// @brief Returns the conjugate (-x, -y, -z, w), which is the inverse rotation of a normalized quaternion.
+    [[nodiscard]] constexpr Quaternion<T> conjugate() const noexcept
+    {
+        return Quaternion<T>(-x, -y, -z, w);
+    }
+
+    /// @brief Returns the multiplicative inverse, for quaternions that may not be normalized.
+    [[nodiscard]] constexpr Quaternion<T> inverse() const noexcept
+    {
+        return conjugate() * (T{ 1 } / lengthSquared());
+    }
+
+    /// @brief Checks whether this quaternion is equal to another one within a given tolerance.
+    /// @note Compares components: q and -q represent the same rotation but are not equal.
+    [[nodiscard]] constexpr bool
+        equals(const Quaternion<T>& other, const T tolerance = constants<T>::kindaSmallNumber) const noexcept
+    {
+        return math::abs(x - other.x) <= tolerance && math::abs(y - other.y) <= tolerance &&
+               math::abs(z - other.z) <= tolerance && math::abs(w - other.w) <= tolerance;
+    }
+
+    /// @brief Rotates a vector by this quaternion, which must be normalized.
+    [[nodiscard]] constexpr Vector3<T> rotateVector(const Vector3<T>& vec) const noexcept
+    {
+        // v' = v + w t + q x t, with t = 2 q x v: two cross products instead of two quaternion products.
+        const Vector3<T> axis = getVector();
+        const Vector3<T> twiceCross = axis.cross(vec) * T{ 2 };
+        return vec + twiceCross * w + axis.cross(twiceCross);
+    }
+
+    /// @brief Rotates a vector by the inverse of this quaternion, which must be normalized.
+    [[nodiscard]] constexpr Vector3<T> unrotateVector(const Vector3<T>& vec) const noexcept
+    {
+        return conjugate().rotateVector(vec);
+    }
+
+    /// @brief Converts the rotation to a matrix. The quaternion must be normalized.
+    [[nodiscard]] constexpr Matrix3x3<T> toMatrix() const noexcept;
+
+public:
+    /// @brief Interpolates linearly between two rotations and normalizes the result.
+    /// @details Cheaper than slerp() but not at a constant angular speed. Takes the shortest path: @p to is negated
+    /// when it lies in the opposite hemisphere.
+    /// @param[in] from The rotation at @p alpha = 0.
+    /// @param[in] to The rotation at @p alpha = 1.
+    /// @param[in] alpha The interpolation factor, in [0, 1].
+    [[nodiscard]] static constexpr Quaternion<T>
+        nlerp(const Quaternion<T>& from, const Quaternion<T>& to, const T alpha) noexcept
+    {
+        const T toScale = from.dot(to) < T{ 0 } ? -alpha : alpha;
+        return (from * (T{ 1 } - alpha) + to * toScale).normalized();
+    }
+
+    /// @brief Interpolates spherically between two normalized rotations, at a constant angular speed.
+    /// @details Takes the shortest path, and falls back to nlerp() when the rotations are almost equal.
+    /// @param[in] from The rotation at @p alpha = 0.
+    /// @param[in] to The rotation at @p alpha = 1.
+    /// @param[in] alpha The interpolation factor, in [0, 1].
+    [[nodiscard]] static Quaternion<T>
+        slerp(const Quaternion<T>& from, const Quaternion<T>& to, const T alpha) noexcept;
+
+    /// @brief Interpolates spherically between two batches of normalized rotations, e.g. to blend two animation poses.
+    /// @details
+    /// Float32 batches are processed four rotations at a time with the polynomial approximation of Eberly ("A Fast
+    /// and Accurate Algorithm for Computing SLERP"), which only needs multiplies and adds and stays within Float32
+    /// rounding of slerp(). Other types call slerp() for each rotation.
+    /// @param[in] from The rotations at @p alpha = 0.
+    /// @param[in] to The rotations at @p alpha = 1, as many as @p from.
+    /// @param[in] alpha The interpolation factor, in [0, 1], shared by the whole batch.
+    /// @param[out] output The interpolated rotations, as many as @p from. May be the same memory as @p from or @p to,
+    /// but must not partially overlap them.
+    static void slerp(
+        ConstVectorView<Quaternion<T>> from,
+        ConstVectorView<Quaternion<T>> to,
+        const T alpha,
+        VectorView<Quaternion<T>> output
+    ) noexcept;
+
+    /// @brief Interpolates linearly between two batches of rotations and normalizes the results.
+    /// @copydetails nlerp(const Quaternion<T>&, const Quaternion<T>&, const T)
+    /// @param[out] output The interpolated rotations, as many as @p from. May be the same memory as @p from or @p to,
+    /// but must not partially overlap them.
+    static void nlerp(
+        ConstVectorView<Quaternion<T>> from,
+        ConstVectorView<Quaternion<T>> to,
+        const T alpha,
+        VectorView<Quaternion<T>> output
+    ) noexcept;
+};
+
+}   // namespace gp::math
+
+// Include the implementation of the Quaternion template
+#include "maths/rotation/Quaternion.inl"
@@ -0,0 +1,372 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "maths/rotation/Quaternion.hpp"
+#include "maths/simd/VectorRegister.hpp"
+#include <type_traits>
+
+namespace gp::math
+{
+
+namespace detail
+{
+
+/// @brief Whether quaternions of T go through the SIMD register layer, which handles four Float32 lanes.
+template <typename T>
+inline constexpr bool kIsSimdQuaternion = std::is_same_v<T, Float32>;
+
+/// @brief Four Float32 quaternions, one register per component.
+struct QuaternionLanes
+{
+    simd::VectorRegister4f x;
+    simd::VectorRegister4f y;
+    simd::VectorRegister4f z;
+    simd::VectorRegister4f w;
+};
+
+/// @brief Transposes four quaternions held one register each to one register per component, or back.
+GP_FORCEINLINE void transposeLanes(QuaternionLanes& lanes) noexcept
+{
+    const simd::VectorRegister4f low01 = simd::interleaveLow(lanes.x, lanes.y);
+    const simd::VectorRegister4f low23 = simd::interleaveLow(lanes.z, lanes.w);
+    const simd::VectorRegister4f high01 = simd::interleaveHigh(lanes.x, lanes.y);
+    const simd::VectorRegister4f high23 = simd::interleaveHigh(lanes.z, lanes.w);
+    lanes.x = simd::shuffle<0, 1, 0, 1>(low01, low23);
+    lanes.y = simd::shuffle<2, 3, 2, 3>(low01, low23);
+    lanes.z = simd::shuffle<0, 1, 0, 1>(high01, high23);
+    lanes.w = simd::shuffle<2, 3, 2, 3>(high01, high23);
+}
+
+/// @brief Loads four consecutive quaternions to one register per component.
+GP_FORCEINLINE QuaternionLanes loadQuaternionLanes(const Quaternion<Float32>* quaternions) noexcept
+{
+    QuaternionLanes lanes{ simd::load4f(&quaternions[0].x),
+                           simd::load4f(&quaternions[1].x),
+                           simd::load4f(&quaternions[2].x),
+                           simd::load4f(&quaternions[3].x) };
+    transposeLanes(lanes);
+    return lanes;
+}
+
+/// @brief Stores four quaternions held one register per component consecutively.
+GP_FORCEINLINE void storeQuaternionLanes(Quaternion<Float32>* quaternions, QuaternionLanes lanes) noexcept
+{
+    transposeLanes(lanes);
+    simd::store(&quaternions[0].x, lanes.x);
+    simd::store(&quaternions[1].x, lanes.y);
+    simd::store(&quaternions[2].x, lanes.z);
+    simd::store(&quaternions[3].x, lanes.w);
+}
+
+/// @brief Negates the lanes of @p to whose dot product with @p from is negative, so both share a hemisphere.
+/// @return The absolute value of the dot products.
+GP_FORCEINLINE simd::VectorRegister4f alignHemispheres(const QuaternionLanes& from, QuaternionLanes& to) noexcept
+{
+    simd::VectorRegister4f cosine = simd::mul(from.x, to.x);
+    cosine = simd::madd(from.y, to.y, cosine);
+    cosine = simd::madd(from.z, to.z, cosine);
+    cosine = simd::madd(from.w, to.w, cosine);
+
+    const simd::VectorRegister4f sign = simd::bitAnd(cosine, simd::splat4f(-0.0f));
+    to.x = simd::bitXor(to.x, sign);
+    to.y = simd::bitXor(to.y, sign);
+    to.z = simd::bitXor(to.z, sign);
+    to.w = simd::bitXor(to.w, sign);
+    return simd::bitXor(cosine, sign);
+}
+
+/// @brief Returns from * fromScale + to * toScale, lane by lane.
+GP_FORCEINLINE QuaternionLanes blendQuaternionLanes(
+    const QuaternionLanes& from,
+    simd::VectorRegister4f fromScale,
+    const QuaternionLanes& to,
+    simd::VectorRegister4f toScale
+) noexcept
+{
+    return { simd::madd(from.x, fromScale, simd::mul(to.x, toScale)),
+             simd::madd(from.y, fromScale, simd::mul(to.y, toScale)),
+             simd::madd(from.z, fromScale, simd::mul(to.z, toScale)),
+             simd::madd(from.w, fromScale, simd::mul(to.w, toScale)) };
+}
+
+/// @brief Applies @p kernel to batches of Float32 quaternions four at a time, padding the last group with identities.
+/// @param[in] kernel Callable taking the from and to lanes and returning the result lanes.
+template <typename Kernel>
+void interpolateBatch(
+    ConstVectorView<Quaternion<Float32>> from,
+    ConstVectorView<Quaternion<Float32>> to,
+    VectorView<Quaternion<Float32>> output,
+    Kernel kernel
+) noexcept
+{
+    const Int32 count = from.size();
+    Int32 index = 0;
+    for (; index + 4 <= count; index += 4)
+    {
+        const QuaternionLanes fromLanes = loadQuaternionLanes(from.data() + index);
+        const QuaternionLanes toLanes = loadQuaternionLanes(to.data() + index);
+        storeQuaternionLanes(output.data() + index, kernel(fromLanes, toLanes));
+    }
+
+    if (index < count)
+    {
+        // Running the remainder through the same kernel keeps every element bit-identical to a full group.
+        Quaternion<Float32> fromTail[4];
+        Quaternion<Float32> toTail[4];
+        Quaternion<Float32> outputTail[4];
+        const Int32 remainder = count - index;
+        for (Int32 lane = 0; lane < remainder; ++lane)
+        {
+            fromTail[lane] = from[index + lane];
+            toTail[lane] = to[index + lane];
+        }
+        storeQuaternionLanes(outputTail, kernel(loadQuaternionLanes(fromTail), loadQuaternionLanes(toTail)));
+        for (Int32 lane = 0; lane < remainder; ++lane)
+        {
+            output[index + lane] = outputTail[lane];
+        }
+    }
+}
+
+}   // namespace detail
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Quaternion<T>::Quaternion(const Matrix3x3<T>& rotation) noexcept
+{
+    // Shepperd's method: derive the largest component from the diagonal, the others from the off-diagonal terms.
+    const auto& m = rotation.m;
+    const T trace = m[0][0] + m[1][1] + m[2][2];
+    if (trace > T{ 0 })
+    {
+        const T scale = T{ 0.5 } * math::inverseSqrt(trace + T{ 1 });
+        x = (m[2][1] - m[1][2]) * scale;
+        y = (m[0][2] - m[2][0]) * scale;
+        z = (m[1][0] - m[0][1]) * scale;
+        w = T{ 0.25 } / scale;
+    }
+    else if (m[0][0] > m[1][1] && m[0][0] > m[2][2])
+    {
+        const T scale = T{ 0.5 } * math::inverseSqrt(T{ 1 } + m[0][0] - m[1][1] - m[2][2]);
+        x = T{ 0.25 } / scale;
+        y = (m[0][1] + m[1][0]) * scale;
+        z = (m[0][2] + m[2][0]) * scale;
+        w = (m[2][1] - m[1][2]) * scale;
+    }
+    else if (m[1][1] > m[2][2])
+    {
+        const T scale = T{ 0.5 } * math::inverseSqrt(T{ 1 } + m[1][1] - m[0][0] - m[2][2]);
+        x = (m[0][1] + m[1][0]) * scale;
+        y = T{ 0.25 } / scale;
+        z = (m[1][2] + m[2][1]) * scale;
+        w = (m[0][2] - m[2][0]) * scale;
+    }
+    else
+    {
+        const T scale = T{ 0.5 } * math::inverseSqrt(T{ 1 } + m[2][2] - m[0][0] - m[1][1]);
+        x = (m[0][2] + m[2][0]) * scale;
+        y = (m[1][2] + m[2][1]) * scale;
+        z = T{ 0.25 } / scale;
+        w = (m[1][0] - m[0][1]) * scale;
+    }
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Quaternion<T> Quaternion<T>::operator*(const Quaternion<T>& other) const noexcept
+{
+    if !consteval
+    {
+        if constexpr (detail::kIsSimdQuaternion<T>)
+        {
+            // Each component of this scales a permutation of other, with the signs of the Hamilton product.
+            const simd::VectorRegister4f lhs = simd::load4f(&x);
+            const simd::VectorRegister4f rhs = simd::load4f(&other.x);
+            simd::VectorRegister4f product = simd::mul(simd::swizzle<3, 3, 3, 3>(lhs), rhs);
+            product = simd::madd(
+                simd::mul(simd::swizzle<0, 0, 0, 0>(lhs), simd::set4f(1.0f, -1.0f, 1.0f, -1.0f)),
+                simd::swizzle<3, 2, 1, 0>(rhs),
+                product
+            );
+            product = simd::madd(
+                simd::mul(simd::swizzle<1, 1, 1, 1>(lhs), simd::set4f(1.0f, 1.0f, -1.0f, -1.0f)),
+                simd::swizzle<2, 3, 0, 1>(rhs),
+                product
+            );
+            product = simd::madd(
+                simd::mul(simd::swizzle<2, 2, 2, 2>(lhs), simd::set4f(-1.0f, 1.0f, 1.0f, -1.0f)),
+                simd::swizzle<1, 0, 3, 2>(rhs),
+                product
+            );
+            Quaternion<T> result;
+            simd::store(&result.x, product);
+            return result;
+        }
+    }
+
+    return Quaternion<T>(
+        w * other.x + x * other.w + y * other.z - z * other.y,
+        w * other.y - x * other.z + y * other.w + z * other.x,
+        w * other.z + x * other.y - y * other.x + z * other.w,
+        w * other.w - x * other.x - y * other.y - z * other.z
+    );
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Matrix3x3<T> Quaternion<T>::toMatrix() const noexcept
+{
+    const T xx = x * x;
+    const T yy = y * y;
+    const T zz = z * z;
+    const T xy = x * y;
+    const T xz = x * z;
+    const T yz = y * z;
+    const T wx = w * x;
+    const T wy = w * y;
+    const T wz = w * z;
+    return Matrix3x3<T>(
+        T{ 1 } - T{ 2 } * (yy + zz),
+        T{ 2 } * (xy - wz),
+        T{ 2 } * (xz + wy),
+        T{ 2 } * (xy + wz),
+        T{ 1 } - T{ 2 } * (xx + zz),
+        T{ 2 } * (yz - wx),
+        T{ 2 } * (xz - wy),
+        T{ 2 } * (yz + wx),
+        T{ 1 } - T{ 2 } * (xx + yy)
+    );
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] Quaternion<T>
+    Quaternion<T>::slerp(const Quaternion<T>& from, const Quaternion<T>& to, const T alpha) noexcept
+{
+    T cosine = from.dot(to);
+    T toSign = T{ 1 };
+    if (cosine < T{ 0 })
+    {
+        cosine = -cosine;
+        toSign = T{ -1 };
+    }
+
+    // The sine of the angle vanishes for almost equal rotations, where the linear interpolation is as accurate.
+    if (cosine > T{ 1 } - constants<T>::kindaSmallNumber)
+    {
+        return nlerp(from, to, alpha);
+    }
+
+    const T angle = std::acos(cosine);
+    const T inverseSine = T{ 1 } / std::sin(angle);
+    return from * (std::sin((T{ 1 } - alpha) * angle) * inverseSine) +
+           to * (toSign * std::sin(alpha * angle) * inverseSine);
+}
+
+template <concepts::IsFloatingPoint T>
+void Quaternion<T>::slerp(
+    ConstVectorView<Quaternion<T>> from,
+    ConstVectorView<Quaternion<T>> to,
+    const T alpha,
+    VectorView<Quaternion<T>> output
+) noexcept
+{
+    GP_ASSERT(from.size() == to.size() && from.size() == output.size(), "slerp() requires batches of equal sizes");
+    if constexpr (detail::kIsSimdQuaternion<T>)
+    {
+        // Eberly's approximation writes the slerp weights as series in (cos(angle) - 1), evaluated with Horner's
+        // scheme. The last term is scaled by (1 + mu) to absorb the truncation: with sixteen terms and the value below,
+        // which minimizes the maximum error over every angle and alpha, the weights are within 3e-8 of sin().
+        constexpr Int32 kTerms = 16;
+        constexpr Float32 kOnePlusMu = 1.91668f;
+        const Float32 inverseAlpha = 1.0f - alpha;
+        simd::VectorRegister4f toTerms[kTerms];
+        simd::VectorRegister4f fromTerms[kTerms];
+        for (Int32 term = 0; term < kTerms; ++term)
+        {
+            const Float32 index = static_cast<Float32>(term + 1);
+            const Float32 odd = 2.0f * index + 1.0f;
+            const Float32 correction = term == kTerms - 1 ? kOnePlusMu : 1.0f;
+            const Float32 u = correction / (index * odd);
+            const Float32 v = correction * index / odd;
+            toTerms[term] = simd::splat4f(u * alpha * alpha - v);
+            fromTerms[term] = simd::splat4f(u * inverseAlpha * inverseAlpha - v);
+        }
+
+        const simd::VectorRegister4f one = simd::splat4f(1.0f);
+        const simd::VectorRegister4f alphaLanes = simd::splat4f(alpha);
+        const simd::VectorRegister4f inverseAlphaLanes = simd::splat4f(inverseAlpha);
+        detail::interpolateBatch(
+            from,
+            to,
+            output,
+            [&](const detail::QuaternionLanes& fromLanes, detail::QuaternionLanes toLanes) noexcept
+            {
+                const simd::VectorRegister4f cosineMinusOne =
+                    simd::sub(detail::alignHemispheres(fromLanes, toLanes), one);
+                simd::VectorRegister4f toScale = one;
+                simd::VectorRegister4f fromScale = one;
+                for (Int32 term = kTerms - 1; term >= 0; --term)
+                {
+                    toScale = simd::madd(simd::mul(toTerms[term], cosineMinusOne), toScale, one);
+                    fromScale = simd::madd(simd::mul(fromTerms[term], cosineMinusOne), fromScale, one);
+                }
+                return detail::blendQuaternionLanes(
+                    fromLanes, simd::mul(fromScale, inverseAlphaLanes), toLanes, simd::mul(toScale, alphaLanes)
+                );
+            }
+        );
+    }
+    else
+    {
+        for (Int32 index = 0; index < from.size(); ++index)
+        {
+            output[index] = slerp(from[index], to[index], alpha);
+        }
+    }
+}
+
+template <concepts::IsFloatingPoint T>
+void Quaternion<T>::nlerp(
+    ConstVectorView<Quaternion<T>> from,
+    ConstVectorView<Quaternion<T>> to,
+    const T alpha,
+    VectorView<Quaternion<T>> output
+) noexcept
+{
+    GP_ASSERT(from.size() == to.size() && from.size() == output.size(), "nlerp() requires batches of equal sizes");
+    if constexpr (detail::kIsSimdQuaternion<T>)
+    {
+        const simd::VectorRegister4f alphaLanes = simd::splat4f(alpha);
+        const simd::VectorRegister4f inverseAlphaLanes = simd::splat4f(1.0f - alpha);
+        detail::interpolateBatch(
+            from,
+            to,
+            output,
+            [&](const detail::QuaternionLanes& fromLanes, detail::QuaternionLanes toLanes) noexcept
+            {
+                detail::alignHemispheres(fromLanes, toLanes);
+                detail::QuaternionLanes result =
+                    detail::blendQuaternionLanes(fromLanes, inverseAlphaLanes, toLanes, alphaLanes);
+                simd::VectorRegister4f lengthSquared = simd::mul(result.x, result.x);
+                lengthSquared = simd::madd(result.y, result.y, lengthSquared);
+                lengthSquared = simd::madd(result.z, result.z, lengthSquared);
+                lengthSquared = simd::madd(result.w, result.w, lengthSquared);
+                const simd::VectorRegister4f inverseLength = simd::rsqrt(lengthSquared);
+                result.x = simd::mul(result.x, inverseLength);
+                result.y = simd::mul(result.y, inverseLength);
+                result.z = simd::mul(result.z, inverseLength);
+                result.w = simd::mul(result.w, inverseLength);
+                return result;
+            }
+        );
+    }
+    else
+    {
+        for (Int32 index = 0; index < from.size(); ++index)
+        {
+            output[index] = nlerp(from[index], to[index], alpha);
+        }
+    }
+}
+
+}   // namespace gp::math
@@ -3,3 +3,495 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "maths/simd/Common.hpp"
+#include "maths/simd/Generic.hpp"
+#include "maths/simd/NEON.hpp"
+#include "maths/simd/SSE.hpp"
+
+namespace gp::simd
+{
+
+#if GP_SIMD_AVX2
+
+/// @brief Eight 32-bit floats in an AVX register.
+using VectorRegister8f = __m256;
+
+/// @section Creation, loads and stores.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f zero8f() noexcept
+{
+    return _mm256_setzero_ps();
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f splat8f(Float32 value) noexcept
+{
+    return _mm256_set1_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f
+    set8f(Float32 a, Float32 b, Float32 c, Float32 d, Float32 e, Float32 f, Float32 g, Float32 h) noexcept
+{
+    return _mm256_setr_ps(a, b, c, d, e, f, g, h);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f load8f(const Float32* source) noexcept
+{
+    return _mm256_load_ps(source);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f loadUnaligned8f(const Float32* source) noexcept
+{
+    return _mm256_loadu_ps(source);
+}
+
+GP_FORCEINLINE void store(Float32* destination, VectorRegister8f value) noexcept
+{
+    _mm256_store_ps(destination, value);
+}
+
+GP_FORCEINLINE void storeUnaligned(Float32* destination, VectorRegister8f value) noexcept
+{
+    _mm256_storeu_ps(destination, value);
+}
+
+/// @brief Returns the lanes 0 to 3 of a register.
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f getLow(VectorRegister8f value) noexcept
+{
+    return _mm256_castps256_ps128(value);
+}
+
+/// @brief Returns the lanes 4 to 7 of a register.
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f getHigh(VectorRegister8f value) noexcept
+{
+    return _mm256_extractf128_ps(value, 1);
+}
+
+/// @brief Builds a register from its lanes 0 to 3 and 4 to 7.
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f combine(VectorRegister4f low, VectorRegister4f high) noexcept
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+}
+
+/// @section Arithmetic.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f add(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_add_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f sub(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_sub_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f mul(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_mul_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f div(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_div_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f madd(VectorRegister8f a, VectorRegister8f b, VectorRegister8f c) noexcept
+{
+    return _mm256_fmadd_ps(a, b, c);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f nmadd(VectorRegister8f a, VectorRegister8f b, VectorRegister8f c) noexcept
+{
+    return _mm256_fnmadd_ps(a, b, c);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f min(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_min_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f max(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_max_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f abs(VectorRegister8f value) noexcept
+{
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f negate(VectorRegister8f value) noexcept
+{
+    return _mm256_xor_ps(_mm256_set1_ps(-0.0f), value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f sqrt(VectorRegister8f value) noexcept
+{
+    return _mm256_sqrt_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f rsqrtFast(VectorRegister8f value) noexcept
+{
+    return _mm256_rsqrt_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f rsqrt(VectorRegister8f value) noexcept
+{
+    // One Newton-Raphson step on the 12-bit estimate: y' = y * (1.5 - 0.5 * x * y * y). The step gives NaN for 0 and
+    // infinity, where x * y is 0 * infinity: those lanes keep the estimate, exact there.
+    const VectorRegister8f estimate = _mm256_rsqrt_ps(value);
+    const VectorRegister8f halfValue = _mm256_mul_ps(value, _mm256_set1_ps(0.5f));
+    const VectorRegister8f refined = _mm256_mul_ps(
+        estimate, _mm256_fnmadd_ps(_mm256_mul_ps(halfValue, estimate), estimate, _mm256_set1_ps(1.5f))
+    );
+    return _mm256_blendv_ps(estimate, refined, _mm256_cmp_ps(refined, refined, _CMP_ORD_Q));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f rcpFast(VectorRegister8f value) noexcept
+{
+    return _mm256_rcp_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f rcp(VectorRegister8f value) noexcept
+{
+    // One Newton-Raphson step on the 12-bit estimate: y' = y * (2 - x * y). As in rsqrt(), 0 and infinity keep the
+    // estimate.
+    const VectorRegister8f estimate = _mm256_rcp_ps(value);
+    const VectorRegister8f refined = _mm256_mul_ps(estimate, _mm256_fnmadd_ps(value, estimate, _mm256_set1_ps(2.0f)));
+    return _mm256_blendv_ps(estimate, refined, _mm256_cmp_ps(refined, refined, _CMP_ORD_Q));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f floor(VectorRegister8f value) noexcept
+{
+    return _mm256_floor_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f ceil(VectorRegister8f value) noexcept
+{
+    return _mm256_ceil_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f roundNearest(VectorRegister8f value) noexcept
+{
+    return _mm256_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+
+/// @section Comparisons, masks and bitwise operations.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpEq(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpNe(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpLt(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpLe(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpGt(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpGe(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f bitAnd(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_and_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f bitOr(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_or_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f bitXor(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_xor_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f bitAndNot(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return _mm256_andnot_ps(b, a);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f
+    select(VectorRegister8f mask, VectorRegister8f ifTrue, VectorRegister8f ifFalse) noexcept
+{
+    return _mm256_blendv_ps(ifFalse, ifTrue, mask);
+}
+
+[[nodiscard]] GP_FORCEINLINE UInt32 moveMask(VectorRegister8f mask) noexcept
+{
+    return static_cast<UInt32>(_mm256_movemask_ps(mask));
+}
+
+#else
+
+/// @brief Eight 32-bit floats, held in two 4-wide registers where AVX is not available.
+struct VectorRegister8f
+{
+    VectorRegister4f low;    //<! Lanes 0 to 3.
+    VectorRegister4f high;   //<! Lanes 4 to 7.
+};
+
+/// @section Creation, loads and stores.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f zero8f() noexcept
+{
+    return { zero4f(), zero4f() };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f splat8f(Float32 value) noexcept
+{
+    return { splat4f(value), splat4f(value) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f
+    set8f(Float32 a, Float32 b, Float32 c, Float32 d, Float32 e, Float32 f, Float32 g, Float32 h) noexcept
+{
+    return { set4f(a, b, c, d), set4f(e, f, g, h) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f load8f(const Float32* source) noexcept
+{
+    return { load4f(source), load4f(source + 4) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f loadUnaligned8f(const Float32* source) noexcept
+{
+    return { loadUnaligned4f(source), loadUnaligned4f(source + 4) };
+}
+
+GP_FORCEINLINE void store(Float32* destination, VectorRegister8f value) noexcept
+{
+    store(destination, value.low);
+    store(destination + 4, value.high);
+}
+
+GP_FORCEINLINE void storeUnaligned(Float32* destination, VectorRegister8f value) noexcept
+{
+    storeUnaligned(destination, value.low);
+    storeUnaligned(destination + 4, value.high);
+}
+
+/// @brief Returns the lanes 0 to 3 of a register.
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f getLow(VectorRegister8f value) noexcept
+{
+    return value.low;
+}
+
+/// @brief Returns the lanes 4 to 7 of a register.
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f getHigh(VectorRegister8f value) noexcept
+{
+    return value.high;
+}
+
+/// @brief Builds a register from its lanes 0 to 3 and 4 to 7.
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f combine(VectorRegister4f low, VectorRegister4f high) noexcept
+{
+    return { low, high };
+}
+
+/// @section Arithmetic.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f add(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { add(a.low, b.low), add(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f sub(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { sub(a.low, b.low), sub(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f mul(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { mul(a.low, b.low), mul(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f div(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { div(a.low, b.low), div(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f madd(VectorRegister8f a, VectorRegister8f b, VectorRegister8f c) noexcept
+{
+    return { madd(a.low, b.low, c.low), madd(a.high, b.high, c.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f nmadd(VectorRegister8f a, VectorRegister8f b, VectorRegister8f c) noexcept
+{
+    return { nmadd(a.low, b.low, c.low), nmadd(a.high, b.high, c.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f min(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { min(a.low, b.low), min(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f max(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { max(a.low, b.low), max(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f abs(VectorRegister8f value) noexcept
+{
+    return { abs(value.low), abs(value.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f negate(VectorRegister8f value) noexcept
+{
+    return { negate(value.low), negate(value.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f sqrt(VectorRegister8f value) noexcept
+{
+    return { sqrt(value.low), sqrt(value.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f rsqrtFast(VectorRegister8f value) noexcept
+{
+    return { rsqrtFast(value.low), rsqrtFast(value.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f rsqrt(VectorRegister8f value) noexcept
+{
+    return { rsqrt(value.low), rsqrt(value.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f rcpFast(VectorRegister8f value) noexcept
+{
+    return { rcpFast(value.low), rcpFast(value.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f rcp(VectorRegister8f value) noexcept
+{
+    return { rcp(value.low), rcp(value.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f floor(VectorRegister8f value) noexcept
+{
+    return { floor(value.low), floor(value.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f ceil(VectorRegister8f value) noexcept
+{
+    return { ceil(value.low), ceil(value.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f roundNearest(VectorRegister8f value) noexcept
+{
+    return { roundNearest(value.low), roundNearest(value.high) };
+}
+
+/// @section Comparisons, masks and bitwise operations.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpEq(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { cmpEq(a.low, b.low), cmpEq(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpNe(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { cmpNe(a.low, b.low), cmpNe(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpLt(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { cmpLt(a.low, b.low), cmpLt(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpLe(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { cmpLe(a.low, b.low), cmpLe(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpGt(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { cmpGt(a.low, b.low), cmpGt(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f cmpGe(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { cmpGe(a.low, b.low), cmpGe(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f bitAnd(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { bitAnd(a.low, b.low), bitAnd(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f bitOr(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { bitOr(a.low, b.low), bitOr(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f bitXor(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { bitXor(a.low, b.low), bitXor(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f bitAndNot(VectorRegister8f a, VectorRegister8f b) noexcept
+{
+    return { bitAndNot(a.low, b.low), bitAndNot(a.high, b.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister8f
+    select(VectorRegister8f mask, VectorRegister8f ifTrue, VectorRegister8f ifFalse) noexcept
+{
+    return { select(mask.low, ifTrue.low, ifFalse.low), select(mask.high, ifTrue.high, ifFalse.high) };
+}
+
+[[nodiscard]] GP_FORCEINLINE UInt32 moveMask(VectorRegister8f mask) noexcept
+{
+    return moveMask(mask.low) | (moveMask(mask.high) << 4);
+}
+
+#endif
+
+/// @section Lane access and horizontal reductions, shared by both representations.
+
+template <UInt32 Index>
+[[nodiscard]] GP_FORCEINLINE Float32 getLane(VectorRegister8f value) noexcept
+{
+    static_assert(Index < 8, "Lane index out of range");
+    if constexpr (Index < 4)
+    {
+        return getLane<Index>(getLow(value));
+    }
+    else
+    {
+        return getLane<Index - 4>(getHigh(value));
+    }
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceAdd(VectorRegister8f value) noexcept
+{
+    return reduceAdd(add(getLow(value), getHigh(value)));
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceMin(VectorRegister8f value) noexcept
+{
+    return reduceMin(min(getLow(value), getHigh(value)));
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceMax(VectorRegister8f value) noexcept
+{
+    return reduceMax(max(getLow(value), getHigh(value)));
+}
+
+}   // namespace gp::simd
@@ -3,3 +3,72 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "CoreMinimal.hpp"
+
+/// @section Instruction set selection.
+///
+/// The register layer is compiled for the best instruction set enabled by the compiler flags:
+/// - GP_SIMD_AVX2   : 8-wide registers on AVX2 + FMA, the 4-wide ones use SSE4.1 with FMA.
+/// - GP_SIMD_SSE4_1 : 4-wide registers on SSE4.1, 8-wide ones made of two 4-wide registers.
+/// - GP_SIMD_SSE2   : as GP_SIMD_SSE4_1, emulating the few SSE4.1 instructions. SSE2 is part of every x64 CPU, so
+///                    this is the baseline of x64 builds without instruction set flags.
+/// - GP_SIMD_NEON   : 4-wide registers on AArch64 NEON, 8-wide ones made of two 4-wide registers.
+/// - GP_SIMD_SCALAR : plain C++ fallback, also used when the build defines GP_SIMD_FORCE_SCALAR.
+/// Exactly one of the five is GP_TRUE. MSVC does not report SSE4.1 and FMA on their own: enabling /arch:AVX or above
+/// enables them.
+
+#if defined(GP_SIMD_FORCE_SCALAR)
+    #define GP_SIMD_AVX2   GP_FALSE
+    #define GP_SIMD_SSE4_1 GP_FALSE
+    #define GP_SIMD_SSE2   GP_FALSE
+    #define GP_SIMD_NEON   GP_FALSE
+#elif defined(__AVX2__) && (defined(__FMA__) || GP_COMPILER_MSVC)
+    #define GP_SIMD_AVX2   GP_TRUE
+    #define GP_SIMD_SSE4_1 GP_FALSE
+    #define GP_SIMD_SSE2   GP_FALSE
+    #define GP_SIMD_NEON   GP_FALSE
+#elif defined(__SSE4_1__) || (GP_COMPILER_MSVC && defined(__AVX__))
+    #define GP_SIMD_AVX2   GP_FALSE
+    #define GP_SIMD_SSE4_1 GP_TRUE
+    #define GP_SIMD_SSE2   GP_FALSE
+    #define GP_SIMD_NEON   GP_FALSE
+#elif defined(__SSE2__) || (GP_COMPILER_MSVC && (GP_ARCHITECTURE_X64 || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+    #define GP_SIMD_AVX2   GP_FALSE
+    #define GP_SIMD_SSE4_1 GP_FALSE
+    #define GP_SIMD_SSE2   GP_TRUE
+    #define GP_SIMD_NEON   GP_FALSE
+#elif defined(__ARM_NEON) && GP_ARCHITECTURE_ARM64
+    #define GP_SIMD_AVX2   GP_FALSE
+    #define GP_SIMD_SSE4_1 GP_FALSE
+    #define GP_SIMD_SSE2   GP_FALSE
+    #define GP_SIMD_NEON   GP_TRUE
+#else
+    #define GP_SIMD_AVX2   GP_FALSE
+    #define GP_SIMD_SSE4_1 GP_FALSE
+    #define GP_SIMD_SSE2   GP_FALSE
+    #define GP_SIMD_NEON   GP_FALSE
+#endif
+
+/// @brief GP_SIMD_SSE, the 4-wide registers use SSE intrinsics, with AVX2, SSE4.1 or SSE2 alone.
+#define GP_SIMD_SSE (GP_SIMD_AVX2 || GP_SIMD_SSE4_1 || GP_SIMD_SSE2)
+
+/// @brief GP_SIMD_SCALAR, no instruction set is available, the registers are plain arrays.
+#define GP_SIMD_SCALAR (!GP_SIMD_SSE && !GP_SIMD_NEON)
+
+#if GP_SIMD_SSE
+    #include <immintrin.h>
+#elif GP_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace gp::simd
+{
+
+/// @brief Alignment required by the aligned loads and stores of 4-wide registers, in bytes.
+inline constexpr USize kRegister4Alignment = 16;
+
+/// @brief Alignment required by the aligned loads and stores of 8-wide registers, in bytes.
+inline constexpr USize kRegister8Alignment = 32;
+
+}   // namespace gp::simd
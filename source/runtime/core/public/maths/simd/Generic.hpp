@@ -0,0 +1,525 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "maths/simd/Common.hpp"
+
+#if GP_SIMD_SCALAR
+
+    #include <bit>
+    #include <cmath>
+
+namespace gp::simd
+{
+
+/// @brief Four 32-bit floats, emulated with plain arrays where no SIMD instruction set is available.
+struct alignas(16) VectorRegister4f
+{
+    Float32 lanes[4];
+};
+
+/// @brief Four 32-bit signed integers, emulated with plain arrays where no SIMD instruction set is available.
+struct alignas(16) VectorRegister4i
+{
+    Int32 lanes[4];
+};
+
+namespace detail
+{
+
+template <typename Register, typename Function>
+[[nodiscard]] GP_FORCEINLINE Register mapLanes(Function&& function) noexcept
+{
+    Register result;
+    for (UInt32 index = 0; index < 4; ++index)
+    {
+        result.lanes[index] = function(index);
+    }
+    return result;
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 maskLane(bool condition) noexcept
+{
+    return std::bit_cast<Float32>(condition ? 0xFFFFFFFFu : 0u);
+}
+
+[[nodiscard]] GP_FORCEINLINE UInt32 bitsOf(Float32 value) noexcept
+{
+    return std::bit_cast<UInt32>(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 floatOf(UInt32 bits) noexcept
+{
+    return std::bit_cast<Float32>(bits);
+}
+
+}   // namespace detail
+
+/// @section Creation, loads and stores.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f zero4f() noexcept
+{
+    return { { 0.0f, 0.0f, 0.0f, 0.0f } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f splat4f(Float32 value) noexcept
+{
+    return { { value, value, value, value } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f set4f(Float32 x, Float32 y, Float32 z, Float32 w) noexcept
+{
+    return { { x, y, z, w } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f load4f(const Float32* source) noexcept
+{
+    return { { source[0], source[1], source[2], source[3] } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f loadUnaligned4f(const Float32* source) noexcept
+{
+    return { { source[0], source[1], source[2], source[3] } };
+}
+
+GP_FORCEINLINE void store(Float32* destination, VectorRegister4f value) noexcept
+{
+    for (UInt32 index = 0; index < 4; ++index)
+    {
+        destination[index] = value.lanes[index];
+    }
+}
+
+GP_FORCEINLINE void storeUnaligned(Float32* destination, VectorRegister4f value) noexcept
+{
+    store(destination, value);
+}
+
+template <UInt32 Index>
+[[nodiscard]] GP_FORCEINLINE Float32 getLane(VectorRegister4f value) noexcept
+{
+    static_assert(Index < 4, "Lane index out of range");
+    return value.lanes[Index];
+}
+
+/// @section Arithmetic.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f add(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return a.lanes[index] + b.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f sub(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return a.lanes[index] - b.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f mul(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return a.lanes[index] * b.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f div(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return a.lanes[index] / b.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f madd(VectorRegister4f a, VectorRegister4f b, VectorRegister4f c) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return std::fma(a.lanes[index], b.lanes[index], c.lanes[index]); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f nmadd(VectorRegister4f a, VectorRegister4f b, VectorRegister4f c) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return std::fma(-a.lanes[index], b.lanes[index], c.lanes[index]); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f min(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return a.lanes[index] < b.lanes[index] ? a.lanes[index] : b.lanes[index]; }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f max(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return a.lanes[index] > b.lanes[index] ? a.lanes[index] : b.lanes[index]; }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f abs(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return std::fabs(value.lanes[index]); });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f negate(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return -value.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f sqrt(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return std::sqrt(value.lanes[index]); });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rsqrtFast(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return 1.0f / std::sqrt(value.lanes[index]); });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rsqrt(VectorRegister4f value) noexcept
+{
+    return rsqrtFast(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rcpFast(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return 1.0f / value.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rcp(VectorRegister4f value) noexcept
+{
+    return rcpFast(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f floor(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return std::floor(value.lanes[index]); });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f ceil(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return std::ceil(value.lanes[index]); });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f roundNearest(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return std::nearbyint(value.lanes[index]); });
+}
+
+/// @section Comparisons, masks and bitwise operations.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpEq(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return detail::maskLane(a.lanes[index] == b.lanes[index]); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpNe(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return detail::maskLane(a.lanes[index] != b.lanes[index]); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpLt(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return detail::maskLane(a.lanes[index] < b.lanes[index]); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpLe(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return detail::maskLane(a.lanes[index] <= b.lanes[index]); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpGt(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return detail::maskLane(a.lanes[index] > b.lanes[index]); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpGe(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return detail::maskLane(a.lanes[index] >= b.lanes[index]); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitAnd(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return detail::floatOf(detail::bitsOf(a.lanes[index]) & detail::bitsOf(b.lanes[index])); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitOr(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return detail::floatOf(detail::bitsOf(a.lanes[index]) | detail::bitsOf(b.lanes[index])); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitXor(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index) { return detail::floatOf(detail::bitsOf(a.lanes[index]) ^ detail::bitsOf(b.lanes[index])); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitAndNot(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>(
+        [&](UInt32 index)
+    { return detail::floatOf(detail::bitsOf(a.lanes[index]) & ~detail::bitsOf(b.lanes[index])); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f
+    select(VectorRegister4f mask, VectorRegister4f ifTrue, VectorRegister4f ifFalse) noexcept
+{
+    return bitOr(bitAnd(mask, ifTrue), bitAndNot(ifFalse, mask));
+}
+
+[[nodiscard]] GP_FORCEINLINE UInt32 moveMask(VectorRegister4f mask) noexcept
+{
+    UInt32 bits = 0;
+    for (UInt32 index = 0; index < 4; ++index)
+    {
+        bits |= (detail::bitsOf(mask.lanes[index]) >> 31) << index;
+    }
+    return bits;
+}
+
+/// @section Shuffles.
+
+template <UInt32 X, UInt32 Y, UInt32 Z, UInt32 W>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f swizzle(VectorRegister4f value) noexcept
+{
+    static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Lane index out of range");
+    return { { value.lanes[X], value.lanes[Y], value.lanes[Z], value.lanes[W] } };
+}
+
+template <UInt32 X, UInt32 Y, UInt32 Z, UInt32 W>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f shuffle(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Lane index out of range");
+    return { { a.lanes[X], a.lanes[Y], b.lanes[Z], b.lanes[W] } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f interleaveLow(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return { { a.lanes[0], b.lanes[0], a.lanes[1], b.lanes[1] } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f interleaveHigh(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return { { a.lanes[2], b.lanes[2], a.lanes[3], b.lanes[3] } };
+}
+
+/// @section Horizontal reductions.
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceAdd(VectorRegister4f value) noexcept
+{
+    return (value.lanes[0] + value.lanes[1]) + (value.lanes[2] + value.lanes[3]);
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceMin(VectorRegister4f value) noexcept
+{
+    const Float32 low = value.lanes[0] < value.lanes[1] ? value.lanes[0] : value.lanes[1];
+    const Float32 high = value.lanes[2] < value.lanes[3] ? value.lanes[2] : value.lanes[3];
+    return low < high ? low : high;
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceMax(VectorRegister4f value) noexcept
+{
+    const Float32 low = value.lanes[0] > value.lanes[1] ? value.lanes[0] : value.lanes[1];
+    const Float32 high = value.lanes[2] > value.lanes[3] ? value.lanes[2] : value.lanes[3];
+    return low > high ? low : high;
+}
+
+/// @section Integer registers.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i zero4i() noexcept
+{
+    return { { 0, 0, 0, 0 } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i splat4i(Int32 value) noexcept
+{
+    return { { value, value, value, value } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i set4i(Int32 x, Int32 y, Int32 z, Int32 w) noexcept
+{
+    return { { x, y, z, w } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i load4i(const Int32* source) noexcept
+{
+    return { { source[0], source[1], source[2], source[3] } };
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i loadUnaligned4i(const Int32* source) noexcept
+{
+    return { { source[0], source[1], source[2], source[3] } };
+}
+
+GP_FORCEINLINE void store(Int32* destination, VectorRegister4i value) noexcept
+{
+    for (UInt32 index = 0; index < 4; ++index)
+    {
+        destination[index] = value.lanes[index];
+    }
+}
+
+GP_FORCEINLINE void storeUnaligned(Int32* destination, VectorRegister4i value) noexcept
+{
+    store(destination, value);
+}
+
+template <UInt32 Index>
+[[nodiscard]] GP_FORCEINLINE Int32 getLane(VectorRegister4i value) noexcept
+{
+    static_assert(Index < 4, "Lane index out of range");
+    return value.lanes[Index];
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i add(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>(
+        [&](UInt32 index)
+    { return static_cast<Int32>(static_cast<UInt32>(a.lanes[index]) + static_cast<UInt32>(b.lanes[index])); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i sub(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>(
+        [&](UInt32 index)
+    { return static_cast<Int32>(static_cast<UInt32>(a.lanes[index]) - static_cast<UInt32>(b.lanes[index])); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i mul(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>(
+        [&](UInt32 index)
+    { return static_cast<Int32>(static_cast<UInt32>(a.lanes[index]) * static_cast<UInt32>(b.lanes[index])); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i min(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>(
+        [&](UInt32 index) { return a.lanes[index] < b.lanes[index] ? a.lanes[index] : b.lanes[index]; }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i max(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>(
+        [&](UInt32 index) { return a.lanes[index] > b.lanes[index] ? a.lanes[index] : b.lanes[index]; }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i cmpEq(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>([&](UInt32 index) { return a.lanes[index] == b.lanes[index] ? -1 : 0; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i cmpGt(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>([&](UInt32 index) { return a.lanes[index] > b.lanes[index] ? -1 : 0; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i cmpLt(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>([&](UInt32 index) { return a.lanes[index] < b.lanes[index] ? -1 : 0; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitAnd(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>([&](UInt32 index) { return a.lanes[index] & b.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitOr(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>([&](UInt32 index) { return a.lanes[index] | b.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitXor(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>([&](UInt32 index) { return a.lanes[index] ^ b.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitAndNot(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>([&](UInt32 index) { return a.lanes[index] & ~b.lanes[index]; });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i
+    select(VectorRegister4i mask, VectorRegister4i ifTrue, VectorRegister4i ifFalse) noexcept
+{
+    return bitOr(bitAnd(mask, ifTrue), bitAndNot(ifFalse, mask));
+}
+
+template <UInt32 Count>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i shiftLeft(VectorRegister4i value) noexcept
+{
+    static_assert(Count < 32, "Shift count out of range");
+    return detail::mapLanes<VectorRegister4i>(
+        [&](UInt32 index) { return static_cast<Int32>(static_cast<UInt32>(value.lanes[index]) << Count); }
+    );
+}
+
+template <UInt32 Count>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i shiftRightLogical(VectorRegister4i value) noexcept
+{
+    static_assert(Count < 32, "Shift count out of range");
+    return detail::mapLanes<VectorRegister4i>(
+        [&](UInt32 index) { return static_cast<Int32>(static_cast<UInt32>(value.lanes[index]) >> Count); }
+    );
+}
+
+template <UInt32 Count>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i shiftRightArithmetic(VectorRegister4i value) noexcept
+{
+    static_assert(Count < 32, "Shift count out of range");
+    return detail::mapLanes<VectorRegister4i>([&](UInt32 index) { return value.lanes[index] >> Count; });
+}
+
+/// @section Conversions.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f convertToFloat(VectorRegister4i value) noexcept
+{
+    return detail::mapLanes<VectorRegister4f>([&](UInt32 index) { return static_cast<Float32>(value.lanes[index]); });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i convertToInt(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>(
+        [&](UInt32 index) { return static_cast<Int32>(std::nearbyint(value.lanes[index])); }
+    );
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i truncateToInt(VectorRegister4f value) noexcept
+{
+    return detail::mapLanes<VectorRegister4i>([&](UInt32 index) { return static_cast<Int32>(value.lanes[index]); });
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i castToInt(VectorRegister4f value) noexcept
+{
+    return std::bit_cast<VectorRegister4i>(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f castToFloat(VectorRegister4i value) noexcept
+{
+    return std::bit_cast<VectorRegister4f>(value);
+}
+
+}   // namespace gp::simd
+
+#endif
@@ -3,3 +3,472 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "maths/simd/Common.hpp"
+
+#if GP_SIMD_NEON
+
+namespace gp::simd
+{
+
+/// @brief Four 32-bit floats in a NEON register.
+using VectorRegister4f = float32x4_t;
+
+/// @brief Four 32-bit signed integers in a NEON register.
+using VectorRegister4i = int32x4_t;
+
+namespace detail
+{
+
+/// @brief Byte indices of a table lookup picking the 32-bit lanes X, Y, Z and W out of one or two registers.
+template <UInt32 X, UInt32 Y, UInt32 Z, UInt32 W>
+[[nodiscard]] GP_FORCEINLINE uint8x16_t laneTable() noexcept
+{
+    // clang-format off
+    static constexpr UInt8 kTable[16] = {
+        X * 4, X * 4 + 1, X * 4 + 2, X * 4 + 3,
+        Y * 4, Y * 4 + 1, Y * 4 + 2, Y * 4 + 3,
+        Z * 4, Z * 4 + 1, Z * 4 + 2, Z * 4 + 3,
+        W * 4, W * 4 + 1, W * 4 + 2, W * 4 + 3,
+    };
+    // clang-format on
+    return vld1q_u8(kTable);
+}
+
+}   // namespace detail
+
+/// @section Creation, loads and stores.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f zero4f() noexcept
+{
+    return vdupq_n_f32(0.0f);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f splat4f(Float32 value) noexcept
+{
+    return vdupq_n_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f set4f(Float32 x, Float32 y, Float32 z, Float32 w) noexcept
+{
+    const Float32 values[4] = { x, y, z, w };
+    return vld1q_f32(values);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f load4f(const Float32* source) noexcept
+{
+    return vld1q_f32(source);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f loadUnaligned4f(const Float32* source) noexcept
+{
+    return vld1q_f32(source);
+}
+
+GP_FORCEINLINE void store(Float32* destination, VectorRegister4f value) noexcept
+{
+    vst1q_f32(destination, value);
+}
+
+GP_FORCEINLINE void storeUnaligned(Float32* destination, VectorRegister4f value) noexcept
+{
+    vst1q_f32(destination, value);
+}
+
+template <UInt32 Index>
+[[nodiscard]] GP_FORCEINLINE Float32 getLane(VectorRegister4f value) noexcept
+{
+    static_assert(Index < 4, "Lane index out of range");
+    return vgetq_lane_f32(value, Index);
+}
+
+/// @section Arithmetic.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f add(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vaddq_f32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f sub(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vsubq_f32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f mul(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vmulq_f32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f div(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vdivq_f32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f madd(VectorRegister4f a, VectorRegister4f b, VectorRegister4f c) noexcept
+{
+    return vfmaq_f32(c, a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f nmadd(VectorRegister4f a, VectorRegister4f b, VectorRegister4f c) noexcept
+{
+    return vfmsq_f32(c, a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f min(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vminq_f32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f max(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vmaxq_f32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f abs(VectorRegister4f value) noexcept
+{
+    return vabsq_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f negate(VectorRegister4f value) noexcept
+{
+    return vnegq_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f sqrt(VectorRegister4f value) noexcept
+{
+    return vsqrtq_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rsqrtFast(VectorRegister4f value) noexcept
+{
+    return vrsqrteq_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rsqrt(VectorRegister4f value) noexcept
+{
+    // The estimate is only 8 bits accurate: two Newton-Raphson steps, each computed by FRSQRTS.
+    VectorRegister4f estimate = vrsqrteq_f32(value);
+    estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(value, estimate), estimate));
+    return vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(value, estimate), estimate));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rcpFast(VectorRegister4f value) noexcept
+{
+    return vrecpeq_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rcp(VectorRegister4f value) noexcept
+{
+    // The estimate is only 8 bits accurate: two Newton-Raphson steps, each computed by FRECPS.
+    VectorRegister4f estimate = vrecpeq_f32(value);
+    estimate = vmulq_f32(estimate, vrecpsq_f32(value, estimate));
+    return vmulq_f32(estimate, vrecpsq_f32(value, estimate));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f floor(VectorRegister4f value) noexcept
+{
+    return vrndmq_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f ceil(VectorRegister4f value) noexcept
+{
+    return vrndpq_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f roundNearest(VectorRegister4f value) noexcept
+{
+    return vrndnq_f32(value);
+}
+
+/// @section Comparisons, masks and bitwise operations.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpEq(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(vceqq_f32(a, b));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpNe(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(a, b)));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpLt(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(vcltq_f32(a, b));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpLe(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(vcleq_f32(a, b));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpGt(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(vcgtq_f32(a, b));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpGe(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(vcgeq_f32(a, b));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitAnd(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitOr(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitXor(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitAndNot(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f
+    select(VectorRegister4f mask, VectorRegister4f ifTrue, VectorRegister4f ifFalse) noexcept
+{
+    return vbslq_f32(vreinterpretq_u32_f32(mask), ifTrue, ifFalse);
+}
+
+[[nodiscard]] GP_FORCEINLINE UInt32 moveMask(VectorRegister4f mask) noexcept
+{
+    static constexpr Int32 kShifts[4] = { 0, 1, 2, 3 };
+    const uint32x4_t signBits = vshrq_n_u32(vreinterpretq_u32_f32(mask), 31);
+    return vaddvq_u32(vshlq_u32(signBits, vld1q_s32(kShifts)));
+}
+
+/// @section Shuffles.
+
+template <UInt32 X, UInt32 Y, UInt32 Z, UInt32 W>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f swizzle(VectorRegister4f value) noexcept
+{
+    static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Lane index out of range");
+    if constexpr (X == Y && Y == Z && Z == W)
+    {
+        return vdupq_laneq_f32(value, X);
+    }
+    else
+    {
+        return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(value), detail::laneTable<X, Y, Z, W>()));
+    }
+}
+
+template <UInt32 X, UInt32 Y, UInt32 Z, UInt32 W>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f shuffle(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Lane index out of range");
+    const uint8x16x2_t table = { { vreinterpretq_u8_f32(a), vreinterpretq_u8_f32(b) } };
+    return vreinterpretq_f32_u8(vqtbl2q_u8(table, detail::laneTable<X, Y, Z + 4, W + 4>()));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f interleaveLow(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vzip1q_f32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f interleaveHigh(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return vzip2q_f32(a, b);
+}
+
+/// @section Horizontal reductions.
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceAdd(VectorRegister4f value) noexcept
+{
+    return vaddvq_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceMin(VectorRegister4f value) noexcept
+{
+    return vminvq_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceMax(VectorRegister4f value) noexcept
+{
+    return vmaxvq_f32(value);
+}
+
+/// @section Integer registers.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i zero4i() noexcept
+{
+    return vdupq_n_s32(0);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i splat4i(Int32 value) noexcept
+{
+    return vdupq_n_s32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i set4i(Int32 x, Int32 y, Int32 z, Int32 w) noexcept
+{
+    const Int32 values[4] = { x, y, z, w };
+    return vld1q_s32(values);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i load4i(const Int32* source) noexcept
+{
+    return vld1q_s32(source);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i loadUnaligned4i(const Int32* source) noexcept
+{
+    return vld1q_s32(source);
+}
+
+GP_FORCEINLINE void store(Int32* destination, VectorRegister4i value) noexcept
+{
+    vst1q_s32(destination, value);
+}
+
+GP_FORCEINLINE void storeUnaligned(Int32* destination, VectorRegister4i value) noexcept
+{
+    vst1q_s32(destination, value);
+}
+
+template <UInt32 Index>
+[[nodiscard]] GP_FORCEINLINE Int32 getLane(VectorRegister4i value) noexcept
+{
+    static_assert(Index < 4, "Lane index out of range");
+    return vgetq_lane_s32(value, Index);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i add(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vaddq_s32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i sub(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vsubq_s32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i mul(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vmulq_s32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i min(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vminq_s32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i max(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vmaxq_s32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i cmpEq(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vreinterpretq_s32_u32(vceqq_s32(a, b));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i cmpGt(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vreinterpretq_s32_u32(vcgtq_s32(a, b));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i cmpLt(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vreinterpretq_s32_u32(vcltq_s32(a, b));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitAnd(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vandq_s32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitOr(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vorrq_s32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitXor(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return veorq_s32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitAndNot(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return vbicq_s32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i
+    select(VectorRegister4i mask, VectorRegister4i ifTrue, VectorRegister4i ifFalse) noexcept
+{
+    return vbslq_s32(vreinterpretq_u32_s32(mask), ifTrue, ifFalse);
+}
+
+template <UInt32 Count>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i shiftLeft(VectorRegister4i value) noexcept
+{
+    static_assert(Count < 32, "Shift count out of range");
+    return vshlq_n_s32(value, Count);
+}
+
+template <UInt32 Count>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i shiftRightLogical(VectorRegister4i value) noexcept
+{
+    static_assert(Count < 32, "Shift count out of range");
+    if constexpr (Count == 0)
+    {
+        return value;
+    }
+    else
+    {
+        return vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(value), Count));
+    }
+}
+
+template <UInt32 Count>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i shiftRightArithmetic(VectorRegister4i value) noexcept
+{
+    static_assert(Count < 32, "Shift count out of range");
+    if constexpr (Count == 0)
+    {
+        return value;
+    }
+    else
+    {
+        return vshrq_n_s32(value, Count);
+    }
+}
+
+/// @section Conversions.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f convertToFloat(VectorRegister4i value) noexcept
+{
+    return vcvtq_f32_s32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i convertToInt(VectorRegister4f value) noexcept
+{
+    return vcvtnq_s32_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i truncateToInt(VectorRegister4f value) noexcept
+{
+    return vcvtq_s32_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i castToInt(VectorRegister4f value) noexcept
+{
+    return vreinterpretq_s32_f32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f castToFloat(VectorRegister4i value) noexcept
+{
+    return vreinterpretq_f32_s32(value);
+}
+
+}   // namespace gp::simd
+
+#endif
@@ -3,3 +3,538 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "maths/simd/Common.hpp"
+
+#if GP_SIMD_SSE
+
+namespace gp::simd
+{
+
+/// @brief Four 32-bit floats in an SSE register.
+using VectorRegister4f = __m128;
+
+/// @brief Four 32-bit signed integers in an SSE register.
+using VectorRegister4i = __m128i;
+
+namespace detail
+{
+
+/// @brief Picks the lanes of @p ifTrue where @p mask is set, the lanes of @p ifFalse elsewhere.
+[[nodiscard]] GP_FORCEINLINE __m128 blend(__m128 mask, __m128 ifTrue, __m128 ifFalse) noexcept
+{
+    #if GP_SIMD_SSE2
+    return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+    #else
+    return _mm_blendv_ps(ifFalse, ifTrue, mask);
+    #endif
+}
+
+/// @copydoc blend(__m128, __m128, __m128)
+[[nodiscard]] GP_FORCEINLINE __m128i blend(__m128i mask, __m128i ifTrue, __m128i ifFalse) noexcept
+{
+    #if GP_SIMD_SSE2
+    return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+    #else
+    return _mm_blendv_epi8(ifFalse, ifTrue, mask);
+    #endif
+}
+
+/// @brief Copies the odd lanes over the even ones, (y, y, w, w).
+[[nodiscard]] GP_FORCEINLINE __m128 duplicateOdd(__m128 value) noexcept
+{
+    #if GP_SIMD_SSE2
+    return _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 1, 1));
+    #else
+    return _mm_movehdup_ps(value);
+    #endif
+}
+
+    #if GP_SIMD_SSE2
+/// @brief Rounds to the nearest integer, ties to even, without SSE4.1: adding and subtracting 2^23 drops the fraction
+/// under the default rounding mode. Values from 2^23 up, infinities and NaN are already integral and kept as is.
+[[nodiscard]] GP_FORCEINLINE __m128 roundNearest(__m128 value) noexcept
+{
+    const __m128 sign = _mm_and_ps(value, _mm_set1_ps(-0.0f));
+    const __m128 magic = _mm_or_ps(sign, _mm_set1_ps(8388608.0f));
+    const __m128 rounded = _mm_or_ps(_mm_sub_ps(_mm_add_ps(value, magic), magic), sign);
+    const __m128 isFractional = _mm_cmplt_ps(_mm_andnot_ps(sign, value), _mm_set1_ps(8388608.0f));
+    return blend(isFractional, rounded, value);
+}
+    #endif
+
+}   // namespace detail
+
+/// @section Creation, loads and stores.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f zero4f() noexcept
+{
+    return _mm_setzero_ps();
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f splat4f(Float32 value) noexcept
+{
+    return _mm_set1_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f set4f(Float32 x, Float32 y, Float32 z, Float32 w) noexcept
+{
+    return _mm_setr_ps(x, y, z, w);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f load4f(const Float32* source) noexcept
+{
+    return _mm_load_ps(source);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f loadUnaligned4f(const Float32* source) noexcept
+{
+    return _mm_loadu_ps(source);
+}
+
+GP_FORCEINLINE void store(Float32* destination, VectorRegister4f value) noexcept
+{
+    _mm_store_ps(destination, value);
+}
+
+GP_FORCEINLINE void storeUnaligned(Float32* destination, VectorRegister4f value) noexcept
+{
+    _mm_storeu_ps(destination, value);
+}
+
+template <UInt32 Index>
+[[nodiscard]] GP_FORCEINLINE Float32 getLane(VectorRegister4f value) noexcept
+{
+    static_assert(Index < 4, "Lane index out of range");
+    if constexpr (Index == 0)
+    {
+        return _mm_cvtss_f32(value);
+    }
+    else
+    {
+        return _mm_cvtss_f32(_mm_shuffle_ps(value, value, _MM_SHUFFLE(Index, Index, Index, Index)));
+    }
+}
+
+/// @section Arithmetic.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f add(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_add_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f sub(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_sub_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f mul(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_mul_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f div(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_div_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f madd(VectorRegister4f a, VectorRegister4f b, VectorRegister4f c) noexcept
+{
+    #if GP_SIMD_AVX2
+    return _mm_fmadd_ps(a, b, c);
+    #else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+    #endif
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f nmadd(VectorRegister4f a, VectorRegister4f b, VectorRegister4f c) noexcept
+{
+    #if GP_SIMD_AVX2
+    return _mm_fnmadd_ps(a, b, c);
+    #else
+    return _mm_sub_ps(c, _mm_mul_ps(a, b));
+    #endif
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f min(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_min_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f max(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_max_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f abs(VectorRegister4f value) noexcept
+{
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f negate(VectorRegister4f value) noexcept
+{
+    return _mm_xor_ps(_mm_set1_ps(-0.0f), value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f sqrt(VectorRegister4f value) noexcept
+{
+    return _mm_sqrt_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rsqrtFast(VectorRegister4f value) noexcept
+{
+    return _mm_rsqrt_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rsqrt(VectorRegister4f value) noexcept
+{
+    // One Newton-Raphson step on the 12-bit estimate: y' = y * (1.5 - 0.5 * x * y * y). The step gives NaN for 0 and
+    // infinity, where x * y is 0 * infinity: those lanes keep the estimate, exact there.
+    const VectorRegister4f estimate = _mm_rsqrt_ps(value);
+    const VectorRegister4f halfValue = _mm_mul_ps(value, _mm_set1_ps(0.5f));
+    const VectorRegister4f refined =
+        _mm_mul_ps(estimate, nmadd(_mm_mul_ps(halfValue, estimate), estimate, _mm_set1_ps(1.5f)));
+    return detail::blend(_mm_cmpord_ps(refined, refined), refined, estimate);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rcpFast(VectorRegister4f value) noexcept
+{
+    return _mm_rcp_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f rcp(VectorRegister4f value) noexcept
+{
+    // One Newton-Raphson step on the 12-bit estimate: y' = y * (2 - x * y). As in rsqrt(), 0 and infinity keep the
+    // estimate.
+    const VectorRegister4f estimate = _mm_rcp_ps(value);
+    const VectorRegister4f refined = _mm_mul_ps(estimate, nmadd(value, estimate, _mm_set1_ps(2.0f)));
+    return detail::blend(_mm_cmpord_ps(refined, refined), refined, estimate);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f floor(VectorRegister4f value) noexcept
+{
+    #if GP_SIMD_SSE2
+    // Steps down the lanes that rounded up.
+    const VectorRegister4f rounded = detail::roundNearest(value);
+    return _mm_sub_ps(rounded, _mm_and_ps(_mm_cmpgt_ps(rounded, value), _mm_set1_ps(1.0f)));
+    #else
+    return _mm_floor_ps(value);
+    #endif
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f ceil(VectorRegister4f value) noexcept
+{
+    #if GP_SIMD_SSE2
+    // Steps up the lanes that rounded down, then restores the sign of the results that reached -0.
+    const VectorRegister4f rounded = detail::roundNearest(value);
+    const VectorRegister4f stepped = _mm_add_ps(rounded, _mm_and_ps(_mm_cmplt_ps(rounded, value), _mm_set1_ps(1.0f)));
+    return _mm_or_ps(stepped, _mm_and_ps(value, _mm_set1_ps(-0.0f)));
+    #else
+    return _mm_ceil_ps(value);
+    #endif
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f roundNearest(VectorRegister4f value) noexcept
+{
+    #if GP_SIMD_SSE2
+    return detail::roundNearest(value);
+    #else
+    return _mm_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    #endif
+}
+
+/// @section Comparisons, masks and bitwise operations.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpEq(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_cmpeq_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpNe(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_cmpneq_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpLt(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_cmplt_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpLe(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_cmple_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpGt(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_cmpgt_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f cmpGe(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_cmpge_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitAnd(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_and_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitOr(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_or_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitXor(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_xor_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f bitAndNot(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_andnot_ps(b, a);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f
+    select(VectorRegister4f mask, VectorRegister4f ifTrue, VectorRegister4f ifFalse) noexcept
+{
+    return detail::blend(mask, ifTrue, ifFalse);
+}
+
+[[nodiscard]] GP_FORCEINLINE UInt32 moveMask(VectorRegister4f mask) noexcept
+{
+    return static_cast<UInt32>(_mm_movemask_ps(mask));
+}
+
+/// @section Shuffles.
+
+template <UInt32 X, UInt32 Y, UInt32 Z, UInt32 W>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f swizzle(VectorRegister4f value) noexcept
+{
+    static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Lane index out of range");
+    #if GP_SIMD_AVX2
+    return _mm_permute_ps(value, _MM_SHUFFLE(W, Z, Y, X));
+    #else
+    return _mm_shuffle_ps(value, value, _MM_SHUFFLE(W, Z, Y, X));
+    #endif
+}
+
+template <UInt32 X, UInt32 Y, UInt32 Z, UInt32 W>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f shuffle(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Lane index out of range");
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f interleaveLow(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_unpacklo_ps(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f interleaveHigh(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return _mm_unpackhi_ps(a, b);
+}
+
+/// @section Horizontal reductions.
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceAdd(VectorRegister4f value) noexcept
+{
+    const VectorRegister4f pairs = _mm_add_ps(value, detail::duplicateOdd(value));
+    return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceMin(VectorRegister4f value) noexcept
+{
+    const VectorRegister4f pairs = _mm_min_ps(value, detail::duplicateOdd(value));
+    return _mm_cvtss_f32(_mm_min_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+}
+
+[[nodiscard]] GP_FORCEINLINE Float32 reduceMax(VectorRegister4f value) noexcept
+{
+    const VectorRegister4f pairs = _mm_max_ps(value, detail::duplicateOdd(value));
+    return _mm_cvtss_f32(_mm_max_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+}
+
+/// @section Integer registers.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i zero4i() noexcept
+{
+    return _mm_setzero_si128();
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i splat4i(Int32 value) noexcept
+{
+    return _mm_set1_epi32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i set4i(Int32 x, Int32 y, Int32 z, Int32 w) noexcept
+{
+    return _mm_setr_epi32(x, y, z, w);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i load4i(const Int32* source) noexcept
+{
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(source));
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i loadUnaligned4i(const Int32* source) noexcept
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+}
+
+GP_FORCEINLINE void store(Int32* destination, VectorRegister4i value) noexcept
+{
+    _mm_store_si128(reinterpret_cast<__m128i*>(destination), value);
+}
+
+GP_FORCEINLINE void storeUnaligned(Int32* destination, VectorRegister4i value) noexcept
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value);
+}
+
+template <UInt32 Index>
+[[nodiscard]] GP_FORCEINLINE Int32 getLane(VectorRegister4i value) noexcept
+{
+    static_assert(Index < 4, "Lane index out of range");
+    #if GP_SIMD_SSE2
+    return _mm_cvtsi128_si32(_mm_shuffle_epi32(value, _MM_SHUFFLE(Index, Index, Index, Index)));
+    #else
+    return _mm_extract_epi32(value, Index);
+    #endif
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i add(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return _mm_add_epi32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i sub(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return _mm_sub_epi32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i mul(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    #if GP_SIMD_SSE2
+    // Multiplies the even lanes and the odd ones into 64-bit products, then gathers their low halves.
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(
+        _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))
+    );
+    #else
+    return _mm_mullo_epi32(a, b);
+    #endif
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i min(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    #if GP_SIMD_SSE2
+    return detail::blend(_mm_cmpgt_epi32(a, b), b, a);
+    #else
+    return _mm_min_epi32(a, b);
+    #endif
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i max(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    #if GP_SIMD_SSE2
+    return detail::blend(_mm_cmpgt_epi32(a, b), a, b);
+    #else
+    return _mm_max_epi32(a, b);
+    #endif
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i cmpEq(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return _mm_cmpeq_epi32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i cmpGt(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return _mm_cmpgt_epi32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i cmpLt(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return _mm_cmplt_epi32(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitAnd(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return _mm_and_si128(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitOr(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return _mm_or_si128(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitXor(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return _mm_xor_si128(a, b);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i bitAndNot(VectorRegister4i a, VectorRegister4i b) noexcept
+{
+    return _mm_andnot_si128(b, a);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i
+    select(VectorRegister4i mask, VectorRegister4i ifTrue, VectorRegister4i ifFalse) noexcept
+{
+    return detail::blend(mask, ifTrue, ifFalse);
+}
+
+template <UInt32 Count>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i shiftLeft(VectorRegister4i value) noexcept
+{
+    static_assert(Count < 32, "Shift count out of range");
+    return _mm_slli_epi32(value, Count);
+}
+
+template <UInt32 Count>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i shiftRightLogical(VectorRegister4i value) noexcept
+{
+    static_assert(Count < 32, "Shift count out of range");
+    return _mm_srli_epi32(value, Count);
+}
+
+template <UInt32 Count>
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i shiftRightArithmetic(VectorRegister4i value) noexcept
+{
+    static_assert(Count < 32, "Shift count out of range");
+    return _mm_srai_epi32(value, Count);
+}
+
+/// @section Conversions.
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f convertToFloat(VectorRegister4i value) noexcept
+{
+    return _mm_cvtepi32_ps(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i convertToInt(VectorRegister4f value) noexcept
+{
+    return _mm_cvtps_epi32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i truncateToInt(VectorRegister4f value) noexcept
+{
+    return _mm_cvttps_epi32(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4i castToInt(VectorRegister4f value) noexcept
+{
+    return _mm_castps_si128(value);
+}
+
+[[nodiscard]] GP_FORCEINLINE VectorRegister4f castToFloat(VectorRegister4i value) noexcept
+{
+    return _mm_castsi128_ps(value);
+}
+
+}   // namespace gp::simd
+
+#endif
@@ -0,0 +1,58 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+/// @brief Entry point of the SIMD register layer.
+/// @details
+/// Includes the backend selected by maths/simd/Common.hpp, every one of them exposing the same free functions in
+/// gp::simd over VectorRegister4f, VectorRegister4i and VectorRegister8f, so the code written against them compiles
+/// unchanged for SSE2, SSE4.1, AVX2, NEON and the scalar fallback. Behaviour that differs between instruction sets:
+/// - min and max return either operand when one of them is NaN.
+/// - select expects masks made of whole lanes, as returned by the comparisons; partial masks are not portable.
+/// - rsqrtFast and rcpFast are hardware estimates, of 12 bits on x86 and 8 bits on NEON; rsqrt and rcp refine them to
+///   about 22 bits. The scalar fallback computes all four exactly. On every backend, rsqrt and rcp return an
+///   infinity of the same sign for a zero, and 0 for +infinity.
+/// - convertToInt rounds to nearest even, lanes out of the Int32 range give an unspecified value.
+
+#include "maths/simd/AVX.hpp"
+#include "maths/simd/Common.hpp"
+#include "maths/simd/Generic.hpp"
+#include "maths/simd/NEON.hpp"
+#include "maths/simd/SSE.hpp"
+
+namespace gp::simd
+{
+
+/// @brief Checks whether at least one lane of a mask is set.
+[[nodiscard]] GP_FORCEINLINE bool anyTrue(VectorRegister4f mask) noexcept
+{
+    return moveMask(mask) != 0;
+}
+
+/// @brief Checks whether every lane of a mask is set.
+[[nodiscard]] GP_FORCEINLINE bool allTrue(VectorRegister4f mask) noexcept
+{
+    return moveMask(mask) == 0xFu;
+}
+
+/// @brief Checks whether at least one lane of a mask is set.
+[[nodiscard]] GP_FORCEINLINE bool anyTrue(VectorRegister8f mask) noexcept
+{
+    return moveMask(mask) != 0;
+}
+
+/// @brief Checks whether every lane of a mask is set.
+[[nodiscard]] GP_FORCEINLINE bool allTrue(VectorRegister8f mask) noexcept
+{
+    return moveMask(mask) == 0xFFu;
+}
+
+/// @brief Computes the dot product of the four lanes of two registers.
+[[nodiscard]] GP_FORCEINLINE Float32 dot4(VectorRegister4f a, VectorRegister4f b) noexcept
+{
+    return reduceAdd(mul(a, b));
+}
+
+}   // namespace gp::simd
@@ -3,3 +3,232 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/geometry/primitives/Frustum.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/matrix/Matrix4x4.hpp"
+#include "maths/vector/Vector2.hpp"
+#include "maths/vector/Vector3.hpp"
+#include "maths/vector/Vector4.hpp"
+#include <cmath>
+
+namespace gp::math
+{
+
+/// @brief How a projection maps view depth to clip depth.
+enum class ProjectionDepth : UInt8
+{
+    Standard,   //<! The near plane maps to depth 0 and the far plane to depth 1.
+    Reversed    //<! The near plane maps to depth 1 and the far plane to depth 0, for an even precision over distance.
+};
+
+/// @brief A projection template, the matrix from view space to clip space along with its inverse.
+/// @details
+/// View space is left-handed: x goes right, y up, and the camera looks down +z. Clip space has x and y in [-w, w]
+/// with y up, and depth in [0, w] as with Vulkan, Direct3D, Metal and WebGPU. Reverse-Z spreads the floating-point
+/// precision of a depth buffer evenly over distance, and infinite projections have no far plane. The inverse is
+/// computed once, in closed form for the factories, so that unprojections do not invert a matrix per query.
+/// @tparam T The floating-point type for the matrix elements.
+template <concepts::IsFloatingPoint T>
+struct Projection
+{
+public:
+    Matrix4x4<T> matrix;                                  //<! The matrix from view space to clip space.
+    Matrix4x4<T> inverseMatrix;                           //<! The matrix from clip space to view space.
+    ProjectionDepth depth{ ProjectionDepth::Standard };   //<! Which of depth 0 or 1 is on the near plane.
+
+public:
+    /// @brief Returns a perspective projection.
+    /// @param[in] verticalFov The vertical field of view, in radians.
+    /// @param[in] aspectRatio The width of the view divided by its height.
+    /// @param[in] nearZ The distance of the near plane, must be positive.
+    /// @param[in] farZ The distance of the far plane, must be greater than @p nearZ.
+    /// @param[in] inDepth Whether the depth is reversed.
+    [[nodiscard]] static Projection<T> makePerspective(
+        const T verticalFov,
+        const T aspectRatio,
+        const T nearZ,
+        const T farZ,
+        const ProjectionDepth inDepth = ProjectionDepth::Reversed
+    ) noexcept
+    {
+        // Clip depth is (a * z + b) / z, which is 0 on one plane and 1 on the other.
+        const T range = farZ - nearZ;
+        if (inDepth == ProjectionDepth::Reversed)
+        {
+            return makePerspectiveWithDepth(verticalFov, aspectRatio, -nearZ / range, nearZ * farZ / range, inDepth);
+        }
+        return makePerspectiveWithDepth(verticalFov, aspectRatio, farZ / range, -nearZ * farZ / range, inDepth);
+    }
+
+    /// @brief Returns a perspective projection without far plane, every distance past the near plane being visible.
+    /// @param[in] verticalFov The vertical field of view, in radians.
+    /// @param[in] aspectRatio The width of the view divided by its height.
+    /// @param[in] nearZ The distance of the near plane, must be positive.
+    /// @param[in] inDepth Whether the depth is reversed, the infinity mapping to 0 instead of 1.
+    [[nodiscard]] static Projection<T> makeInfinitePerspective(
+        const T verticalFov,
+        const T aspectRatio,
+        const T nearZ,
+        const ProjectionDepth inDepth = ProjectionDepth::Reversed
+    ) noexcept
+    {
+        // Clip depth is near / z with reverse-Z, and 1 - near / z otherwise.
+        if (inDepth == ProjectionDepth::Reversed)
+        {
+            return makePerspectiveWithDepth(verticalFov, aspectRatio, T{ 0 }, nearZ, inDepth);
+        }
+        return makePerspectiveWithDepth(verticalFov, aspectRatio, T{ 1 }, -nearZ, inDepth);
+    }
+
+    /// @brief Returns an orthographic projection, centered on the view axis.
+    /// @param[in] width The width of the view volume.
+    /// @param[in] height The height of the view volume.
+    /// @param[in] nearZ The distance of the near plane.
+    /// @param[in] farZ The distance of the far plane, must be greater than @p nearZ.
+    /// @param[in] inDepth Whether the depth is reversed.
+    [[nodiscard]] static constexpr Projection<T> makeOrthographic(
+        const T width,
+        const T height,
+        const T nearZ,
+        const T farZ,
+        const ProjectionDepth inDepth = ProjectionDepth::Reversed
+    ) noexcept
+    {
+        // Clip depth is a * z + b, which is 0 on one plane and 1 on the other.
+        const T range = farZ - nearZ;
+        const bool isReversed = inDepth == ProjectionDepth::Reversed;
+        const T a = isReversed ? T{ -1 } / range : T{ 1 } / range;
+        const T b = isReversed ? farZ / range : -nearZ / range;
+
+        Projection<T> result;
+        result.matrix = Matrix4x4<T>(T{ 2 } / width, 0, 0, 0, 0, T{ 2 } / height, 0, 0, 0, 0, a, b, 0, 0, 0, 1);
+        result.inverseMatrix = Matrix4x4<T>(
+            width * T{ 0.5 }, 0, 0, 0, 0, height * T{ 0.5 }, 0, 0, 0, 0, T{ 1 } / a, -b / a, 0, 0, 0, 1
+        );
+        result.depth = inDepth;
+        return result;
+    }
+
+    /// @brief Returns the sub-pixel offset of a frame in the jitter sequence of temporal anti-aliasing.
+    /// @details Follows the Halton sequence in bases 2 and 3, which covers a pixel evenly over a few frames.
+    /// @param[in] frameIndex The index of the frame, wrapped around the sequence.
+    /// @param[in] phaseCount The length of the sequence, such as 8 or 16.
+    /// @return The offset of the frame, in pixels, in [-0.5, 0.5) on each axis.
+    [[nodiscard]] static constexpr Vector2<T> getJitterOffset(const UInt32 frameIndex, const UInt32 phaseCount = 8)
+        noexcept
+    {
+        // The sequence starts at 1, as its first element is the pixel corner in both bases.
+        const UInt32 index = frameIndex % phaseCount + 1;
+        return Vector2<T>(getHalton(index, 2) - T{ 0.5 }, getHalton(index, 3) - T{ 0.5 });
+    }
+
+public:
+    /// @brief Default constructor initializes to the identity, which maps view space to clip space as is.
+    [[nodiscard]] constexpr Projection() noexcept = default;
+
+    /// @brief Constructor with a projection matrix, inverted once.
+    /// @param[in] inMatrix The matrix from view space to clip space, must be invertible.
+    /// @param[in] inDepth Which of depth 0 or 1 the matrix maps the near plane to.
+    [[nodiscard]] explicit constexpr Projection(
+        const Matrix4x4<T>& inMatrix, const ProjectionDepth inDepth = ProjectionDepth::Standard
+    ) noexcept
+        : matrix(inMatrix)
+        , inverseMatrix(inMatrix.inverse())
+        , depth(inDepth)
+    {}
+
+public:
+    /// @brief Checks whether the near plane maps to depth 1.
+    [[nodiscard]] constexpr bool isReversed() const noexcept
+    {
+        return depth == ProjectionDepth::Reversed;
+    }
+
+    /// @brief Returns the clip depth of the near plane, 0 or 1.
+    [[nodiscard]] constexpr T getNearDepth() const noexcept
+    {
+        return isReversed() ? T{ 1 } : T{ 0 };
+    }
+
+    /// @brief Returns the frustum of the projection, in view space.
+    [[nodiscard]] constexpr Frustum<T> getFrustum() const noexcept
+    {
+        return Frustum<T>(matrix);
+    }
+
+    /// @brief Returns the normalized device coordinates of a point in view space, with a depth in [0, 1].
+    [[nodiscard]] constexpr Vector3<T> projectPoint(const Vector3<T>& viewPoint) const noexcept
+    {
+        const Vector4<T> clip = matrix * Vector4<T>(viewPoint, T{ 1 });
+        return Vector3<T>(clip) / clip.w;
+    }
+
+    /// @brief Returns the point in view space of normalized device coordinates, with a depth in [0, 1].
+    [[nodiscard]] constexpr Vector3<T> unprojectPoint(const Vector3<T>& ndcPoint) const noexcept
+    {
+        const Vector4<T> view = inverseMatrix * Vector4<T>(ndcPoint, T{ 1 });
+        return Vector3<T>(view) / view.w;
+    }
+
+    /// @brief Returns the projection moved by a sub-pixel offset, for temporal anti-aliasing.
+    /// @details The offset is applied in clip space, so that the inverse is updated in closed form.
+    /// @param[in] pixelOffset The offset in pixels, with y down, such as getJitterOffset().
+    /// @param[in] viewportSize The size of the viewport in pixels.
+    [[nodiscard]] constexpr Projection<T>
+        jittered(const Vector2<T>& pixelOffset, const Vector2<T>& viewportSize) const noexcept
+    {
+        // Clip x and y move by offset * w: the rows of x and y take a part of the row of w, and the inverse of this
+        // shear subtracts the same part of the columns of x and y from the column of w.
+        const T offsetX = T{ 2 } * pixelOffset.x / viewportSize.x;
+        const T offsetY = T{ -2 } * pixelOffset.y / viewportSize.y;
+        Projection<T> result = *this;
+        for (Int32 column = 0; column < 4; ++column)
+        {
+            result.matrix.m[0][column] += offsetX * matrix.m[3][column];
+            result.matrix.m[1][column] += offsetY * matrix.m[3][column];
+        }
+        for (Int32 row = 0; row < 4; ++row)
+        {
+            result.inverseMatrix.m[row][3] -= offsetX * inverseMatrix.m[row][0] + offsetY * inverseMatrix.m[row][1];
+        }
+        return result;
+    }
+
+private:
+    /// @brief Returns the perspective projection whose clip depth is (a * z + b) / z.
+    [[nodiscard]] static Projection<T> makePerspectiveWithDepth(
+        const T verticalFov, const T aspectRatio, const T a, const T b, const ProjectionDepth inDepth
+    ) noexcept
+    {
+        const T scaleY = T{ 1 } / std::tan(verticalFov * T{ 0.5 });
+        const T scaleX = scaleY / aspectRatio;
+
+        // Clip w is the view depth z, and the inverse recovers the view w from the clip depth and w.
+        Projection<T> result;
+        result.matrix = Matrix4x4<T>(scaleX, 0, 0, 0, 0, scaleY, 0, 0, 0, 0, a, b, 0, 0, 1, 0);
+        result.inverseMatrix = Matrix4x4<T>(
+            T{ 1 } / scaleX, 0, 0, 0, 0, T{ 1 } / scaleY, 0, 0, 0, 0, 0, 1, 0, 0, T{ 1 } / b, -a / b
+        );
+        result.depth = inDepth;
+        return result;
+    }
+
+    /// @brief Returns the element of the Halton sequence of a base at @p index, in [0, 1).
+    [[nodiscard]] static constexpr T getHalton(UInt32 index, const UInt32 base) noexcept
+    {
+        // The digits of the index in the base, mirrored around the radix point.
+        T result = T{ 0 };
+        T fraction = T{ 1 };
+        for (; index > 0; index /= base)
+        {
+            fraction /= static_cast<T>(base);
+            result += fraction * static_cast<T>(index % base);
+        }
+        return result;
+    }
+};
+
+}   // namespace gp::math
@@ -3,3 +3,166 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/views/VectorView.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Constants.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/matrix/Matrix4x4.hpp"
+#include "maths/rotation/Quaternion.hpp"
+#include "maths/vector/Vector3.hpp"
+
+namespace gp::math
+{
+
+/// @brief A transformation made of a scale, a rotation and a translation, applied in that order.
+/// @details
+/// Transforms compose like matrices, A * B applies B first. Composition and inversion are exact as long as the
+/// scale is uniform, or the scaled transform carries no rotation: otherwise the result is the nearest scale, rotation
+/// and translation, and world matrices should be propagated with localToWorld() instead. Float32 transforms compose
+/// and invert through the maths/simd register layer, other types and constant evaluation use the scalar code.
+/// @tparam T The floating-point type for the transform components.
+template <concepts::IsFloatingPoint T>
+struct alignas(sizeof(T) * 4) Transform
+{
+public:
+    Quaternion<T> rotation;   //<! The rotation, normalized.
+    Vector3<T> translation;   //<! The translation, applied last.
+    Vector3<T> scale;         //<! The scale along each local axis, applied first.
+
+public:
+    /// @brief Returns the identity transform.
+    [[nodiscard]] static constexpr Transform<T> identity() noexcept
+    {
+        return Transform<T>();
+    }
+
+public:
+    /// @brief Default constructor initializes to the identity transform.
+    [[nodiscard]] constexpr Transform() noexcept
+        : rotation()
+        , translation(T{ 0 })
+        , scale(T{ 1 })
+    {}
+
+    /// @brief Constructor with individual components.
+    /// @param[in] inRotation The rotation, must be normalized.
+    /// @param[in] inTranslation The translation.
+    /// @param[in] inScale The scale along each local axis.
+    [[nodiscard]] constexpr Transform(
+        const Quaternion<T>& inRotation, const Vector3<T>& inTranslation, const Vector3<T>& inScale = Vector3<T>(T{ 1 })
+    ) noexcept
+        : rotation(inRotation)
+        , translation(inTranslation)
+        , scale(inScale)
+    {}
+
+public:
+    /// @brief Composes two transforms, the result applies @p other first and this transform second.
+    [[nodiscard]] constexpr Transform<T> operator*(const Transform<T>& other) const noexcept;
+
+    /// @brief Composes this transform with another one, this = this * other.
+    constexpr Transform<T>& operator*=(const Transform<T>& other) noexcept
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    /// @brief Checks whether every component is exactly equal to the one of another transform.
+    [[nodiscard]] constexpr bool operator==(const Transform<T>& other) const noexcept
+    {
+        return rotation == other.rotation && translation == other.translation && scale == other.scale;
+    }
+
+    /// @brief Checks whether at least one component differs from the one of another transform.
+    [[nodiscard]] constexpr bool operator!=(const Transform<T>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+public:
+    /// @brief Returns the inverse transform, exact when the scale is uniform.
+    /// @note Every scale component must be non-zero.
+    [[nodiscard]] constexpr Transform<T> inverse() const noexcept;
+
+    /// @brief Checks whether this transform is equal to another one within a given tolerance.
+    /// @note Compares rotations by components: q and -q represent the same rotation but are not equal.
+    [[nodiscard]] constexpr bool
+        equals(const Transform<T>& other, const T tolerance = constants<T>::kindaSmallNumber) const noexcept
+    {
+        return rotation.equals(other.rotation, tolerance) && translation.equals(other.translation, tolerance) &&
+               scale.equals(other.scale, tolerance);
+    }
+
+    /// @brief Transforms a point: scale, rotation, then translation.
+    [[nodiscard]] constexpr Vector3<T> transformPoint(const Vector3<T>& point) const noexcept
+    {
+        return rotation.rotateVector(point * scale) + translation;
+    }
+
+    /// @brief Transforms a direction: scale and rotation, without the translation.
+    [[nodiscard]] constexpr Vector3<T> transformVector(const Vector3<T>& vec) const noexcept
+    {
+        return rotation.rotateVector(vec * scale);
+    }
+
+    /// @brief Converts the transform to an affine matrix.
+    [[nodiscard]] constexpr Matrix4x4<T> toMatrix() const noexcept;
+
+public:
+    /// @brief Computes the world matrix of every node of a hierarchy from its local transform.
+    /// @details
+    /// Nodes are stored in topological order, every parent before its children, so a single forward pass multiplies
+    /// the world matrix of each parent by the local matrix of its children. Matrices are propagated, not transforms,
+    /// so non-uniform scales under rotated children stay exact.
+    /// @param[in] locals The transform of each node relative to its parent.
+    /// @param[in] parents The index of the parent of each node, lower than the index of the node, or -1 for roots.
+    /// @param[out] worlds The world matrix of each node.
+    static void localToWorld(
+        ConstVectorView<Transform<T>> locals, ConstVectorView<Int32> parents, VectorView<Matrix4x4<T>> worlds
+    ) noexcept
+    {
+        localToWorld(locals, parents, worlds, 0, locals.size());
+    }
+
+    /// @brief Computes the world matrices of a range of nodes, whose ancestors outside the range are up to date.
+    /// @details
+    /// Lets a hierarchy be updated in parallel by subtree: when nodes are stored in depth-first pre-order, every
+    /// subtree is a contiguous range, see getSubtreeEnd(). Once the world matrices of the upper levels are computed,
+    /// the ranges of the subtrees below them share no node and can be handed to different jobs.
+    /// @param[in] locals The transform of each node relative to its parent, for the whole hierarchy.
+    /// @param[in] parents The index of the parent of each node, for the whole hierarchy.
+    /// @param[in,out] worlds The world matrix of each node, for the whole hierarchy. Only the range is written, the
+    /// parents outside of it are read.
+    /// @param[in] first The index of the first node to update.
+    /// @param[in] count The number of nodes to update.
+    static void localToWorld(
+        ConstVectorView<Transform<T>> locals,
+        ConstVectorView<Int32> parents,
+        VectorView<Matrix4x4<T>> worlds,
+        const Int32 first,
+        const Int32 count
+    ) noexcept;
+
+    /// @brief Returns the end of the subtree rooted at @p node, in a hierarchy stored in depth-first pre-order.
+    /// @details In pre-order, the descendants of a node directly follow it, and all have parents at or after it: the
+    /// subtree ends at the first following node whose parent comes before @p node.
+    /// @param[in] parents The index of the parent of each node, or -1 for roots.
+    /// @param[in] node The root of the subtree.
+    /// @return One past the index of the last node of the subtree.
+    [[nodiscard]] static Int32 getSubtreeEnd(ConstVectorView<Int32> parents, const Int32 node) noexcept
+    {
+        Int32 end = node + 1;
+        while (end < parents.size() && parents[end] >= node)
+        {
+            ++end;
+        }
+        return end;
+    }
+};
+
+}   // namespace gp::math
+
+// Include the implementation of the Transform template
+#include "maths/transform/Transform.inl"
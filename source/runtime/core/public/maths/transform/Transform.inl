@@ -0,0 +1,146 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "maths/simd/VectorRegister.hpp"
+#include "maths/transform/Transform.hpp"
+#include <type_traits>
+
+namespace gp::math
+{
+
+namespace detail
+{
+
+/// @brief Whether transforms of T go through the SIMD register layer, which handles four Float32 lanes.
+template <typename T>
+inline constexpr bool kIsSimdTransform = std::is_same_v<T, Float32>;
+
+/// @brief Loads a Float32 vector in the first three lanes of a register, the last one being zero.
+GP_FORCEINLINE simd::VectorRegister4f loadVector3(const Vector3<Float32>& vec) noexcept
+{
+    return simd::set4f(vec.x, vec.y, vec.z, 0.0f);
+}
+
+/// @brief Stores the first three lanes of a register to a Float32 vector.
+GP_FORCEINLINE Vector3<Float32> storeVector3(simd::VectorRegister4f value) noexcept
+{
+    alignas(simd::kRegister4Alignment) Float32 lanes[4];
+    simd::store(lanes, value);
+    return Vector3<Float32>(lanes[0], lanes[1], lanes[2]);
+}
+
+/// @brief Computes the cross product of the first three lanes of two registers.
+GP_FORCEINLINE simd::VectorRegister4f cross3(simd::VectorRegister4f a, simd::VectorRegister4f b) noexcept
+{
+    return simd::sub(
+        simd::mul(simd::swizzle<1, 2, 0, 3>(a), simd::swizzle<2, 0, 1, 3>(b)),
+        simd::mul(simd::swizzle<2, 0, 1, 3>(a), simd::swizzle<1, 2, 0, 3>(b))
+    );
+}
+
+/// @brief Rotates the vector held by the first three lanes of a register by a normalized quaternion register.
+GP_FORCEINLINE simd::VectorRegister4f rotate3(simd::VectorRegister4f rotation, simd::VectorRegister4f vec) noexcept
+{
+    // Same as Quaternion::rotateVector(): v' = v + w t + q x t, with t = 2 q x v.
+    const simd::VectorRegister4f cross = cross3(rotation, vec);
+    const simd::VectorRegister4f twiceCross = simd::add(cross, cross);
+    return simd::add(
+        simd::madd(simd::swizzle<3, 3, 3, 3>(rotation), twiceCross, vec), cross3(rotation, twiceCross)
+    );
+}
+
+}   // namespace detail
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Transform<T> Transform<T>::operator*(const Transform<T>& other) const noexcept
+{
+    if !consteval
+    {
+        if constexpr (detail::kIsSimdTransform<T>)
+        {
+            const simd::VectorRegister4f thisRotation = simd::load4f(&rotation.x);
+            const simd::VectorRegister4f thisScale = detail::loadVector3(scale);
+            const simd::VectorRegister4f otherTranslation = detail::loadVector3(other.translation);
+
+            Transform<T> result;
+            result.rotation = rotation * other.rotation;
+            result.scale = detail::storeVector3(simd::mul(thisScale, detail::loadVector3(other.scale)));
+            result.translation = detail::storeVector3(simd::add(
+                detail::rotate3(thisRotation, simd::mul(thisScale, otherTranslation)), detail::loadVector3(translation)
+            ));
+            return result;
+        }
+    }
+
+    return Transform<T>(rotation * other.rotation, transformPoint(other.translation), scale * other.scale);
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Transform<T> Transform<T>::inverse() const noexcept
+{
+    // The inverse rotation and scale undo the translation: p = R(S q) + t gives q = S^-1 R^-1 (p - t).
+    if !consteval
+    {
+        if constexpr (detail::kIsSimdTransform<T>)
+        {
+            const simd::VectorRegister4f inverseRotation =
+                simd::mul(simd::load4f(&rotation.x), simd::set4f(-1.0f, -1.0f, -1.0f, 1.0f));
+            const simd::VectorRegister4f inverseScale =
+                simd::div(simd::splat4f(1.0f), simd::set4f(scale.x, scale.y, scale.z, 1.0f));
+
+            Transform<T> result;
+            simd::store(&result.rotation.x, inverseRotation);
+            result.scale = detail::storeVector3(inverseScale);
+            const simd::VectorRegister4f negatedTranslation = simd::negate(detail::loadVector3(translation));
+            result.translation =
+                detail::storeVector3(simd::mul(inverseScale, detail::rotate3(inverseRotation, negatedTranslation)));
+            return result;
+        }
+    }
+
+    const Quaternion<T> inverseRotation = rotation.conjugate();
+    const Vector3<T> inverseScale = Vector3<T>(T{ 1 }) / scale;
+    return Transform<T>(inverseRotation, inverseRotation.rotateVector(-translation) * inverseScale, inverseScale);
+}
+
+template <concepts::IsFloatingPoint T>
+[[nodiscard]] constexpr Matrix4x4<T> Transform<T>::toMatrix() const noexcept
+{
+    // The columns of the rotation matrix are the rotated axes, each one scaled by its own factor.
+    const Matrix3x3<T> rotationMatrix = rotation.toMatrix();
+    Matrix4x4<T> result;
+    for (Int32 row = 0; row < 3; ++row)
+    {
+        result.m[row][0] = rotationMatrix.m[row][0] * scale.x;
+        result.m[row][1] = rotationMatrix.m[row][1] * scale.y;
+        result.m[row][2] = rotationMatrix.m[row][2] * scale.z;
+    }
+    result.setTranslation(translation);
+    return result;
+}
+
+template <concepts::IsFloatingPoint T>
+void Transform<T>::localToWorld(
+    ConstVectorView<Transform<T>> locals,
+    ConstVectorView<Int32> parents,
+    VectorView<Matrix4x4<T>> worlds,
+    const Int32 first,
+    const Int32 count
+) noexcept
+{
+    GP_ASSERT(locals.size() == parents.size() && locals.size() == worlds.size(), "localToWorld() size mismatch");
+    GP_ASSERT(first >= 0 && count >= 0 && first + count <= locals.size(), "localToWorld() range out of bounds");
+
+    for (Int32 node = first; node < first + count; ++node)
+    {
+        const Int32 parent = parents[node];
+        GP_ASSERT(parent < node, "localToWorld() requires parents to come before their children");
+        const Matrix4x4<T> local = locals[node].toMatrix();
+        worlds[node] = parent < 0 ? local : worlds[parent] * local;
+    }
+}
+
+}   // namespace gp::math
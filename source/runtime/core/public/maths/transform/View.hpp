@@ -3,3 +3,158 @@
 // mailto:support AT graphical-playground DOT com
 
 #pragma once
+
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/geometry/primitives/Frustum.hpp"
+#include "maths/geometry/primitives/Ray.hpp"
+#include "maths/MathForward.hpp"
+#include "maths/matrix/Matrix4x4.hpp"
+#include "maths/transform/Projection.hpp"
+#include "maths/vector/Vector2.hpp"
+#include "maths/vector/Vector3.hpp"
+#include "maths/vector/Vector4.hpp"
+
+namespace gp::math
+{
+
+/// @brief A view template, the placement of a camera along with its projection.
+/// @details
+/// Holds the matrices from world space to view space and to clip space, and their inverses, all computed once so
+/// that the per-pixel queries such as getScreenRay() are a matrix-vector product and a division each.
+/// @tparam T The floating-point type for the matrix elements.
+template <concepts::IsFloatingPoint T>
+struct View
+{
+public:
+    Matrix4x4<T> viewMatrix;              //<! The matrix from world space to view space.
+    Matrix4x4<T> inverseViewMatrix;       //<! The matrix from view space to world space.
+    Projection<T> projection;             //<! The projection from view space to clip space.
+    Matrix4x4<T> viewProjection;          //<! The matrix from world space to clip space.
+    Matrix4x4<T> inverseViewProjection;   //<! The matrix from clip space to world space.
+
+public:
+    /// @brief Returns the view of a camera at @p eye looking at @p target.
+    /// @param[in] eye The position of the camera.
+    /// @param[in] target The point looked at, distinct from @p eye.
+    /// @param[in] up The direction of the top of the view, not parallel to the view direction.
+    /// @param[in] inProjection The projection of the camera.
+    [[nodiscard]] static constexpr View<T> makeLookAt(
+        const Vector3<T>& eye, const Vector3<T>& target, const Vector3<T>& up, const Projection<T>& inProjection
+    ) noexcept
+    {
+        // The rows of the rotation are the axes of the camera, and its inverse is their transpose.
+        const Vector3<T> forward = (target - eye).getSafeNormal();
+        const Vector3<T> right = up.cross(forward).getSafeNormal();
+        const Vector3<T> trueUp = forward.cross(right);
+        const Matrix4x4<T> viewMatrix(
+            right.x, right.y, right.z, -right.dot(eye),
+            trueUp.x, trueUp.y, trueUp.z, -trueUp.dot(eye),
+            forward.x, forward.y, forward.z, -forward.dot(eye),
+            0, 0, 0, 1
+        );
+        const Matrix4x4<T> inverseViewMatrix(
+            right.x, trueUp.x, forward.x, eye.x,
+            right.y, trueUp.y, forward.y, eye.y,
+            right.z, trueUp.z, forward.z, eye.z,
+            0, 0, 0, 1
+        );
+        return View<T>(viewMatrix, inverseViewMatrix, inProjection);
+    }
+
+public:
+    /// @brief Default constructor initializes to the identity view and projection.
+    [[nodiscard]] constexpr View() noexcept = default;
+
+    /// @brief Constructor with a rigid view matrix, inverted once.
+    /// @param[in] inViewMatrix The matrix from world space to view space, must be affine.
+    /// @param[in] inProjection The projection from view space to clip space.
+    [[nodiscard]] constexpr View(const Matrix4x4<T>& inViewMatrix, const Projection<T>& inProjection) noexcept
+        : View(inViewMatrix, inViewMatrix.inverseAffine(), inProjection)
+    {}
+
+    /// @brief Constructor with a view matrix and its inverse.
+    /// @param[in] inViewMatrix The matrix from world space to view space.
+    /// @param[in] inInverseViewMatrix The matrix from view space to world space.
+    /// @param[in] inProjection The projection from view space to clip space.
+    [[nodiscard]] constexpr View(
+        const Matrix4x4<T>& inViewMatrix, const Matrix4x4<T>& inInverseViewMatrix, const Projection<T>& inProjection
+    ) noexcept
+        : viewMatrix(inViewMatrix)
+        , inverseViewMatrix(inInverseViewMatrix)
+        , projection(inProjection)
+        , viewProjection(inProjection.matrix * inViewMatrix)
+        , inverseViewProjection(inInverseViewMatrix * inProjection.inverseMatrix)
+    {}
+
+public:
+    /// @brief Returns the position of the camera, in world space.
+    [[nodiscard]] constexpr Vector3<T> getPosition() const noexcept
+    {
+        return inverseViewMatrix.getTranslation();
+    }
+
+    /// @brief Returns the direction the camera looks at, in world space.
+    [[nodiscard]] constexpr Vector3<T> getForward() const noexcept
+    {
+        return Vector3<T>(inverseViewMatrix.getColumn(2));
+    }
+
+    /// @brief Returns the frustum of the view, in world space.
+    [[nodiscard]] constexpr Frustum<T> getFrustum() const noexcept
+    {
+        return Frustum<T>(viewProjection);
+    }
+
+    /// @brief Returns the normalized device coordinates of a point in world space, with a depth in [0, 1].
+    [[nodiscard]] constexpr Vector3<T> projectPoint(const Vector3<T>& worldPoint) const noexcept
+    {
+        const Vector4<T> clip = viewProjection * Vector4<T>(worldPoint, T{ 1 });
+        return Vector3<T>(clip) / clip.w;
+    }
+
+    /// @brief Returns the point in world space of normalized device coordinates, with a depth in [0, 1].
+    [[nodiscard]] constexpr Vector3<T> unprojectPoint(const Vector3<T>& ndcPoint) const noexcept
+    {
+        const Vector4<T> world = inverseViewProjection * Vector4<T>(ndcPoint, T{ 1 });
+        return Vector3<T>(world) / world.w;
+    }
+
+    /// @brief Returns the ray through normalized device coordinates, starting on the near plane.
+    /// @details Works for perspective and orthographic projections alike, including infinite ones.
+    /// @param[in] ndc The coordinates on the screen, x and y in [-1, 1] with y up.
+    [[nodiscard]] constexpr Ray<T> getRay(const Vector2<T>& ndc) const noexcept
+    {
+        // Both points share the unprojection of x and y, and differ by a multiple of the column of depth. The second
+        // point is halfway through the depth range, which stays at a finite distance for infinite projections.
+        const Vector4<T> base = inverseViewProjection * Vector4<T>(ndc.x, ndc.y, T{ 0 }, T{ 1 });
+        const Vector4<T> depthAxis = inverseViewProjection.getColumn(2);
+        const T nearDepth = projection.getNearDepth();
+        const Vector3<T> origin =
+            (Vector3<T>(base) + Vector3<T>(depthAxis) * nearDepth) / (base.w + depthAxis.w * nearDepth);
+        const Vector3<T> midPoint =
+            (Vector3<T>(base) + Vector3<T>(depthAxis) * T{ 0.5 }) / (base.w + depthAxis.w * T{ 0.5 });
+        return Ray<T>(origin, (midPoint - origin).getSafeNormal());
+    }
+
+    /// @brief Returns the ray through a pixel, starting on the near plane.
+    /// @param[in] pixel The position in pixels, with y down and the origin at the top-left corner of the viewport.
+    /// @param[in] viewportSize The size of the viewport in pixels.
+    [[nodiscard]] constexpr Ray<T> getScreenRay(const Vector2<T>& pixel, const Vector2<T>& viewportSize) const noexcept
+    {
+        return getRay(
+            Vector2<T>(T{ 2 } * pixel.x / viewportSize.x - T{ 1 }, T{ 1 } - T{ 2 } * pixel.y / viewportSize.y)
+        );
+    }
+
+    /// @brief Returns the view with its projection moved by a sub-pixel offset, for temporal anti-aliasing.
+    /// @param[in] pixelOffset The offset in pixels, with y down, such as Projection::getJitterOffset().
+    /// @param[in] viewportSize The size of the viewport in pixels.
+    [[nodiscard]] constexpr View<T>
+        jittered(const Vector2<T>& pixelOffset, const Vector2<T>& viewportSize) const noexcept
+    {
+        return View<T>(viewMatrix, inverseViewMatrix, projection.jittered(pixelOffset, viewportSize));
+    }
+};
+
+}   // namespace gp::math
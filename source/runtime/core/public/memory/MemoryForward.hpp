@@ -14,6 +14,10 @@ namespace gp::memory
 class Malloc;
 class MallocAnsi;
 
+/// @section Allocators forward declarations
+
+class DefaultAllocator;
+
 }   // namespace gp::memory
 
 namespace gp
@@ -21,15 +25,28 @@ namespace gp
 
 /// @section Pointers forward declarations
 
+/// @brief Selects how reference counts are updated.
+enum class RefCountMode : UInt8
+{
+    ThreadSafe,      //<! Atomic counts, the pointer may be shared between threads.
+    NotThreadSafe    //<! Plain counts, for objects confined to a single thread.
+};
+
 template <typename T>
+class DefaultDelete;
+
+template <typename T, typename Deleter = DefaultDelete<T>>
 class UniquePtr;
 
-template <typename T>
+template <typename T, RefCountMode Mode = RefCountMode::ThreadSafe>
 class SharedPtr;
 
-template <typename T>
+template <typename T, RefCountMode Mode = RefCountMode::ThreadSafe>
 class WeakPtr;
 
+template <RefCountMode Mode = RefCountMode::ThreadSafe>
+class RefCountedObject;
+
 template <typename T>
 class RefCountedPtr;
 
@@ -0,0 +1,77 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include "memory/backends/Malloc.hpp"
+#include "memory/GlobalMemory.hpp"
+#include "memory/MemoryBase.hpp"
+
+namespace gp::memory
+{
+
+/// @brief Stateless allocator forwarding every request to the global Malloc instance.
+/// @details
+/// This is the allocator containers use unless told otherwise. Being empty, it costs nothing when stored as a
+/// `GP_NO_UNIQUE_ADDRESS` member, and every instance can free memory allocated by any other one.
+class DefaultAllocator
+{
+public:
+    /// @brief Allocates a block of memory.
+    /// @param[in] size Size of the block in bytes.
+    /// @param[in] alignment Alignment of the block in bytes, kDefaultAlignment lets the backend decide.
+    /// @return Pointer to the allocated block.
+    [[nodiscard]] static void* allocate(USize size, UInt32 alignment = kDefaultAlignment)
+    {
+        return getGlobalMalloc()->allocate(size, alignment);
+    }
+
+    /// @brief Resizes a block of memory, preserving its content up to the smallest of the two sizes.
+    /// @param[in] ptr Block to resize, may be nullptr.
+    /// @param[in] newSize New size of the block in bytes.
+    /// @param[in] alignment Alignment of the block in bytes, must match the one used to allocate it.
+    /// @return Pointer to the resized block.
+    [[nodiscard]] static void* reallocate(void* ptr, USize newSize, UInt32 alignment = kDefaultAlignment)
+    {
+        return getGlobalMalloc()->reallocate(ptr, newSize, alignment);
+    }
+
+    /// @brief Releases a block of memory.
+    /// @param[in] ptr Block to release, may be nullptr.
+    static void deallocate(void* ptr)
+    {
+        if (ptr != nullptr)
+        {
+            getGlobalMalloc()->deallocate(ptr);
+        }
+    }
+
+    /// @brief Allocates uninitialized storage for @p count objects of type T.
+    /// @tparam T Object type.
+    /// @param[in] count Number of objects.
+    /// @return Pointer to the allocated storage.
+    template <typename T>
+    [[nodiscard]] static T* allocateArray(USize count)
+    {
+        return static_cast<T*>(allocate(count * sizeof(T), static_cast<UInt32>(alignof(T))));
+    }
+
+    /// @brief Resizes a storage previously returned by allocateArray(), relocating it bytewise.
+    /// @note Only valid for trivially relocatable types.
+    /// @tparam T Object type.
+    /// @param[in] ptr Storage to resize, may be nullptr.
+    /// @param[in] newCount New number of objects.
+    /// @return Pointer to the resized storage.
+    template <typename T>
+    [[nodiscard]] static T* reallocateArray(T* ptr, USize newCount)
+    {
+        return static_cast<T*>(reallocate(ptr, newCount * sizeof(T), static_cast<UInt32>(alignof(T))));
+    }
+
+public:
+    [[nodiscard]] constexpr bool operator==(const DefaultAllocator&) const noexcept = default;
+};
+
+}   // namespace gp::memory
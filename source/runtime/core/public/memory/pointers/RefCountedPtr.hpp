@@ -4,13 +4,249 @@
 
 #pragma once
 
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "memory/MemoryForward.hpp"
+#include "memory/pointers/RefCounter.hpp"
+#include <utility>
+
 namespace gp
 {
 
-/// @brief
-/// @tparam T
+/// @brief Base class of intrusively reference counted objects, used with RefCountedPtr.
+/// @details
+/// The count lives in the object itself, so a RefCountedPtr is a single pointer and can be rebuilt from a raw pointer
+/// at any time (handy for objects handed through C APIs or stored in descriptor tables). The object deletes itself when
+/// its last reference is released. Objects start with a count of zero: the first RefCountedPtr takes ownership.
+/// @tparam Mode Thread safety of the reference count.
+template <RefCountMode Mode>
+class RefCountedObject
+{
+private:
+    mutable memory::RefCounter<Mode> m_refCount;
+
+public:
+    RefCountedObject() noexcept = default;
+
+    /// @brief The reference count belongs to the object's identity and is never copied.
+    RefCountedObject(const RefCountedObject&) = delete;
+    RefCountedObject& operator=(const RefCountedObject&) = delete;
+
+protected:
+    virtual ~RefCountedObject()
+    {
+        GP_ASSERT(m_refCount.get() == 0, "RefCountedObject destroyed while still referenced");
+    }
+
+public:
+    /// @brief Adds a reference.
+    void addRef() const noexcept
+    {
+        m_refCount.increment();
+    }
+
+    /// @brief Removes a reference, deleting the object when it was the last one.
+    /// @return The number of references left.
+    UInt32 release() const
+    {
+        const UInt32 count = m_refCount.decrement();
+        if (count == 0)
+        {
+            delete this;
+        }
+        return count;
+    }
+
+    /// @brief Returns the number of references, only a hint in ThreadSafe mode.
+    [[nodiscard]] UInt32 getRefCount() const noexcept
+    {
+        return m_refCount.get();
+    }
+};
+
+namespace concepts
+{
+
+/// @brief Concept satisfied by types exposing addRef() and release(), as expected by RefCountedPtr.
+template <typename T>
+concept IsRefCounted = requires(const T& object) {
+    object.addRef();
+    object.release();
+};
+
+}   // namespace concepts
+
+/// @brief Smart pointer to an intrusively reference counted object.
+/// @details
+/// Works with any type providing addRef() and release(), RefCountedObject being the usual base. The pointer is as
+/// large as a raw pointer and copying it only touches the object's own count.
+/// @tparam T Type of the pointed object.
 template <typename T>
 class RefCountedPtr
-{};
+{
+public:
+    using ElementType = T;
+
+private:
+    T* m_ptr{ nullptr };
+
+public:
+    /// @brief Constructs a null pointer.
+    constexpr RefCountedPtr() noexcept = default;
+
+    /// @brief Constructs a null pointer.
+    constexpr RefCountedPtr(std::nullptr_t) noexcept {}
+
+    /// @brief Constructs a pointer referencing @p ptr, adding a reference.
+    /// @param[in] ptr Object to reference, may be nullptr.
+    explicit RefCountedPtr(T* ptr) noexcept
+        : m_ptr(ptr)
+    {
+        addRef();
+    }
+
+    RefCountedPtr(const RefCountedPtr& other) noexcept
+        : m_ptr(other.m_ptr)
+    {
+        addRef();
+    }
+
+    RefCountedPtr(RefCountedPtr&& other) noexcept
+        : m_ptr(std::exchange(other.m_ptr, nullptr))
+    {}
+
+    /// @brief Converting copy and move constructors, from pointers to derived types.
+    template <concepts::IsPointerConvertibleTo<T> U>
+    RefCountedPtr(const RefCountedPtr<U>& other) noexcept
+        : m_ptr(other.get())
+    {
+        addRef();
+    }
+
+    template <concepts::IsPointerConvertibleTo<T> U>
+    RefCountedPtr(RefCountedPtr<U>&& other) noexcept
+        : m_ptr(other.detach())
+    {}
+
+    ~RefCountedPtr()
+    {
+        releaseRef();
+    }
+
+    RefCountedPtr& operator=(const RefCountedPtr& other) noexcept
+    {
+        RefCountedPtr(other).swap(*this);
+        return *this;
+    }
+
+    RefCountedPtr& operator=(RefCountedPtr&& other) noexcept
+    {
+        RefCountedPtr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    RefCountedPtr& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+public:
+    /// @brief Wraps a pointer whose reference is already owned by the caller, without adding one.
+    /// @param[in] ptr Object whose reference is transferred to the returned pointer.
+    /// @return The owning pointer.
+    [[nodiscard]] static RefCountedPtr adopt(T* ptr) noexcept
+    {
+        RefCountedPtr result;
+        result.m_ptr = ptr;
+        return result;
+    }
+
+    /// @brief Releases ownership of the reference without decrementing it.
+    /// @return The pointer, whose reference must later be released by the caller.
+    [[nodiscard]] T* detach() noexcept
+    {
+        return std::exchange(m_ptr, nullptr);
+    }
+
+    /// @brief Drops the current reference and references @p ptr instead.
+    /// @param[in] ptr Object to reference, may be nullptr.
+    void reset(T* ptr = nullptr) noexcept
+    {
+        RefCountedPtr(ptr).swap(*this);
+    }
+
+    void swap(RefCountedPtr& other) noexcept
+    {
+        std::swap(m_ptr, other.m_ptr);
+    }
+
+public:
+    [[nodiscard]] T* get() const noexcept
+    {
+        return m_ptr;
+    }
+
+    [[nodiscard]] T& operator*() const noexcept
+    {
+        GP_ASSERT(m_ptr != nullptr, "Dereferencing a null RefCountedPtr");
+        return *m_ptr;
+    }
+
+    [[nodiscard]] T* operator->() const noexcept
+    {
+        GP_ASSERT(m_ptr != nullptr, "Dereferencing a null RefCountedPtr");
+        return m_ptr;
+    }
+
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return m_ptr != nullptr;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+        return m_ptr != nullptr;
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const RefCountedPtr<U>& other) const noexcept
+    {
+        return m_ptr == other.get();
+    }
+
+    [[nodiscard]] bool operator==(std::nullptr_t) const noexcept
+    {
+        return m_ptr == nullptr;
+    }
+
+private:
+    void addRef() const noexcept
+    {
+        if (m_ptr != nullptr)
+        {
+            m_ptr->addRef();
+        }
+    }
+
+    void releaseRef() noexcept
+    {
+        if (m_ptr != nullptr)
+        {
+            m_ptr->release();
+        }
+    }
+};
+
+/// @brief Creates a reference counted object and returns the first reference to it.
+/// @tparam T Type of the object, must be reference counted.
+/// @param[in] args Arguments forwarded to the constructor.
+/// @return The owning pointer.
+template <typename T, typename... Args>
+requires concepts::IsRefCounted<T>
+[[nodiscard]] RefCountedPtr<T> makeRefCounted(Args&&... args)
+{
+    return RefCountedPtr<T>(new T(std::forward<Args>(args)...));
+}
 
 }   // namespace gp
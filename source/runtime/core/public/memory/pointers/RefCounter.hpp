@@ -0,0 +1,114 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include "memory/MemoryForward.hpp"
+#include <atomic>
+
+namespace gp::memory
+{
+
+/// @brief Reference count shared by the smart pointers, atomic or not depending on @p Mode.
+/// @details
+/// In ThreadSafe mode increments are relaxed and decrements use acquire-release ordering, so that the thread
+/// releasing the last reference observes every write made through the other references before destroying the object.
+/// In NotThreadSafe mode the count is a plain integer and no locked instruction is ever emitted.
+/// @tparam Mode Thread safety of the count.
+template <RefCountMode Mode>
+class RefCounter;
+
+template <>
+class RefCounter<RefCountMode::ThreadSafe>
+{
+private:
+    std::atomic<UInt32> m_count;
+
+public:
+    constexpr explicit RefCounter(UInt32 initial = 0) noexcept
+        : m_count(initial)
+    {}
+
+public:
+    /// @brief Adds a reference.
+    void increment() noexcept
+    {
+        m_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Adds a reference only if the count is not zero.
+    /// @return True if a reference was added.
+    [[nodiscard]] bool tryIncrement() noexcept
+    {
+        UInt32 count = m_count.load(std::memory_order_relaxed);
+        while (count != 0)
+        {
+            if (m_count.compare_exchange_weak(count, count + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Removes a reference.
+    /// @return The count after the decrement.
+    UInt32 decrement() noexcept
+    {
+        return m_count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    }
+
+    /// @brief Returns the current count, only a hint when other threads hold references.
+    [[nodiscard]] UInt32 get() const noexcept
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+};
+
+template <>
+class RefCounter<RefCountMode::NotThreadSafe>
+{
+private:
+    UInt32 m_count;
+
+public:
+    constexpr explicit RefCounter(UInt32 initial = 0) noexcept
+        : m_count(initial)
+    {}
+
+public:
+    /// @brief Adds a reference.
+    void increment() noexcept
+    {
+        ++m_count;
+    }
+
+    /// @brief Adds a reference only if the count is not zero.
+    /// @return True if a reference was added.
+    [[nodiscard]] bool tryIncrement() noexcept
+    {
+        if (m_count == 0)
+        {
+            return false;
+        }
+        ++m_count;
+        return true;
+    }
+
+    /// @brief Removes a reference.
+    /// @return The count after the decrement.
+    UInt32 decrement() noexcept
+    {
+        return --m_count;
+    }
+
+    /// @brief Returns the current count.
+    [[nodiscard]] UInt32 get() const noexcept
+    {
+        return m_count;
+    }
+};
+
+}   // namespace gp::memory
@@ -4,13 +4,365 @@
 
 #pragma once
 
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "memory/allocators/DefaultAllocator.hpp"
+#include "memory/MemoryForward.hpp"
+#include "memory/pointers/RefCounter.hpp"
+#include "memory/pointers/UniquePtr.hpp"
+#include <memory>
+#include <new>
+#include <utility>
+
 namespace gp
 {
 
-/// @brief
-/// @tparam T
-template <typename T>
+namespace detail
+{
+
+/// @brief Reference counts shared by the SharedPtr and WeakPtr instances pointing to the same object.
+/// @details
+/// The weak count holds one extra reference on behalf of all the strong references: the object is destroyed when the
+/// strong count reaches zero, the block itself when the weak count does.
+template <RefCountMode Mode>
+class SharedControlBlock
+{
+private:
+    memory::RefCounter<Mode> m_strongCount{ 1 };
+    memory::RefCounter<Mode> m_weakCount{ 1 };
+
+public:
+    SharedControlBlock() noexcept = default;
+    SharedControlBlock(const SharedControlBlock&) = delete;
+    SharedControlBlock& operator=(const SharedControlBlock&) = delete;
+
+protected:
+    virtual ~SharedControlBlock() = default;
+
+    /// @brief Destroys the managed object, called once the last strong reference is released.
+    virtual void destroyObject() noexcept = 0;
+
+public:
+    void addStrong() noexcept
+    {
+        m_strongCount.increment();
+    }
+
+    [[nodiscard]] bool tryAddStrong() noexcept
+    {
+        return m_strongCount.tryIncrement();
+    }
+
+    void releaseStrong() noexcept
+    {
+        if (m_strongCount.decrement() == 0)
+        {
+            destroyObject();
+            releaseWeak();
+        }
+    }
+
+    void addWeak() noexcept
+    {
+        m_weakCount.increment();
+    }
+
+    void releaseWeak() noexcept
+    {
+        if (m_weakCount.decrement() == 0)
+        {
+            this->~SharedControlBlock();
+            memory::DefaultAllocator::deallocate(this);
+        }
+    }
+
+    [[nodiscard]] UInt32 getStrongCount() const noexcept
+    {
+        return m_strongCount.get();
+    }
+};
+
+/// @brief Control block storing the managed object inline, used by makeShared() for a single allocation.
+template <typename T, RefCountMode Mode>
+class SharedControlBlockInline final : public SharedControlBlock<Mode>
+{
+private:
+    alignas(T) Byte m_storage[sizeof(T)];
+
+public:
+    template <typename... Args>
+    explicit SharedControlBlockInline(Args&&... args)
+    {
+        ::new (static_cast<void*>(m_storage)) T(std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] T* getObject() noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(m_storage));
+    }
+
+protected:
+    void destroyObject() noexcept override
+    {
+        std::destroy_at(getObject());
+    }
+};
+
+/// @brief Control block owning a separately allocated object, destroyed with a deleter.
+template <typename T, typename Deleter, RefCountMode Mode>
+class SharedControlBlockPointer final : public SharedControlBlock<Mode>
+{
+private:
+    T* m_ptr;
+    GP_NO_UNIQUE_ADDRESS Deleter m_deleter;
+
+public:
+    SharedControlBlockPointer(T* ptr, Deleter deleter) noexcept
+        : m_ptr(ptr)
+        , m_deleter(std::move(deleter))
+    {}
+
+protected:
+    void destroyObject() noexcept override
+    {
+        m_deleter(m_ptr);
+    }
+};
+
+}   // namespace detail
+
+/// @brief Smart pointer sharing the ownership of an object, destroyed when its last SharedPtr goes away.
+/// @details
+/// Ownership is tracked by a separate control block holding a strong and a weak count. makeShared() allocates the
+/// object inside its control block, so a shared object costs a single allocation.
+/// The counts are atomic in ThreadSafe mode, and plain integers in NotThreadSafe mode: objects that never leave their
+/// thread do not pay for locked increments. Pointers of different modes do not convert to each other.
+/// @tparam T Type of the shared object.
+/// @tparam Mode Thread safety of the reference counts.
+template <typename T, RefCountMode Mode>
 class SharedPtr
-{};
+{
+    template <typename, RefCountMode>
+    friend class SharedPtr;
+
+    template <typename, RefCountMode>
+    friend class WeakPtr;
+
+    template <typename U, RefCountMode M, typename... Args>
+    friend SharedPtr<U, M> makeShared(Args&&... args);
+
+public:
+    using ElementType = T;
+    using ControlBlock = detail::SharedControlBlock<Mode>;
+
+private:
+    T* m_ptr{ nullptr };
+    ControlBlock* m_control{ nullptr };
+
+public:
+    /// @brief Constructs an empty pointer.
+    constexpr SharedPtr() noexcept = default;
+
+    /// @brief Constructs an empty pointer.
+    constexpr SharedPtr(std::nullptr_t) noexcept {}
+
+    /// @brief Takes ownership of @p ptr, deleted with DefaultDelete.
+    /// @note Prefer makeShared(), which allocates the object and the counts together.
+    /// @param[in] ptr Object to own, may be nullptr.
+    template <concepts::IsPointerConvertibleTo<T> U>
+    explicit SharedPtr(U* ptr)
+        : SharedPtr(ptr, DefaultDelete<U>())
+    {}
+
+    /// @brief Takes ownership of @p ptr, destroyed with @p deleter.
+    /// @param[in] ptr Object to own, may be nullptr.
+    /// @param[in] deleter Deleter invoked with @p ptr once the last strong reference is released.
+    template <concepts::IsPointerConvertibleTo<T> U, typename Deleter>
+    requires concepts::IsInvocable<Deleter&, U*>
+    SharedPtr(U* ptr, Deleter deleter)
+    {
+        if (ptr != nullptr)
+        {
+            using Block = detail::SharedControlBlockPointer<U, Deleter, Mode>;
+            m_control = ::new (memory::DefaultAllocator::allocate(sizeof(Block), alignof(Block)))
+                Block(ptr, std::move(deleter));
+            m_ptr = ptr;
+        }
+    }
+
+    /// @brief Takes the ownership of the object of a UniquePtr.
+    template <concepts::IsPointerConvertibleTo<T> U, typename Deleter>
+    SharedPtr(UniquePtr<U, Deleter>&& other)
+        : SharedPtr(other.get(), std::move(other.getDeleter()))
+    {
+        (void)other.release();
+    }
+
+    SharedPtr(const SharedPtr& other) noexcept
+        : m_ptr(other.m_ptr)
+        , m_control(other.m_control)
+    {
+        addStrong();
+    }
+
+    SharedPtr(SharedPtr&& other) noexcept
+        : m_ptr(std::exchange(other.m_ptr, nullptr))
+        , m_control(std::exchange(other.m_control, nullptr))
+    {}
+
+    /// @brief Converting copy and move constructors, from pointers to derived types.
+    template <concepts::IsPointerConvertibleTo<T> U>
+    SharedPtr(const SharedPtr<U, Mode>& other) noexcept
+        : m_ptr(other.m_ptr)
+        , m_control(other.m_control)
+    {
+        addStrong();
+    }
+
+    template <concepts::IsPointerConvertibleTo<T> U>
+    SharedPtr(SharedPtr<U, Mode>&& other) noexcept
+        : m_ptr(std::exchange(other.m_ptr, nullptr))
+        , m_control(std::exchange(other.m_control, nullptr))
+    {}
+
+    /// @brief Aliasing constructor, shares the ownership of @p owner while pointing to @p ptr.
+    /// @details Typically used to point to a member of the owned object.
+    /// @param[in] owner Pointer whose ownership is shared.
+    /// @param[in] ptr Pointer returned by get(), must stay valid as long as the owned object is.
+    template <typename U>
+    SharedPtr(const SharedPtr<U, Mode>& owner, T* ptr) noexcept
+        : m_ptr(ptr)
+        , m_control(owner.m_control)
+    {
+        addStrong();
+    }
+
+    ~SharedPtr()
+    {
+        if (m_control != nullptr)
+        {
+            m_control->releaseStrong();
+        }
+    }
+
+    SharedPtr& operator=(const SharedPtr& other) noexcept
+    {
+        SharedPtr(other).swap(*this);
+        return *this;
+    }
+
+    SharedPtr& operator=(SharedPtr&& other) noexcept
+    {
+        SharedPtr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    template <concepts::IsPointerConvertibleTo<T> U>
+    SharedPtr& operator=(const SharedPtr<U, Mode>& other) noexcept
+    {
+        SharedPtr(other).swap(*this);
+        return *this;
+    }
+
+    template <concepts::IsPointerConvertibleTo<T> U>
+    SharedPtr& operator=(SharedPtr<U, Mode>&& other) noexcept
+    {
+        SharedPtr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    SharedPtr& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+private:
+    SharedPtr(ControlBlock* control, T* ptr) noexcept
+        : m_ptr(ptr)
+        , m_control(control)
+    {}
+
+public:
+    /// @brief Releases the shared ownership, leaving the pointer empty.
+    void reset() noexcept
+    {
+        SharedPtr().swap(*this);
+    }
+
+    void swap(SharedPtr& other) noexcept
+    {
+        std::swap(m_ptr, other.m_ptr);
+        std::swap(m_control, other.m_control);
+    }
+
+public:
+    [[nodiscard]] T* get() const noexcept
+    {
+        return m_ptr;
+    }
+
+    [[nodiscard]] T& operator*() const noexcept
+    {
+        GP_ASSERT(m_ptr != nullptr, "Dereferencing a null SharedPtr");
+        return *m_ptr;
+    }
+
+    [[nodiscard]] T* operator->() const noexcept
+    {
+        GP_ASSERT(m_ptr != nullptr, "Dereferencing a null SharedPtr");
+        return m_ptr;
+    }
+
+    /// @brief Returns the number of SharedPtr sharing the object, only a hint in ThreadSafe mode.
+    [[nodiscard]] UInt32 useCount() const noexcept
+    {
+        return m_control != nullptr ? m_control->getStrongCount() : 0;
+    }
+
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return m_ptr != nullptr;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+        return m_ptr != nullptr;
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const SharedPtr<U, Mode>& other) const noexcept
+    {
+        return m_ptr == other.get();
+    }
+
+    [[nodiscard]] bool operator==(std::nullptr_t) const noexcept
+    {
+        return m_ptr == nullptr;
+    }
+
+private:
+    void addStrong() const noexcept
+    {
+        if (m_control != nullptr)
+        {
+            m_control->addStrong();
+        }
+    }
+};
+
+/// @brief Creates a shared object, allocating the object and its reference counts in a single block.
+/// @tparam T Type of the object.
+/// @tparam Mode Thread safety of the reference counts.
+/// @param[in] args Arguments forwarded to the constructor.
+/// @return The owning pointer.
+template <typename T, RefCountMode Mode = RefCountMode::ThreadSafe, typename... Args>
+[[nodiscard]] SharedPtr<T, Mode> makeShared(Args&&... args)
+{
+    using Block = detail::SharedControlBlockInline<T, Mode>;
+    Block* const block = ::new (memory::DefaultAllocator::allocate(sizeof(Block), alignof(Block)))
+        Block(std::forward<Args>(args)...);
+    return SharedPtr<T, Mode>(block, block->getObject());
+}
 
 }   // namespace gp
@@ -6,6 +6,8 @@
 
 #include "concepts/Concepts.hpp"
 #include "CoreMinimal.hpp"
+#include "memory/MemoryForward.hpp"
+#include <utility>
 
 namespace gp
 {
@@ -45,10 +47,176 @@ public:
     }
 };
 
-/// @brief
-/// @tparam T
-template <typename T>
+/// @brief Smart pointer owning an object exclusively, deleting it when going out of scope.
+/// @details
+/// The deleter is stored as a `GP_NO_UNIQUE_ADDRESS` member, so stateless deleters (DefaultDelete, empty lambdas)
+/// take no space and a UniquePtr is exactly as large as a raw pointer.
+/// @tparam T Type of the owned object.
+/// @tparam Deleter Callable invoked with the pointer to destroy the object.
+template <typename T, typename Deleter>
 class UniquePtr
-{};
+{
+    template <typename, typename>
+    friend class UniquePtr;
+
+public:
+    using ElementType = T;
+    using DeleterType = Deleter;
+
+private:
+    T* m_ptr{ nullptr };
+    GP_NO_UNIQUE_ADDRESS Deleter m_deleter;
+
+public:
+    /// @brief Constructs an empty pointer.
+    constexpr UniquePtr() noexcept = default;
+
+    /// @brief Constructs an empty pointer.
+    constexpr UniquePtr(std::nullptr_t) noexcept {}
+
+    /// @brief Takes ownership of @p ptr.
+    /// @param[in] ptr Object to own, may be nullptr.
+    constexpr explicit UniquePtr(T* ptr) noexcept
+        : m_ptr(ptr)
+    {}
+
+    /// @brief Takes ownership of @p ptr, destroyed with @p deleter.
+    /// @param[in] ptr Object to own, may be nullptr.
+    /// @param[in] deleter Deleter to use.
+    constexpr UniquePtr(T* ptr, Deleter deleter) noexcept
+        : m_ptr(ptr)
+        , m_deleter(std::move(deleter))
+    {}
+
+    UniquePtr(const UniquePtr&) = delete;
+    UniquePtr& operator=(const UniquePtr&) = delete;
+
+    constexpr UniquePtr(UniquePtr&& other) noexcept
+        : m_ptr(std::exchange(other.m_ptr, nullptr))
+        , m_deleter(std::move(other.m_deleter))
+    {}
+
+    /// @brief Converting move constructor, from pointers to derived types.
+    template <concepts::IsPointerConvertibleTo<T> U, typename OtherDeleter>
+    requires concepts::IsConstructibleWith<Deleter, OtherDeleter&&>
+    constexpr UniquePtr(UniquePtr<U, OtherDeleter>&& other) noexcept
+        : m_ptr(std::exchange(other.m_ptr, nullptr))
+        , m_deleter(std::move(other.m_deleter))
+    {}
+
+    ~UniquePtr()
+    {
+        reset();
+    }
+
+    UniquePtr& operator=(UniquePtr&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset(std::exchange(other.m_ptr, nullptr));
+            m_deleter = std::move(other.m_deleter);
+        }
+        return *this;
+    }
+
+    template <concepts::IsPointerConvertibleTo<T> U, typename OtherDeleter>
+    requires concepts::IsConstructibleWith<Deleter, OtherDeleter&&>
+    UniquePtr& operator=(UniquePtr<U, OtherDeleter>&& other) noexcept
+    {
+        reset(std::exchange(other.m_ptr, nullptr));
+        m_deleter = std::move(other.m_deleter);
+        return *this;
+    }
+
+    UniquePtr& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+public:
+    /// @brief Releases ownership of the object without destroying it.
+    /// @return The pointer, now owned by the caller.
+    [[nodiscard]] constexpr T* release() noexcept
+    {
+        return std::exchange(m_ptr, nullptr);
+    }
+
+    /// @brief Destroys the owned object, if any, and takes ownership of @p ptr.
+    /// @param[in] ptr Object to own, may be nullptr.
+    void reset(T* ptr = nullptr) noexcept
+    {
+        T* const old = std::exchange(m_ptr, ptr);
+        if (old != nullptr)
+        {
+            m_deleter(old);
+        }
+    }
+
+    constexpr void swap(UniquePtr& other) noexcept
+    {
+        std::swap(m_ptr, other.m_ptr);
+        std::swap(m_deleter, other.m_deleter);
+    }
+
+public:
+    [[nodiscard]] constexpr T* get() const noexcept
+    {
+        return m_ptr;
+    }
+
+    [[nodiscard]] constexpr Deleter& getDeleter() noexcept
+    {
+        return m_deleter;
+    }
+
+    [[nodiscard]] constexpr const Deleter& getDeleter() const noexcept
+    {
+        return m_deleter;
+    }
+
+    [[nodiscard]] constexpr T& operator*() const noexcept
+    {
+        GP_ASSERT(m_ptr != nullptr, "Dereferencing a null UniquePtr");
+        return *m_ptr;
+    }
+
+    [[nodiscard]] constexpr T* operator->() const noexcept
+    {
+        GP_ASSERT(m_ptr != nullptr, "Dereferencing a null UniquePtr");
+        return m_ptr;
+    }
+
+    [[nodiscard]] constexpr bool isValid() const noexcept
+    {
+        return m_ptr != nullptr;
+    }
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept
+    {
+        return m_ptr != nullptr;
+    }
+
+    template <typename U, typename OtherDeleter>
+    [[nodiscard]] constexpr bool operator==(const UniquePtr<U, OtherDeleter>& other) const noexcept
+    {
+        return m_ptr == other.get();
+    }
+
+    [[nodiscard]] constexpr bool operator==(std::nullptr_t) const noexcept
+    {
+        return m_ptr == nullptr;
+    }
+};
+
+/// @brief Creates an object owned by a UniquePtr.
+/// @tparam T Type of the object.
+/// @param[in] args Arguments forwarded to the constructor.
+/// @return The owning pointer.
+template <typename T, typename... Args>
+[[nodiscard]] UniquePtr<T> makeUnique(Args&&... args)
+{
+    return UniquePtr<T>(new T(std::forward<Args>(args)...));
+}
 
 }   // namespace gp
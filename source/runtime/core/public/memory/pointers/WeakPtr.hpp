@@ -4,13 +4,155 @@
 
 #pragma once
 
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "memory/MemoryForward.hpp"
+#include "memory/pointers/SharedPtr.hpp"
+#include <utility>
+
 namespace gp
 {
 
-/// @brief
-/// @tparam T
-template <typename T>
+/// @brief Non-owning reference to an object owned by SharedPtr instances.
+/// @details
+/// A WeakPtr keeps the control block alive but not the object. lock() returns a SharedPtr to the object if it still
+/// exists, or an empty one otherwise, which makes it the tool of choice to break ownership cycles and to cache objects
+/// without extending their lifetime.
+/// @tparam T Type of the referenced object.
+/// @tparam Mode Thread safety of the reference counts, must match the one of the SharedPtr.
+template <typename T, RefCountMode Mode>
 class WeakPtr
-{};
+{
+    template <typename, RefCountMode>
+    friend class WeakPtr;
+
+public:
+    using ElementType = T;
+    using ControlBlock = detail::SharedControlBlock<Mode>;
+
+private:
+    T* m_ptr{ nullptr };
+    ControlBlock* m_control{ nullptr };
+
+public:
+    /// @brief Constructs an empty pointer.
+    constexpr WeakPtr() noexcept = default;
+
+    /// @brief Constructs an empty pointer.
+    constexpr WeakPtr(std::nullptr_t) noexcept {}
+
+    /// @brief Constructs a weak reference to the object owned by @p shared.
+    template <concepts::IsPointerConvertibleTo<T> U>
+    WeakPtr(const SharedPtr<U, Mode>& shared) noexcept
+        : m_ptr(shared.m_ptr)
+        , m_control(shared.m_control)
+    {
+        addWeak();
+    }
+
+    WeakPtr(const WeakPtr& other) noexcept
+        : m_ptr(other.m_ptr)
+        , m_control(other.m_control)
+    {
+        addWeak();
+    }
+
+    WeakPtr(WeakPtr&& other) noexcept
+        : m_ptr(std::exchange(other.m_ptr, nullptr))
+        , m_control(std::exchange(other.m_control, nullptr))
+    {}
+
+    /// @brief Converting copy and move constructors, from pointers to derived types.
+    template <concepts::IsPointerConvertibleTo<T> U>
+    WeakPtr(const WeakPtr<U, Mode>& other) noexcept
+        : m_ptr(other.m_ptr)
+        , m_control(other.m_control)
+    {
+        addWeak();
+    }
+
+    template <concepts::IsPointerConvertibleTo<T> U>
+    WeakPtr(WeakPtr<U, Mode>&& other) noexcept
+        : m_ptr(std::exchange(other.m_ptr, nullptr))
+        , m_control(std::exchange(other.m_control, nullptr))
+    {}
+
+    ~WeakPtr()
+    {
+        if (m_control != nullptr)
+        {
+            m_control->releaseWeak();
+        }
+    }
+
+    WeakPtr& operator=(const WeakPtr& other) noexcept
+    {
+        WeakPtr(other).swap(*this);
+        return *this;
+    }
+
+    WeakPtr& operator=(WeakPtr&& other) noexcept
+    {
+        WeakPtr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    template <concepts::IsPointerConvertibleTo<T> U>
+    WeakPtr& operator=(const SharedPtr<U, Mode>& shared) noexcept
+    {
+        WeakPtr(shared).swap(*this);
+        return *this;
+    }
+
+    WeakPtr& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+public:
+    /// @brief Returns a SharedPtr to the object, or an empty one if the object was already destroyed.
+    [[nodiscard]] SharedPtr<T, Mode> lock() const noexcept
+    {
+        if (m_control != nullptr && m_control->tryAddStrong())
+        {
+            return SharedPtr<T, Mode>(m_control, m_ptr);
+        }
+        return SharedPtr<T, Mode>();
+    }
+
+    /// @brief Checks whether the object was destroyed, or was never referenced.
+    [[nodiscard]] bool isExpired() const noexcept
+    {
+        return m_control == nullptr || m_control->getStrongCount() == 0;
+    }
+
+    /// @brief Returns the number of SharedPtr owning the object, only a hint in ThreadSafe mode.
+    [[nodiscard]] UInt32 useCount() const noexcept
+    {
+        return m_control != nullptr ? m_control->getStrongCount() : 0;
+    }
+
+    /// @brief Drops the weak reference, leaving the pointer empty.
+    void reset() noexcept
+    {
+        WeakPtr().swap(*this);
+    }
+
+    void swap(WeakPtr& other) noexcept
+    {
+        std::swap(m_ptr, other.m_ptr);
+        std::swap(m_control, other.m_control);
+    }
+
+private:
+    void addWeak() const noexcept
+    {
+        if (m_control != nullptr)
+        {
+            m_control->addWeak();
+        }
+    }
+};
 
 }   // namespace gp
@@ -5,14 +5,14 @@
 #pragma once
 
 #include "CoreMinimal.hpp"   // IWYU pragma: keep
-#include "platforms/generic/GenericPlatformMemory.hpp"
+#include "platforms/unix/UnixPlatformMemory.hpp"
 
 namespace gp::platform::apple
 {
 
-/// @brief Apple-specific implementation of the memory management platform.
+/// @brief Apple-specific implementation of the memory management platform, sharing the mmap-based pages of Unix.
 /// @note This class is not `final` to allow for platform-specific overrides in derived classes (e.g., macOS).
-class Memory : public gp::platform::generic::Memory
+class Memory : public gp::platform::unix::Memory
 {
 private:
     /// @brief Deleted constructor prevent instantiation of the Memory class, as it is intended to be used.
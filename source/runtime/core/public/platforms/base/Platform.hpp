@@ -245,6 +245,11 @@
     #define GP_FLATTEN
 #endif
 
+/// @brief Compiles a function for extra instruction sets. MSVC accepts any intrinsic without it.
+#ifndef GP_TARGET
+    #define GP_TARGET(features)
+#endif
+
 #ifndef GP_DEFINE_FORCEINLINE_HINT_TO_INLINE
     #define GP_DEFINE_FORCEINLINE_HINT_TO_INLINE GP_FALSE
 #endif
@@ -421,6 +426,26 @@
     #define GP_PLATFORM_CACHE_LINE_SIZE 64
 #endif
 
+/// @section Spin-wait hint.
+
+/// @brief GP_PLATFORM_CPU_PAUSE(), tells the CPU the current thread is spinning.
+///        Lowers power usage and hands execution resources to the sibling hyper-thread; use it in every spin loop.
+#ifndef GP_PLATFORM_CPU_PAUSE
+    #if (GP_ARCHITECTURE_X64 || GP_ARCHITECTURE_X86) && (GP_COMPILER_CLANG || GP_COMPILER_GCC || GP_COMPILER_INTEL)
+        #define GP_PLATFORM_CPU_PAUSE() __builtin_ia32_pause()
+    #elif (GP_ARCHITECTURE_ARM64 || GP_ARCHITECTURE_ARM32) && (GP_COMPILER_CLANG || GP_COMPILER_GCC)
+        #define GP_PLATFORM_CPU_PAUSE() __asm__ __volatile__("yield")
+    #elif (GP_ARCHITECTURE_X64 || GP_ARCHITECTURE_X86) && GP_COMPILER_MSVC
+        #include <intrin.h>
+        #define GP_PLATFORM_CPU_PAUSE() _mm_pause()
+    #elif (GP_ARCHITECTURE_ARM64 || GP_ARCHITECTURE_ARM32) && GP_COMPILER_MSVC
+        #include <intrin.h>
+        #define GP_PLATFORM_CPU_PAUSE() __yield()
+    #else
+        #define GP_PLATFORM_CPU_PAUSE() (void(0))
+    #endif
+#endif
+
 /// @section Assertion macros.
 
 /// @brief GP_ASSERT(expr), runtime assertion, breaks into the debugger if expr is false.
@@ -121,6 +121,23 @@ public:
         return std::memcpy(destination, source, numBytes);
     }
 
+    /// @brief Allocates page-aligned, readable and writable memory directly from the operating system.
+    /// @param[in] numBytes The number of bytes to allocate, rounded up to the page size by the platform.
+    /// @return A pointer to the first page, or nullptr if the allocation failed.
+    static GP_CORE_API void* allocatePages(gp::USize numBytes);
+
+    /// @brief Frees memory allocated with allocatePages().
+    /// @param[in] pointer The pointer returned by allocatePages().
+    /// @param[in] numBytes The number of bytes passed to allocatePages().
+    static GP_CORE_API void freePages(void* pointer, gp::USize numBytes);
+
+    /// @brief Makes pages inaccessible, so that any read or write to them faults. Used to guard the end of stacks and
+    /// buffers against overflows.
+    /// @param[in] pointer The page-aligned pointer to the first page to protect.
+    /// @param[in] numBytes The number of bytes to protect, a multiple of the page size.
+    /// @return True if the pages are protected, false if the platform cannot protect memory.
+    static GP_CORE_API bool guardPages(void* pointer, gp::USize numBytes);
+
     /// @brief Get the default memory allocator for the platform.
     /// @return A pointer to the default memory allocator for the platform.
     static GP_CORE_API memory::Malloc* getDefaultAllocator();
@@ -62,5 +62,9 @@
 
 /// @section Locks / Mutexes
 
-#define GP_LOCKABLE(type, var)
-#define GP_LOCKABLE_N(type, var, desc)
+#define GP_LOCKABLE(type, var) type var
+#define GP_LOCKABLE_N(type, var, desc) type var
+#define GP_LOCKABLE_BASE(type) type
+#define GP_SHARED_LOCKABLE(type, var) type var
+#define GP_SHARED_LOCKABLE_N(type, var, desc) type var
+#define GP_SHARED_LOCKABLE_BASE(type) type
@@ -85,3 +85,7 @@
 
 #define GP_LOCKABLE(type, var) TracyLockable(type, var)
 #define GP_LOCKABLE_N(type, var, desc) TracyLockableN(type, var, desc)
+#define GP_LOCKABLE_BASE(type) LockableBase(type)
+#define GP_SHARED_LOCKABLE(type, var) TracySharedLockable(type, var)
+#define GP_SHARED_LOCKABLE_N(type, var, desc) TracySharedLockableN(type, var, desc)
+#define GP_SHARED_LOCKABLE_BASE(type) SharedLockableBase(type)
@@ -4,19 +4,268 @@
 
 #pragma once
 
+#include "concepts/Concepts.hpp"
 #include "CoreMinimal.hpp"
+#include "memory/Memory.hpp"
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace gp
 {
 
-template <typename Signature>
+/// @brief Default size of the inline storage of a Delegate, in bytes. Fits a lambda capturing four pointers.
+inline constexpr USize kDelegateInlineSize = 4 * sizeof(void*);
+
+template <typename Signature, USize InlineSize = kDelegateInlineSize>
 class Delegate;
 
 /// @brief A non-allocating callback wrapper for static functions, lambdas, and member functions.
+/// @details
+/// The callable is stored in InlineSize bytes of inline storage; callables that do not fit are rejected at compile
+/// time rather than moved to the heap. A call is a single indirect call through a thunk that knows the concrete type
+/// of the callable, there is no virtual dispatch and no type-erased wrapper in between.
+/// Member functions known at compile time are bound with bind<&Class::method>(object): the storage then only holds
+/// the object pointer and the thunk calls the method directly, which is as cheap as a callback can get.
+/// Delegates holding trivially copyable callables (function pointers, member bindings, lambdas capturing pointers or
+/// scalars) are copied with a plain memory copy and need no destruction. Other callables get a small manager function
+/// handling copy, move and destruction. Since delegates are copyable, move-only callables are rejected at compile time.
 /// @tparam Ret The return type of the function signature.
 /// @tparam Args The argument types of the function signature.
-template <typename Ret, typename... Args>
-class Delegate<Ret(Args...)>
-{};
+/// @tparam InlineSize Size of the inline storage in bytes.
+template <typename Ret, typename... Args, USize InlineSize>
+class Delegate<Ret(Args...), InlineSize>
+{
+public:
+    using ReturnType = Ret;
+
+private:
+    enum class Operation : UInt8
+    {
+        Copy,
+        Move,
+        Destroy
+    };
+
+    using InvokeFunction = Ret (*)(void*, Args&&...);
+    using ManageFunction = void (*)(Operation, void*, void*);
+
+    template <typename F>
+    static constexpr bool kFitsInline = sizeof(F) <= InlineSize && alignof(F) <= alignof(void*);
+
+private:
+    alignas(void*) mutable Byte m_storage[InlineSize];
+    InvokeFunction m_invoke{ nullptr };
+    ManageFunction m_manage{ nullptr };   //<! Null when the stored callable is trivially copyable.
+
+public:
+    /// @brief Constructs an unbound delegate.
+    constexpr Delegate() noexcept = default;
+
+    /// @brief Constructs an unbound delegate.
+    constexpr Delegate(std::nullptr_t) noexcept {}
+
+    /// @brief Constructs a delegate wrapping any callable object (lambda, functor, function pointer).
+    /// @tparam F Type of the callable, must be copy constructible and fit in the inline storage.
+    /// @param[in] callable Callable to wrap, copied or moved into the inline storage.
+    template <typename F>
+    requires(
+        !concepts::IsOneOf<std::remove_cvref_t<F>, Delegate, std::nullptr_t> &&
+        concepts::IsCopyConstructible<std::remove_cvref_t<F>> &&
+        std::is_invocable_r_v<Ret, std::remove_cvref_t<F>&, Args...>
+    )
+    Delegate(F&& callable) noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<F>, F>)
+    {
+        emplace<std::remove_cvref_t<F>>(std::forward<F>(callable));
+    }
+
+    /// @brief Copies another delegate.
+    Delegate(const Delegate& other)
+        : m_invoke(other.m_invoke)
+        , m_manage(other.m_manage)
+    {
+        if (m_manage != nullptr)
+        {
+            m_manage(Operation::Copy, m_storage, other.m_storage);
+        }
+        else
+        {
+            memory::copyMemory(m_storage, other.m_storage, InlineSize);
+        }
+    }
+
+    /// @brief Moves another delegate, which is left unbound.
+    Delegate(Delegate&& other) noexcept
+        : m_invoke(other.m_invoke)
+        , m_manage(other.m_manage)
+    {
+        if (m_manage != nullptr)
+        {
+            m_manage(Operation::Move, m_storage, other.m_storage);
+        }
+        else
+        {
+            memory::copyMemory(m_storage, other.m_storage, InlineSize);
+        }
+        other.reset();
+    }
+
+    /// @brief Destroys the stored callable.
+    ~Delegate()
+    {
+        reset();
+    }
+
+    Delegate& operator=(const Delegate& other)
+    {
+        if (this != &other)
+        {
+            reset();
+            ::new (this) Delegate(other);
+        }
+        return *this;
+    }
+
+    Delegate& operator=(Delegate&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            ::new (this) Delegate(std::move(other));
+        }
+        return *this;
+    }
+
+    Delegate& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+public:
+    /// @brief Creates a delegate calling a free or static function known at compile time.
+    /// @tparam Function The function to call.
+    /// @return The bound delegate.
+    template <auto Function>
+    requires std::is_invocable_r_v<Ret, decltype(Function), Args...>
+    [[nodiscard]] static Delegate create() noexcept
+    {
+        Delegate delegate;
+        delegate.m_invoke = [](void*, Args&&... args) -> Ret
+        {
+            return static_cast<Ret>(std::invoke(Function, std::forward<Args>(args)...));
+        };
+        return delegate;
+    }
+
+    /// @brief Creates a delegate calling a member function known at compile time on @p object.
+    /// @note The delegate does not own @p object, which must outlive it.
+    /// @tparam Method The member function to call.
+    /// @tparam C Class of the object.
+    /// @param[in] object Object to call the method on.
+    /// @return The bound delegate.
+    template <auto Method, typename C>
+    requires std::is_invocable_r_v<Ret, decltype(Method), C*, Args...>
+    [[nodiscard]] static Delegate bind(C* object) noexcept
+    {
+        Delegate delegate;
+        memory::copyMemory(delegate.m_storage, &object, sizeof(C*));
+        delegate.m_invoke = [](void* storage, Args&&... args) -> Ret
+        {
+            C* instance;
+            memory::copyMemory(&instance, storage, sizeof(C*));
+            return static_cast<Ret>(std::invoke(Method, instance, std::forward<Args>(args)...));
+        };
+        return delegate;
+    }
+
+public:
+    /// @brief Calls the bound callable.
+    /// @warning Calling an unbound delegate is undefined behavior, check isBound() first when in doubt.
+    /// @param[in] args Arguments forwarded to the callable.
+    /// @return The value returned by the callable.
+    Ret operator()(Args... args) const
+    {
+        GP_ASSERT(m_invoke != nullptr, "Calling an unbound Delegate");
+        return m_invoke(m_storage, std::forward<Args>(args)...);
+    }
+
+    /// @brief Calls the bound callable if any.
+    /// @param[in] args Arguments forwarded to the callable.
+    /// @return True if a callable was bound and got called, false otherwise.
+    bool executeIfBound(Args... args) const
+    requires concepts::IsSameAs<Ret, void>
+    {
+        if (m_invoke == nullptr)
+        {
+            return false;
+        }
+        m_invoke(m_storage, std::forward<Args>(args)...);
+        return true;
+    }
+
+    /// @brief Checks whether a callable is bound.
+    [[nodiscard]] bool isBound() const noexcept
+    {
+        return m_invoke != nullptr;
+    }
+
+    /// @brief Checks whether a callable is bound.
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+        return isBound();
+    }
+
+    [[nodiscard]] bool operator==(std::nullptr_t) const noexcept
+    {
+        return !isBound();
+    }
+
+    /// @brief Unbinds the delegate, destroying the stored callable.
+    void reset() noexcept
+    {
+        if (m_manage != nullptr)
+        {
+            m_manage(Operation::Destroy, m_storage, nullptr);
+        }
+        m_invoke = nullptr;
+        m_manage = nullptr;
+    }
+
+private:
+    template <typename F, typename... CtorArgs>
+    void emplace(CtorArgs&&... ctorArgs)
+    {
+        static_assert(
+            kFitsInline<F>, "Callable does not fit in the Delegate inline storage, increase InlineSize or capture less"
+        );
+
+        ::new (static_cast<void*>(m_storage)) F(std::forward<CtorArgs>(ctorArgs)...);
+        m_invoke = [](void* storage, Args&&... args) -> Ret
+        {
+            return static_cast<Ret>(std::invoke(*std::launder(static_cast<F*>(storage)), std::forward<Args>(args)...));
+        };
+
+        if constexpr (!concepts::IsTriviallyCopyable<F> || !concepts::IsTriviallyDestructible<F>)
+        {
+            m_manage = [](Operation operation, void* destination, void* source)
+            {
+                switch (operation)
+                {
+                case Operation::Copy:
+                    ::new (destination) F(*std::launder(static_cast<const F*>(source)));
+                    break;
+                case Operation::Move:
+                    ::new (destination) F(std::move(*std::launder(static_cast<F*>(source))));
+                    break;
+                case Operation::Destroy:
+                    std::launder(static_cast<F*>(destination))->~F();
+                    break;
+                }
+            };
+        }
+    }
+};
 
 }   // namespace gp
@@ -6,7 +6,9 @@
 
 #include "concepts/Concepts.hpp"
 #include "CoreMinimal.hpp"
+#include "templates/traits/NicheTraits.hpp"
 #include <functional>
+#include <type_traits>
 
 namespace gp
 {
@@ -123,6 +125,44 @@ template <typename E>
     return Unexpected<std::decay_t<E>>(std::forward<E>(error));
 }
 
+namespace detail
+{
+
+/// @brief Computes where an Expected<T, E> can keep its error when the niche of T encodes the error state.
+/// @details
+/// While the niche is set, only the niche bytes of T are meaningful, the others are free to hold the error. The error
+/// goes either before or after the niche bytes, wherever it fits with its alignment. When it fits nowhere, Expected
+/// falls back to a separate flag.
+/// @tparam T Value type.
+/// @tparam E Error type.
+template <typename T, typename E>
+struct ExpectedNicheLayout
+{
+public:
+    static constexpr bool kUsesNiche = false;
+    static constexpr USize kErrorOffset = 0;
+};
+
+template <concepts::HasNiche T, typename E>
+requires(alignof(E) <= alignof(T))
+struct ExpectedNicheLayout<T, E>
+{
+private:
+    using Traits = trait::NicheTraits<T>;
+
+    static constexpr USize kNicheBegin = Traits::kNicheOffset;
+    static constexpr USize kNicheEnd = kNicheBegin + sizeof(typename Traits::NicheType);
+    static constexpr USize kOffsetAfterNiche = (kNicheEnd + alignof(E) - 1) / alignof(E) * alignof(E);
+    static constexpr bool kFitsBefore = sizeof(E) <= kNicheBegin;
+    static constexpr bool kFitsAfter = kOffsetAfterNiche + sizeof(E) <= sizeof(T);
+
+public:
+    static constexpr bool kUsesNiche = kFitsBefore || kFitsAfter;
+    static constexpr USize kErrorOffset = kFitsBefore ? 0 : kOffsetAfterNiche;
+};
+
+}   // namespace detail
+
 /// @brief Holds either a success value of type T, or a failure error of type E. Never both.
 /// @note No heap allocation. T and E share a single aligned inline storage buffer sized for
 /// whichever type is larger. Use hasValue() / operator bool to check the active state before
@@ -145,6 +185,10 @@ template <typename E>
 ///           .andThen(buildMesh)
 ///           .transformError([](IoError e){ return AssetError{e}; });
 /// @endcode
+/// @note Storage layout: when T declares a niche (see trait::NicheTraits) and E fits in the bytes of T the niche leaves
+/// unused (e.g. a StringView and a small error code), the error state is encoded by the niche and no flag is stored,
+/// so Expected<T, E> is as large as T. When T and E are trivially copyable, so is Expected<T, E>, and a small result is
+/// returned in registers.
 /// @tparam T Success value type. Must not be a reference. T = void is not supported here;
 ///           use Expected<bool, E> or a unit struct as a workaround.
 /// @tparam E Error type. Must not be a reference.
@@ -159,36 +203,46 @@ public:
     using ThisType = Expected<T, E>;
 
 private:
-    static constexpr std::size_t kStorageSize = sizeof(T) > sizeof(E) ? sizeof(T) : sizeof(E);
+    using NicheLayout = detail::ExpectedNicheLayout<T, E>;
+
+    static constexpr bool kUsesNiche = NicheLayout::kUsesNiche;
+    static constexpr bool kIsTrivial = concepts::IsTriviallyCopyable<T> && concepts::IsTriviallyDestructible<T> &&
+                                       concepts::IsTriviallyCopyable<E> && concepts::IsTriviallyDestructible<E>;
+    static constexpr std::size_t kStorageSize =
+        kUsesNiche ? sizeof(T) : (sizeof(T) > sizeof(E) ? sizeof(T) : sizeof(E));
     static constexpr std::size_t kStorageAlign = alignof(T) > alignof(E) ? alignof(T) : alignof(E);
 
+    /// @brief Placeholder for the state flag when the niche of T encodes it.
+    struct NoFlag
+    {};
+
     alignas(kStorageAlign) Byte m_storage[kStorageSize];
-    bool m_hasValue = false;
+    GP_NO_UNIQUE_ADDRESS std::conditional_t<kUsesNiche, NoFlag, bool> m_hasValue{};
 
 public:
     /// @brief Default-constructs a successful Expected holding a default-constructed T.
     /// @note A default-constructed Expected is always in the value state, "success until
     /// proven otherwise" is a safer default and mirrors std::expected's design decision.
     constexpr Expected() noexcept(noexcept(T())) requires concepts::IsDefaultConstructible<T>
-        : m_hasValue(true)
     {
         ::new (&m_storage) T();
+        setHasValue(true);
     }
 
     /// @brief Copy-constructs a successful Expected holding @p value.
     /// @param[in] value Value to store.
     constexpr Expected(const T& value) noexcept(noexcept(T(value)))
-        : m_hasValue(true)
     {
         ::new (&m_storage) T(value);
+        setHasValue(true);
     }
 
     /// @brief Move-constructs a successful Expected holding @p value.
     /// @param[in] value Value to move.
     constexpr Expected(T&& value) noexcept(noexcept(T(std::move(value))))
-        : m_hasValue(true)
     {
         ::new (&m_storage) T(std::move(value));
+        setHasValue(true);
     }
 
     /// @brief Constructs a successful Expected from a compatible type via perfect forwarding.
@@ -202,58 +256,65 @@ public:
     requires concepts::IsConstructibleWith<T, U&&> && (!std::is_same_v<std::remove_cvref_t<U>, Expected>) &&
              (!std::is_same_v<std::remove_cvref_t<U>, Unexpected<E>>) && (!std::is_same_v<std::remove_cvref_t<U>, T>)
     explicit(!std::is_convertible_v<U&&, T>) constexpr Expected(U&& value) noexcept(noexcept(T(std::forward<U>(value))))
-        : m_hasValue(true)
     {
         ::new (&m_storage) T(std::forward<U>(value));
+        setHasValue(true);
     }
 
     /// @brief Constructs a failed Expected from a copied Unexpected<E>.
     /// @param[in] unexpected Unexpected wrapper holding the error to copy.
     constexpr Expected(const Unexpected<E>& unexpected) noexcept(noexcept(E(unexpected.error())))
-        : m_hasValue(false)
     {
-        ::new (&m_storage) E(unexpected.error());
+        ::new (errorPtr()) E(unexpected.error());
+        setHasValue(false);
     }
 
     /// @brief Constructs a failed Expected from a moved Unexpected<E>.
     /// @param[in] unexpected Unexpected wrapper holding the error to move.
     constexpr Expected(Unexpected<E>&& unexpected) noexcept(noexcept(E(std::move(unexpected.error()))))
-        : m_hasValue(false)
     {
-        ::new (&m_storage) E(std::move(unexpected.error()));
+        ::new (errorPtr()) E(std::move(unexpected.error()));
+        setHasValue(false);
     }
 
+    /// @brief Trivial copy and move constructors, used when T and E are trivially copyable.
+    constexpr Expected(const Expected&) requires kIsTrivial = default;
+    constexpr Expected(Expected&&) requires kIsTrivial = default;
+
     /// @brief Copy-constructs from another Expected.
     /// @param[in] other Expected to copy from.
     constexpr Expected(const Expected& other)
-        : m_hasValue(other.m_hasValue)
     {
-        if (m_hasValue)
+        if (other.hasValue())
         {
             ::new (&m_storage) T(*other.valuePtr());
         }
         else
         {
-            ::new (&m_storage) E(*other.errorPtr());
+            ::new (errorPtr()) E(*other.errorPtr());
         }
+        setHasValue(other.hasValue());
     }
 
     /// @brief Move-constructs from another Expected.
     /// @param[in] other Expected to move from.
     constexpr Expected(Expected&& other
     ) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
-        : m_hasValue(other.m_hasValue)
     {
-        if (m_hasValue)
+        if (other.hasValue())
         {
             ::new (&m_storage) T(std::move(*other.valuePtr()));
         }
         else
         {
-            ::new (&m_storage) E(std::move(*other.errorPtr()));
+            ::new (errorPtr()) E(std::move(*other.errorPtr()));
         }
+        setHasValue(other.hasValue());
     }
 
+    /// @brief Trivial destructor, used when T and E are trivially destructible.
+    ~Expected() requires kIsTrivial = default;
+
     /// @brief Destroys whichever object (value or error) is currently alive.
     ~Expected()
     {
@@ -261,6 +322,10 @@ public:
     }
 
 public:
+    /// @brief Trivial copy and move assignment operators, used when T and E are trivially copyable.
+    constexpr Expected& operator=(const Expected&) requires kIsTrivial = default;
+    constexpr Expected& operator=(Expected&&) requires kIsTrivial = default;
+
     /// @brief Copy-assigns from another Expected.
     /// @note When source and destination are on different tracks, the live object must be
     /// destroyed and the new one placement-new'd into the same storage. The flag is only
@@ -273,25 +338,25 @@ public:
         {
             return *this;
         }
-        if (m_hasValue && other.m_hasValue)
+        if (hasValue() && other.hasValue())
         {
             *valuePtr() = *other.valuePtr();
         }
-        else if (!m_hasValue && !other.m_hasValue)
+        else if (!hasValue() && !other.hasValue())
         {
             *errorPtr() = *other.errorPtr();
         }
-        else if (m_hasValue && !other.m_hasValue)
+        else if (hasValue() && !other.hasValue())
         {
             destroyActive();
-            ::new (&m_storage) E(*other.errorPtr());
-            m_hasValue = false;
+            ::new (errorPtr()) E(*other.errorPtr());
+            setHasValue(false);
         }
-        else   // !m_hasValue && other.m_hasValue
+        else   // !hasValue() && other.hasValue()
         {
             destroyActive();
             ::new (&m_storage) T(*other.valuePtr());
-            m_hasValue = true;
+            setHasValue(true);
         }
         return *this;
     }
@@ -306,25 +371,25 @@ public:
         {
             return *this;
         }
-        if (m_hasValue && other.m_hasValue)
+        if (hasValue() && other.hasValue())
         {
             *valuePtr() = std::move(*other.valuePtr());
         }
-        else if (!m_hasValue && !other.m_hasValue)
+        else if (!hasValue() && !other.hasValue())
         {
             *errorPtr() = std::move(*other.errorPtr());
         }
-        else if (m_hasValue && !other.m_hasValue)
+        else if (hasValue() && !other.hasValue())
         {
             destroyActive();
-            ::new (&m_storage) E(std::move(*other.errorPtr()));
-            m_hasValue = false;
+            ::new (errorPtr()) E(std::move(*other.errorPtr()));
+            setHasValue(false);
         }
-        else   // !m_hasValue && other.m_hasValue
+        else   // !hasValue() && other.hasValue()
         {
             destroyActive();
             ::new (&m_storage) T(std::move(*other.valuePtr()));
-            m_hasValue = true;
+            setHasValue(true);
         }
         return *this;
     }
@@ -339,7 +404,7 @@ public:
              (!std::is_same_v<std::remove_cvref_t<U>, Unexpected<E>>)Expected&
         operator=(U&& inValue)
     {
-        if (m_hasValue)
+        if (hasValue())
         {
             *valuePtr() = std::forward<U>(inValue);
         }
@@ -347,7 +412,7 @@ public:
         {
             destroyActive();
             ::new (&m_storage) T(std::forward<U>(inValue));
-            m_hasValue = true;
+            setHasValue(true);
         }
         return *this;
     }
@@ -357,15 +422,15 @@ public:
     /// @return Reference to this Expected.
     Expected& operator=(const Unexpected<E>& unexpected)
     {
-        if (!m_hasValue)
+        if (!hasValue())
         {
             *errorPtr() = unexpected.error();
         }
         else
         {
             destroyActive();
-            ::new (&m_storage) E(unexpected.error());
-            m_hasValue = false;
+            ::new (errorPtr()) E(unexpected.error());
+            setHasValue(false);
         }
         return *this;
     }
@@ -375,15 +440,15 @@ public:
     /// @return Reference to this Expected.
     Expected& operator=(Unexpected<E>&& unexpected)
     {
-        if (!m_hasValue)
+        if (!hasValue())
         {
             *errorPtr() = std::move(unexpected.error());
         }
         else
         {
             destroyActive();
-            ::new (&m_storage) E(std::move(unexpected.error()));
-            m_hasValue = false;
+            ::new (errorPtr()) E(std::move(unexpected.error()));
+            setHasValue(false);
         }
         return *this;
     }
@@ -398,11 +463,11 @@ public:
     [[nodiscard]] bool operator==(const Expected& other) const noexcept
         requires concepts::IsEqualityComparable<T> && concepts::IsEqualityComparable<E>
     {
-        if (m_hasValue != other.m_hasValue)
+        if (hasValue() != other.hasValue())
         {
             return false;
         }
-        return m_hasValue ? (*valuePtr() == *other.valuePtr()) : (*errorPtr() == *other.errorPtr());
+        return hasValue() ? (*valuePtr() == *other.valuePtr()) : (*errorPtr() == *other.errorPtr());
     }
 
     /// @brief Checks inequality between two Expected instances.
@@ -419,7 +484,7 @@ public:
     /// @return True if in value state and the stored value equals @p inValue, false otherwise.
     [[nodiscard]] bool operator==(const T& inValue) const noexcept requires concepts::IsEqualityComparable<T>
     {
-        return m_hasValue && *valuePtr() == inValue;
+        return hasValue() && *valuePtr() == inValue;
     }
 
     /// @brief Checks if this Expected holds the error contained in @p unexpected.
@@ -428,7 +493,7 @@ public:
     [[nodiscard]] bool operator==(const Unexpected<E>& unexpected) const noexcept
         requires concepts::IsEqualityComparable<E>
     {
-        return !m_hasValue && *errorPtr() == unexpected.error();
+        return !hasValue() && *errorPtr() == unexpected.error();
     }
 
     /// @brief Dereferences to the contained value (lvalue).
@@ -470,7 +535,7 @@ public:
     /// @return True if holding a value, false if holding an error.
     [[nodiscard]] constexpr explicit operator bool() const noexcept
     {
-        return m_hasValue;
+        return hasValue();
     }
 
 public:
@@ -478,7 +543,14 @@ public:
     /// @return True if in value state, false otherwise.
     [[nodiscard]] constexpr bool hasValue() const noexcept
     {
-        return m_hasValue;
+        if constexpr (kUsesNiche)
+        {
+            return !trait::isNiche<T>(m_storage);
+        }
+        else
+        {
+            return m_hasValue;
+        }
     }
 
     /// @brief Accesses the contained value (lvalue), asserting if in error state.
@@ -487,7 +559,7 @@ public:
     /// @return Reference to the contained value.
     [[nodiscard]] constexpr T& value() & noexcept
     {
-        GP_ASSERT(m_hasValue);
+        GP_ASSERT(hasValue());
         return *valuePtr();
     }
 
@@ -495,7 +567,7 @@ public:
     /// @return Const reference to the contained value.
     [[nodiscard]] constexpr const T& value() const& noexcept
     {
-        GP_ASSERT(m_hasValue);
+        GP_ASSERT(hasValue());
         return *valuePtr();
     }
 
@@ -503,7 +575,7 @@ public:
     /// @return Rvalue reference to the contained value.
     [[nodiscard]] constexpr T&& value() && noexcept
     {
-        GP_ASSERT(m_hasValue);
+        GP_ASSERT(hasValue());
         return std::move(*valuePtr());
     }
 
@@ -511,7 +583,7 @@ public:
     /// @return Reference to the contained error.
     [[nodiscard]] constexpr E& error() & noexcept
     {
-        GP_ASSERT(!m_hasValue);
+        GP_ASSERT(!hasValue());
         return *errorPtr();
     }
 
@@ -519,7 +591,7 @@ public:
     /// @return Const reference to the contained error.
     [[nodiscard]] constexpr const E& error() const& noexcept
     {
-        GP_ASSERT(!m_hasValue);
+        GP_ASSERT(!hasValue());
         return *errorPtr();
     }
 
@@ -527,7 +599,7 @@ public:
     /// @return Rvalue reference to the contained error.
     [[nodiscard]] constexpr E&& error() && noexcept
     {
-        GP_ASSERT(!m_hasValue);
+        GP_ASSERT(!hasValue());
         return std::move(*errorPtr());
     }
 
@@ -536,7 +608,7 @@ public:
     /// @return The stored value or @p defaultValue.
     [[nodiscard]] constexpr T valueOr(T&& defaultValue) const& noexcept
     {
-        return m_hasValue ? *valuePtr() : std::move(defaultValue);
+        return hasValue() ? *valuePtr() : std::move(defaultValue);
     }
 
     /// @brief Returns the contained value if in value state, otherwise returns @p defaultValue (rvalue overload).
@@ -544,7 +616,7 @@ public:
     /// @return The stored value or @p defaultValue.
     [[nodiscard]] constexpr T valueOr(T&& defaultValue) && noexcept
     {
-        return m_hasValue ? std::move(*valuePtr()) : std::move(defaultValue);
+        return hasValue() ? std::move(*valuePtr()) : std::move(defaultValue);
     }
 
     /// @brief Returns the contained error if in error state, otherwise returns @p defaultError.
@@ -552,7 +624,7 @@ public:
     /// @return The stored error or @p defaultError.
     [[nodiscard]] constexpr E errorOr(E&& defaultError) const& noexcept
     {
-        return !m_hasValue ? *errorPtr() : std::move(defaultError);
+        return !hasValue() ? *errorPtr() : std::move(defaultError);
     }
 
     /// @brief Returns the contained error if in error state, otherwise returns @p defaultError (rvalue overload).
@@ -560,7 +632,7 @@ public:
     /// @return The stored error or @p defaultError.
     [[nodiscard]] constexpr E errorOr(E&& defaultError) && noexcept
     {
-        return !m_hasValue ? std::move(*errorPtr()) : std::move(defaultError);
+        return !hasValue() ? std::move(*errorPtr()) : std::move(defaultError);
     }
 
     /// @brief Destroys the current contents and constructs a new value in-place.
@@ -572,7 +644,7 @@ public:
     {
         destroyActive();
         ::new (&m_storage) T(std::forward<Args>(args)...);
-        m_hasValue = true;
+        setHasValue(true);
         return *valuePtr();
     }
 
@@ -584,8 +656,8 @@ public:
     requires concepts::IsConstructibleWith<E, Args...> E& emplaceError(Args&&... args)
     {
         destroyActive();
-        ::new (&m_storage) E(std::forward<Args>(args)...);
-        m_hasValue = false;
+        ::new (errorPtr()) E(std::forward<Args>(args)...);
+        setHasValue(false);
         return *errorPtr();
     }
 
@@ -599,15 +671,15 @@ public:
     void swap(Expected& other
     ) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
     {
-        if (m_hasValue && other.m_hasValue)
+        if (hasValue() && other.hasValue())
         {
             std::swap(*valuePtr(), *other.valuePtr());
         }
-        else if (!m_hasValue && !other.m_hasValue)
+        else if (!hasValue() && !other.hasValue())
         {
             std::swap(*errorPtr(), *other.errorPtr());
         }
-        else if (m_hasValue && !other.m_hasValue)
+        else if (hasValue() && !other.hasValue())
         {
             // this = value  |  other = error
             // Step 1: save other's error on the stack.
@@ -616,12 +688,12 @@ public:
             E tempError(std::move(*other.errorPtr()));
             other.destroyActive();
             ::new (&other.m_storage) T(std::move(*valuePtr()));
-            other.m_hasValue = true;
+            other.setHasValue(true);
             destroyActive();
-            ::new (&m_storage) E(std::move(tempError));
-            m_hasValue = false;
+            ::new (errorPtr()) E(std::move(tempError));
+            setHasValue(false);
         }
-        else   // !m_hasValue && other.m_hasValue  →  symmetric, delegate
+        else   // !hasValue() && other.hasValue()  →  symmetric, delegate
         {
             other.swap(*this);
         }
@@ -643,7 +715,7 @@ public:
     requires concepts::IsInvocable<F, T&> [[nodiscard]] auto andThen(F&& f) &
     {
         using ResultType = std::invoke_result_t<F, T&>;
-        if (m_hasValue)
+        if (hasValue())
         {
             return std::invoke(std::forward<F>(f), *valuePtr());
         }
@@ -658,7 +730,7 @@ public:
     requires concepts::IsInvocable<F, const T&> [[nodiscard]] auto andThen(F&& f) const&
     {
         using ResultType = std::invoke_result_t<F, const T&>;
-        if (m_hasValue)
+        if (hasValue())
         {
             return std::invoke(std::forward<F>(f), *valuePtr());
         }
@@ -673,7 +745,7 @@ public:
     requires concepts::IsInvocable<F, T&&> [[nodiscard]] auto andThen(F&& f) &&
     {
         using ResultType = std::invoke_result_t<F, T&&>;
-        if (m_hasValue)
+        if (hasValue())
         {
             return std::invoke(std::forward<F>(f), std::move(*valuePtr()));
         }
@@ -695,7 +767,7 @@ public:
     requires concepts::IsInvocable<F, E&> [[nodiscard]] auto orElse(F&& f) &
     {
         using ResultType = std::invoke_result_t<F, E&>;
-        if (!m_hasValue)
+        if (!hasValue())
         {
             return std::invoke(std::forward<F>(f), *errorPtr());
         }
@@ -710,7 +782,7 @@ public:
     requires concepts::IsInvocable<F, const E&> [[nodiscard]] auto orElse(F&& f) const&
     {
         using ResultType = std::invoke_result_t<F, const E&>;
-        if (!m_hasValue)
+        if (!hasValue())
         {
             return std::invoke(std::forward<F>(f), *errorPtr());
         }
@@ -725,7 +797,7 @@ public:
     requires concepts::IsInvocable<F, E&&> [[nodiscard]] auto orElse(F&& f) &&
     {
         using ResultType = std::invoke_result_t<F, E&&>;
-        if (!m_hasValue)
+        if (!hasValue())
         {
             return std::invoke(std::forward<F>(f), std::move(*errorPtr()));
         }
@@ -748,7 +820,7 @@ public:
     {
         using U = std::invoke_result_t<F, T&>;
         using ResultType = Expected<U, E>;
-        if (m_hasValue)
+        if (hasValue())
         {
             return ResultType(std::invoke(std::forward<F>(f), *valuePtr()));
         }
@@ -764,7 +836,7 @@ public:
     {
         using U = std::invoke_result_t<F, const T&>;
         using ResultType = Expected<U, E>;
-        if (m_hasValue)
+        if (hasValue())
         {
             return ResultType(std::invoke(std::forward<F>(f), *valuePtr()));
         }
@@ -780,7 +852,7 @@ public:
     {
         using U = std::invoke_result_t<F, T&&>;
         using ResultType = Expected<U, E>;
-        if (m_hasValue)
+        if (hasValue())
         {
             return ResultType(std::invoke(std::forward<F>(f), std::move(*valuePtr())));
         }
@@ -803,7 +875,7 @@ public:
     {
         using G = std::invoke_result_t<F, E&>;
         using ResultType = Expected<T, G>;
-        if (!m_hasValue)
+        if (!hasValue())
         {
             return ResultType(Unexpected<G>(std::invoke(std::forward<F>(f), *errorPtr())));
         }
@@ -819,7 +891,7 @@ public:
     {
         using G = std::invoke_result_t<F, const E&>;
         using ResultType = Expected<T, G>;
-        if (!m_hasValue)
+        if (!hasValue())
         {
             return ResultType(Unexpected<G>(std::invoke(std::forward<F>(f), *errorPtr())));
         }
@@ -835,7 +907,7 @@ public:
     {
         using G = std::invoke_result_t<F, E&&>;
         using ResultType = Expected<T, G>;
-        if (!m_hasValue)
+        if (!hasValue())
         {
             return ResultType(Unexpected<G>(std::invoke(std::forward<F>(f), std::move(*errorPtr()))));
         }
@@ -855,12 +927,29 @@ private:
 
     [[nodiscard]] E* errorPtr() noexcept
     {
-        return reinterpret_cast<E*>(&m_storage);
+        return reinterpret_cast<E*>(m_storage + NicheLayout::kErrorOffset);
     }
 
     [[nodiscard]] const E* errorPtr() const noexcept
     {
-        return reinterpret_cast<const E*>(&m_storage);
+        return reinterpret_cast<const E*>(m_storage + NicheLayout::kErrorOffset);
+    }
+
+    /// @brief Records the active track, must be called after constructing the value or the error.
+    /// @param[in] isValue True if the storage now holds a value, false if it holds an error.
+    constexpr void setHasValue(bool isValue) noexcept
+    {
+        if constexpr (kUsesNiche)
+        {
+            if (!isValue)
+            {
+                trait::writeNiche<T>(m_storage);
+            }
+        }
+        else
+        {
+            m_hasValue = isValue;
+        }
     }
 
     /// @brief Destroys whichever object is currently alive in the shared storage.
@@ -869,7 +958,7 @@ private:
     /// loops that process arrays of Expecteds (e.g. bulk asset load results).
     void destroyActive() noexcept
     {
-        if (m_hasValue)
+        if (hasValue())
         {
             if constexpr (!concepts::IsTriviallyDestructible<T>)
             {
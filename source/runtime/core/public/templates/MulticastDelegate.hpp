@@ -0,0 +1,338 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "maths/base/Scalar.hpp"
+#include "memory/allocators/DefaultAllocator.hpp"
+#include "templates/Delegate.hpp"
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace gp
+{
+
+template <typename Signature, USize InlineSize = kDelegateInlineSize>
+class MulticastDelegate;
+
+/// @brief Identifies a callback registered in a MulticastDelegate, used to remove it.
+class DelegateHandle
+{
+    template <typename, USize>
+    friend class MulticastDelegate;
+
+private:
+    UInt64 m_id{ 0 };
+
+public:
+    /// @brief Constructs an invalid handle.
+    constexpr DelegateHandle() noexcept = default;
+
+private:
+    constexpr explicit DelegateHandle(UInt64 id) noexcept
+        : m_id(id)
+    {}
+
+public:
+    /// @brief Checks whether the handle was returned by a registration.
+    [[nodiscard]] constexpr bool isValid() const noexcept
+    {
+        return m_id != 0;
+    }
+
+    /// @brief Invalidates the handle. Does not unregister anything.
+    constexpr void reset() noexcept
+    {
+        m_id = 0;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const DelegateHandle&) const noexcept = default;
+};
+
+/// @brief List of delegates invoked together, used for events.
+/// @details
+/// The invocation list is a compact array of delegates, invoked in registration order by broadcast(). Callbacks are
+/// registered with add() or bind() and removed with the returned DelegateHandle.
+/// Callbacks may add or remove callbacks, including themselves, while the event is being broadcast:
+/// - A removed callback is tombstoned, it is skipped by the ongoing broadcast and physically removed (keeping the order
+///   of the others) once the outermost broadcast returns. It is never destroyed while it may still be running.
+/// - An added callback is parked in a pending list and joins the invocation list once the outermost broadcast returns,
+///   so the array being iterated never reallocates and the new callback is first called by the next broadcast.
+/// @note Not thread-safe. Broadcasting and (un)registering must happen on the same thread.
+/// @tparam Args The argument types of the event.
+/// @tparam InlineSize Size of the inline storage of each delegate in bytes.
+template <typename... Args, USize InlineSize>
+class MulticastDelegate<void(Args...), InlineSize>
+{
+public:
+    using DelegateType = Delegate<void(Args...), InlineSize>;
+    using SizeType = UInt32;
+
+private:
+    using Allocator = memory::DefaultAllocator;
+
+    struct Entry
+    {
+        DelegateType delegate;
+        UInt64 id;   //<! Zero once the entry is tombstoned.
+    };
+
+    /// @brief Minimal growable array of entries.
+    struct EntryList
+    {
+        Entry* data{ nullptr };
+        SizeType size{ 0 };
+        SizeType capacity{ 0 };
+
+        void pushBack(DelegateType&& delegate, UInt64 id)
+        {
+            if (size == capacity)
+            {
+                const SizeType newCapacity = math::max<SizeType>(capacity * 2, 4);
+                Entry* const newData = Allocator::allocateArray<Entry>(newCapacity);
+                for (SizeType i = 0; i < size; ++i)
+                {
+                    ::new (static_cast<void*>(newData + i)) Entry(std::move(data[i]));
+                    std::destroy_at(data + i);
+                }
+                Allocator::deallocate(data);
+                data = newData;
+                capacity = newCapacity;
+            }
+            ::new (static_cast<void*>(data + size)) Entry{ std::move(delegate), id };
+            ++size;
+        }
+
+        /// @brief Removes every entry matching @p predicate, keeping the order of the others.
+        template <typename Predicate>
+        void eraseIf(Predicate predicate)
+        {
+            SizeType kept = 0;
+            for (SizeType i = 0; i < size; ++i)
+            {
+                if (!predicate(data[i]))
+                {
+                    if (kept != i)
+                    {
+                        data[kept] = std::move(data[i]);
+                    }
+                    ++kept;
+                }
+            }
+            for (SizeType i = kept; i < size; ++i)
+            {
+                std::destroy_at(data + i);
+            }
+            size = kept;
+        }
+
+        void clear() noexcept
+        {
+            for (SizeType i = 0; i < size; ++i)
+            {
+                std::destroy_at(data + i);
+            }
+            size = 0;
+        }
+
+        void release() noexcept
+        {
+            clear();
+            Allocator::deallocate(data);
+            data = nullptr;
+            capacity = 0;
+        }
+    };
+
+private:
+    EntryList m_entries;
+    EntryList m_pending;   //<! Callbacks added during a broadcast.
+    UInt64 m_nextId{ 1 };
+    SizeType m_liveCount{ 0 };
+    SizeType m_broadcastDepth{ 0 };
+    bool m_hasTombstones{ false };
+
+public:
+    /// @brief Constructs an empty event.
+    MulticastDelegate() noexcept = default;
+
+    /// @brief Releases every callback.
+    ~MulticastDelegate()
+    {
+        GP_ASSERT(m_broadcastDepth == 0, "MulticastDelegate destroyed while broadcasting");
+        m_entries.release();
+        m_pending.release();
+    }
+
+    /// @brief Events are referenced by their listeners' handles and are neither copyable nor movable.
+    MulticastDelegate(const MulticastDelegate&) = delete;
+    MulticastDelegate& operator=(const MulticastDelegate&) = delete;
+    MulticastDelegate(MulticastDelegate&&) = delete;
+    MulticastDelegate& operator=(MulticastDelegate&&) = delete;
+
+public:
+    /// @brief Registers a callback.
+    /// @param[in] delegate Callback to register, must be bound.
+    /// @return Handle to pass to remove().
+    DelegateHandle add(DelegateType delegate)
+    {
+        GP_ASSERT(delegate.isBound(), "Adding an unbound delegate to a MulticastDelegate");
+        const UInt64 id = m_nextId++;
+        (m_broadcastDepth > 0 ? m_pending : m_entries).pushBack(std::move(delegate), id);
+        ++m_liveCount;
+        return DelegateHandle(id);
+    }
+
+    /// @brief Registers a member function known at compile time, called on @p object.
+    /// @note The event does not own @p object, which must stay alive until the callback is removed.
+    /// @tparam Method The member function to call.
+    /// @tparam C Class of the object.
+    /// @param[in] object Object to call the method on.
+    /// @return Handle to pass to remove().
+    template <auto Method, typename C>
+    DelegateHandle bind(C* object)
+    {
+        return add(DelegateType::template bind<Method>(object));
+    }
+
+    /// @brief Unregisters a callback. Safe to call from within a broadcast, including from the callback itself.
+    /// @param[in] handle Handle returned when the callback was registered.
+    /// @return True if the callback was registered and got removed, false otherwise.
+    bool remove(DelegateHandle handle)
+    {
+        if (!handle.isValid())
+        {
+            return false;
+        }
+
+        for (SizeType i = 0; i < m_entries.size; ++i)
+        {
+            Entry& entry = m_entries.data[i];
+            if (entry.id == handle.m_id)
+            {
+                if (m_broadcastDepth > 0)
+                {
+                    entry.id = 0;
+                    m_hasTombstones = true;
+                }
+                else
+                {
+                    m_entries.eraseIf([id = handle.m_id](const Entry& candidate) { return candidate.id == id; });
+                }
+                --m_liveCount;
+                return true;
+            }
+        }
+
+        for (SizeType i = 0; i < m_pending.size; ++i)
+        {
+            if (m_pending.data[i].id == handle.m_id)
+            {
+                m_pending.eraseIf([id = handle.m_id](const Entry& candidate) { return candidate.id == id; });
+                --m_liveCount;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Unregisters every callback. Safe to call from within a broadcast.
+    void clear()
+    {
+        if (m_broadcastDepth > 0)
+        {
+            for (SizeType i = 0; i < m_entries.size; ++i)
+            {
+                m_entries.data[i].id = 0;
+            }
+            m_hasTombstones = m_entries.size > 0;
+        }
+        else
+        {
+            m_entries.clear();
+        }
+        m_pending.clear();
+        m_liveCount = 0;
+    }
+
+    /// @brief Calls every registered callback, in registration order.
+    /// @param[in] args Arguments passed to every callback.
+    void broadcast(Args... args)
+    {
+        ++m_broadcastDepth;
+        const SizeType count = m_entries.size;
+        for (SizeType i = 0; i < count; ++i)
+        {
+            const Entry& entry = m_entries.data[i];
+            if (entry.id != 0)
+            {
+                entry.delegate(args...);
+            }
+        }
+        if (--m_broadcastDepth == 0)
+        {
+            flushDeferredChanges();
+        }
+    }
+
+public:
+    /// @brief Checks whether the callback referred to by @p handle is registered.
+    [[nodiscard]] bool contains(DelegateHandle handle) const noexcept
+    {
+        if (!handle.isValid())
+        {
+            return false;
+        }
+        for (const EntryList* list : { &m_entries, &m_pending })
+        {
+            for (SizeType i = 0; i < list->size; ++i)
+            {
+                if (list->data[i].id == handle.m_id)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /// @brief Returns the number of registered callbacks.
+    [[nodiscard]] SizeType size() const noexcept
+    {
+        return m_liveCount;
+    }
+
+    /// @brief Checks whether no callback is registered.
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return m_liveCount == 0;
+    }
+
+    /// @brief Checks whether a broadcast is in progress.
+    [[nodiscard]] bool isBroadcasting() const noexcept
+    {
+        return m_broadcastDepth > 0;
+    }
+
+private:
+    void flushDeferredChanges()
+    {
+        if (m_hasTombstones)
+        {
+            m_entries.eraseIf([](const Entry& entry) { return entry.id == 0; });
+            m_hasTombstones = false;
+        }
+        for (SizeType i = 0; i < m_pending.size; ++i)
+        {
+            m_entries.pushBack(std::move(m_pending.data[i].delegate), m_pending.data[i].id);
+        }
+        m_pending.clear();
+    }
+};
+
+}   // namespace gp
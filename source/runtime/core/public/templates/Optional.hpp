@@ -7,6 +7,8 @@
 #include "concepts/Concepts.hpp"
 #include "concepts/Memory.hpp"   // IWYU pragma: keep
 #include "CoreMinimal.hpp"
+#include "templates/traits/NicheTraits.hpp"
+#include <type_traits>
 
 namespace gp
 {
@@ -28,6 +30,11 @@ inline constexpr detail::NullOptT nullopt{};
 /// @brief Optional value container, holds a T or nothing.
 /// @note No heap allocation. The value lives in aligned inline storage. Use hasValue() / operator bool to check
 /// presence before access.
+/// @note When T declares a niche (see trait::NicheTraits: pointers, bool, handles, string views, opted-in enums), the
+/// empty state is encoded as the niche inside the storage and no flag is stored, so Optional<T> is as large as T.
+/// When T is trivially copyable, so is Optional<T>: together, a niche-optimised Optional of a register-sized T is
+/// passed and returned in registers. Moving such an optional copies it and leaves the source engaged, moving an
+/// optional of a non-trivial T resets the source.
 /// @tparam T Contained type.
 template <typename T>
 requires concepts::IsDestructible<T> && (!concepts::IsReference<T>)class Optional
@@ -36,35 +43,44 @@ public:
     using ValueType = T;
 
 private:
+    static constexpr bool kUsesNiche = concepts::HasNiche<T>;
+    static constexpr bool kIsTrivial = concepts::IsTriviallyCopyable<T> && concepts::IsTriviallyDestructible<T>;
+
+    /// @brief Placeholder for the engaged flag when the niche of T encodes it.
+    struct NoFlag
+    {};
+
     alignas(alignof(T)) Byte m_storage[sizeof(T)];
-    bool m_hasValue = false;
+    GP_NO_UNIQUE_ADDRESS std::conditional_t<kUsesNiche, NoFlag, bool> m_hasValue{};
 
 public:
     /// @brief Constructs an empty optional.
     constexpr Optional() noexcept
-        : m_hasValue(false)
-    {}
+    {
+        setHasValue(false);
+    }
 
     /// @brief Constructs an empty optional from NullOpt.
     /// @param[in] NullOpt NullOpt tag.
     constexpr Optional(detail::NullOptT) noexcept
-        : m_hasValue(false)
-    {}
+    {
+        setHasValue(false);
+    }
 
     /// @brief Copy-constructs an optional holding @p value.
     /// @param[in] value Value to store.
     constexpr Optional(const T& value) noexcept(noexcept(T(value)))
-        : m_hasValue(true)
     {
         ::new (&m_storage) T(value);
+        setHasValue(true);
     }
 
     /// @brief Move-constructs an optional holding @p value.
     /// @param[in] value Value to move.
     constexpr Optional(T&& value) noexcept(noexcept(T(std::move(value))))
-        : m_hasValue(true)
     {
         ::new (&m_storage) T(std::move(value));
+        setHasValue(true);
     }
 
     /// @brief Constructs a new value in-place.
@@ -73,34 +89,42 @@ public:
     template <typename... Args>
     requires std::is_constructible_v<T, Args...>
     explicit constexpr Optional(Args&&... args) noexcept(noexcept(T(std::forward<Args>(args)...)))
-        : m_hasValue(true)
     {
         ::new (&m_storage) T(std::forward<Args>(args)...);
+        setHasValue(true);
     }
 
+    /// @brief Trivial copy and move constructors, used when T is trivially copyable.
+    constexpr Optional(const Optional&) requires kIsTrivial = default;
+    constexpr Optional(Optional&&) requires kIsTrivial = default;
+
     /// @brief Copy-constructs from another optional.
     /// @param[in] other Optional to copy from.
     constexpr Optional(const Optional& other)
-        : m_hasValue(other.m_hasValue)
     {
-        if (m_hasValue)
+        if (other.hasValue())
         {
             ::new (&m_storage) T(other.value());
         }
+        setHasValue(other.hasValue());
     }
 
     /// @brief Move-constructs from another optional.
     /// @param[in] other Optional to move from.
     constexpr Optional(Optional&& other) noexcept(noexcept(T(std::move(other.value()))))
-        : m_hasValue(other.m_hasValue)
     {
-        if (m_hasValue)
+        const bool otherHasValue = other.hasValue();
+        if (otherHasValue)
         {
             ::new (&m_storage) T(std::move(other.value()));
             other.reset();
         }
+        setHasValue(otherHasValue);
     }
 
+    /// @brief Trivial destructor, used when T is trivially destructible.
+    ~Optional() requires kIsTrivial = default;
+
     /// @brief Destroys the contained value (if any).
     ~Optional()
     {
@@ -116,6 +140,10 @@ public:
         return *this;
     }
 
+    /// @brief Trivial copy and move assignment operators, used when T is trivially copyable.
+    constexpr Optional& operator=(const Optional&) requires kIsTrivial = default;
+    constexpr Optional& operator=(Optional&&) requires kIsTrivial = default;
+
     /// @brief Copy-assigns from another optional.
     /// @param[in] other Optional to copy from.
     /// @return Reference to this optional.
@@ -125,16 +153,16 @@ public:
         {
             return *this;
         }
-        if (m_hasValue && other.m_hasValue)
+        if (hasValue() && other.hasValue())
         {
             value() = other.value();
         }
-        else if (!m_hasValue && other.m_hasValue)
+        else if (!hasValue() && other.hasValue())
         {
             ::new (&m_storage) T(other.value());
-            m_hasValue = true;
+            setHasValue(true);
         }
-        else if (m_hasValue)
+        else if (hasValue())
         {
             reset();
         }
@@ -150,18 +178,18 @@ public:
         {
             return *this;
         }
-        if (m_hasValue && other.m_hasValue)
+        if (hasValue() && other.hasValue())
         {
             value() = std::move(other.value());
             other.reset();
         }
-        else if (!m_hasValue && other.m_hasValue)
+        else if (!hasValue() && other.hasValue())
         {
             ::new (&m_storage) T(std::move(other.value()));
-            m_hasValue = true;
+            setHasValue(true);
             other.reset();
         }
-        else if (m_hasValue)
+        else if (hasValue())
         {
             reset();
         }
@@ -176,14 +204,14 @@ public:
     requires std::is_constructible_v<T, U&&> && (!std::is_same_v<std::remove_cvref_t<U>, Optional>)Optional&
         operator=(U&& inValue)
     {
-        if (m_hasValue)
+        if (hasValue())
         {
             value() = std::forward<U>(inValue);
         }
         else
         {
             ::new (&m_storage) T(std::forward<U>(inValue));
-            m_hasValue = true;
+            setHasValue(true);
         }
         return *this;
     }
@@ -194,11 +222,11 @@ public:
     /// @return True if both optionals are empty or both contain equal values, false otherwise.
     [[nodiscard]] bool operator==(const Optional& other) const noexcept requires std::equality_comparable<T>
     {
-        if (m_hasValue != other.m_hasValue)
+        if (hasValue() != other.hasValue())
         {
             return false;
         }
-        return !m_hasValue || value() == other.value();
+        return !hasValue() || value() == other.value();
     }
 
     /// @brief Checks if the optional is empty.
@@ -206,7 +234,7 @@ public:
     /// @return True if this optional is empty, false otherwise.
     [[nodiscard]] bool operator==(detail::NullOptT) const noexcept
     {
-        return !m_hasValue;
+        return !hasValue();
     }
 
     /// @brief Checks if the optional is not empty.
@@ -214,7 +242,7 @@ public:
     /// @return True if this optional has a value, false otherwise.
     [[nodiscard]] bool operator!=(detail::NullOptT) const noexcept
     {
-        return m_hasValue;
+        return hasValue();
     }
 
     /// @brief Checks if the optional contains a value equal to @p inValue.
@@ -222,7 +250,7 @@ public:
     /// @return True if the optional has a value and it is equal to @p inValue, false otherwise.
     [[nodiscard]] bool operator==(const T& inValue) const noexcept requires std::equality_comparable<T>
     {
-        return m_hasValue && value() == inValue;
+        return hasValue() && value() == inValue;
     }
 
     /// @brief Checks if the optional does not contain a value equal to @p value.
@@ -280,7 +308,7 @@ public:
     /// @return True if the optional has a value, false otherwise.
     [[nodiscard]] constexpr explicit operator bool() const noexcept
     {
-        return m_hasValue;
+        return hasValue();
     }
 
 public:
@@ -288,14 +316,21 @@ public:
     /// @return True if the optional has a value, false otherwise.
     [[nodiscard]] constexpr bool hasValue() const noexcept
     {
-        return m_hasValue;
+        if constexpr (kUsesNiche)
+        {
+            return !trait::isNiche<T>(m_storage);
+        }
+        else
+        {
+            return m_hasValue;
+        }
     }
 
     /// @brief Accesses the contained value, asserting if there is none.
     /// @return Reference to the contained value.
     [[nodiscard]] constexpr T& value() & noexcept
     {
-        GP_ASSERT(m_hasValue);
+        GP_ASSERT(hasValue());
         return *reinterpret_cast<T*>(&m_storage);
     }
 
@@ -303,7 +338,7 @@ public:
     /// @return Reference to the contained value.
     [[nodiscard]] constexpr const T& value() const& noexcept
     {
-        GP_ASSERT(m_hasValue);
+        GP_ASSERT(hasValue());
         return *reinterpret_cast<const T*>(&m_storage);
     }
 
@@ -311,7 +346,7 @@ public:
     /// @return Rvalue reference to the contained value.
     [[nodiscard]] constexpr T&& value() && noexcept
     {
-        GP_ASSERT(m_hasValue);
+        GP_ASSERT(hasValue());
         return std::move(*reinterpret_cast<T*>(&m_storage));
     }
 
@@ -320,7 +355,7 @@ public:
     /// @return The contained value or @p defaultValue.
     [[nodiscard]] constexpr T valueOr(T&& defaultValue) const& noexcept
     {
-        return m_hasValue ? value() : std::move(defaultValue);
+        return hasValue() ? value() : std::move(defaultValue);
     }
 
     /// @brief Returns the contained value if present, otherwise returns @p defaultValue.
@@ -328,19 +363,19 @@ public:
     /// @return The contained value or @p defaultValue.
     [[nodiscard]] constexpr T valueOr(T&& defaultValue) && noexcept
     {
-        return m_hasValue ? std::move(value()) : std::move(defaultValue);
+        return hasValue() ? std::move(value()) : std::move(defaultValue);
     }
 
     /// @brief Destroys the contained value if present, leaving the optional empty.
     void reset() noexcept
     {
-        if (m_hasValue)
+        if (hasValue())
         {
             if constexpr (!concepts::IsTriviallyDestructible<T>)
             {
                 reinterpret_cast<T*>(&m_storage)->~T();
             }
-            m_hasValue = false;
+            setHasValue(false);
         }
     }
 
@@ -353,7 +388,7 @@ public:
     {
         reset();
         ::new (&m_storage) T(std::forward<Args>(args)...);
-        m_hasValue = true;
+        setHasValue(true);
         return value();
     }
 
@@ -361,23 +396,41 @@ public:
     /// @param[in] other Optional to swap with.
     void swap(Optional& other) noexcept(noexcept(T(std::move(std::declval<T&>()))))
     {
-        if (m_hasValue && other.m_hasValue)
+        if (hasValue() && other.hasValue())
         {
             std::swap(value(), other.value());
         }
-        else if (!m_hasValue && other.m_hasValue)
+        else if (!hasValue() && other.hasValue())
         {
             ::new (&m_storage) T(std::move(other.value()));
-            m_hasValue = true;
+            setHasValue(true);
             other.reset();
         }
-        else if (m_hasValue && !other.m_hasValue)
+        else if (hasValue() && !other.hasValue())
         {
             ::new (&other.m_storage) T(std::move(value()));
-            other.m_hasValue = true;
+            other.setHasValue(true);
             reset();
         }
     }
+
+private:
+    /// @brief Records whether a value is engaged, must be called after constructing or destroying the value.
+    /// @param[in] engaged True if the storage now holds a value.
+    constexpr void setHasValue(bool engaged) noexcept
+    {
+        if constexpr (kUsesNiche)
+        {
+            if (!engaged)
+            {
+                trait::writeNiche<T>(m_storage);
+            }
+        }
+        else
+        {
+            m_hasValue = engaged;
+        }
+    }
 };
 
 /// @brief Creates a Optional with an in-place constructed value.
@@ -4,20 +4,260 @@
 
 #pragma once
 
+#include "concepts/Concepts.hpp"
 #include "CoreMinimal.hpp"
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace gp
 {
 
-template <typename... Types>
-class Tuple;
+namespace detail
+{
 
-template <>
-class Tuple<>
-{};
+/// @brief Storage of a single Tuple element, tagged with its index so that equal types stay distinct bases.
+/// @details
+/// The value is a `GP_NO_UNIQUE_ADDRESS` member: empty elements (stateless allocators, deleters, tag types) take no
+/// space as long as no other element of the same type needs its own address.
+/// @tparam I Index of the element.
+/// @tparam T Type of the element.
+template <USize I, typename T>
+struct TupleLeaf
+{
+public:
+    GP_NO_UNIQUE_ADDRESS T value;
+};
+
+template <typename Indices, typename... Types>
+struct TupleStorage;
 
-template <typename Head, typename... Tail>
-class Tuple<Head, Tail...> : public Tuple<Tail...>
+/// @brief Flat aggregate of every leaf, avoiding the deep recursive inheritance of a head/tail tuple.
+template <USize... Is, typename... Types>
+struct TupleStorage<std::index_sequence<Is...>, Types...> : TupleLeaf<Is, Types>...
 {};
 
+/// @brief Type of the element at index I of a type list.
+template <USize I, typename... Types>
+using TupleElementType = std::tuple_element_t<I, std::tuple<Types...>>;
+
+/// @brief Index of the first occurrence of T in a type list, or the size of the list if absent.
+template <typename T, typename... Types>
+inline constexpr USize kTypeIndex = []()
+{
+    constexpr bool kMatches[] = { concepts::IsSameAs<T, Types>..., false };
+    USize index = 0;
+    while (index < sizeof...(Types) && !kMatches[index])
+    {
+        ++index;
+    }
+    return index;
+}();
+
+/// @brief Number of occurrences of T in a type list.
+template <typename T, typename... Types>
+inline constexpr USize kTypeCount = (USize{ 0 } + ... + (concepts::IsSameAs<T, Types> ? 1 : 0));
+
+}   // namespace detail
+
+/// @brief Fixed-size collection of heterogeneous values.
+/// @details
+/// Elements are stored as flat bases rather than through recursive inheritance, which keeps instantiation cheap, and
+/// empty elements are compressed away with `GP_NO_UNIQUE_ADDRESS`. A Tuple of trivially copyable types is itself
+/// trivially copyable. Structured bindings are supported.
+/// @tparam Types Types of the elements.
+template <typename... Types>
+class Tuple
+{
+public:
+    static constexpr USize kSize = sizeof...(Types);
+
+private:
+    using Storage = detail::TupleStorage<std::index_sequence_for<Types...>, Types...>;
+
+    template <USize I>
+    using Leaf = detail::TupleLeaf<I, detail::TupleElementType<I, Types...>>;
+
+private:
+    GP_NO_UNIQUE_ADDRESS Storage m_storage;
+
+public:
+    /// @brief Value-initializes every element.
+    constexpr Tuple() requires(concepts::IsDefaultConstructible<Types> && ...)
+        : m_storage()
+    {}
+
+    /// @brief Constructs every element from a value.
+    /// @param[in] values Values of the elements.
+    constexpr explicit(kSize == 1) Tuple(const Types&... values) requires(
+        kSize > 0 && (concepts::IsCopyConstructible<Types> && ...)
+    )
+        : m_storage{ { values }... }
+    {}
+
+    /// @brief Constructs every element by forwarding an argument.
+    /// @tparam Args Argument types, one per element.
+    /// @param[in] args Arguments forwarded to the element constructors.
+    template <typename... Args>
+    requires(
+        sizeof...(Args) == kSize && kSize > 0 && (concepts::IsConstructibleWith<Types, Args &&> && ...) &&
+        !(kSize == 1 && (concepts::IsSameAs<std::remove_cvref_t<Args>, Tuple> || ...))
+    )
+    constexpr explicit(kSize == 1) Tuple(Args&&... args)
+        : m_storage{ { Types(std::forward<Args>(args)) }... }
+    {}
+
+    constexpr Tuple(const Tuple&) = default;
+    constexpr Tuple(Tuple&&) = default;
+    constexpr Tuple& operator=(const Tuple&) = default;
+    constexpr Tuple& operator=(Tuple&&) = default;
+
+    /// @brief Assigns the elements of another tuple pairwise, e.g. to a tuple of references created by tie().
+    /// @param[in] other Tuple to assign from.
+    /// @return Reference to this tuple.
+    template <typename... Others>
+    requires(sizeof...(Others) == kSize && (std::is_assignable_v<Types&, const Others&> && ...))
+    constexpr Tuple& operator=(const Tuple<Others...>& other)
+    {
+        [&]<USize... Is>(std::index_sequence<Is...>)
+        {
+            ((get<Is>() = other.template get<Is>()), ...);
+        }(std::index_sequence_for<Types...>{});
+        return *this;
+    }
+
+    template <typename... Others>
+    requires(sizeof...(Others) == kSize && (std::is_assignable_v<Types&, Others &&> && ...))
+    constexpr Tuple& operator=(Tuple<Others...>&& other)
+    {
+        [&]<USize... Is>(std::index_sequence<Is...>)
+        {
+            ((get<Is>() = std::move(other).template get<Is>()), ...);
+        }(std::index_sequence_for<Types...>{});
+        return *this;
+    }
+
+public:
+    /// @brief Accesses the element at index I.
+    /// @tparam I Index of the element.
+    /// @return Reference to the element.
+    template <USize I>
+    requires(I < kSize)
+    [[nodiscard]] constexpr auto& get() & noexcept
+    {
+        return static_cast<Leaf<I>&>(m_storage).value;
+    }
+
+    template <USize I>
+    requires(I < kSize)
+    [[nodiscard]] constexpr const auto& get() const& noexcept
+    {
+        return static_cast<const Leaf<I>&>(m_storage).value;
+    }
+
+    /// @note Reference elements stay lvalue references, as with std::get on an rvalue std::tuple.
+    template <USize I>
+    requires(I < kSize)
+    [[nodiscard]] constexpr detail::TupleElementType<I, Types...>&& get() && noexcept
+    {
+        return std::forward<detail::TupleElementType<I, Types...>>(static_cast<Leaf<I>&>(m_storage).value);
+    }
+
+    /// @brief Accesses the element of type T, which must appear exactly once in the tuple.
+    /// @tparam T Type of the element.
+    /// @return Reference to the element.
+    template <typename T>
+    requires(detail::kTypeCount<T, Types...> == 1)
+    [[nodiscard]] constexpr T& get() & noexcept
+    {
+        return get<detail::kTypeIndex<T, Types...>>();
+    }
+
+    template <typename T>
+    requires(detail::kTypeCount<T, Types...> == 1)
+    [[nodiscard]] constexpr const T& get() const& noexcept
+    {
+        return get<detail::kTypeIndex<T, Types...>>();
+    }
+
+    template <typename T>
+    requires(detail::kTypeCount<T, Types...> == 1)
+    [[nodiscard]] constexpr T&& get() && noexcept
+    {
+        return std::move(*this).template get<detail::kTypeIndex<T, Types...>>();
+    }
+
+public:
+    /// @brief Compares the elements pairwise.
+    /// @param[in] other Tuple to compare with.
+    /// @return True if every element compares equal.
+    [[nodiscard]] constexpr bool operator==(const Tuple& other) const
+        requires(concepts::IsEqualityComparable<Types> && ...)
+    {
+        return [&]<USize... Is>(std::index_sequence<Is...>)
+        {
+            return ((get<Is>() == other.template get<Is>()) && ...);
+        }(std::index_sequence_for<Types...>{});
+    }
+
+    /// @brief Swaps the elements pairwise.
+    /// @param[in] other Tuple to swap with.
+    constexpr void swap(Tuple& other) noexcept((std::is_nothrow_swappable_v<Types> && ...))
+    {
+        [&]<USize... Is>(std::index_sequence<Is...>)
+        {
+            using std::swap;
+            (swap(get<Is>(), other.template get<Is>()), ...);
+        }(std::index_sequence_for<Types...>{});
+    }
+};
+
+/// @brief Class template argument deduction guide for Tuple.
+template <typename... Types>
+Tuple(Types...) -> Tuple<Types...>;
+
+/// @brief Factory function to create a Tuple, with template argument deduction and perfect forwarding.
+/// @tparam Types Types of the values, decayed to deduce the element types.
+/// @param[in] values Values of the elements.
+/// @return A Tuple containing the provided values.
+template <typename... Types>
+[[nodiscard]] constexpr Tuple<std::decay_t<Types>...> makeTuple(Types&&... values)
+{
+    return Tuple<std::decay_t<Types>...>(std::forward<Types>(values)...);
+}
+
+/// @brief Creates a Tuple of references to the arguments, typically to assign a returned tuple to existing variables.
+/// @param[in] values Variables to reference.
+/// @return A Tuple of lvalue references.
+template <typename... Types>
+[[nodiscard]] constexpr Tuple<Types&...> tie(Types&... values) noexcept
+{
+    return Tuple<Types&...>(values...);
+}
+
+/// @brief Invokes @p func with the elements of @p tuple as arguments.
+/// @param[in] func Callable to invoke.
+/// @param[in] tuple Tuple whose elements are forwarded to @p func.
+/// @return The value returned by @p func.
+template <typename F, typename TupleType>
+requires requires { std::remove_cvref_t<TupleType>::kSize; }
+constexpr decltype(auto) apply(F&& func, TupleType&& tuple)
+{
+    return [&]<USize... Is>(std::index_sequence<Is...>) -> decltype(auto)
+    {
+        return std::invoke(std::forward<F>(func), std::forward<TupleType>(tuple).template get<Is>()...);
+    }(std::make_index_sequence<std::remove_cvref_t<TupleType>::kSize>{});
+}
+
 }   // namespace gp
+
+template <typename... Types>
+struct std::tuple_size<gp::Tuple<Types...>> : std::integral_constant<std::size_t, sizeof...(Types)>
+{};
+
+template <std::size_t I, typename... Types>
+struct std::tuple_element<I, gp::Tuple<Types...>>
+{
+    using type = std::tuple_element_t<I, std::tuple<Types...>>;
+};
@@ -4,14 +4,495 @@
 
 #pragma once
 
+#include "concepts/Concepts.hpp"
 #include "CoreMinimal.hpp"
+#include "templates/Tuple.hpp"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace gp
 {
 
-/// @brief A type-safe union that can hold one of the specified types.
-template <typename... Ts>
-requires(sizeof...(Ts) > 0) class Variant
-{};
+namespace detail
+{
+
+/// @brief Smallest unsigned integer type able to index Count alternatives.
+template <USize Count>
+using VariantIndexType = std::conditional_t<(Count <= 0xFF), UInt8, UInt16>;
+
+// clang-format off
+#define GP_VARIANT_DISPATCH_CASE(k)                                             \
+    case Base + k:                                                              \
+        if constexpr (Base + k < Count)                                         \
+        {                                                                       \
+            return caseFn(std::integral_constant<USize, Base + k>{});           \
+        }                                                                       \
+        else                                                                    \
+        {                                                                       \
+            GP_BUILTIN_UNREACHABLE();                                           \
+        }
+// clang-format on
+
+/// @brief Calls @p caseFn with `std::integral_constant<USize, index>` through a switch over [0, Count).
+/// @details
+/// Each switch covers 16 consecutive indices, and the default label recurses into the next block of 16. The compiler
+/// sees plain constant case labels and lowers them to a jump table, which unlike an array of function pointers keeps
+/// every case body inlinable.
+/// @tparam R Return type of @p caseFn.
+/// @tparam Count Number of valid indices.
+/// @tparam Base First index handled by this block.
+/// @param[in] index Runtime index, must be lower than Count.
+/// @param[in] caseFn Callable invoked with the index as a compile-time constant.
+/// @return The value returned by @p caseFn.
+template <typename R, USize Count, USize Base = 0, typename CaseFn>
+GP_FORCEINLINE constexpr R dispatchSwitch(USize index, CaseFn&& caseFn)
+{
+    switch (index)
+    {
+        GP_VARIANT_DISPATCH_CASE(0)
+        GP_VARIANT_DISPATCH_CASE(1)
+        GP_VARIANT_DISPATCH_CASE(2)
+        GP_VARIANT_DISPATCH_CASE(3)
+        GP_VARIANT_DISPATCH_CASE(4)
+        GP_VARIANT_DISPATCH_CASE(5)
+        GP_VARIANT_DISPATCH_CASE(6)
+        GP_VARIANT_DISPATCH_CASE(7)
+        GP_VARIANT_DISPATCH_CASE(8)
+        GP_VARIANT_DISPATCH_CASE(9)
+        GP_VARIANT_DISPATCH_CASE(10)
+        GP_VARIANT_DISPATCH_CASE(11)
+        GP_VARIANT_DISPATCH_CASE(12)
+        GP_VARIANT_DISPATCH_CASE(13)
+        GP_VARIANT_DISPATCH_CASE(14)
+        GP_VARIANT_DISPATCH_CASE(15)
+    default:
+        if constexpr (Base + 16 < Count)
+        {
+            return dispatchSwitch<R, Count, Base + 16>(index, std::forward<CaseFn>(caseFn));
+        }
+        else
+        {
+            GP_BUILTIN_UNREACHABLE();
+        }
+    }
+}
+
+#undef GP_VARIANT_DISPATCH_CASE
+
+}   // namespace detail
+
+/// @brief A type-safe union that holds exactly one of the specified types.
+/// @details
+/// The alternative index is stored in the smallest integer type that fits, one byte for up to 255 alternatives, so a
+/// Variant of small types stays small. A Variant whose alternatives are all trivially copyable is itself trivially
+/// copyable and can be memcpy'd. The engine does not use exceptions, so there is no valueless state: a Variant always
+/// holds a valid alternative.
+/// @tparam Types Types of the alternatives, each non-reference and destructible.
+template <typename... Types>
+requires(sizeof...(Types) > 0 && sizeof...(Types) <= 0xFFFF && (!concepts::IsReference<Types> && ...))
+class Variant
+{
+public:
+    static constexpr USize kCount = sizeof...(Types);
+
+    using IndexType = detail::VariantIndexType<kCount>;
+
+    template <USize I>
+    using AlternativeType = detail::TupleElementType<I, Types...>;
+
+private:
+    static constexpr bool kIsTrivial =
+        ((concepts::IsTriviallyCopyable<Types> && concepts::IsTriviallyDestructible<Types>) && ...);
+
+    template <typename T>
+    static constexpr USize kIndexOf = detail::kTypeIndex<T, Types...>;
+
+    template <typename T>
+    static constexpr bool kIsUniqueAlternative = detail::kTypeCount<T, Types...> == 1;
+
+private:
+    alignas(Types...) Byte m_storage[std::max({ sizeof(Types)... })];
+    IndexType m_index;
+
+public:
+    /// @brief Value-initializes the first alternative.
+    constexpr Variant() noexcept(std::is_nothrow_default_constructible_v<AlternativeType<0>>)
+        requires concepts::IsDefaultConstructible<AlternativeType<0>>
+    {
+        construct<0>();
+    }
+
+    /// @brief Constructs the alternative whose type is exactly the decayed type of @p value.
+    /// @param[in] value Value to store.
+    template <typename U>
+    requires(
+        !concepts::IsSameAs<std::remove_cvref_t<U>, Variant> && kIsUniqueAlternative<std::remove_cvref_t<U>> &&
+        concepts::IsConstructibleWith<std::remove_cvref_t<U>, U &&>
+    )
+    constexpr Variant(U&& value)
+    {
+        construct<kIndexOf<std::remove_cvref_t<U>>>(std::forward<U>(value));
+    }
+
+    /// @brief Constructs the alternative at index I in-place.
+    /// @param[in] args Arguments forwarded to the constructor of the alternative.
+    template <USize I, typename... Args>
+    requires(I < kCount && concepts::IsConstructibleWith<AlternativeType<I>, Args && ...>)
+    constexpr explicit Variant(std::in_place_index_t<I>, Args&&... args)
+    {
+        construct<I>(std::forward<Args>(args)...);
+    }
+
+    /// @brief Constructs the alternative of type T in-place.
+    /// @param[in] args Arguments forwarded to the constructor of T.
+    template <typename T, typename... Args>
+    requires(kIsUniqueAlternative<T> && concepts::IsConstructibleWith<T, Args && ...>)
+    constexpr explicit Variant(std::in_place_type_t<T>, Args&&... args)
+    {
+        construct<kIndexOf<T>>(std::forward<Args>(args)...);
+    }
+
+    /// @brief Trivial copy and move constructors, used when every alternative is trivially copyable.
+    constexpr Variant(const Variant&) requires kIsTrivial = default;
+    constexpr Variant(Variant&&) requires kIsTrivial = default;
+
+    /// @brief Copy-constructs the alternative held by @p other.
+    /// @param[in] other Variant to copy from.
+    constexpr Variant(const Variant& other) requires(!kIsTrivial && (concepts::IsCopyConstructible<Types> && ...))
+    {
+        detail::dispatchSwitch<void, kCount>(
+            other.m_index,
+            [&]<USize I>(std::integral_constant<USize, I>)
+            {
+                construct<I>(other.template getUnchecked<I>());
+            }
+        );
+    }
+
+    /// @brief Move-constructs the alternative held by @p other, which keeps holding a moved-from alternative.
+    /// @param[in] other Variant to move from.
+    constexpr Variant(Variant&& other) noexcept((std::is_nothrow_move_constructible_v<Types> && ...))
+        requires(!kIsTrivial && (concepts::IsMoveConstructible<Types> && ...))
+    {
+        detail::dispatchSwitch<void, kCount>(
+            other.m_index,
+            [&]<USize I>(std::integral_constant<USize, I>)
+            {
+                construct<I>(std::move(other.template getUnchecked<I>()));
+            }
+        );
+    }
+
+    /// @brief Trivial destructor, used when every alternative is trivially destructible.
+    ~Variant() requires kIsTrivial = default;
+
+    /// @brief Destroys the held alternative.
+    ~Variant()
+    {
+        destroy();
+    }
+
+    /// @brief Trivial copy and move assignment operators, used when every alternative is trivially copyable.
+    constexpr Variant& operator=(const Variant&) requires kIsTrivial = default;
+    constexpr Variant& operator=(Variant&&) requires kIsTrivial = default;
+
+    /// @brief Copy-assigns from another variant.
+    /// @details Assigns in place when both hold the same alternative, otherwise destroys and copy-constructs.
+    /// @param[in] other Variant to copy from.
+    /// @return Reference to this variant.
+    constexpr Variant& operator=(const Variant& other) requires(!kIsTrivial && (concepts::IsCopyConstructible<Types> && ...))
+    {
+        if (this != &other)
+        {
+            detail::dispatchSwitch<void, kCount>(
+                other.m_index,
+                [&]<USize I>(std::integral_constant<USize, I>)
+                {
+                    assign<I>(other.template getUnchecked<I>());
+                }
+            );
+        }
+        return *this;
+    }
+
+    /// @brief Move-assigns from another variant.
+    /// @details Assigns in place when both hold the same alternative, otherwise destroys and move-constructs.
+    /// @param[in] other Variant to move from.
+    /// @return Reference to this variant.
+    constexpr Variant& operator=(Variant&& other) noexcept((std::is_nothrow_move_constructible_v<Types> && ...))
+        requires(!kIsTrivial && (concepts::IsMoveConstructible<Types> && ...))
+    {
+        if (this != &other)
+        {
+            detail::dispatchSwitch<void, kCount>(
+                other.m_index,
+                [&]<USize I>(std::integral_constant<USize, I>)
+                {
+                    assign<I>(std::move(other.template getUnchecked<I>()));
+                }
+            );
+        }
+        return *this;
+    }
+
+    /// @brief Assigns a value to the alternative whose type is exactly the decayed type of @p value.
+    /// @param[in] value Value to assign.
+    /// @return Reference to this variant.
+    template <typename U>
+    requires(
+        !concepts::IsSameAs<std::remove_cvref_t<U>, Variant> && kIsUniqueAlternative<std::remove_cvref_t<U>> &&
+        concepts::IsConstructibleWith<std::remove_cvref_t<U>, U &&>
+    )
+    constexpr Variant& operator=(U&& value)
+    {
+        assign<kIndexOf<std::remove_cvref_t<U>>>(std::forward<U>(value));
+        return *this;
+    }
+
+public:
+    /// @brief Destroys the held alternative and constructs the alternative at index I in-place.
+    /// @param[in] args Arguments forwarded to the constructor of the alternative.
+    /// @return Reference to the new alternative.
+    template <USize I, typename... Args>
+    requires(I < kCount && concepts::IsConstructibleWith<AlternativeType<I>, Args && ...>)
+    constexpr AlternativeType<I>& emplace(Args&&... args)
+    {
+        destroy();
+        construct<I>(std::forward<Args>(args)...);
+        return getUnchecked<I>();
+    }
+
+    /// @brief Destroys the held alternative and constructs the alternative of type T in-place.
+    /// @param[in] args Arguments forwarded to the constructor of T.
+    /// @return Reference to the new alternative.
+    template <typename T, typename... Args>
+    requires(kIsUniqueAlternative<T> && concepts::IsConstructibleWith<T, Args && ...>)
+    constexpr T& emplace(Args&&... args)
+    {
+        return emplace<kIndexOf<T>>(std::forward<Args>(args)...);
+    }
+
+    /// @brief Returns the index of the held alternative.
+    [[nodiscard]] constexpr USize index() const noexcept
+    {
+        return m_index;
+    }
+
+    /// @brief Checks whether the held alternative is of type T.
+    template <typename T>
+    requires kIsUniqueAlternative<T>
+    [[nodiscard]] constexpr bool holdsAlternative() const noexcept
+    {
+        return m_index == kIndexOf<T>;
+    }
+
+    /// @brief Accesses the alternative at index I, which must be the held one.
+    /// @tparam I Index of the alternative.
+    /// @return Reference to the alternative.
+    template <USize I>
+    requires(I < kCount)
+    [[nodiscard]] constexpr AlternativeType<I>& get() & noexcept
+    {
+        GP_ASSERT(m_index == I, "Variant does not hold the requested alternative");
+        return getUnchecked<I>();
+    }
+
+    template <USize I>
+    requires(I < kCount)
+    [[nodiscard]] constexpr const AlternativeType<I>& get() const& noexcept
+    {
+        GP_ASSERT(m_index == I, "Variant does not hold the requested alternative");
+        return getUnchecked<I>();
+    }
+
+    template <USize I>
+    requires(I < kCount)
+    [[nodiscard]] constexpr AlternativeType<I>&& get() && noexcept
+    {
+        GP_ASSERT(m_index == I, "Variant does not hold the requested alternative");
+        return std::move(getUnchecked<I>());
+    }
+
+    /// @brief Accesses the alternative of type T, which must be the held one.
+    /// @tparam T Type of the alternative.
+    /// @return Reference to the alternative.
+    template <typename T>
+    requires kIsUniqueAlternative<T>
+    [[nodiscard]] constexpr T& get() & noexcept
+    {
+        return get<kIndexOf<T>>();
+    }
+
+    template <typename T>
+    requires kIsUniqueAlternative<T>
+    [[nodiscard]] constexpr const T& get() const& noexcept
+    {
+        return get<kIndexOf<T>>();
+    }
+
+    template <typename T>
+    requires kIsUniqueAlternative<T>
+    [[nodiscard]] constexpr T&& get() && noexcept
+    {
+        return std::move(*this).template get<kIndexOf<T>>();
+    }
+
+    /// @brief Accesses the alternative of type T if it is the held one.
+    /// @tparam T Type of the alternative.
+    /// @return Pointer to the alternative, or nullptr if another alternative is held.
+    template <typename T>
+    requires kIsUniqueAlternative<T>
+    [[nodiscard]] constexpr T* tryGet() noexcept
+    {
+        return holdsAlternative<T>() ? &getUnchecked<kIndexOf<T>>() : nullptr;
+    }
+
+    template <typename T>
+    requires kIsUniqueAlternative<T>
+    [[nodiscard]] constexpr const T* tryGet() const noexcept
+    {
+        return holdsAlternative<T>() ? &getUnchecked<kIndexOf<T>>() : nullptr;
+    }
+
+public:
+    /// @brief Compares two variants.
+    /// @param[in] other Variant to compare with.
+    /// @return True if both hold the same alternative and the alternatives compare equal.
+    [[nodiscard]] constexpr bool operator==(const Variant& other) const
+        requires(concepts::IsEqualityComparable<Types> && ...)
+    {
+        if (m_index != other.m_index)
+        {
+            return false;
+        }
+        return detail::dispatchSwitch<bool, kCount>(
+            m_index,
+            [&]<USize I>(std::integral_constant<USize, I>)
+            {
+                return getUnchecked<I>() == other.template getUnchecked<I>();
+            }
+        );
+    }
+
+private:
+    template <USize I>
+    [[nodiscard]] constexpr AlternativeType<I>& getUnchecked() & noexcept
+    {
+        return *std::launder(reinterpret_cast<AlternativeType<I>*>(m_storage));
+    }
+
+    template <USize I>
+    [[nodiscard]] constexpr const AlternativeType<I>& getUnchecked() const& noexcept
+    {
+        return *std::launder(reinterpret_cast<const AlternativeType<I>*>(m_storage));
+    }
+
+    template <USize I>
+    [[nodiscard]] constexpr AlternativeType<I>&& getUnchecked() && noexcept
+    {
+        return std::move(getUnchecked<I>());
+    }
+
+    template <USize I, typename... Args>
+    constexpr void construct(Args&&... args)
+    {
+        ::new (static_cast<void*>(m_storage)) AlternativeType<I>(std::forward<Args>(args)...);
+        m_index = static_cast<IndexType>(I);
+    }
+
+    template <USize I, typename U>
+    constexpr void assign(U&& value)
+    {
+        if (m_index == I)
+        {
+            getUnchecked<I>() = std::forward<U>(value);
+        }
+        else
+        {
+            destroy();
+            construct<I>(std::forward<U>(value));
+        }
+    }
+
+    constexpr void destroy() noexcept
+    {
+        if constexpr (!(concepts::IsTriviallyDestructible<Types> && ...))
+        {
+            detail::dispatchSwitch<void, kCount>(
+                m_index,
+                [&]<USize I>(std::integral_constant<USize, I>)
+                {
+                    std::destroy_at(&getUnchecked<I>());
+                }
+            );
+        }
+    }
+
+    template <typename F, typename... Variants>
+    friend constexpr decltype(auto) visit(F&& func, Variants&&... variants);
+};
+
+namespace detail
+{
+
+/// @brief Compile-time layout of the flattened index used to visit several variants with a single switch.
+/// @details The flat index is the row-major position of the held alternatives: ((i0 * n1) + i1) * n2 + i2...
+template <typename... Variants>
+struct VisitLayout
+{
+public:
+    static constexpr USize kSizes[] = { std::remove_cvref_t<Variants>::kCount... };
+    static constexpr USize kCount = (USize{ 1 } * ... * std::remove_cvref_t<Variants>::kCount);
+
+    /// @brief Extracts the alternative index of the K-th variant from a flat index.
+    template <USize Flat, USize K>
+    static constexpr USize kIndexAt = []()
+    {
+        USize stride = 1;
+        for (USize i = K + 1; i < sizeof...(Variants); ++i)
+        {
+            stride *= kSizes[i];
+        }
+        return (Flat / stride) % kSizes[K];
+    }();
+};
+
+}   // namespace detail
+
+/// @brief Invokes @p func with the alternatives held by @p variants.
+/// @details
+/// Dispatch goes through a switch over the flattened alternative indices, which compilers turn into a jump table with
+/// inlined case bodies. @p func must return the same type for every combination of alternatives; the return type is
+/// taken from the combination of first alternatives.
+/// @param[in] func Callable accepting every combination of alternatives.
+/// @param[in] variants Variants whose held alternatives are forwarded to @p func.
+/// @return The value returned by @p func.
+template <typename F, typename... Variants>
+constexpr decltype(auto) visit(F&& func, Variants&&... variants)
+{
+    using Layout = detail::VisitLayout<Variants...>;
+    using R = std::invoke_result_t<F, decltype(std::forward<Variants>(variants).template getUnchecked<0>())...>;
+
+    USize flat = 0;
+    ((flat = flat * std::remove_cvref_t<Variants>::kCount + variants.index()), ...);
+
+    return detail::dispatchSwitch<R, Layout::kCount>(
+        flat,
+        [&]<USize Flat>(std::integral_constant<USize, Flat>) -> R
+        {
+            return [&]<USize... Ks>(std::index_sequence<Ks...>) -> R
+            {
+                return std::invoke(
+                    std::forward<F>(func),
+                    std::forward<Variants>(variants).template getUnchecked<Layout::template kIndexAt<Flat, Ks>>()...
+                );
+            }(std::index_sequence_for<Variants...>{});
+        }
+    );
+}
 
 }   // namespace gp
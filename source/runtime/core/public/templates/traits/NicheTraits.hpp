@@ -0,0 +1,138 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "memory/Memory.hpp"
+#include <type_traits>
+
+/// @brief Declares a niche for the specified enum type: a value of its underlying type that no enumerator uses.
+/// @param[in] enumType The enum type for which to declare a niche.
+/// @param[in] nicheValue The unused value, expressed in the underlying type of the enum.
+/// @attention The value must never be stored in a variable of the enum type, otherwise an engaged Optional holding it
+///            would read as empty.
+/// @example
+/// @code
+/// enum class TextureFormat : UInt8
+/// {
+///     RGBA8,
+///     BC7
+/// };
+/// GP_ENABLE_ENUM_NICHE(TextureFormat, 0xFF);
+///
+/// static_assert(sizeof(Optional<TextureFormat>) == sizeof(TextureFormat));
+/// @endcode
+#define GP_ENABLE_ENUM_NICHE(enumType, nicheValue) \
+    template <> \
+    struct gp::trait::NicheTraits<enumType> : ::gp::trait::detail::EnumNicheTraits<enumType, nicheValue> {}
+
+namespace gp::trait
+{
+
+/// @brief Describes a niche of T: a bit pattern that no valid T ever holds.
+/// @details
+/// Optional and Expected use the niche to encode their empty or error state inside the storage of T itself instead of
+/// in a separate flag, which keeps them as small as T and lets them be returned in registers. A specialization sets
+/// kHasNiche to true and provides:
+/// - NicheType, a trivially copyable integer type holding the niche.
+/// - kNicheOffset, the byte offset of the niche inside T.
+/// - kNicheValue, the niche itself.
+/// The bytes of T outside of [kNicheOffset, kNicheOffset + sizeof(NicheType)) are free while the niche is set.
+/// @note The primary template declares no niche.
+/// @tparam T The type for which to describe the niche.
+template <typename T>
+struct NicheTraits
+{
+public:
+    static constexpr bool kHasNiche = false;
+};
+
+/// @brief Specialization for object pointers, which are never equal to 1.
+/// @tparam T The type pointed to by the pointer.
+template <typename T>
+requires concepts::IsObject<T>
+struct NicheTraits<T*>
+{
+public:
+    using NicheType = UIntPtr;
+
+    static constexpr bool kHasNiche = true;
+    static constexpr USize kNicheOffset = 0;
+    static constexpr NicheType kNicheValue = 1;
+};
+
+/// @brief Specialization for bool, which only ever holds 0 or 1.
+template <>
+struct NicheTraits<bool>
+{
+public:
+    using NicheType = UInt8;
+
+    static constexpr bool kHasNiche = true;
+    static constexpr USize kNicheOffset = 0;
+    static constexpr NicheType kNicheValue = 2;
+};
+
+namespace detail
+{
+
+/// @brief Niche of an enum type declared with GP_ENABLE_ENUM_NICHE.
+/// @tparam E The enum type.
+/// @tparam NicheValue The unused value, in the underlying type of the enum.
+template <concepts::IsEnum E, std::underlying_type_t<E> NicheValue>
+struct EnumNicheTraits
+{
+public:
+    using NicheType = std::underlying_type_t<E>;
+
+    static constexpr bool kHasNiche = true;
+    static constexpr USize kNicheOffset = 0;
+    static constexpr NicheType kNicheValue = NicheValue;
+};
+
+}   // namespace detail
+
+}   // namespace gp::trait
+
+namespace gp::concepts
+{
+
+/// @brief Concept to check if a type declares a niche through NicheTraits.
+/// @note Only trivially destructible types qualify: the niche is written over the storage of a destroyed T, and no
+/// destructor ever runs on it.
+template <typename T>
+concept HasNiche = trait::NicheTraits<T>::kHasNiche && concepts::IsTriviallyDestructible<T> &&
+                   (trait::NicheTraits<T>::kNicheOffset + sizeof(typename trait::NicheTraits<T>::NicheType) <=
+                    sizeof(T));
+
+}   // namespace gp::concepts
+
+namespace gp::trait
+{
+
+/// @brief Writes the niche of T into @p storage, which must be at least sizeof(T) bytes and hold no live T.
+/// @tparam T The type whose niche to write.
+/// @param[out] storage The storage of T.
+template <concepts::HasNiche T>
+inline void writeNiche(void* storage) noexcept
+{
+    constexpr typename NicheTraits<T>::NicheType kValue = NicheTraits<T>::kNicheValue;
+    memory::copyMemory(static_cast<Byte*>(storage) + NicheTraits<T>::kNicheOffset, &kValue, sizeof(kValue));
+}
+
+/// @brief Checks whether @p storage holds the niche of T rather than a valid T.
+/// @tparam T The type whose niche to check.
+/// @param[in] storage The storage of T.
+/// @return True if the niche is set.
+template <concepts::HasNiche T>
+[[nodiscard]] inline bool isNiche(const void* storage) noexcept
+{
+    typename NicheTraits<T>::NicheType value;
+    memory::copyMemory(&value, static_cast<const Byte*>(storage) + NicheTraits<T>::kNicheOffset, sizeof(value));
+    return value == NicheTraits<T>::kNicheValue;
+}
+
+}   // namespace gp::trait
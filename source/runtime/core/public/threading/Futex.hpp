@@ -0,0 +1,43 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include <atomic>
+
+namespace gp
+{
+
+/// @brief Parks threads on the value of a 32-bit word, the building block of the blocking synchronisation primitives.
+/// @details
+/// Maps to futex() on Linux, WaitOnAddress() on Windows, and to std::atomic waits elsewhere. Threads only enter the
+/// kernel when they actually have to sleep: the uncontended paths of the primitives built on top stay in user space.
+class Futex
+{
+private:
+    /// @brief Deleted constructor prevent instantiation of the Futex class, as it is intended to be used.
+    Futex() = delete;
+
+    /// @brief Deleted destructor prevent instantiation of the Futex class, as it is intended to be used.
+    ~Futex() = delete;
+
+public:
+    /// @brief Sleeps until @p word is woken, if it still holds @p expectedValue.
+    /// @details The comparison and the sleep are atomic with respect to wake calls. Wakeups may be spurious: callers
+    /// re-check their condition in a loop.
+    /// @param[in] word Word to wait on.
+    /// @param[in] expectedValue Value the word must hold for the thread to sleep.
+    static void wait(std::atomic<UInt32>& word, UInt32 expectedValue) noexcept;
+
+    /// @brief Wakes at most one thread waiting on @p word.
+    /// @param[in] word Word the threads wait on.
+    static void wakeOne(std::atomic<UInt32>& word) noexcept;
+
+    /// @brief Wakes every thread waiting on @p word.
+    /// @param[in] word Word the threads wait on.
+    static void wakeAll(std::atomic<UInt32>& word) noexcept;
+};
+
+}   // namespace gp
@@ -0,0 +1,71 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include <atomic>
+
+namespace gp
+{
+
+/// @brief Event that stays signaled until it is reset, releasing every waiter at once.
+/// @details
+/// The event word holds a signaled flag, a flag telling that threads may be asleep on it, and a generation bumped by
+/// every set(): a waiter returns once the event is signaled or its generation changed, so a set() immediately followed
+/// by a reset() still releases every thread that was waiting. Setting an event nobody waits for, and waiting for an
+/// event already set, are single atomic operations.
+class ManualResetEvent
+{
+private:
+    static constexpr UInt32 kSetFlag = 1u << 0;
+    static constexpr UInt32 kWaitersFlag = 1u << 1;
+    static constexpr UInt32 kGenerationStep = 1u << 2;
+
+private:
+    std::atomic<UInt32> m_state;
+
+public:
+    /// @brief Constructs an event.
+    /// @param[in] isSet Whether the event starts signaled.
+    explicit ManualResetEvent(bool isSet = false) noexcept
+        : m_state(isSet ? kSetFlag : 0)
+    {}
+
+    ManualResetEvent(const ManualResetEvent&) = delete;
+    ManualResetEvent& operator=(const ManualResetEvent&) = delete;
+    ManualResetEvent(ManualResetEvent&&) = delete;
+    ManualResetEvent& operator=(ManualResetEvent&&) = delete;
+
+public:
+    /// @brief Signals the event, releasing the threads waiting for it and the ones to come until reset().
+    void set() noexcept;
+
+    /// @brief Returns the event to the non-signaled state. Threads already released are not affected.
+    void reset() noexcept
+    {
+        m_state.fetch_and(~kSetFlag, std::memory_order_relaxed);
+    }
+
+    /// @brief Waits until the event is signaled.
+    void wait() noexcept
+    {
+        const UInt32 state = m_state.load(std::memory_order_acquire);
+        if ((state & kSetFlag) == 0)
+        {
+            waitContended(state);
+        }
+    }
+
+    /// @brief Checks whether the event is signaled.
+    [[nodiscard]] bool isSet() const noexcept
+    {
+        return (m_state.load(std::memory_order_acquire) & kSetFlag) != 0;
+    }
+
+private:
+    void waitContended(UInt32 state) noexcept;
+};
+
+}   // namespace gp
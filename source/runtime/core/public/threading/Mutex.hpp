@@ -0,0 +1,80 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include <atomic>
+
+namespace gp
+{
+
+/// @brief Adaptive mutex: spins briefly when contended, then parks the thread on a futex.
+/// @details
+/// The lock word is 0 when free, 1 when held, and 2 when held with threads possibly asleep on it. Locking and
+/// unlocking an uncontended mutex costs a single atomic operation and never enters the kernel, and unlock() only
+/// issues a wake system call when a thread may be sleeping.
+/// A contended lock() first spins, trying to grab the mutex as soon as it is released, then sleeps. Each mutex tracks
+/// how long its successful spins took on average and bounds the next spins to about twice that, up to kMaxSpinCount.
+/// Spins that end up sleeping pull the average towards zero: a mutex held for short sections keeps spinning, one held
+/// for long sections quickly goes to sleep.
+/// lock(), unlock() and try_lock() follow the standard Lockable naming: the mutex works with std::scoped_lock and
+/// GP_LOCKABLE.
+class Mutex
+{
+public:
+    static constexpr UInt32 kMaxSpinCount = 200;
+
+private:
+    std::atomic<UInt32> m_state{ 0 };
+    std::atomic<UInt32> m_spinEstimate{ 0 };   //<! Moving average of the spins the contended acquisitions took.
+
+public:
+    Mutex() noexcept = default;
+
+    Mutex(const Mutex&) = delete;
+    Mutex& operator=(const Mutex&) = delete;
+    Mutex(Mutex&&) = delete;
+    Mutex& operator=(Mutex&&) = delete;
+
+public:
+    /// @brief Acquires the mutex, waiting until it is free.
+    void lock() noexcept
+    {
+        UInt32 expected = 0;
+        if (!m_state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            lockContended();
+        }
+    }
+
+    /// @brief Acquires the mutex if it is free.
+    /// @return Whether the mutex was acquired.
+    [[nodiscard]] bool try_lock() noexcept
+    {
+        UInt32 expected = 0;
+        return m_state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    /// @brief Releases the mutex, which must be held by the calling thread.
+    void unlock() noexcept
+    {
+        if (m_state.exchange(0, std::memory_order_release) == 2)
+        {
+            wakeWaiter();
+        }
+    }
+
+    /// @brief Returns the moving average of the spins the contended acquisitions took, which bounds the next spins.
+    [[nodiscard]] UInt32 getSpinEstimate() const noexcept
+    {
+        return m_spinEstimate.load(std::memory_order_relaxed);
+    }
+
+private:
+    void lockContended() noexcept;
+    void wakeWaiter() noexcept;
+};
+
+}   // namespace gp
@@ -0,0 +1,78 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include <atomic>
+
+namespace gp
+{
+
+/// @brief Counting semaphore.
+/// @details
+/// The count of available units lives in its own word, and a separate counter tracks the threads that went to sleep:
+/// release() only wakes threads when some may be asleep, and acquire() only sleeps after spinning kMaxSpinCount times
+/// without finding a unit.
+class Semaphore
+{
+public:
+    static constexpr UInt32 kMaxSpinCount = 100;
+
+private:
+    std::atomic<UInt32> m_count;
+    std::atomic<UInt32> m_waiterCount{ 0 };
+
+public:
+    /// @brief Constructs a semaphore.
+    /// @param[in] initialCount Number of units available.
+    explicit Semaphore(UInt32 initialCount = 0) noexcept
+        : m_count(initialCount)
+    {}
+
+    Semaphore(const Semaphore&) = delete;
+    Semaphore& operator=(const Semaphore&) = delete;
+    Semaphore(Semaphore&&) = delete;
+    Semaphore& operator=(Semaphore&&) = delete;
+
+public:
+    /// @brief Takes a unit, waiting until one is available.
+    void acquire() noexcept
+    {
+        if (!tryAcquire())
+        {
+            acquireContended();
+        }
+    }
+
+    /// @brief Takes a unit if one is available.
+    /// @return Whether a unit was taken.
+    [[nodiscard]] bool tryAcquire() noexcept
+    {
+        UInt32 count = m_count.load(std::memory_order_relaxed);
+        while (count != 0)
+        {
+            if (m_count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Makes units available, waking as many waiting threads.
+    /// @param[in] count Number of units to add.
+    void release(UInt32 count = 1) noexcept;
+
+    /// @brief Returns the number of units currently available.
+    [[nodiscard]] UInt32 getCount() const noexcept
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    void acquireContended() noexcept;
+};
+
+}   // namespace gp
@@ -0,0 +1,86 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include "threading/Mutex.hpp"
+#include <atomic>
+
+namespace gp
+{
+
+/// @brief Reader-writer lock giving precedence to writers.
+/// @details
+/// Readers register in a single word holding their count and two flags. A writer first takes an internal Mutex, which
+/// queues writers among themselves, then raises the writer flag: from then on new readers wait, and the writer only
+/// waits for the readers already inside to leave. A steady stream of readers therefore cannot starve writers.
+/// Readers and writers spin briefly before sleeping on the word, and wakes are only issued when a flag says that a
+/// thread may be asleep.
+/// The member functions follow the standard SharedLockable naming: the lock works with std::scoped_lock,
+/// std::shared_lock and GP_SHARED_LOCKABLE.
+class SharedMutex
+{
+public:
+    static constexpr UInt32 kMaxSpinCount = 100;
+
+private:
+    static constexpr UInt32 kWriterFlag = 1u << 31;          //<! A writer holds or waits for the lock.
+    static constexpr UInt32 kReadersWaitingFlag = 1u << 30;   //<! Readers may be asleep until the writer leaves.
+    static constexpr UInt32 kReaderMask = kReadersWaitingFlag - 1;
+
+private:
+    std::atomic<UInt32> m_state{ 0 };
+    Mutex m_writerMutex;
+
+public:
+    SharedMutex() noexcept = default;
+
+    SharedMutex(const SharedMutex&) = delete;
+    SharedMutex& operator=(const SharedMutex&) = delete;
+    SharedMutex(SharedMutex&&) = delete;
+    SharedMutex& operator=(SharedMutex&&) = delete;
+
+public:
+    /// @brief Acquires the lock exclusively, waiting for the current readers to leave.
+    void lock() noexcept;
+
+    /// @brief Acquires the lock exclusively if no thread holds it.
+    /// @return Whether the lock was acquired.
+    [[nodiscard]] bool try_lock() noexcept;
+
+    /// @brief Releases the exclusive lock, which must be held by the calling thread.
+    void unlock() noexcept;
+
+    /// @brief Acquires the lock in shared mode, waiting while a writer holds or waits for it.
+    void lock_shared() noexcept
+    {
+        UInt32 state = m_state.load(std::memory_order_relaxed);
+        if ((state & kWriterFlag) != 0 ||
+            !m_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            lockSharedContended();
+        }
+    }
+
+    /// @brief Acquires the lock in shared mode if no writer holds or waits for it.
+    /// @return Whether the lock was acquired.
+    [[nodiscard]] bool try_lock_shared() noexcept;
+
+    /// @brief Releases the shared lock, which must be held by the calling thread.
+    void unlock_shared() noexcept
+    {
+        const UInt32 state = m_state.fetch_sub(1, std::memory_order_release);
+        if ((state & kReaderMask) == 1 && (state & kWriterFlag) != 0)
+        {
+            wakeWriter();
+        }
+    }
+
+private:
+    void lockSharedContended() noexcept;
+    void wakeWriter() noexcept;
+};
+
+}   // namespace gp
@@ -0,0 +1,86 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include <atomic>
+#include <thread>
+
+namespace gp
+{
+
+/// @brief Lock that never sleeps, for critical sections of a few dozen instructions.
+/// @details
+/// Waiters spin on a plain load, so the cache line stays shared until the lock is released, and back off
+/// exponentially with CPU pause instructions between attempts. Past kMaxSpinCount pauses, they yield their time slice
+/// so a preempted owner gets a chance to run.
+/// lock(), unlock() and try_lock() follow the standard Lockable naming: the lock works with std::scoped_lock and
+/// GP_LOCKABLE.
+class SpinLock
+{
+public:
+    static constexpr UInt32 kMaxBackoff = 64;
+    static constexpr UInt32 kMaxSpinCount = 1024;
+
+private:
+    std::atomic<bool> m_isLocked{ false };
+
+public:
+    SpinLock() noexcept = default;
+
+    SpinLock(const SpinLock&) = delete;
+    SpinLock& operator=(const SpinLock&) = delete;
+    SpinLock(SpinLock&&) = delete;
+    SpinLock& operator=(SpinLock&&) = delete;
+
+public:
+    /// @brief Acquires the lock, spinning until it is free.
+    void lock() noexcept
+    {
+        UInt32 backoff = 1;
+        UInt32 spinCount = 0;
+        while (m_isLocked.exchange(true, std::memory_order_acquire))
+        {
+            do
+            {
+                if (spinCount < kMaxSpinCount)
+                {
+                    for (UInt32 index = 0; index < backoff; ++index)
+                    {
+                        GP_PLATFORM_CPU_PAUSE();
+                    }
+                    spinCount += backoff;
+                    backoff = backoff < kMaxBackoff ? backoff * 2 : kMaxBackoff;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            while (m_isLocked.load(std::memory_order_relaxed));
+        }
+    }
+
+    /// @brief Acquires the lock if it is free.
+    /// @return Whether the lock was acquired.
+    [[nodiscard]] bool try_lock() noexcept
+    {
+        return !m_isLocked.load(std::memory_order_relaxed) && !m_isLocked.exchange(true, std::memory_order_acquire);
+    }
+
+    /// @brief Releases the lock, which must be held by the calling thread.
+    void unlock() noexcept
+    {
+        m_isLocked.store(false, std::memory_order_release);
+    }
+
+    /// @brief Checks whether the lock is held by any thread.
+    [[nodiscard]] bool isLocked() const noexcept
+    {
+        return m_isLocked.load(std::memory_order_relaxed);
+    }
+};
+
+}   // namespace gp
@@ -0,0 +1,158 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/arrays/BitArray.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace gp::tests
+{
+
+TEST(BitArrayTest, StartsEmpty)
+{
+    BitArray<> bits;
+    EXPECT_TRUE(bits.isEmpty());
+    EXPECT_EQ(bits.popCount(), 0u);
+    EXPECT_EQ(bits.findFirstSet(), BitArray<>::npos);
+    EXPECT_EQ(bits.setBits().begin(), bits.setBits().end());
+}
+
+TEST(BitArrayTest, SetResetFlip)
+{
+    BitArray<> bits(130);
+    EXPECT_EQ(bits.size(), 130u);
+    EXPECT_EQ(bits.wordCount(), 3u);
+    EXPECT_TRUE(bits.none());
+
+    bits.set(0);
+    bits.set(64);
+    bits.set(129);
+    EXPECT_TRUE(bits[0]);
+    EXPECT_TRUE(bits.test(64));
+    EXPECT_TRUE(bits[129]);
+    EXPECT_FALSE(bits[1]);
+    EXPECT_EQ(bits.popCount(), 3u);
+
+    bits.reset(64);
+    bits.flip(1);
+    bits.assign(2, true);
+    bits.assign(0, false);
+    EXPECT_FALSE(bits[64]);
+    EXPECT_TRUE(bits[1]);
+    EXPECT_TRUE(bits[2]);
+    EXPECT_FALSE(bits[0]);
+    EXPECT_EQ(bits.popCount(), 3u);
+}
+
+TEST(BitArrayTest, SetAllKeepsTailCleared)
+{
+    BitArray<> bits(70);
+    bits.setAll();
+    EXPECT_EQ(bits.popCount(), 70u);
+    EXPECT_TRUE(bits.all());
+    EXPECT_EQ(bits.data()[1], (UInt64{ 1 } << 6) - 1);
+
+    bits.flipAll();
+    EXPECT_TRUE(bits.none());
+    bits.flipAll();
+    EXPECT_EQ(bits.popCount(), 70u);
+}
+
+TEST(BitArrayTest, ResizeFillsNewBits)
+{
+    BitArray<> bits(10, true);
+    bits.resize(100, false);
+    EXPECT_EQ(bits.popCount(), 10u);
+    bits.resize(200, true);
+    EXPECT_EQ(bits.popCount(), 110u);
+    EXPECT_FALSE(bits[50]);
+    EXPECT_TRUE(bits[150]);
+    bits.resize(5);
+    EXPECT_EQ(bits.popCount(), 5u);
+    bits.resize(64);
+    EXPECT_EQ(bits.popCount(), 5u);
+}
+
+TEST(BitArrayTest, BulkOperators)
+{
+    BitArray<> a(300);
+    BitArray<> b(300);
+    for (USize i = 0; i < 300; i += 2)
+    {
+        a.set(i);
+    }
+    for (USize i = 0; i < 300; i += 3)
+    {
+        b.set(i);
+    }
+
+    const BitArray<> both = a & b;
+    const BitArray<> either = a | b;
+    const BitArray<> exclusive = a ^ b;
+    BitArray<> onlyA = a;
+    onlyA.andNot(b);
+
+    for (USize i = 0; i < 300; ++i)
+    {
+        const bool inA = i % 2 == 0;
+        const bool inB = i % 3 == 0;
+        EXPECT_EQ(both[i], inA && inB);
+        EXPECT_EQ(either[i], inA || inB);
+        EXPECT_EQ(exclusive[i], inA != inB);
+        EXPECT_EQ(onlyA[i], inA && !inB);
+    }
+    EXPECT_EQ(both.popCount(), 50u);
+    EXPECT_EQ(either.popCount(), 200u);
+}
+
+TEST(BitArrayTest, FindFirst)
+{
+    BitArray<> bits(200);
+    bits.set(3);
+    bits.set(150);
+    EXPECT_EQ(bits.findFirstSet(), 3u);
+    EXPECT_EQ(bits.findFirstSet(4), 150u);
+    EXPECT_EQ(bits.findFirstSet(151), BitArray<>::npos);
+
+    bits.setAll();
+    EXPECT_EQ(bits.findFirstUnset(), BitArray<>::npos);
+    bits.reset(130);
+    EXPECT_EQ(bits.findFirstUnset(), 130u);
+    EXPECT_EQ(bits.findFirstUnset(131), BitArray<>::npos);
+}
+
+TEST(BitArrayTest, SetBitIteration)
+{
+    BitArray<> bits(1000);
+    const std::vector<USize> expected = { 0, 1, 63, 64, 200, 511, 999 };
+    for (const USize index : expected)
+    {
+        bits.set(index);
+    }
+
+    std::vector<USize> visited;
+    for (const USize index : bits.setBits())
+    {
+        visited.push_back(index);
+    }
+    EXPECT_EQ(visited, expected);
+
+    visited.clear();
+    bits.forEachSetBit([&visited](USize index) { visited.push_back(index); });
+    EXPECT_EQ(visited, expected);
+}
+
+TEST(BitArrayTest, CopyAndMove)
+{
+    BitArray<> bits(100);
+    bits.set(42);
+    BitArray<> copy = bits;
+    EXPECT_EQ(copy, bits);
+
+    BitArray<> moved = std::move(copy);
+    EXPECT_TRUE(moved[42]);
+    EXPECT_TRUE(copy.isEmpty());
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,141 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/arrays/ChunkedArray.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace gp::tests
+{
+
+TEST(ChunkedArrayTest, StartsEmpty)
+{
+    ChunkedArray<int, 8> array;
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(array.capacity(), 0u);
+    EXPECT_EQ(array.chunkCount(), 0u);
+    EXPECT_EQ(array.begin(), array.end());
+}
+
+TEST(ChunkedArrayTest, GrowsByChunks)
+{
+    ChunkedArray<int, 8> array;
+    for (int i = 0; i < 20; ++i)
+    {
+        array.pushBack(i);
+    }
+    EXPECT_EQ(array.size(), 20u);
+    EXPECT_EQ(array.capacity(), 24u);
+    EXPECT_EQ(array.chunkCount(), 3u);
+    for (int i = 0; i < 20; ++i)
+    {
+        EXPECT_EQ(array[static_cast<USize>(i)], i);
+    }
+    EXPECT_EQ(array.front(), 0);
+    EXPECT_EQ(array.back(), 19);
+}
+
+TEST(ChunkedArrayTest, AddressesAreStable)
+{
+    ChunkedArray<int, 4> array;
+    std::vector<int*> addresses;
+    for (int i = 0; i < 1000; ++i)
+    {
+        addresses.push_back(&array.emplaceBack(i));
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(&array[static_cast<USize>(i)], addresses[static_cast<USize>(i)]);
+        EXPECT_EQ(*addresses[static_cast<USize>(i)], i);
+    }
+}
+
+TEST(ChunkedArrayTest, ChunkViews)
+{
+    ChunkedArray<int, 16> array;
+    for (int i = 0; i < 40; ++i)
+    {
+        array.pushBack(i);
+    }
+
+    EXPECT_EQ(array.chunk(0).size(), 16);
+    EXPECT_EQ(array.chunk(2).size(), 8);
+    EXPECT_EQ(array.chunk(2).front(), 32);
+
+    int sum = 0;
+    USize visited = 0;
+    array.forEachChunk(
+        [&](VectorView<int> chunk, USize firstIndex)
+    {
+        EXPECT_EQ(chunk.front(), static_cast<int>(firstIndex));
+        sum = std::accumulate(chunk.begin(), chunk.end(), sum);
+        ++visited;
+    }
+    );
+    EXPECT_EQ(visited, 3u);
+    EXPECT_EQ(sum, 780);
+}
+
+TEST(ChunkedArrayTest, PopBackClearAndShrink)
+{
+    ChunkedArray<int, 4> array;
+    for (int i = 0; i < 10; ++i)
+    {
+        array.pushBack(i);
+    }
+    array.popBack();
+    EXPECT_EQ(array.size(), 9u);
+    EXPECT_EQ(array.back(), 8);
+
+    array.clear();
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(array.capacity(), 12u);
+
+    array.pushBack(1);
+    array.shrinkToFit();
+    EXPECT_EQ(array.capacity(), 4u);
+    EXPECT_EQ(array[0], 1);
+}
+
+TEST(ChunkedArrayTest, IteratorsWorkWithAlgorithms)
+{
+    ChunkedArray<int, 4> array;
+    for (int i = 9; i >= 0; --i)
+    {
+        array.pushBack(i);
+    }
+    std::sort(array.begin(), array.end());
+    EXPECT_TRUE(std::is_sorted(array.begin(), array.end()));
+    EXPECT_EQ(array.end() - array.begin(), 10);
+
+    const auto& constArray = array;
+    EXPECT_EQ(std::accumulate(constArray.begin(), constArray.end(), 0), 45);
+}
+
+TEST(ChunkedArrayTest, CopyMoveAndDestroy)
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        ChunkedArray<std::shared_ptr<int>, 4> array;
+        for (int i = 0; i < 10; ++i)
+        {
+            array.pushBack(tracker);
+        }
+        const std::shared_ptr<int>* first = &array[0];
+
+        ChunkedArray<std::shared_ptr<int>, 4> copy = array;
+        EXPECT_EQ(tracker.use_count(), 21);
+
+        ChunkedArray<std::shared_ptr<int>, 4> moved = std::move(array);
+        EXPECT_TRUE(array.isEmpty());
+        EXPECT_EQ(&moved[0], first);
+        EXPECT_EQ(tracker.use_count(), 21);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+}   // namespace gp::tests
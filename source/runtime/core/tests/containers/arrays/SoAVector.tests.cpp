@@ -0,0 +1,172 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/arrays/SoAVector.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+namespace gp::tests
+{
+
+TEST(SoAVectorTest, StartsEmpty)
+{
+    SoAVector<float, int> soa;
+    EXPECT_TRUE(soa.isEmpty());
+    EXPECT_EQ(soa.begin(), soa.end());
+    EXPECT_TRUE(soa.field<0>().isEmpty());
+}
+
+TEST(SoAVectorTest, PushBackAndAccess)
+{
+    SoAVector<float, int, std::string> soa;
+    EXPECT_EQ(soa.pushBack(1.0f, 10, "a"), 0);
+    EXPECT_EQ(soa.pushBack(2.0f, 20, "b"), 1);
+    EXPECT_EQ(soa.size(), 2);
+
+    EXPECT_FLOAT_EQ(soa.get<0>(1), 2.0f);
+    EXPECT_EQ(soa.get<1>(0), 10);
+    EXPECT_EQ(soa.get<2>(1), "b");
+
+    auto [f, i, s] = soa[0];
+    i = 11;
+    EXPECT_EQ(soa.get<1>(0), 11);
+    EXPECT_EQ(s, "a");
+    EXPECT_FLOAT_EQ(f, 1.0f);
+}
+
+TEST(SoAVectorTest, PushBackOwnElementWhileGrowing)
+{
+    // The values reference the storage that growing releases: the new element must be built before that.
+    SoAVector<int, std::string> soa;
+    soa.pushBack(1, std::string(64, 'x'));
+    while (soa.size() < soa.capacity())
+    {
+        soa.pushBack(soa.get<0>(0), soa.get<1>(0));
+    }
+    const auto capacity = soa.capacity();
+    soa.pushBack(soa.get<0>(0), soa.get<1>(0));
+
+    EXPECT_GT(soa.capacity(), capacity);
+    for (auto index = 0; index < soa.size(); ++index)
+    {
+        EXPECT_EQ(soa.get<0>(index), 1);
+        EXPECT_EQ(soa.get<1>(index), std::string(64, 'x'));
+    }
+}
+
+TEST(SoAVectorTest, FieldsAreAlignedAndContiguous)
+{
+    using Layout = SoAVector<float, double, UInt8>;
+    Layout soa;
+    for (int i = 0; i < 100; ++i)
+    {
+        soa.pushBack(static_cast<float>(i), static_cast<double>(i) * 2.0, static_cast<UInt8>(i));
+    }
+
+    const auto xs = soa.field<0>();
+    const auto ys = soa.field<1>();
+    const auto zs = soa.field<2>();
+    EXPECT_EQ(xs.size(), 100);
+    EXPECT_EQ(reinterpret_cast<UIntPtr>(xs.data()) % Layout::kArrayAlignment, 0u);
+    EXPECT_EQ(reinterpret_cast<UIntPtr>(ys.data()) % Layout::kArrayAlignment, 0u);
+    EXPECT_EQ(reinterpret_cast<UIntPtr>(zs.data()) % Layout::kArrayAlignment, 0u);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_FLOAT_EQ(xs[i], static_cast<float>(i));
+        EXPECT_DOUBLE_EQ(ys[i], static_cast<double>(i) * 2.0);
+        EXPECT_EQ(zs[i], static_cast<UInt8>(i));
+    }
+}
+
+TEST(SoAVectorTest, ZipIteration)
+{
+    SoAVector<float, float> soa;
+    soa.pushBack(1.0f, 2.0f);
+    soa.pushBack(3.0f, 4.0f);
+
+    for (auto [a, b] : soa)
+    {
+        a += b;
+    }
+    EXPECT_FLOAT_EQ(soa.get<0>(0), 3.0f);
+    EXPECT_FLOAT_EQ(soa.get<0>(1), 7.0f);
+
+    const auto& constSoa = soa;
+    float sum = 0.0f;
+    for (const auto [a, b] : constSoa)
+    {
+        sum += a + b;
+    }
+    EXPECT_FLOAT_EQ(sum, 16.0f);
+    EXPECT_EQ(soa.end() - soa.begin(), 2);
+}
+
+TEST(SoAVectorTest, RemoveAtSwapAndPopBack)
+{
+    SoAVector<int, std::string> soa;
+    soa.pushBack(0, "zero");
+    soa.pushBack(1, "one");
+    soa.pushBack(2, "two");
+
+    soa.removeAtSwap(0);
+    EXPECT_EQ(soa.size(), 2);
+    EXPECT_EQ(soa.get<0>(0), 2);
+    EXPECT_EQ(soa.get<1>(0), "two");
+
+    soa.popBack();
+    EXPECT_EQ(soa.size(), 1);
+    EXPECT_EQ(soa.get<1>(0), "two");
+}
+
+TEST(SoAVectorTest, ResizeAndReserve)
+{
+    SoAVector<int, float> soa;
+    soa.reserve(100);
+    EXPECT_GE(soa.capacity(), 100);
+    soa.resize(10);
+    EXPECT_EQ(soa.size(), 10);
+    EXPECT_EQ(soa.get<0>(9), 0);
+    soa.resize(3);
+    EXPECT_EQ(soa.size(), 3);
+    soa.clear();
+    EXPECT_TRUE(soa.isEmpty());
+}
+
+TEST(SoAVectorTest, CopyMoveAndDestroy)
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        SoAVector<int, std::shared_ptr<int>> soa;
+        for (int i = 0; i < 50; ++i)
+        {
+            soa.pushBack(i, tracker);
+        }
+        EXPECT_EQ(tracker.use_count(), 51);
+
+        SoAVector<int, std::shared_ptr<int>> copy = soa;
+        EXPECT_EQ(tracker.use_count(), 101);
+        EXPECT_EQ(copy.get<0>(49), 49);
+
+        SoAVector<int, std::shared_ptr<int>> moved = std::move(copy);
+        EXPECT_TRUE(copy.isEmpty());
+        EXPECT_EQ(tracker.use_count(), 101);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(SoAVectorTest, WorksWithAlgorithms)
+{
+    SoAVector<float> soa;
+    soa.pushBack(3.0f);
+    soa.pushBack(1.0f);
+    soa.pushBack(2.0f);
+    auto xs = soa.field<0>();
+    std::sort(xs.begin(), xs.end());
+    EXPECT_FLOAT_EQ(soa.get<0>(0), 1.0f);
+    EXPECT_FLOAT_EQ(*std::max_element(xs.begin(), xs.end()), 3.0f);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,236 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/pools/SlotMap.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace gp::tests
+{
+
+TEST(SlotMapHandleTest, DefaultHandleIsInvalid)
+{
+    EXPECT_FALSE(SlotMapHandle32().isValid());
+    EXPECT_FALSE(SlotMapHandle64().isValid());
+    EXPECT_EQ(SlotMapHandle32().value(), 0u);
+}
+
+TEST(SlotMapHandleTest, PacksIndexAndGeneration)
+{
+    const SlotMapHandle32 handle32(SlotMapHandle32::kMaxSlots - 1, SlotMapHandle32::kMaxGeneration);
+    EXPECT_EQ(handle32.index(), (1u << 20) - 2);
+    EXPECT_EQ(handle32.generation(), (1u << 12) - 1);
+    EXPECT_EQ(SlotMapHandle32::fromValue(handle32.value()), handle32);
+
+    const SlotMapHandle64 handle64(0xdeadbeefu, 0xcafebabeu);
+    EXPECT_EQ(handle64.index(), 0xdeadbeefu);
+    EXPECT_EQ(handle64.generation(), 0xcafebabeu);
+    EXPECT_EQ(sizeof(SlotMapHandle64), 8u);
+}
+
+TEST(SlotMapTest, InsertAndGet)
+{
+    SlotMap<int> map;
+    EXPECT_TRUE(map.isEmpty());
+
+    const auto a = map.insert(10);
+    const auto b = map.emplace(20);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_TRUE(map.contains(a));
+    EXPECT_TRUE(map.contains(b));
+    EXPECT_EQ(map[a], 10);
+    EXPECT_EQ(*map.tryGet(b), 20);
+    EXPECT_FALSE(map.contains(SlotMapHandle32()));
+}
+
+TEST(SlotMapTest, RemoveInvalidatesHandle)
+{
+    SlotMap<int> map;
+    const auto a = map.insert(1);
+    const auto b = map.insert(2);
+    const auto c = map.insert(3);
+
+    EXPECT_TRUE(map.remove(a));
+    EXPECT_FALSE(map.remove(a));
+    EXPECT_FALSE(map.contains(a));
+    EXPECT_EQ(map.tryGet(a), nullptr);
+    EXPECT_EQ(map.size(), 2u);
+
+    // The last value was swapped into the hole, handles to it still resolve.
+    EXPECT_EQ(map[b], 2);
+    EXPECT_EQ(map[c], 3);
+}
+
+TEST(SlotMapTest, ReusedSlotGetsNewGeneration)
+{
+    SlotMap<int> map;
+    const auto a = map.insert(1);
+    map.remove(a);
+    const auto b = map.insert(2);
+
+    EXPECT_EQ(a.index(), b.index());
+    EXPECT_NE(a.generation(), b.generation());
+    EXPECT_FALSE(map.contains(a));
+    EXPECT_EQ(map[b], 2);
+}
+
+TEST(SlotMapTest, SaturatedSlotIsRetired)
+{
+    SlotMap<int> map;
+    auto handle = map.insert(0);
+    const UInt32 index = handle.index();
+    for (UInt32 i = 1; i < SlotMapHandle32::kMaxGeneration; ++i)
+    {
+        map.remove(handle);
+        handle = map.insert(0);
+        EXPECT_EQ(handle.index(), index);
+    }
+    EXPECT_EQ(handle.generation(), SlotMapHandle32::kMaxGeneration);
+
+    map.remove(handle);
+    const auto next = map.insert(0);
+    EXPECT_NE(next.index(), index);
+    EXPECT_FALSE(map.contains(handle));
+}
+
+TEST(SlotMapTest, IterationIsDense)
+{
+    SlotMap<int> map;
+    std::vector<SlotMapHandle32> handles;
+    for (int i = 0; i < 100; ++i)
+    {
+        handles.push_back(map.insert(i));
+    }
+    for (int i = 0; i < 100; i += 2)
+    {
+        map.remove(handles[i]);
+    }
+
+    int sum = 0;
+    for (int value : map)
+    {
+        sum += value;
+    }
+    EXPECT_EQ(map.size(), 50u);
+    EXPECT_EQ(sum, 2500);
+
+    for (UInt32 i = 0; i < map.size(); ++i)
+    {
+        EXPECT_EQ(map[map.handleAt(i)], map.data()[i]);
+    }
+}
+
+TEST(SlotMapTest, DestroysValues)
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        SlotMap<std::shared_ptr<int>> map;
+        const auto a = map.insert(tracker);
+        map.insert(tracker);
+        map.insert(tracker);
+        EXPECT_EQ(tracker.use_count(), 4);
+        map.remove(a);
+        EXPECT_EQ(tracker.use_count(), 3);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(SlotMapTest, ClearInvalidatesEveryHandle)
+{
+    SlotMap<int> map;
+    const auto a = map.insert(1);
+    const auto b = map.insert(2);
+    map.clear();
+
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(a));
+    EXPECT_FALSE(map.contains(b));
+    EXPECT_EQ(map[map.insert(3)], 3);
+}
+
+TEST(SlotMapTest, MoveKeepsHandles)
+{
+    SlotMap<int> map;
+    const auto a = map.insert(42);
+    SlotMap<int> other(std::move(map));
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_EQ(other[a], 42);
+}
+
+TEST(SlotMapTest, ReservedHandlesAreMaterializedOnFlush)
+{
+    SlotMap<int> map;
+    const auto a = map.insert(1);
+    map.insert(2);
+    map.remove(a);
+
+    const auto reused = map.reserveHandle();
+    const auto fresh = map.reserveHandle();
+    EXPECT_TRUE(map.hasPendingReservations());
+    EXPECT_EQ(reused.index(), a.index());
+    EXPECT_NE(reused, a);
+    EXPECT_FALSE(map.contains(reused));
+    EXPECT_FALSE(map.contains(fresh));
+
+    EXPECT_EQ(map.flushReserved([](SlotMapHandle32 handle) { return static_cast<int>(handle.index()) + 100; }), 2u);
+    EXPECT_FALSE(map.hasPendingReservations());
+    EXPECT_EQ(map[reused], static_cast<int>(reused.index()) + 100);
+    EXPECT_EQ(map[fresh], static_cast<int>(fresh.index()) + 100);
+    EXPECT_EQ(map.size(), 3u);
+}
+
+TEST(SlotMapTest, ConcurrentReservationHandsOutUniqueHandles)
+{
+    constexpr int kThreadCount = 4;
+    constexpr int kPerThread = 2000;
+
+    SlotMap64<int> map;
+    std::vector<SlotMapHandle64> initial;
+    for (int i = 0; i < 1000; ++i)
+    {
+        initial.push_back(map.insert(i));
+    }
+    for (const auto handle : initial)
+    {
+        map.remove(handle);
+    }
+
+    std::vector<std::vector<SlotMapHandle64>> reserved(kThreadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadCount; ++t)
+    {
+        threads.emplace_back(
+            [&map, &reserved, t]()
+        {
+            for (int i = 0; i < kPerThread; ++i)
+            {
+                reserved[t].push_back(map.reserveHandle());
+            }
+        }
+        );
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(map.flushReserved(), static_cast<UInt32>(kThreadCount * kPerThread));
+
+    std::set<UInt64> unique;
+    for (const auto& handles : reserved)
+    {
+        for (const auto handle : handles)
+        {
+            EXPECT_TRUE(map.contains(handle));
+            unique.insert(handle.value());
+        }
+    }
+    EXPECT_EQ(unique.size(), static_cast<USize>(kThreadCount * kPerThread));
+    EXPECT_EQ(map.size(), static_cast<UInt32>(kThreadCount * kPerThread));
+}
+
+}   // namespace gp::tests
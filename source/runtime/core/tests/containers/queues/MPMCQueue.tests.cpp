@@ -0,0 +1,133 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/queues/MPMCQueue.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace gp::tests
+{
+
+TEST(MPMCQueueTest, StartsEmpty)
+{
+    MPMCQueue<int, 8> queue;
+    int value = 0;
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.capacity(), 8u);
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST(MPMCQueueTest, PushPopPreservesOrder)
+{
+    MPMCQueue<int, 4> queue;
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    EXPECT_TRUE(queue.tryEmplace(3));
+    EXPECT_EQ(queue.sizeApprox(), 3u);
+
+    int value = 0;
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, 3);
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST(MPMCQueueTest, RejectsPushWhenFull)
+{
+    MPMCQueue<int, 2> queue;
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    EXPECT_FALSE(queue.tryPush(3));
+
+    int value = 0;
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_TRUE(queue.tryPush(3));
+}
+
+TEST(MPMCQueueTest, BatchOperations)
+{
+    MPMCQueue<int, 8> queue;
+    const int values[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    EXPECT_EQ(queue.tryPushBatch(values, 5), 5u);
+    EXPECT_EQ(queue.tryPushBatch(values + 5, 5), 3u);
+    EXPECT_EQ(queue.tryPushBatch(values, 1), 0u);
+
+    int out[10] = {};
+    EXPECT_EQ(queue.tryPopBatch(out, 6), 6u);
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_EQ(out[i], i);
+    }
+    EXPECT_EQ(queue.tryPopBatch(out, 10), 2u);
+    EXPECT_EQ(out[0], 6);
+    EXPECT_EQ(out[1], 7);
+    EXPECT_EQ(queue.tryPopBatch(out, 10), 0u);
+}
+
+TEST(MPMCQueueTest, ManyProducersManyConsumers)
+{
+    constexpr int kProducers = 4;
+    constexpr int kConsumers = 4;
+    constexpr int kPerProducer = 50000;
+    MPMCQueue<int, 256> queue;
+    std::atomic<long long> sum{ 0 };
+    std::atomic<int> consumed{ 0 };
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kProducers; ++p)
+    {
+        threads.emplace_back(
+            [&queue, p]()
+        {
+            for (int i = 0; i < kPerProducer;)
+            {
+                const int value = p * kPerProducer + i;
+                if ((i & 1) == 0 && i + 1 < kPerProducer)
+                {
+                    const int pair[2] = { value, value + 1 };
+                    i += static_cast<int>(queue.tryPushBatch(pair, 2));
+                }
+                else if (queue.tryPush(value))
+                {
+                    ++i;
+                }
+            }
+        }
+        );
+    }
+    for (int c = 0; c < kConsumers; ++c)
+    {
+        threads.emplace_back(
+            [&]()
+        {
+            int batch[16];
+            while (consumed.load(std::memory_order_relaxed) < kProducers * kPerProducer)
+            {
+                const USize popped = queue.tryPopBatch(batch, 16);
+                for (USize i = 0; i < popped; ++i)
+                {
+                    sum.fetch_add(batch[i], std::memory_order_relaxed);
+                }
+                consumed.fetch_add(static_cast<int>(popped), std::memory_order_relaxed);
+            }
+        }
+        );
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    constexpr long long kTotal = static_cast<long long>(kProducers) * kPerProducer;
+    EXPECT_EQ(consumed.load(), kTotal);
+    EXPECT_EQ(sum.load(), kTotal * (kTotal - 1) / 2);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+}   // namespace gp::tests
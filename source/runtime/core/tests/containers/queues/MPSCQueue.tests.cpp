@@ -0,0 +1,127 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/queues/MPSCQueue.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace gp::tests
+{
+
+struct MPSCCommand : public MPSCQueueNode
+{
+    int producer = 0;
+    int sequence = 0;
+};
+
+TEST(MPSCQueueTest, StartsEmpty)
+{
+    MPSCQueue<MPSCCommand> queue;
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.tryPop(), nullptr);
+}
+
+TEST(MPSCQueueTest, PushPopPreservesOrder)
+{
+    MPSCQueue<MPSCCommand> queue;
+    MPSCCommand commands[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        commands[i].sequence = i;
+        queue.push(&commands[i]);
+    }
+    EXPECT_FALSE(queue.isEmpty());
+
+    for (int i = 0; i < 3; ++i)
+    {
+        MPSCCommand* command = queue.tryPop();
+        ASSERT_NE(command, nullptr);
+        EXPECT_EQ(command->sequence, i);
+    }
+    EXPECT_EQ(queue.tryPop(), nullptr);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(MPSCQueueTest, NodesCanBeRequeued)
+{
+    MPSCQueue<MPSCCommand> queue;
+    MPSCCommand command;
+    for (int i = 0; i < 4; ++i)
+    {
+        queue.push(&command);
+        EXPECT_EQ(queue.tryPop(), &command);
+        EXPECT_EQ(queue.tryPop(), nullptr);
+    }
+}
+
+TEST(MPSCQueueTest, PushChain)
+{
+    MPSCQueue<MPSCCommand> queue;
+    MPSCCommand single;
+    single.sequence = -1;
+    queue.push(&single);
+
+    MPSCCommand chain[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        chain[i].sequence = i;
+        if (i > 0)
+        {
+            MPSCQueue<MPSCCommand>::link(&chain[i - 1], &chain[i]);
+        }
+    }
+    queue.pushChain(&chain[0], &chain[3]);
+
+    std::vector<int> sequences;
+    EXPECT_EQ(queue.drain([&sequences](MPSCCommand* command) { sequences.push_back(command->sequence); }), 5u);
+    EXPECT_EQ(sequences, (std::vector<int>{ -1, 0, 1, 2, 3 }));
+}
+
+TEST(MPSCQueueTest, ManyProducersSingleConsumer)
+{
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 20000;
+    MPSCQueue<MPSCCommand> queue;
+    std::vector<MPSCCommand> commands(kProducers * kPerProducer);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p)
+    {
+        producers.emplace_back(
+            [&queue, &commands, p]()
+        {
+            for (int i = 0; i < kPerProducer; ++i)
+            {
+                MPSCCommand& command = commands[p * kPerProducer + i];
+                command.producer = p;
+                command.sequence = i;
+                queue.push(&command);
+            }
+        }
+        );
+    }
+
+    int lastSequence[kProducers] = { -1, -1, -1, -1 };
+    bool ordered = true;
+    int received = 0;
+    while (received < kProducers * kPerProducer)
+    {
+        if (MPSCCommand* command = queue.tryPop())
+        {
+            ordered &= command->sequence == lastSequence[command->producer] + 1;
+            lastSequence[command->producer] = command->sequence;
+            ++received;
+        }
+    }
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(queue.tryPop(), nullptr);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,146 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/queues/SPSCQueue.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+
+namespace gp::tests
+{
+
+TEST(SPSCQueueTest, StartsEmpty)
+{
+    SPSCQueue<int, 8> queue;
+    int value = 0;
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.sizeApprox(), 0u);
+    EXPECT_EQ(queue.capacity(), 8u);
+    EXPECT_FALSE(queue.tryPop(value));
+    EXPECT_EQ(queue.front(), nullptr);
+}
+
+TEST(SPSCQueueTest, PushPopPreservesOrder)
+{
+    SPSCQueue<int, 4> queue;
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    EXPECT_TRUE(queue.tryEmplace(3));
+    EXPECT_EQ(queue.sizeApprox(), 3u);
+
+    int value = 0;
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, 3);
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST(SPSCQueueTest, RejectsPushWhenFull)
+{
+    SPSCQueue<int, 2> queue;
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    EXPECT_FALSE(queue.tryPush(3));
+
+    int value = 0;
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_TRUE(queue.tryPush(3));
+}
+
+TEST(SPSCQueueTest, WrapsAround)
+{
+    SPSCQueue<int, 4> queue;
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(queue.tryPush(i));
+        int value = -1;
+        EXPECT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(SPSCQueueTest, FrontAndPopFront)
+{
+    SPSCQueue<int, 4> queue;
+    EXPECT_TRUE(queue.tryPush(42));
+    ASSERT_NE(queue.front(), nullptr);
+    EXPECT_EQ(*queue.front(), 42);
+    queue.popFront();
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(SPSCQueueTest, BatchPushIsClampedToFreeSlots)
+{
+    SPSCQueue<int, 4> queue;
+    const int values[6] = { 0, 1, 2, 3, 4, 5 };
+    EXPECT_EQ(queue.tryPushBatch(values, 6), 4u);
+    EXPECT_EQ(queue.tryPushBatch(values, 6), 0u);
+
+    int out[8] = {};
+    EXPECT_EQ(queue.tryPopBatch(out, 3), 3u);
+    EXPECT_EQ(out[0], 0);
+    EXPECT_EQ(out[1], 1);
+    EXPECT_EQ(out[2], 2);
+    EXPECT_EQ(queue.tryPopBatch(out, 8), 1u);
+    EXPECT_EQ(out[0], 3);
+    EXPECT_EQ(queue.tryPopBatch(out, 8), 0u);
+}
+
+TEST(SPSCQueueTest, RemainingElementsAreDestroyed)
+{
+    auto tracked = std::make_shared<int>(7);
+    {
+        SPSCQueue<std::shared_ptr<int>, 4> queue;
+        EXPECT_TRUE(queue.tryPush(tracked));
+        EXPECT_TRUE(queue.tryPush(tracked));
+        EXPECT_EQ(tracked.use_count(), 3);
+
+        std::shared_ptr<int> out;
+        EXPECT_TRUE(queue.tryPop(out));
+        EXPECT_EQ(tracked.use_count(), 3);
+    }
+    EXPECT_EQ(tracked.use_count(), 1);
+}
+
+TEST(SPSCQueueTest, ProducerConsumerThreads)
+{
+    constexpr int kCount = 200000;
+    SPSCQueue<int, 64> queue;
+
+    std::thread producer(
+        [&queue]()
+    {
+        for (int i = 0; i < kCount;)
+        {
+            if (queue.tryPush(i))
+            {
+                ++i;
+            }
+        }
+    }
+    );
+
+    long long sum = 0;
+    int expected = 0;
+    bool ordered = true;
+    while (expected < kCount)
+    {
+        int value;
+        if (queue.tryPop(value))
+        {
+            ordered &= (value == expected);
+            sum += value;
+            ++expected;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(sum, static_cast<long long>(kCount) * (kCount - 1) / 2);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,114 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/queues/WorkStealingDeque.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace gp::tests
+{
+
+TEST(WorkStealingDequeTest, StartsEmpty)
+{
+    WorkStealingDeque<int*, 8> deque;
+    int* value = nullptr;
+    EXPECT_TRUE(deque.isEmpty());
+    EXPECT_EQ(deque.capacity(), 8u);
+    EXPECT_FALSE(deque.tryPop(value));
+    EXPECT_FALSE(deque.trySteal(value));
+}
+
+TEST(WorkStealingDequeTest, OwnerPopsLifoThievesStealFifo)
+{
+    int items[3] = {};
+    WorkStealingDeque<int*, 8> deque;
+    EXPECT_TRUE(deque.tryPush(&items[0]));
+    EXPECT_TRUE(deque.tryPush(&items[1]));
+    EXPECT_TRUE(deque.tryPush(&items[2]));
+    EXPECT_EQ(deque.sizeApprox(), 3u);
+
+    int* value = nullptr;
+    EXPECT_TRUE(deque.tryPop(value));
+    EXPECT_EQ(value, &items[2]);
+    EXPECT_TRUE(deque.trySteal(value));
+    EXPECT_EQ(value, &items[0]);
+    EXPECT_TRUE(deque.tryPop(value));
+    EXPECT_EQ(value, &items[1]);
+    EXPECT_FALSE(deque.tryPop(value));
+    EXPECT_TRUE(deque.isEmpty());
+}
+
+TEST(WorkStealingDequeTest, RejectsPushWhenFull)
+{
+    WorkStealingDeque<USize, 2> deque;
+    EXPECT_TRUE(deque.tryPush(1));
+    EXPECT_TRUE(deque.tryPush(2));
+    EXPECT_FALSE(deque.tryPush(3));
+
+    USize value = 0;
+    EXPECT_TRUE(deque.trySteal(value));
+    EXPECT_TRUE(deque.tryPush(3));
+}
+
+TEST(WorkStealingDequeTest, ConcurrentStealingTakesEveryElementOnce)
+{
+    constexpr USize kThieves = 4;
+    constexpr USize kElements = 200000;
+    WorkStealingDeque<USize, 1024> deque;
+    std::vector<std::atomic<UInt8>> taken(kElements);
+    std::atomic<USize> takenCount{ 0 };
+
+    std::vector<std::thread> thieves;
+    for (USize t = 0; t < kThieves; ++t)
+    {
+        thieves.emplace_back(
+            [&]()
+        {
+            USize value = 0;
+            while (takenCount.load(std::memory_order_relaxed) < kElements)
+            {
+                if (deque.trySteal(value))
+                {
+                    taken[value].fetch_add(1, std::memory_order_relaxed);
+                    takenCount.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        );
+    }
+
+    USize value = 0;
+    for (USize i = 0; i < kElements;)
+    {
+        if (deque.tryPush(i))
+        {
+            ++i;
+        }
+        // Pop every few pushes so that the owner and the thieves race for the last elements.
+        if ((i & 3) == 0 && deque.tryPop(value))
+        {
+            taken[value].fetch_add(1, std::memory_order_relaxed);
+            takenCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    while (deque.tryPop(value))
+    {
+        taken[value].fetch_add(1, std::memory_order_relaxed);
+        takenCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    for (std::thread& thief : thieves)
+    {
+        thief.join();
+    }
+
+    EXPECT_EQ(takenCount.load(), kElements);
+    for (USize i = 0; i < kElements; ++i)
+    {
+        ASSERT_EQ(taken[i].load(), 1u) << "element " << i;
+    }
+}
+
+}   // namespace gp::tests
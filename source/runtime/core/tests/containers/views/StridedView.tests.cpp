@@ -0,0 +1,67 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/views/StridedView.hpp"
+#include <gtest/gtest.h>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+struct Vertex
+{
+    float position;
+    int index;
+    double weight;
+};
+
+}   // namespace
+
+TEST(StridedViewTest, DefaultIsEmpty)
+{
+    StridedView<int> view;
+    EXPECT_TRUE(view.isEmpty());
+    EXPECT_EQ(view.size(), 0);
+    EXPECT_EQ(view.begin(), view.end());
+}
+
+TEST(StridedViewTest, ViewsOneFieldOfStructures)
+{
+    Vertex vertices[] = { { 1.0f, 10, 0.5 }, { 2.0f, 20, 0.25 }, { 3.0f, 30, 0.125 } };
+    StridedView<int> indices = StridedView<int>::ofField(VectorView<Vertex>(vertices), &Vertex::index);
+    EXPECT_EQ(indices.size(), 3);
+    EXPECT_EQ(indices.stride(), sizeof(Vertex));
+    EXPECT_FALSE(indices.isContiguous());
+    EXPECT_EQ(indices[1], 20);
+
+    indices[2] = 33;
+    EXPECT_EQ(vertices[2].index, 33);
+
+    int sum = 0;
+    for (int index : indices)
+    {
+        sum += index;
+    }
+    EXPECT_EQ(sum, 63);
+
+    ConstStridedView<int> constIndices = indices;
+    EXPECT_EQ(constIndices[0], 10);
+    EXPECT_EQ(constIndices.stride(), sizeof(Vertex));
+}
+
+TEST(StridedViewTest, ViewsContiguousElements)
+{
+    int values[] = { 4, 5, 6, 7 };
+    StridedView<int> view = VectorView<int>(values);
+    EXPECT_TRUE(view.isContiguous());
+    EXPECT_EQ(view[3], 7);
+
+    StridedView<int> everyOther(values, 2, 2 * sizeof(int));
+    EXPECT_EQ(everyOther[0], 4);
+    EXPECT_EQ(everyOther[1], 6);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,77 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "containers/arrays/Array.hpp"
+#include "containers/views/VectorView.hpp"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <ranges>
+
+namespace gp::tests
+{
+
+TEST(VectorViewTest, DefaultIsEmpty)
+{
+    VectorView<int> view;
+    EXPECT_TRUE(view.isEmpty());
+    EXPECT_EQ(view.size(), 0);
+    EXPECT_EQ(view.data(), nullptr);
+    EXPECT_EQ(view.begin(), view.end());
+}
+
+TEST(VectorViewTest, ViewsCArrayAndArray)
+{
+    int values[] = { 1, 2, 3, 4 };
+    VectorView<int> view(values);
+    EXPECT_EQ(view.size(), 4);
+    EXPECT_EQ(view.front(), 1);
+    EXPECT_EQ(view.back(), 4);
+
+    view[1] = 20;
+    EXPECT_EQ(values[1], 20);
+
+    Array<float, 3> array{ 1.0f, 2.0f, 3.0f };
+    ConstVectorView<float> constView(array);
+    EXPECT_EQ(constView.size(), 3);
+    EXPECT_EQ(constView.sizeInBytes(), 3 * sizeof(float));
+    EXPECT_FLOAT_EQ(std::accumulate(constView.begin(), constView.end(), 0.0f), 6.0f);
+}
+
+TEST(VectorViewTest, ConvertsToConst)
+{
+    int values[] = { 1, 2, 3 };
+    VectorView<int> view(values, 3);
+    ConstVectorView<int> constView = view;
+    EXPECT_EQ(constView.data(), values);
+    EXPECT_EQ(constView.size(), 3);
+}
+
+TEST(VectorViewTest, Slicing)
+{
+    int values[] = { 0, 1, 2, 3, 4, 5 };
+    VectorView<int> view(values);
+    EXPECT_EQ(view.slice(2, 3).front(), 2);
+    EXPECT_EQ(view.slice(2, 3).size(), 3);
+    EXPECT_EQ(view.first(2).back(), 1);
+    EXPECT_EQ(view.last(2).front(), 4);
+    EXPECT_EQ(view.dropFirst(5).size(), 1);
+    EXPECT_TRUE(view.isValidIndex(5));
+    EXPECT_FALSE(view.isValidIndex(6));
+    EXPECT_FALSE(view.isValidIndex(-1));
+}
+
+TEST(VectorViewTest, IsARange)
+{
+    static_assert(std::ranges::contiguous_range<VectorView<int>>);
+    static_assert(std::ranges::borrowed_range<VectorView<int>>);
+    static_assert(std::ranges::view<VectorView<int>>);
+
+    int values[] = { 3, 1, 2 };
+    VectorView<int> view(values);
+    std::ranges::sort(view);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(*view.rbegin(), 3);
+}
+
+}   // namespace gp::tests
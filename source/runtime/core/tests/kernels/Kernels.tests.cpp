@@ -0,0 +1,154 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "kernels/Kernels.hpp"
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+/// @brief Returns whether the CPU running the tests supports a level, without depending on the HAL.
+bool isLevelSupported(ISALevel level)
+{
+    switch (level)
+    {
+    case ISALevel::Scalar:
+        return true;
+#if (GP_ARCHITECTURE_X86 || GP_ARCHITECTURE_X64) && (GP_COMPILER_GCC || GP_COMPILER_CLANG)
+    case ISALevel::SSE4_2:
+        return __builtin_cpu_supports("sse4.2");
+    case ISALevel::AVX2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#elif GP_ARCHITECTURE_ARM64
+    case ISALevel::NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+class KernelsTest : public ::testing::TestWithParam<ISALevel>
+{
+protected:
+    const KernelTable& getTable() const
+    {
+        return Kernels::getTable(GetParam());
+    }
+
+    void SetUp() override
+    {
+        if (!isLevelSupported(GetParam()))
+        {
+            GTEST_SKIP() << "ISA level not supported by this CPU or build";
+        }
+    }
+};
+
+}   // namespace
+
+TEST_P(KernelsTest, CopyMemory)
+{
+    for (USize size : { USize{ 0 }, USize{ 7 }, USize{ 1000 }, USize{ 3 * 1024 * 1024 + 5 } })
+    {
+        std::vector<UInt8> source(size + 1);
+        std::vector<UInt8> destination(size + 1, 0);
+        for (USize index = 0; index < source.size(); ++index)
+        {
+            source[index] = static_cast<UInt8>(index * 31 + 7);
+        }
+
+        // Offset the buffers by one byte to exercise the unaligned head of the streaming copy.
+        getTable().copyMemory(destination.data() + 1, source.data() + 1, size);
+        EXPECT_EQ(std::memcmp(destination.data() + 1, source.data() + 1, size), 0);
+        EXPECT_EQ(destination[0], 0);
+    }
+}
+
+TEST_P(KernelsTest, FindByte)
+{
+    std::vector<UInt8> data(100, 'a');
+    EXPECT_EQ(getTable().findByte(data.data(), data.size(), 'b'), data.size());
+
+    data[70] = 'b';
+    data[90] = 'b';
+    EXPECT_EQ(getTable().findByte(data.data(), data.size(), 'b'), 70u);
+    EXPECT_EQ(getTable().findByte(data.data() + 71, data.size() - 71, 'b'), 19u);
+    EXPECT_EQ(getTable().findByte(data.data(), 3, 'a'), 0u);
+    EXPECT_EQ(getTable().findByte(data.data(), 0, 'a'), 0u);
+}
+
+TEST_P(KernelsTest, Crc32c)
+{
+    const char* message = "123456789";
+    EXPECT_EQ(getTable().crc32c(message, 9, 0), 0xE3069283u);
+    EXPECT_EQ(getTable().crc32c(message, 0, 0), 0u);
+
+    // Hashing in two parts gives the checksum of the whole buffer.
+    const UInt32 firstPart = getTable().crc32c(message, 5, 0);
+    EXPECT_EQ(getTable().crc32c(message + 5, 4, firstPart), 0xE3069283u);
+
+    std::vector<UInt8> data(1027);
+    for (USize index = 0; index < data.size(); ++index)
+    {
+        data[index] = static_cast<UInt8>(index * 13);
+    }
+    EXPECT_EQ(
+        getTable().crc32c(data.data(), data.size(), 42),
+        Kernels::getTable(ISALevel::Scalar).crc32c(data.data(), data.size(), 42)
+    );
+}
+
+TEST_P(KernelsTest, DotProductAndMix)
+{
+    std::vector<Float32> a(37);
+    std::vector<Float32> b(37);
+    Float32 expected = 0.0f;
+    for (USize index = 0; index < a.size(); ++index)
+    {
+        a[index] = static_cast<Float32>(index) * 0.5f;
+        b[index] = 2.0f - static_cast<Float32>(index % 5);
+        expected += a[index] * b[index];
+    }
+    EXPECT_NEAR(getTable().dotProduct(a.data(), b.data(), a.size()), expected, 1e-3f);
+    EXPECT_FLOAT_EQ(getTable().dotProduct(a.data(), b.data(), 0), 0.0f);
+
+    std::vector<Float32> mixed = a;
+    getTable().mixAudio(mixed.data(), b.data(), 0.25f, mixed.size());
+    for (USize index = 0; index < a.size(); ++index)
+    {
+        EXPECT_FLOAT_EQ(mixed[index], a[index] + b[index] * 0.25f);
+    }
+}
+
+TEST_P(KernelsTest, TableLevel)
+{
+    EXPECT_EQ(getTable().level, GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AllLevels, KernelsTest, ::testing::Values(ISALevel::Scalar, ISALevel::SSE4_2, ISALevel::AVX2, ISALevel::NEON)
+);
+
+TEST(KernelsDispatchTest, InitializeSelectsTable)
+{
+    EXPECT_EQ(Kernels::getTable(ISALevel::Scalar).level, ISALevel::Scalar);
+
+    Kernels::initialize(ISALevel::Scalar);
+    EXPECT_EQ(Kernels::getLevel(), ISALevel::Scalar);
+    EXPECT_EQ(Kernels::crc32c("123456789", 9), 0xE3069283u);
+
+    const ISALevel best = isLevelSupported(ISALevel::AVX2) ? ISALevel::AVX2 : ISALevel::Scalar;
+    Kernels::initialize(best);
+    EXPECT_EQ(Kernels::getLevel(), best);
+    EXPECT_EQ(Kernels::crc32c("123456789", 9), 0xE3069283u);
+    Kernels::initialize(ISALevel::Scalar);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,243 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "maths/base/FastMath.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+namespace gp::math::tests
+{
+
+namespace
+{
+
+/// @brief Returns the error of an approximation in units in the last place of the rounded exact value.
+double getUlpError(const Float32 approximation, const double exact)
+{
+    const Float32 rounded = std::abs(static_cast<Float32>(exact));
+    const double ulp = std::nextafter(rounded, std::numeric_limits<Float32>::infinity()) - rounded;
+    return std::abs(static_cast<double>(approximation) - exact) / ulp;
+}
+
+/// @brief Returns @p count values spread evenly over [first, last], padded to a multiple of 8.
+std::vector<Float32> makeSamples(const Float32 first, const Float32 last, const Int32 count)
+{
+    std::vector<Float32> samples;
+    for (Int32 index = 0; index < count; ++index)
+    {
+        const double fraction = static_cast<double>(index) / static_cast<double>(count - 1);
+        samples.push_back(static_cast<Float32>(first + (last - first) * fraction));
+    }
+    while (samples.size() % 8 != 0)
+    {
+        samples.push_back(last);
+    }
+    return samples;
+}
+
+/// @brief The largest errors of the scalar and register forms of an approximation.
+struct MaxErrors
+{
+    double scalar = 0.0;
+    double register4 = 0.0;
+    double register8 = 0.0;
+};
+
+/// @brief Returns the error of an approximation, absolute or in units in the last place.
+double getError(const Float32 approximation, const double exact, const bool isAbsolute)
+{
+    return isAbsolute ? std::abs(static_cast<double>(approximation) - exact) : getUlpError(approximation, exact);
+}
+
+/// @brief Measures the largest errors of a function of two arguments over pairs of samples.
+template <typename Scalar, typename Register4, typename Register8, typename Exact>
+MaxErrors measure(
+    const std::vector<Float32>& first,
+    const std::vector<Float32>& second,
+    Scalar scalar,
+    Register4 register4,
+    Register8 register8,
+    Exact exact,
+    const bool isAbsolute = false
+)
+{
+    MaxErrors errors;
+    alignas(simd::kRegister8Alignment) Float32 lanes[8];
+    for (USize index = 0; index < first.size(); index += 8)
+    {
+        const simd::VectorRegister8f a = simd::loadUnaligned8f(&first[index]);
+        const simd::VectorRegister8f b = simd::loadUnaligned8f(&second[index]);
+        simd::store(lanes, register8(a, b));
+        for (USize lane = 0; lane < 8; ++lane)
+        {
+            const Float32 x = first[index + lane];
+            const Float32 y = second[index + lane];
+            const double expected = exact(x, y);
+            errors.scalar = std::max(errors.scalar, getError(scalar(x, y), expected, isAbsolute));
+            errors.register8 = std::max(errors.register8, getError(lanes[lane], expected, isAbsolute));
+        }
+
+        simd::store(lanes, register4(simd::getLow(a), simd::getLow(b)));
+        simd::store(lanes + 4, register4(simd::getHigh(a), simd::getHigh(b)));
+        for (USize lane = 0; lane < 8; ++lane)
+        {
+            const double expected = exact(first[index + lane], second[index + lane]);
+            errors.register4 = std::max(errors.register4, getError(lanes[lane], expected, isAbsolute));
+        }
+    }
+    return errors;
+}
+
+/// @brief Measures the largest errors of a function of one argument.
+template <typename Scalar, typename Register4, typename Register8, typename Exact>
+MaxErrors measure(
+    const std::vector<Float32>& samples,
+    Scalar scalar,
+    Register4 register4,
+    Register8 register8,
+    Exact exact,
+    const bool isAbsolute = false
+)
+{
+    return measure(
+        samples,
+        samples,
+        [&](Float32 value, Float32) { return scalar(value); },
+        [&](simd::VectorRegister4f value, simd::VectorRegister4f) { return register4(value); },
+        [&](simd::VectorRegister8f value, simd::VectorRegister8f) { return register8(value); },
+        [&](Float32 value, Float32) { return exact(static_cast<double>(value)); },
+        isAbsolute
+    );
+}
+
+/// @brief Checks that every form of an approximation stays within the documented error.
+void expectMaxErrors(const MaxErrors& errors, const double maxError)
+{
+    EXPECT_LE(errors.scalar, maxError);
+    EXPECT_LE(errors.register4, maxError);
+    EXPECT_LE(errors.register8, maxError);
+}
+
+}   // namespace
+
+TEST(FastMathTest, ScalarFormsAreConstexpr)
+{
+    static_assert(fastSin(0.0f) == 0.0f);
+    static_assert(fastCos(0.0f) == 1.0f);
+    static_assert(fastExp(0.0f) == 1.0f);
+    static_assert(fastLog(1.0f) == 0.0f);
+    static_assert(fastAtan2(0.0f, 1.0f) == 0.0f);
+}
+
+TEST(FastMathTest, SinAndCosMatchStandard)
+{
+    const auto sinErrors = [](const std::vector<Float32>& samples, const bool isAbsolute)
+    {
+        return measure(
+            samples,
+            [](Float32 value) { return fastSin(value); },
+            [](simd::VectorRegister4f value) { return fastSin(value); },
+            [](simd::VectorRegister8f value) { return fastSin(value); },
+            [](double value) { return std::sin(value); },
+            isAbsolute
+        );
+    };
+    const auto cosErrors = [](const std::vector<Float32>& samples, const bool isAbsolute)
+    {
+        return measure(
+            samples,
+            [](Float32 value) { return fastCos(value); },
+            [](simd::VectorRegister4f value) { return fastCos(value); },
+            [](simd::VectorRegister8f value) { return fastCos(value); },
+            [](double value) { return std::cos(value); },
+            isAbsolute
+        );
+    };
+
+    const Float32 twoPi = constants<Float32>::twoPi;
+    const std::vector<Float32> samples = makeSamples(-twoPi, twoPi, 100003);
+    expectMaxErrors(sinErrors(samples, false), 2.0);
+    expectMaxErrors(cosErrors(samples, false), 2.0);
+
+    // Far from the origin, the errors in units in the last place grow around the zeros of the functions.
+    const std::vector<Float32> wide = makeSamples(-8192.0f, 8192.0f, 100003);
+    expectMaxErrors(sinErrors(wide, true), 2e-7);
+    expectMaxErrors(cosErrors(wide, true), 2e-7);
+}
+
+TEST(FastMathTest, Atan2MatchesStandard)
+{
+    std::vector<Float32> ys;
+    std::vector<Float32> xs;
+    for (const Float32 y : makeSamples(-3.0f, 3.0f, 301))
+    {
+        for (const Float32 x : makeSamples(-3.0f, 3.0f, 304))
+        {
+            ys.push_back(y);
+            xs.push_back(x);
+        }
+    }
+    expectMaxErrors(
+        measure(
+            ys,
+            xs,
+            [](Float32 y, Float32 x) { return fastAtan2(y, x); },
+            [](simd::VectorRegister4f y, simd::VectorRegister4f x) { return fastAtan2(y, x); },
+            [](simd::VectorRegister8f y, simd::VectorRegister8f x) { return fastAtan2(y, x); },
+            [](Float32 y, Float32 x) { return std::atan2(static_cast<double>(y), static_cast<double>(x)); }
+        ),
+        3.0
+    );
+}
+
+TEST(FastMathTest, ExpAndLogMatchStandard)
+{
+    expectMaxErrors(
+        measure(
+            makeSamples(detail::kExpMin, detail::kExpMax, 100003),
+            [](Float32 value) { return fastExp(value); },
+            [](simd::VectorRegister4f value) { return fastExp(value); },
+            [](simd::VectorRegister8f value) { return fastExp(value); },
+            [](double value) { return std::exp(value); }
+        ),
+        2.0
+    );
+
+    // Values over the whole range of exponents, and the mantissas between two of them.
+    std::vector<Float32> samples = makeSamples(0.001f, 10.0f, 100003);
+    for (const Float32 value : makeSamples(-120.0f, 120.0f, 2400))
+    {
+        samples.push_back(std::exp2(value));
+    }
+    expectMaxErrors(
+        measure(
+            samples,
+            [](Float32 value) { return fastLog(value); },
+            [](simd::VectorRegister4f value) { return fastLog(value); },
+            [](simd::VectorRegister8f value) { return fastLog(value); },
+            [](double value) { return std::log(value); }
+        ),
+        1.0
+    );
+}
+
+TEST(FastMathTest, InverseSqrtMatchesStandard)
+{
+    expectMaxErrors(
+        measure(
+            makeSamples(0.001f, 1000.0f, 100003),
+            [](Float32 value) { return fastInverseSqrt(value); },
+            [](simd::VectorRegister4f value) { return fastInverseSqrt(value); },
+            [](simd::VectorRegister8f value) { return fastInverseSqrt(value); },
+            [](double value) { return 1.0 / std::sqrt(value); }
+        ),
+        4.0
+    );
+    EXPECT_EQ(fastInverseSqrt(0.0f), std::numeric_limits<Float32>::infinity());
+    EXPECT_EQ(simd::getLane<7>(fastInverseSqrt(simd::zero8f())), std::numeric_limits<Float32>::infinity());
+}
+
+}   // namespace gp::math::tests
@@ -164,4 +164,18 @@ TEST(ScalarTest, CountLeadingZeros)
     EXPECT_EQ(countLeadingZeros<uint32_t>(~0u), 0u);
 }
 
+TEST(ScalarTest, CountTrailingZeros)
+{
+    EXPECT_EQ(countTrailingZeros<uint32_t>(0), 32u);
+    EXPECT_EQ(countTrailingZeros<uint32_t>(1), 0u);
+    EXPECT_EQ(countTrailingZeros<uint64_t>(1ull << 40), 40u);
+}
+
+TEST(ScalarTest, PopCount)
+{
+    EXPECT_EQ(popCount<uint32_t>(0), 0u);
+    EXPECT_EQ(popCount<uint32_t>(0xf0f0u), 8u);
+    EXPECT_EQ(popCount<uint64_t>(~0ull), 64u);
+}
+
 }   // namespace gp::math::tests
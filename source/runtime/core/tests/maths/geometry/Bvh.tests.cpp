@@ -0,0 +1,330 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include <gtest/gtest.h>
+
+#include "maths/geometry/acceleration/WideBvh.hpp"
+#include <thread>
+#include <vector>
+
+namespace gp::math::tests
+{
+
+template <typename T>
+class BvhTest : public ::testing::Test
+{
+protected:
+    /// @brief Enough triangles for several build tasks and a few levels of wide nodes.
+    static constexpr Int32 kCount = 500;
+    static constexpr Int32 kRayCount = 64;
+
+    std::vector<T> vertices[3][3];   //<! The triangles in their original order, as vertices[vertex][axis].
+    std::vector<T> gathered[3][3];   //<! The triangles in the order of the primitive indices of a hierarchy.
+    std::vector<T> centers[3];       //<! The center of the bounding box of each triangle.
+    std::vector<T> extents[3];       //<! The half size of the bounding box of each triangle.
+
+    const T tolerance = T{ 1e-4 };
+
+protected:
+    void SetUp() override
+    {
+        generate(T{ 0 });
+    }
+
+    /// @brief Returns a pseudo-random value in [-1, 1).
+    static T random(UInt32& state)
+    {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<T>(state >> 8) / static_cast<T>(1u << 23) - T{ 1 };
+    }
+
+    /// @brief Returns a pseudo-random vector in [-1, 1) cubed.
+    static Vector3<T> randomVector(UInt32& state)
+    {
+        const T x = random(state);
+        const T y = random(state);
+        const T z = random(state);
+        return Vector3<T>(x, y, z);
+    }
+
+    /// @brief Scatters small triangles in a cube, moving some of them along x by @p motion, and bounds them.
+    void generate(const T motion)
+    {
+        UInt32 state = 12345u;
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            for (Int32 vertex = 0; vertex < 3; ++vertex)
+            {
+                vertices[vertex][axis].resize(kCount);
+            }
+            centers[axis].resize(kCount);
+            extents[axis].resize(kCount);
+        }
+
+        for (Int32 index = 0; index < kCount; ++index)
+        {
+            const Vector3<T> position =
+                randomVector(state) * T{ 10 } + Vector3<T>(motion * static_cast<T>(index % 3), T{ 0 }, T{ 0 });
+            Vector3<T> boundsMin(constants<T>::infinity);
+            Vector3<T> boundsMax(-constants<T>::infinity);
+            for (Int32 vertex = 0; vertex < 3; ++vertex)
+            {
+                const Vector3<T> corner = position + randomVector(state);
+                boundsMin = math::min(boundsMin, corner);
+                boundsMax = math::max(boundsMax, corner);
+                for (Int32 axis = 0; axis < 3; ++axis)
+                {
+                    vertices[vertex][axis][index] = corner[axis];
+                }
+            }
+            for (Int32 axis = 0; axis < 3; ++axis)
+            {
+                centers[axis][index] = (boundsMin[axis] + boundsMax[axis]) * T{ 0.5 };
+                extents[axis][index] = (boundsMax[axis] - boundsMin[axis]) * T{ 0.5 };
+            }
+        }
+    }
+
+    BoundingBoxStreams<T> getBounds() const
+    {
+        BoundingBoxStreams<T> bounds;
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            bounds.centers[axis] = ConstVectorView<T>(centers[axis].data(), kCount);
+            bounds.extents[axis] = ConstVectorView<T>(extents[axis].data(), kCount);
+        }
+        return bounds;
+    }
+
+    static TriangleStreams<T> getTriangles(const std::vector<T> (&streams)[3][3])
+    {
+        TriangleStreams<T> triangles;
+        for (Int32 vertex = 0; vertex < 3; ++vertex)
+        {
+            for (Int32 axis = 0; axis < 3; ++axis)
+            {
+                triangles.vertices[vertex][axis] = ConstVectorView<T>(streams[vertex][axis].data(), kCount);
+            }
+        }
+        return triangles;
+    }
+
+    /// @brief Gathers the triangles in the order of the primitive indices of a hierarchy.
+    TriangleStreams<T> gather(const Bvh<T>& bvh)
+    {
+        const ConstVectorView<Int32> order = bvh.getPrimitiveIndices();
+        for (Int32 vertex = 0; vertex < 3; ++vertex)
+        {
+            for (Int32 axis = 0; axis < 3; ++axis)
+            {
+                gathered[vertex][axis].resize(kCount);
+                for (Int32 index = 0; index < kCount; ++index)
+                {
+                    gathered[vertex][axis][index] = vertices[vertex][axis][order[index]];
+                }
+            }
+        }
+        return getTriangles(gathered);
+    }
+
+    /// @brief Checks the bounds of every node, the leaf sizes, and that the leaves cover every primitive once.
+    void expectValid(const Bvh<T>& bvh) const
+    {
+        const ConstVectorView<BvhNode<T>> nodes = bvh.getNodes();
+        const ConstVectorView<Int32> order = bvh.getPrimitiveIndices();
+        EXPECT_LE(nodes.size(), Bvh<T>::getMaxNodeCount(kCount));
+
+        std::vector<Int32> coverage(kCount, 0);
+        for (Int32 node = 0; node < nodes.size(); ++node)
+        {
+            const BvhNode<T>& current = nodes[node];
+            if (!current.isLeaf())
+            {
+                ASSERT_GT(current.index, node);
+                for (Int32 child = current.index; child < current.index + 2; ++child)
+                {
+                    EXPECT_EQ(math::min(nodes[child].boundsMin, current.boundsMin), current.boundsMin);
+                    EXPECT_EQ(math::max(nodes[child].boundsMax, current.boundsMax), current.boundsMax);
+                }
+                continue;
+            }
+
+            EXPECT_LE(current.count, Bvh<T>::kMaxLeafSize);
+            for (Int32 index = current.index; index < current.index + current.count; ++index)
+            {
+                const Int32 primitive = order[index];
+                ++coverage[primitive];
+                for (Int32 axis = 0; axis < 3; ++axis)
+                {
+                    EXPECT_GE(centers[axis][primitive] - extents[axis][primitive], current.boundsMin[axis]);
+                    EXPECT_LE(centers[axis][primitive] + extents[axis][primitive], current.boundsMax[axis]);
+                }
+            }
+        }
+        for (Int32 primitive = 0; primitive < kCount; ++primitive)
+        {
+            EXPECT_EQ(coverage[primitive], 1);
+        }
+    }
+
+    /// @brief Checks that two hierarchies have the same tree, whatever the order of their nodes.
+    static void expectSameTree(const Bvh<T>& a, const Int32 nodeA, const Bvh<T>& b, const Int32 nodeB)
+    {
+        const BvhNode<T>& lhs = a.getNodes()[nodeA];
+        const BvhNode<T>& rhs = b.getNodes()[nodeB];
+        ASSERT_EQ(lhs.count, rhs.count);
+        EXPECT_EQ(lhs.boundsMin, rhs.boundsMin);
+        EXPECT_EQ(lhs.boundsMax, rhs.boundsMax);
+        if (lhs.isLeaf())
+        {
+            EXPECT_EQ(lhs.index, rhs.index);
+            return;
+        }
+        expectSameTree(a, lhs.index, b, rhs.index);
+        expectSameTree(a, lhs.index + 1, b, rhs.index + 1);
+    }
+
+    /// @brief Checks the queries of a hierarchy against the batch queries of Ray over every triangle.
+    template <typename Hierarchy>
+    void expectQueriesMatch(const Hierarchy& hierarchy, const TriangleStreams<T>& triangles) const
+    {
+        const TriangleStreams<T> original = getTriangles(vertices);
+        UInt32 state = 6789u;
+        Int32 hitCount = 0;
+        for (Int32 index = 0; index < kRayCount; ++index)
+        {
+            const Vector3<T> origin = randomVector(state) * T{ 15 };
+            const Vector3<T> target = randomVector(state) * T{ 10 };
+            const Ray<T> ray(origin, target - origin);
+
+            RayHit<T> expected;
+            RayHit<T> hit;
+            const bool isExpected = ray.intersectTriangles(original, expected);
+            ASSERT_EQ(hierarchy.intersectClosest(ray, triangles, hit), isExpected);
+            EXPECT_EQ(hierarchy.intersectsAny(ray, triangles, constants<T>::infinity), isExpected);
+            if (!isExpected)
+            {
+                continue;
+            }
+
+            ++hitCount;
+            EXPECT_EQ(hit.index, expected.index);
+            EXPECT_NEAR(hit.distance, expected.distance, this->tolerance);
+            EXPECT_NEAR(hit.u, expected.u, this->tolerance);
+            EXPECT_NEAR(hit.v, expected.v, this->tolerance);
+            const T halfDistance = expected.distance * T{ 0.5 };
+            EXPECT_EQ(
+                hierarchy.intersectsAny(ray, triangles, halfDistance), ray.intersectsAnyTriangle(original, halfDistance)
+            );
+            EXPECT_FALSE(hierarchy.intersectsAny(ray, triangles, expected.distance - this->tolerance));
+        }
+        EXPECT_GT(hitCount, 0);
+        EXPECT_LT(hitCount, kRayCount);
+    }
+};
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(BvhTest, FloatingPointTypes);
+
+TYPED_TEST(BvhTest, BuildsValidHierarchies)
+{
+    constexpr Int32 kCount = TestFixture::kCount;
+    std::vector<BvhNode<TypeParam>> nodes(Bvh<TypeParam>::getMaxNodeCount(kCount));
+    std::vector<Int32> primitives(kCount);
+    Bvh<TypeParam> bvh(nodes, primitives);
+    bvh.build(this->getBounds());
+    this->expectValid(bvh);
+    EXPECT_GT(bvh.getNodeCount(), kCount / Bvh<TypeParam>::kMaxLeafSize);
+
+    // An empty hierarchy has a single empty leaf, that no ray hits.
+    BvhNode<TypeParam> emptyNodes[1];
+    Bvh<TypeParam> empty(emptyNodes, VectorView<Int32>());
+    empty.build(BoundingBoxStreams<TypeParam>());
+    WideBvhNode<TypeParam, 8> emptyWideNodes[1];
+    Bvh8<TypeParam> emptyWide(emptyWideNodes);
+    emptyWide.collapse(empty);
+    RayHit<TypeParam> hit;
+    EXPECT_EQ(empty.getNodeCount(), 1);
+    EXPECT_FALSE(empty.intersectClosest(Ray<TypeParam>(), TriangleStreams<TypeParam>(), hit));
+    EXPECT_FALSE(emptyWide.intersectClosest(Ray<TypeParam>(), TriangleStreams<TypeParam>(), hit));
+    EXPECT_FALSE(emptyWide.intersectsAny(Ray<TypeParam>(), TriangleStreams<TypeParam>(), TypeParam{ 1 }));
+}
+
+TYPED_TEST(BvhTest, ParallelBuildMatchesSerialBuild)
+{
+    constexpr Int32 kCount = TestFixture::kCount;
+    const BoundingBoxStreams<TypeParam> bounds = this->getBounds();
+    std::vector<BvhNode<TypeParam>> serialNodes(Bvh<TypeParam>::getMaxNodeCount(kCount));
+    std::vector<Int32> serialPrimitives(kCount);
+    Bvh<TypeParam> serial(serialNodes, serialPrimitives);
+    serial.build(bounds);
+
+    std::vector<BvhNode<TypeParam>> nodes(Bvh<TypeParam>::getMaxNodeCount(kCount));
+    std::vector<Int32> primitives(kCount);
+    Bvh<TypeParam> parallel(nodes, primitives);
+    BvhBuildTask tasks[8];
+    const Int32 taskCount = parallel.beginBuild(bounds, tasks, 32);
+    ASSERT_GT(taskCount, 1);
+
+    std::vector<std::thread> threads;
+    for (Int32 task = 0; task < taskCount; ++task)
+    {
+        threads.emplace_back([&parallel, &bounds, &tasks, task]() { parallel.buildSubtree(bounds, tasks[task]); });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    parallel.endBuild(ConstVectorView<BvhBuildTask>(tasks, taskCount));
+
+    this->expectValid(parallel);
+    EXPECT_EQ(parallel.getNodeCount(), serial.getNodeCount());
+    EXPECT_EQ(primitives, serialPrimitives);
+    this->expectSameTree(parallel, 0, serial, 0);
+}
+
+TYPED_TEST(BvhTest, QueriesMatchBruteForce)
+{
+    constexpr Int32 kCount = TestFixture::kCount;
+    std::vector<BvhNode<TypeParam>> nodes(Bvh<TypeParam>::getMaxNodeCount(kCount));
+    std::vector<Int32> primitives(kCount);
+    Bvh<TypeParam> bvh(nodes, primitives);
+    bvh.build(this->getBounds());
+    const TriangleStreams<TypeParam> triangles = this->gather(bvh);
+    this->expectQueriesMatch(bvh, triangles);
+
+    std::vector<WideBvhNode<TypeParam, 4>> nodes4(Bvh4<TypeParam>::getMaxNodeCount(bvh));
+    Bvh4<TypeParam> bvh4(nodes4);
+    bvh4.collapse(bvh);
+    EXPECT_LT(bvh4.getNodeCount(), bvh.getNodeCount() / 2);
+    this->expectQueriesMatch(bvh4, triangles);
+
+    std::vector<WideBvhNode<TypeParam, 8>> nodes8(Bvh8<TypeParam>::getMaxNodeCount(bvh));
+    Bvh8<TypeParam> bvh8(nodes8);
+    bvh8.collapse(bvh);
+    EXPECT_LT(bvh8.getNodeCount(), bvh4.getNodeCount());
+    this->expectQueriesMatch(bvh8, triangles);
+}
+
+TYPED_TEST(BvhTest, RefitFollowsMovingTriangles)
+{
+    constexpr Int32 kCount = TestFixture::kCount;
+    std::vector<BvhNode<TypeParam>> nodes(Bvh<TypeParam>::getMaxNodeCount(kCount));
+    std::vector<Int32> primitives(kCount);
+    Bvh<TypeParam> bvh(nodes, primitives);
+    bvh.build(this->getBounds());
+
+    this->generate(TypeParam{ 2 });
+    bvh.refit(this->getBounds());
+    this->expectValid(bvh);
+    const TriangleStreams<TypeParam> triangles = this->gather(bvh);
+    this->expectQueriesMatch(bvh, triangles);
+
+    std::vector<WideBvhNode<TypeParam, 8>> nodes8(Bvh8<TypeParam>::getMaxNodeCount(bvh));
+    Bvh8<TypeParam> bvh8(nodes8);
+    bvh8.collapse(bvh);
+    this->expectQueriesMatch(bvh8, triangles);
+}
+
+}   // namespace gp::math::tests
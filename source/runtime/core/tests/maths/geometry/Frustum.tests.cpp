@@ -0,0 +1,167 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include <gtest/gtest.h>
+
+#include "maths/geometry/primitives/Frustum.hpp"
+
+namespace gp::math::tests
+{
+
+template <typename T>
+class FrustumTest : public ::testing::Test
+{
+protected:
+    /// @brief A perspective projection looking down +z, with a 90 degrees field of view, near = 1 and far = 100.
+    static Matrix4x4<T> makePerspective()
+    {
+        constexpr T kNear = 1;
+        constexpr T kFar = 100;
+        return Matrix4x4<T>(
+            1, 0, 0, 0, 0, 1, 0, 0, 0, 0, kFar / (kFar - kNear), -kNear * kFar / (kFar - kNear), 0, 0, 1, 0
+        );
+    }
+
+    /// @brief The same projection with reverse-Z and an infinite far plane: depth is near / z.
+    static Matrix4x4<T> makeReverseInfinitePerspective()
+    {
+        return Matrix4x4<T>(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0);
+    }
+
+    const T tolerance = T{ 1e-5 };
+};
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(FrustumTest, FloatingPointTypes);
+
+TYPED_TEST(FrustumTest, PlanesAndSpheresAnswerQueries)
+{
+    constexpr Plane<TypeParam> plane(Vector3<TypeParam>(0, 0, 2), Vector3<TypeParam>(0, 0, 3));
+    static_assert(plane.getSignedDistance(Vector3<TypeParam>(5, 5, 4)) == TypeParam{ 2 });
+    EXPECT_TRUE(plane.normalized().equals(Plane<TypeParam>(Vector3<TypeParam>(0, 0, 1), TypeParam{ -3 })));
+    EXPECT_EQ(plane.normalized().projectPoint(Vector3<TypeParam>(1, 2, 7)), Vector3<TypeParam>(1, 2, 3));
+    EXPECT_LT(plane.flipped().getSignedDistance(Vector3<TypeParam>(0, 0, 4)), TypeParam{ 0 });
+
+    constexpr Sphere<TypeParam> sphere(Vector3<TypeParam>(1, 0, 0), 2);
+    static_assert(sphere.contains(Vector3<TypeParam>(3, 0, 0)) && !sphere.contains(Vector3<TypeParam>(3, 1, 0)));
+    EXPECT_TRUE(sphere.intersects(Sphere<TypeParam>(Vector3<TypeParam>(5, 0, 0), 2)));
+    EXPECT_FALSE(sphere.intersects(Sphere<TypeParam>(Vector3<TypeParam>(5, 0, 0), 1)));
+    EXPECT_TRUE(sphere.merged(Sphere<TypeParam>(Vector3<TypeParam>(5, 0, 0), 1))
+                    .equals(Sphere<TypeParam>(Vector3<TypeParam>(TypeParam{ 2.5 }, 0, 0), TypeParam{ 3.5 })));
+    EXPECT_EQ(sphere.merged(Sphere<TypeParam>(Vector3<TypeParam>(2, 0, 0), TypeParam{ 0.5 })), sphere);
+}
+
+TYPED_TEST(FrustumTest, ExtractsPlanesFromViewProjections)
+{
+    // The default frustum is the clip volume itself.
+    constexpr Frustum<TypeParam> clip;
+    static_assert(clip.contains(Vector3<TypeParam>(TypeParam{ 0.5 }, -1, TypeParam{ 0.5 })));
+    static_assert(!clip.contains(Vector3<TypeParam>(0, 0, TypeParam{ -0.1 })));
+    static_assert(!clip.contains(Vector3<TypeParam>(TypeParam{ 1.5 }, 0, TypeParam{ 0.5 })));
+
+    const Frustum<TypeParam> frustum(this->makePerspective());
+    for (const Plane<TypeParam>& plane : frustum.planes)
+    {
+        EXPECT_NEAR(plane.normal.length(), TypeParam{ 1 }, this->tolerance);
+    }
+    EXPECT_TRUE(frustum.planes[Frustum<TypeParam>::kNear].equals(
+        Plane<TypeParam>(Vector3<TypeParam>(0, 0, 1), TypeParam{ -1 }), this->tolerance
+    ));
+    // Float32 loses a few bits to the cancellation of row3 - row2 on the far plane.
+    EXPECT_TRUE(frustum.planes[Frustum<TypeParam>::kFar].equals(
+        Plane<TypeParam>(Vector3<TypeParam>(0, 0, -1), TypeParam{ 100 }), TypeParam{ 1e-3 }
+    ));
+    EXPECT_TRUE(frustum.contains(Vector3<TypeParam>(0, 0, 50)));
+    EXPECT_TRUE(frustum.contains(Vector3<TypeParam>(9, -9, 10)));
+    EXPECT_FALSE(frustum.contains(Vector3<TypeParam>(11, 0, 10)));
+    EXPECT_FALSE(frustum.contains(Vector3<TypeParam>(0, 0, TypeParam{ 0.5 })));
+    EXPECT_FALSE(frustum.contains(Vector3<TypeParam>(0, 0, 101)));
+
+    EXPECT_TRUE(frustum.intersects(Sphere<TypeParam>(Vector3<TypeParam>(12, 0, 10), 2)));
+    EXPECT_FALSE(frustum.intersects(Sphere<TypeParam>(Vector3<TypeParam>(12, 0, 10), 1)));
+    EXPECT_TRUE(frustum.intersectsBox(Vector3<TypeParam>(0, 0, -1), Vector3<TypeParam>(1, 1, 3)));
+    EXPECT_FALSE(frustum.intersectsBox(Vector3<TypeParam>(0, 0, -1), Vector3<TypeParam>(1, 1, 1)));
+
+    // Reverse-Z swaps the depth planes, and the infinite far plane lets everything through.
+    const Frustum<TypeParam> reversed(this->makeReverseInfinitePerspective());
+    EXPECT_EQ(reversed.planes[Frustum<TypeParam>::kNear].normal, Vector3<TypeParam>(TypeParam{ 0 }));
+    EXPECT_TRUE(reversed.planes[Frustum<TypeParam>::kFar].equals(
+        Plane<TypeParam>(Vector3<TypeParam>(0, 0, 1), TypeParam{ -1 }), this->tolerance
+    ));
+    EXPECT_TRUE(reversed.contains(Vector3<TypeParam>(0, 0, TypeParam{ 1e6 })));
+    EXPECT_FALSE(reversed.contains(Vector3<TypeParam>(0, 0, TypeParam{ 0.5 })));
+}
+
+TYPED_TEST(FrustumTest, BatchCullingMatchesSingleTests)
+{
+    // Thirty-seven objects cover full blocks, a second mask word and a partial block, visible or not.
+    constexpr Int32 kCount = 37;
+    TypeParam centers[3][kCount];
+    TypeParam radii[kCount];
+    TypeParam extents[3][kCount];
+    for (Int32 index = 0; index < kCount; ++index)
+    {
+        centers[0][index] = static_cast<TypeParam>((index % 7 - 3) * 4);
+        centers[1][index] = static_cast<TypeParam>((index % 5 - 2) * 3);
+        centers[2][index] = static_cast<TypeParam>((index % 9) * 15 - 20);
+        radii[index] = TypeParam{ 0.5 } + static_cast<TypeParam>(index % 3);
+        extents[0][index] = radii[index];
+        extents[1][index] = static_cast<TypeParam>(index % 4);
+        extents[2][index] = TypeParam{ 2 };
+    }
+
+    BoundingSphereStreams<TypeParam> spheres;
+    BoundingBoxStreams<TypeParam> boxes;
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        spheres.centers[axis] = ConstVectorView<TypeParam>(centers[axis]);
+        boxes.centers[axis] = ConstVectorView<TypeParam>(centers[axis]);
+        boxes.extents[axis] = ConstVectorView<TypeParam>(extents[axis]);
+    }
+    spheres.radii = ConstVectorView<TypeParam>(radii);
+
+    const Frustum<TypeParam> frustum(this->makePerspective());
+    static_assert(Frustum<TypeParam>::getVisibilityMaskSize(kCount) == 2);
+    UInt32 sphereMask[2] = { ~0u, ~0u };
+    UInt32 boxMask[2] = { ~0u, ~0u };
+    Int32 sphereIndices[kCount];
+    Int32 boxIndices[kCount];
+    frustum.cullSpheres(spheres, sphereMask);
+    frustum.cullBoxes(boxes, boxMask);
+    const Int32 visibleSphereCount = frustum.cullSpheres(spheres, sphereIndices);
+    const Int32 visibleBoxCount = frustum.cullBoxes(boxes, boxIndices);
+
+    Int32 expectedSphereCount = 0;
+    Int32 expectedBoxCount = 0;
+    for (Int32 index = 0; index < kCount; ++index)
+    {
+        const Vector3<TypeParam> center(centers[0][index], centers[1][index], centers[2][index]);
+        const bool sphereVisible = frustum.intersects(Sphere<TypeParam>(center, radii[index]));
+        const bool boxVisible = frustum.intersectsBox(
+            center, Vector3<TypeParam>(extents[0][index], extents[1][index], extents[2][index])
+        );
+        EXPECT_EQ(((sphereMask[index / 32] >> (index % 32)) & 1u) != 0, sphereVisible);
+        EXPECT_EQ(((boxMask[index / 32] >> (index % 32)) & 1u) != 0, boxVisible);
+        if (sphereVisible)
+        {
+            EXPECT_EQ(sphereIndices[expectedSphereCount++], index);
+        }
+        if (boxVisible)
+        {
+            EXPECT_EQ(boxIndices[expectedBoxCount++], index);
+        }
+    }
+    EXPECT_EQ(visibleSphereCount, expectedSphereCount);
+    EXPECT_EQ(visibleBoxCount, expectedBoxCount);
+    EXPECT_GT(expectedSphereCount, 0);
+    EXPECT_LT(expectedSphereCount, kCount);
+    EXPECT_GT(expectedBoxCount, 0);
+    EXPECT_LT(expectedBoxCount, kCount);
+
+    // The bits past the last object are cleared.
+    EXPECT_EQ(sphereMask[1] >> (kCount - 32), 0u);
+    EXPECT_EQ(boxMask[1] >> (kCount - 32), 0u);
+}
+
+}   // namespace gp::math::tests
@@ -0,0 +1,237 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include <gtest/gtest.h>
+
+#include "maths/geometry/primitives/Ray.hpp"
+
+namespace gp::math::tests
+{
+
+template <typename T>
+class RayTest : public ::testing::Test
+{
+protected:
+    /// @brief Thirteen primitives cover a packet of eight, one of four and the remainder.
+    static constexpr Int32 kCount = 13;
+
+    /// @brief A ray slightly off the z axis, that misses some of the primitives of the batches.
+    static Ray<T> makeRay()
+    {
+        return Ray<T>(Vector3<T>(T{ 0.1 }, T{ 0.2 }, T{ -1 }), Vector3<T>(T{ 0.05 }, T{ 0.02 }, T{ 1 }));
+    }
+
+    const T tolerance = T{ 1e-4 };
+};
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(RayTest, FloatingPointTypes);
+
+TYPED_TEST(RayTest, IntersectsSingleTriangles)
+{
+    const Triangle<TypeParam> triangle(
+        Vector3<TypeParam>(0, 0, 0), Vector3<TypeParam>(1, 0, 0), Vector3<TypeParam>(0, 1, 0)
+    );
+    const Vector3<TypeParam> origin(TypeParam{ 0.2 }, TypeParam{ 0.3 }, TypeParam{ -5 });
+    const Ray<TypeParam> ray(origin, Vector3<TypeParam>(0, 0, 2));
+
+    RayHit<TypeParam> hit;
+    ASSERT_TRUE(ray.intersectsTriangle(triangle, hit));
+    EXPECT_NEAR(hit.distance, TypeParam{ 2.5 }, this->tolerance);
+    EXPECT_NEAR(hit.u, TypeParam{ 0.2 }, this->tolerance);
+    EXPECT_NEAR(hit.v, TypeParam{ 0.3 }, this->tolerance);
+    EXPECT_TRUE(triangle.getPoint(hit.u, hit.v).equals(ray.getPoint(hit.distance), this->tolerance));
+    EXPECT_EQ(triangle.getNormal(), Vector3<TypeParam>(0, 0, 1));
+    EXPECT_EQ(triangle.getArea(), TypeParam{ 0.5 });
+
+    // Both faces are hit, and the distance bound, the edges and parallel rays are respected.
+    RayHit<TypeParam> missed;
+    EXPECT_TRUE(Ray<TypeParam>(-origin, Vector3<TypeParam>(0, 0, -1)).intersectsTriangle(
+        Triangle<TypeParam>(-triangle.v0, -triangle.v1, -triangle.v2), missed
+    ));
+    EXPECT_FALSE(ray.intersectsTriangle(triangle, missed, TypeParam{ 2 }));
+    EXPECT_FALSE(Ray<TypeParam>(origin, Vector3<TypeParam>(0, 0, -1)).intersectsTriangle(triangle, missed));
+    EXPECT_FALSE(Ray<TypeParam>(Vector3<TypeParam>(TypeParam{ 0.6 }, TypeParam{ 0.6 }, TypeParam{ -1 }),
+                                Vector3<TypeParam>(0, 0, 1))
+                     .intersectsTriangle(triangle, missed));
+    EXPECT_FALSE(Ray<TypeParam>(origin, Vector3<TypeParam>(1, 0, 0)).intersectsTriangle(triangle, missed));
+}
+
+TYPED_TEST(RayTest, IntersectsSmallTriangles)
+{
+    // Edges of 1e-5 give a determinant around 1e-10, far below any absolute epsilon.
+    constexpr Int32 kCount = TestFixture::kCount;
+    const TypeParam size = TypeParam{ 1e-5 };
+    TypeParam vertices[3][3][kCount];
+    for (Int32 index = 0; index < kCount; ++index)
+    {
+        const TypeParam z = TypeParam{ 1 } + static_cast<TypeParam>(index);
+        const Vector3<TypeParam> corners[3] = { Vector3<TypeParam>(0, 0, z),
+                                                Vector3<TypeParam>(size, 0, z),
+                                                Vector3<TypeParam>(0, size, z) };
+        for (Int32 vertex = 0; vertex < 3; ++vertex)
+        {
+            vertices[vertex][0][index] = corners[vertex].x;
+            vertices[vertex][1][index] = corners[vertex].y;
+            vertices[vertex][2][index] = corners[vertex].z;
+        }
+    }
+
+    const Ray<TypeParam> ray(Vector3<TypeParam>(size / 4, size / 4, 0), Vector3<TypeParam>(0, 0, 1));
+    const Triangle<TypeParam> triangle(
+        Vector3<TypeParam>(0, 0, 1), Vector3<TypeParam>(size, 0, 1), Vector3<TypeParam>(0, size, 1)
+    );
+    RayHit<TypeParam> hit;
+    ASSERT_TRUE(ray.intersectsTriangle(triangle, hit));
+    EXPECT_NEAR(hit.distance, TypeParam{ 1 }, this->tolerance);
+    EXPECT_NEAR(hit.u, TypeParam{ 0.25 }, this->tolerance);
+    EXPECT_NEAR(hit.v, TypeParam{ 0.25 }, this->tolerance);
+
+    TriangleStreams<TypeParam> triangles;
+    for (Int32 vertex = 0; vertex < 3; ++vertex)
+    {
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            triangles.vertices[vertex][axis] = ConstVectorView<TypeParam>(vertices[vertex][axis]);
+        }
+    }
+    RayHit<TypeParam> batchHit;
+    ASSERT_TRUE(ray.intersectTriangles(triangles, batchHit));
+    EXPECT_EQ(batchHit.index, 0);
+    EXPECT_NEAR(batchHit.distance, TypeParam{ 1 }, this->tolerance);
+    EXPECT_TRUE(ray.intersectsAnyTriangle(triangles, constants<TypeParam>::infinity));
+}
+
+TYPED_TEST(RayTest, IntersectsSingleBoxes)
+{
+    const Vector3<TypeParam> center(0, 0, 10);
+    const Vector3<TypeParam> extents(1, 2, 1);
+    const Ray<TypeParam> ray;
+
+    TypeParam distance = -1;
+    ASSERT_TRUE(ray.intersectsBox(center, extents, distance));
+    EXPECT_NEAR(distance, TypeParam{ 9 }, this->tolerance);
+    EXPECT_FALSE(ray.intersectsBox(center, extents, distance, TypeParam{ 8 }));
+
+    // Starting inside gives a distance of zero, going sideways or backwards misses.
+    ASSERT_TRUE(Ray<TypeParam>(center, Vector3<TypeParam>(1, 1, 0)).intersectsBox(center, extents, distance));
+    EXPECT_EQ(distance, TypeParam{ 0 });
+    EXPECT_FALSE(Ray<TypeParam>(Vector3<TypeParam>(3, 0, 0), Vector3<TypeParam>(0, 0, 1))
+                     .intersectsBox(center, extents, distance));
+    EXPECT_FALSE(Ray<TypeParam>(Vector3<TypeParam>(0, 0, 12), Vector3<TypeParam>(0, 0, 1))
+                     .intersectsBox(center, extents, distance));
+}
+
+TYPED_TEST(RayTest, BatchTrianglesMatchSingleOnes)
+{
+    constexpr Int32 kCount = TestFixture::kCount;
+    TypeParam vertices[3][3][kCount];
+    for (Int32 index = 0; index < kCount; ++index)
+    {
+        // Every third triangle is off to the side, the others are stacked at decreasing depths.
+        const TypeParam x = index % 3 == 0 ? TypeParam{ 5 } : TypeParam{ 0 };
+        const TypeParam z = TypeParam{ 20 } - static_cast<TypeParam>(index) * TypeParam{ 1.3 };
+        const Vector3<TypeParam> corners[3] = { Vector3<TypeParam>(x - 2, -2, z),
+                                                Vector3<TypeParam>(x + 2, -2, z + TypeParam{ 0.5 }),
+                                                Vector3<TypeParam>(x, 2, z - TypeParam{ 0.3 }) };
+        for (Int32 vertex = 0; vertex < 3; ++vertex)
+        {
+            vertices[vertex][0][index] = corners[vertex].x;
+            vertices[vertex][1][index] = corners[vertex].y;
+            vertices[vertex][2][index] = corners[vertex].z;
+        }
+    }
+
+    TriangleStreams<TypeParam> triangles;
+    for (Int32 vertex = 0; vertex < 3; ++vertex)
+    {
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            triangles.vertices[vertex][axis] = ConstVectorView<TypeParam>(vertices[vertex][axis]);
+        }
+    }
+
+    const Ray<TypeParam> ray = this->makeRay();
+    RayHit<TypeParam> expected;
+    for (Int32 index = 0; index < kCount; ++index)
+    {
+        const Triangle<TypeParam> triangle(
+            Vector3<TypeParam>(vertices[0][0][index], vertices[0][1][index], vertices[0][2][index]),
+            Vector3<TypeParam>(vertices[1][0][index], vertices[1][1][index], vertices[1][2][index]),
+            Vector3<TypeParam>(vertices[2][0][index], vertices[2][1][index], vertices[2][2][index])
+        );
+        if (ray.intersectsTriangle(triangle, expected, expected.distance))
+        {
+            expected.index = index;
+        }
+    }
+    ASSERT_EQ(expected.index, 11);
+
+    RayHit<TypeParam> hit;
+    ASSERT_TRUE(ray.intersectTriangles(triangles, hit));
+    EXPECT_EQ(hit.index, expected.index);
+    EXPECT_NEAR(hit.distance, expected.distance, this->tolerance);
+    EXPECT_NEAR(hit.u, expected.u, this->tolerance);
+    EXPECT_NEAR(hit.v, expected.v, this->tolerance);
+
+    // A closer hit from a previous batch is kept.
+    RayHit<TypeParam> closer;
+    closer.distance = TypeParam{ 1 };
+    closer.index = 42;
+    EXPECT_FALSE(ray.intersectTriangles(triangles, closer));
+    EXPECT_EQ(closer.index, 42);
+
+    EXPECT_TRUE(ray.intersectsAnyTriangle(triangles, constants<TypeParam>::infinity));
+    EXPECT_FALSE(ray.intersectsAnyTriangle(triangles, expected.distance - this->tolerance));
+}
+
+TYPED_TEST(RayTest, BatchBoxesMatchSingleOnes)
+{
+    constexpr Int32 kCount = TestFixture::kCount;
+    TypeParam centers[3][kCount];
+    TypeParam extents[3][kCount];
+    for (Int32 index = 0; index < kCount; ++index)
+    {
+        centers[0][index] = static_cast<TypeParam>(index % 4 - 1) * TypeParam{ 3 };
+        centers[1][index] = TypeParam{ 0.5 };
+        centers[2][index] = static_cast<TypeParam>(5 + index);
+        extents[0][index] = TypeParam{ 1 };
+        extents[1][index] = TypeParam{ 1 } + static_cast<TypeParam>(index % 2);
+        extents[2][index] = TypeParam{ 0.5 };
+    }
+
+    BoundingBoxStreams<TypeParam> boxes;
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        boxes.centers[axis] = ConstVectorView<TypeParam>(centers[axis]);
+        boxes.extents[axis] = ConstVectorView<TypeParam>(extents[axis]);
+    }
+
+    const Ray<TypeParam> ray = this->makeRay();
+    constexpr TypeParam kMaxDistance = 15;
+    TypeParam distances[kCount];
+    const Int32 hitCount = ray.intersectBoxes(boxes, distances, kMaxDistance);
+
+    Int32 expectedHitCount = 0;
+    for (Int32 index = 0; index < kCount; ++index)
+    {
+        TypeParam expected = constants<TypeParam>::infinity;
+        const Vector3<TypeParam> center(centers[0][index], centers[1][index], centers[2][index]);
+        const Vector3<TypeParam> extent(extents[0][index], extents[1][index], extents[2][index]);
+        if (ray.intersectsBox(center, extent, expected, kMaxDistance))
+        {
+            ++expectedHitCount;
+            EXPECT_NEAR(distances[index], expected, this->tolerance);
+        }
+        else
+        {
+            EXPECT_EQ(distances[index], constants<TypeParam>::infinity);
+        }
+    }
+    EXPECT_EQ(hitCount, expectedHitCount);
+    EXPECT_GT(hitCount, 0);
+    EXPECT_LT(hitCount, kCount);
+}
+
+}   // namespace gp::math::tests
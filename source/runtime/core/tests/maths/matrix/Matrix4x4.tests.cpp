@@ -0,0 +1,172 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include <gtest/gtest.h>
+
+#include "maths/matrix/Matrix4x4.hpp"
+
+namespace gp::math::tests
+{
+
+template <typename T>
+class Matrix4x4Test : public ::testing::Test
+{
+protected:
+    /// @brief A well-conditioned affine matrix: rotation about z, non-uniform scale and translation.
+    static Matrix4x4<T> makeAffine()
+    {
+        return Matrix4x4<T>(
+            T{ 0 }, T{ -2 }, T{ 0 }, T{ 5 },
+            T{ 1 }, T{ 0 }, T{ 0 }, T{ -3 },
+            T{ 0 }, T{ 0 }, T{ 4 }, T{ 1 },
+            T{ 0 }, T{ 0 }, T{ 0 }, T{ 1 }
+        );
+    }
+
+    /// @brief A general matrix, with a projective last row.
+    static Matrix4x4<T> makeGeneral()
+    {
+        return Matrix4x4<T>(
+            T{ 2 }, T{ 1 }, T{ 0 }, T{ 3 },
+            T{ 0 }, T{ 3 }, T{ 1 }, T{ 0 },
+            T{ 1 }, T{ 0 }, T{ 4 }, T{ 2 },
+            T{ 0 }, T{ 1 }, T{ 0 }, T{ 1 }
+        );
+    }
+
+    const T tolerance = T{ 1e-5 };
+};
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(Matrix4x4Test, FloatingPointTypes);
+
+TYPED_TEST(Matrix4x4Test, DefaultIsIdentityAndAligned)
+{
+    constexpr Matrix4x4<TypeParam> matrix;
+    static_assert(matrix == Matrix4x4<TypeParam>::identity());
+    static_assert(alignof(Matrix4x4<TypeParam>) >= 16);
+
+    EXPECT_EQ(matrix(0, 0), TypeParam{ 1 });
+    EXPECT_EQ(matrix(0, 1), TypeParam{ 0 });
+    EXPECT_TRUE(matrix.isAffine());
+}
+
+TYPED_TEST(Matrix4x4Test, MultiplyMatchesScalarDefinition)
+{
+    const Matrix4x4<TypeParam> a = this->makeGeneral();
+    const Matrix4x4<TypeParam> b = this->makeAffine();
+    const Matrix4x4<TypeParam> product = a * b;
+
+    for (Int32 row = 0; row < 4; ++row)
+    {
+        for (Int32 column = 0; column < 4; ++column)
+        {
+            TypeParam expected{ 0 };
+            for (Int32 k = 0; k < 4; ++k)
+            {
+                expected += a(row, k) * b(k, column);
+            }
+            EXPECT_NEAR(product(row, column), expected, this->tolerance);
+        }
+    }
+
+    // Constant evaluation takes the scalar path.
+    constexpr Matrix4x4<TypeParam> translation = Matrix4x4<TypeParam>::makeTranslation(Vector3<TypeParam>(1, 2, 3));
+    constexpr Matrix4x4<TypeParam> twice = translation * translation;
+    static_assert(twice.m[2][3] == TypeParam{ 6 });
+
+    Matrix4x4<TypeParam> accumulated = a;
+    accumulated *= b;
+    EXPECT_TRUE(accumulated.equals(product));
+}
+
+TYPED_TEST(Matrix4x4Test, Transpose)
+{
+    const Matrix4x4<TypeParam> matrix = this->makeGeneral();
+    const Matrix4x4<TypeParam> transposed = matrix.transposed();
+    for (Int32 row = 0; row < 4; ++row)
+    {
+        EXPECT_EQ(transposed.getRow(row).x, matrix.getColumn(row).x);
+        EXPECT_EQ(transposed.getRow(row).w, matrix.getColumn(row).w);
+    }
+    EXPECT_EQ(transposed.transposed(), matrix);
+}
+
+TYPED_TEST(Matrix4x4Test, InverseAndDeterminant)
+{
+    const Matrix4x4<TypeParam> general = this->makeGeneral();
+    EXPECT_NEAR(general.determinant(), TypeParam{ 26 }, this->tolerance);
+    EXPECT_TRUE((general * general.inverse()).equals(Matrix4x4<TypeParam>::identity(), this->tolerance));
+    EXPECT_TRUE((general.inverse() * general).equals(Matrix4x4<TypeParam>::identity(), this->tolerance));
+
+    const Matrix4x4<TypeParam> affine = this->makeAffine();
+    EXPECT_TRUE(affine.inverseAffine().equals(affine.inverse(), this->tolerance));
+    EXPECT_TRUE((affine * affine.inverseAffine()).equals(Matrix4x4<TypeParam>::identity(), this->tolerance));
+}
+
+TYPED_TEST(Matrix4x4Test, TransformsPointsAndVectors)
+{
+    const Matrix4x4<TypeParam> matrix = this->makeAffine();
+    const Vector3<TypeParam> point = matrix.transformPoint(Vector3<TypeParam>(1, 2, 3));
+    EXPECT_TRUE(point.equals(Vector3<TypeParam>(1, -2, 13)));
+
+    const Vector3<TypeParam> direction = matrix.transformVector(Vector3<TypeParam>(1, 2, 3));
+    EXPECT_TRUE(direction.equals(Vector3<TypeParam>(-4, 1, 12)));
+
+    const Vector4<TypeParam> homogeneous = this->makeGeneral() * Vector4<TypeParam>(1, 1, 1, 1);
+    EXPECT_NEAR(homogeneous.x, TypeParam{ 6 }, this->tolerance);
+    EXPECT_NEAR(homogeneous.w, TypeParam{ 2 }, this->tolerance);
+}
+
+TYPED_TEST(Matrix4x4Test, BatchTransformsMatchSingleOnes)
+{
+    const Matrix4x4<TypeParam> matrix = this->makeAffine() * this->makeGeneral().transposed();
+
+    // Eleven elements cover the four-wide body and the remainder.
+    Vector3<TypeParam> inputs[11];
+    for (Int32 index = 0; index < 11; ++index)
+    {
+        const TypeParam value = static_cast<TypeParam>(index);
+        inputs[index] = Vector3<TypeParam>(value, value * TypeParam{ 0.5 } - TypeParam{ 2 }, TypeParam{ 3 } - value);
+    }
+
+    Vector3<TypeParam> points[11];
+    Vector3<TypeParam> vectors[11];
+    matrix.transformPoints(ConstVectorView<Vector3<TypeParam>>(inputs), VectorView<Vector3<TypeParam>>(points));
+    matrix.transformVectors(ConstVectorView<Vector3<TypeParam>>(inputs), VectorView<Vector3<TypeParam>>(vectors));
+    for (Int32 index = 0; index < 11; ++index)
+    {
+        EXPECT_TRUE(points[index].equals(matrix.transformPoint(inputs[index]), this->tolerance));
+        EXPECT_TRUE(vectors[index].equals(matrix.transformVector(inputs[index]), this->tolerance));
+    }
+
+    // In place, through interleaved vertices.
+    struct Vertex
+    {
+        Vector3<TypeParam> position;
+        TypeParam u;
+    };
+    Vertex vertices[11];
+    for (Int32 index = 0; index < 11; ++index)
+    {
+        vertices[index] = { inputs[index], TypeParam{ 7 } };
+    }
+    const StridedView<Vector3<TypeParam>> positions =
+        StridedView<Vector3<TypeParam>>::ofField(VectorView<Vertex>(vertices), &Vertex::position);
+    matrix.transformPoints(positions, positions);
+    for (Int32 index = 0; index < 11; ++index)
+    {
+        EXPECT_TRUE(vertices[index].position.equals(points[index], this->tolerance));
+        EXPECT_EQ(vertices[index].u, TypeParam{ 7 });
+    }
+
+    const StridedView<Vector3<TypeParam>> contiguous = VectorView<Vector3<TypeParam>>(inputs);
+    matrix.transformVectors(contiguous, contiguous);
+    for (Int32 index = 0; index < 11; ++index)
+    {
+        EXPECT_TRUE(inputs[index].equals(vectors[index], this->tolerance));
+    }
+}
+
+}   // namespace gp::math::tests
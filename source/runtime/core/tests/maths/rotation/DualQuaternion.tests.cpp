@@ -0,0 +1,185 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include <gtest/gtest.h>
+
+#include "maths/rotation/DualQuaternion.hpp"
+
+namespace gp::math::tests
+{
+
+template <typename T>
+class DualQuaternionTest : public ::testing::Test
+{
+protected:
+    /// @brief A rigid transformation built from an index, to get distinct bones.
+    static DualQuaternion<T> makeBone(const Int32 index)
+    {
+        const T value = static_cast<T>(index);
+        const Vector3<T> axis = Vector3<T>(value, T{ 1 }, T{ 2 } - value).getSafeNormal();
+        const Quaternion<T> rotation = Quaternion<T>::makeFromAxisAngle(axis, value * T{ 0.4 });
+        return DualQuaternion<T>(rotation, Vector3<T>(value, T{ -2 } * value, T{ 1 }));
+    }
+
+    const T tolerance = T{ 1e-4 };
+};
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(DualQuaternionTest, FloatingPointTypes);
+
+TYPED_TEST(DualQuaternionTest, DecomposesIntoRotationAndTranslation)
+{
+    constexpr DualQuaternion<TypeParam> identity;
+    static_assert(identity == DualQuaternion<TypeParam>::identity());
+    EXPECT_TRUE(identity.getTranslation().isZero());
+
+    const Quaternion<TypeParam> rotation =
+        Quaternion<TypeParam>::makeFromAxisAngle(Vector3<TypeParam>(0, 0, 1), constants<TypeParam>::halfPi);
+    const DualQuaternion<TypeParam> transform(rotation, Vector3<TypeParam>(1, 2, 3));
+    EXPECT_TRUE(transform.getRotation().equals(rotation));
+    EXPECT_TRUE(transform.getTranslation().equals(Vector3<TypeParam>(1, 2, 3), this->tolerance));
+    const Vector3<TypeParam> unitX(1, 0, 0);
+    EXPECT_TRUE(transform.transformPoint(unitX).equals(Vector3<TypeParam>(1, 3, 3), this->tolerance));
+    EXPECT_TRUE(transform.transformVector(unitX).equals(Vector3<TypeParam>(0, 1, 0), this->tolerance));
+
+    const Matrix4x4<TypeParam> matrix = transform.toMatrix();
+    const Vector3<TypeParam> point(TypeParam{ -1 }, TypeParam{ 0.5 }, TypeParam{ 2 });
+    EXPECT_TRUE(matrix.transformPoint(point).equals(transform.transformPoint(point), this->tolerance));
+}
+
+TYPED_TEST(DualQuaternionTest, ComposesLikeMatrices)
+{
+    const DualQuaternion<TypeParam> a = this->makeBone(2);
+    const DualQuaternion<TypeParam> b = this->makeBone(5);
+    const Vector3<TypeParam> point(TypeParam{ 3 }, TypeParam{ -1 }, TypeParam{ 0.5 });
+
+    const DualQuaternion<TypeParam> product = a * b;
+    EXPECT_TRUE(product.transformPoint(point).equals(a.transformPoint(b.transformPoint(point)), this->tolerance));
+    EXPECT_TRUE(product.toMatrix().equals(a.toMatrix() * b.toMatrix(), this->tolerance));
+    EXPECT_TRUE((a * a.conjugate()).equals(DualQuaternion<TypeParam>::identity(), this->tolerance));
+    EXPECT_TRUE((a * TypeParam{ 3 }).normalized().equals(a, this->tolerance));
+}
+
+TYPED_TEST(DualQuaternionTest, BlendsInfluencesPerVertex)
+{
+    DualQuaternion<TypeParam> bones[4];
+    for (Int32 index = 0; index < 4; ++index)
+    {
+        bones[index] = this->makeBone(index);
+    }
+    // Storing a bone negated must not change the blend, which aligns hemispheres.
+    bones[3] = bones[3] * TypeParam{ -1 };
+
+    const UInt16 indices[] = { 1, 1, 0, 2, 3, 1 };
+    const TypeParam weights[] = { TypeParam{ 0.5 }, TypeParam{ 0.5 }, TypeParam{ 1 }, TypeParam{ 0 },
+                                  TypeParam{ 0.25 }, TypeParam{ 0.75 } };
+    DualQuaternion<TypeParam> blended[3];
+    DualQuaternion<TypeParam>::blend(
+        ConstVectorView<DualQuaternion<TypeParam>>(bones),
+        ConstVectorView<UInt16>(indices),
+        ConstVectorView<TypeParam>(weights),
+        2,
+        blended
+    );
+
+    EXPECT_TRUE(blended[0].equals(bones[1], this->tolerance));
+    EXPECT_TRUE(blended[1].equals(bones[0], this->tolerance));
+    EXPECT_TRUE(blended[2].real.isNormalized());
+    const DualQuaternion<TypeParam> expected =
+        (bones[3] * TypeParam{ -0.25 } + bones[1] * TypeParam{ 0.75 }).normalized();
+    const Vector3<TypeParam> point(TypeParam{ 1 }, TypeParam{ -3 }, TypeParam{ 2 });
+    EXPECT_TRUE(blended[2].transformPoint(point).equals(expected.transformPoint(point), this->tolerance));
+}
+
+TYPED_TEST(DualQuaternionTest, SkinsStreamsLikeBlendedTransforms)
+{
+    constexpr Int32 kBoneCount = 6;
+    constexpr Int32 kInfluences = 3;
+    constexpr Int32 kVertexCount = 11;   // Covers the four-wide body and the remainder.
+
+    DualQuaternion<TypeParam> bones[kBoneCount];
+    for (Int32 index = 0; index < kBoneCount; ++index)
+    {
+        bones[index] = this->makeBone(index);
+    }
+
+    UInt16 indices[kVertexCount * kInfluences];
+    TypeParam weights[kVertexCount * kInfluences];
+    TypeParam positions[3][kVertexCount];
+    TypeParam normals[3][kVertexCount];
+    for (Int32 vertex = 0; vertex < kVertexCount; ++vertex)
+    {
+        for (Int32 influence = 0; influence < kInfluences; ++influence)
+        {
+            indices[vertex * kInfluences + influence] = static_cast<UInt16>((vertex + influence * 2) % kBoneCount);
+        }
+        weights[vertex * kInfluences] = TypeParam{ 0.5 };
+        weights[vertex * kInfluences + 1] = TypeParam{ 0.3 };
+        weights[vertex * kInfluences + 2] = TypeParam{ 0.2 };
+
+        const Vector3<TypeParam> normal =
+            Vector3<TypeParam>(TypeParam{ 1 }, static_cast<TypeParam>(vertex), TypeParam{ -2 }).getSafeNormal();
+        for (Int32 axis = 0; axis < 3; ++axis)
+        {
+            positions[axis][vertex] = static_cast<TypeParam>(vertex * (axis + 1)) - TypeParam{ 4 };
+            normals[axis][vertex] = normal[axis];
+        }
+    }
+
+    DualQuaternion<TypeParam> blended[kVertexCount];
+    DualQuaternion<TypeParam>::blend(
+        ConstVectorView<DualQuaternion<TypeParam>>(bones),
+        ConstVectorView<UInt16>(indices),
+        ConstVectorView<TypeParam>(weights),
+        kInfluences,
+        blended
+    );
+
+    // Skinning in place, positions and normals.
+    SkinningStreams<TypeParam> streams;
+    streams.boneIndices = ConstVectorView<UInt16>(indices);
+    streams.boneWeights = ConstVectorView<TypeParam>(weights);
+    streams.influences = kInfluences;
+    TypeParam bindPositions[3][kVertexCount];
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        for (Int32 vertex = 0; vertex < kVertexCount; ++vertex)
+        {
+            bindPositions[axis][vertex] = positions[axis][vertex];
+        }
+        streams.positions[axis] = ConstVectorView<TypeParam>(positions[axis]);
+        streams.normals[axis] = ConstVectorView<TypeParam>(normals[axis]);
+        streams.skinnedPositions[axis] = VectorView<TypeParam>(positions[axis]);
+        streams.skinnedNormals[axis] = VectorView<TypeParam>(normals[axis]);
+    }
+    DualQuaternion<TypeParam>::skin(ConstVectorView<DualQuaternion<TypeParam>>(bones), streams);
+
+    for (Int32 vertex = 0; vertex < kVertexCount; ++vertex)
+    {
+        const Vector3<TypeParam> bindPosition(
+            bindPositions[0][vertex], bindPositions[1][vertex], bindPositions[2][vertex]
+        );
+        const Vector3<TypeParam> position(positions[0][vertex], positions[1][vertex], positions[2][vertex]);
+        const Vector3<TypeParam> normal(normals[0][vertex], normals[1][vertex], normals[2][vertex]);
+        EXPECT_TRUE(position.equals(blended[vertex].transformPoint(bindPosition), this->tolerance));
+        EXPECT_TRUE(normal.isUnit(this->tolerance));
+    }
+
+    // Positions only.
+    TypeParam skinned[3][kVertexCount];
+    for (Int32 axis = 0; axis < 3; ++axis)
+    {
+        streams.positions[axis] = ConstVectorView<TypeParam>(bindPositions[axis]);
+        streams.normals[axis] = ConstVectorView<TypeParam>();
+        streams.skinnedPositions[axis] = VectorView<TypeParam>(skinned[axis]);
+        streams.skinnedNormals[axis] = VectorView<TypeParam>();
+    }
+    DualQuaternion<TypeParam>::skin(ConstVectorView<DualQuaternion<TypeParam>>(bones), streams);
+    for (Int32 vertex = 0; vertex < kVertexCount; ++vertex)
+    {
+        EXPECT_NEAR(skinned[1][vertex], positions[1][vertex], this->tolerance);
+    }
+}
+
+}   // namespace gp::math::tests
@@ -0,0 +1,148 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include <gtest/gtest.h>
+
+#include "maths/rotation/Quaternion.hpp"
+
+namespace gp::math::tests
+{
+
+template <typename T>
+class QuaternionTest : public ::testing::Test
+{
+protected:
+    /// @brief A rotation around a skewed axis, far from the identity.
+    static Quaternion<T> makeRotation(const T angle)
+    {
+        return Quaternion<T>::makeFromAxisAngle(Vector3<T>(1, 2, -2) / T{ 3 }, angle);
+    }
+
+    const T tolerance = T{ 1e-5 };
+};
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(QuaternionTest, FloatingPointTypes);
+
+TYPED_TEST(QuaternionTest, DefaultIsIdentityAndAligned)
+{
+    constexpr Quaternion<TypeParam> quaternion;
+    static_assert(quaternion == Quaternion<TypeParam>::identity());
+    static_assert(alignof(Quaternion<TypeParam>) >= 16);
+
+    EXPECT_EQ(quaternion.w, TypeParam{ 1 });
+    EXPECT_TRUE(quaternion.isNormalized());
+    EXPECT_TRUE(quaternion.rotateVector(Vector3<TypeParam>(1, 2, 3)).equals(Vector3<TypeParam>(1, 2, 3)));
+}
+
+TYPED_TEST(QuaternionTest, MultiplyComposesRotations)
+{
+    const Quaternion<TypeParam> a = this->makeRotation(TypeParam{ 0.7 });
+    const Quaternion<TypeParam> b =
+        Quaternion<TypeParam>::makeFromAxisAngle(Vector3<TypeParam>(0, 0, 1), TypeParam{ 2 });
+    const Vector3<TypeParam> vec(TypeParam{ 0.5 }, TypeParam{ -1 }, TypeParam{ 2 });
+
+    const Quaternion<TypeParam> product = a * b;
+    EXPECT_TRUE(product.rotateVector(vec).equals(a.rotateVector(b.rotateVector(vec)), this->tolerance));
+    EXPECT_TRUE(product.toMatrix().equals(a.toMatrix() * b.toMatrix(), this->tolerance));
+    EXPECT_TRUE((a * a.conjugate()).equals(Quaternion<TypeParam>::identity(), this->tolerance));
+    EXPECT_TRUE((a * TypeParam{ 2 }).inverse().equals(a.conjugate() * TypeParam{ 0.5 }, this->tolerance));
+    EXPECT_TRUE(a.unrotateVector(a.rotateVector(vec)).equals(vec, this->tolerance));
+
+    // Constant evaluation takes the scalar path.
+    constexpr Quaternion<TypeParam> i(1, 0, 0, 0);
+    constexpr Quaternion<TypeParam> j(0, 1, 0, 0);
+    static_assert(i * j == Quaternion<TypeParam>(0, 0, 1, 0));
+    static_assert(j * i == Quaternion<TypeParam>(0, 0, -1, 0));
+}
+
+TYPED_TEST(QuaternionTest, RotatesLikeItsMatrix)
+{
+    const Quaternion<TypeParam> quarterTurn =
+        Quaternion<TypeParam>::makeFromAxisAngle(Vector3<TypeParam>(0, 0, 1), constants<TypeParam>::halfPi);
+    EXPECT_TRUE(quarterTurn.rotateVector(Vector3<TypeParam>(1, 0, 0)).equals(Vector3<TypeParam>(0, 1, 0)));
+
+    // Angles past a half turn exercise every branch of the conversion from matrices.
+    for (const TypeParam angle : { TypeParam{ 0.3 }, TypeParam{ 2.5 }, TypeParam{ 3.1 } })
+    {
+        for (const Vector3<TypeParam>& axis :
+             { Vector3<TypeParam>(1, 0, 0), Vector3<TypeParam>(0, 1, 0), Vector3<TypeParam>(0, 0, 1) })
+        {
+            const Vector3<TypeParam> skewedAxis = (axis + Vector3<TypeParam>(TypeParam{ 0.1 })).getSafeNormal();
+            const Quaternion<TypeParam> quaternion = Quaternion<TypeParam>::makeFromAxisAngle(skewedAxis, angle);
+            const Matrix3x3<TypeParam> matrix = quaternion.toMatrix();
+            EXPECT_NEAR(matrix.determinant(), TypeParam{ 1 }, this->tolerance);
+
+            const Vector3<TypeParam> vec(3, -1, 2);
+            EXPECT_TRUE((matrix * vec).equals(quaternion.rotateVector(vec), this->tolerance));
+
+            const Quaternion<TypeParam> roundTrip(matrix);
+            EXPECT_NEAR(math::abs(roundTrip.dot(quaternion)), TypeParam{ 1 }, this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(QuaternionTest, InterpolationsTakeTheShortestPath)
+{
+    const Quaternion<TypeParam> from = Quaternion<TypeParam>::identity();
+    const Quaternion<TypeParam> to = this->makeRotation(TypeParam{ 1.2 });
+
+    // Slerp moves at a constant angular speed, nlerp only stays on the same great arc.
+    const Quaternion<TypeParam> quarter = Quaternion<TypeParam>::slerp(from, to, TypeParam{ 0.25 });
+    EXPECT_TRUE(quarter.equals(this->makeRotation(TypeParam{ 0.3 }), this->tolerance));
+    EXPECT_TRUE(Quaternion<TypeParam>::slerp(from, -to, TypeParam{ 0.25 }).equals(quarter, this->tolerance));
+    EXPECT_TRUE(Quaternion<TypeParam>::slerp(from, to, TypeParam{ 1 }).equals(to, this->tolerance));
+
+    const Quaternion<TypeParam> half = Quaternion<TypeParam>::nlerp(from, -to, TypeParam{ 0.5 });
+    EXPECT_TRUE(half.isNormalized());
+    EXPECT_TRUE(half.equals(this->makeRotation(TypeParam{ 0.6 }), this->tolerance));
+
+    // Almost equal rotations fall back to the linear interpolation.
+    const Quaternion<TypeParam> close = this->makeRotation(TypeParam{ 1e-3 });
+    EXPECT_TRUE(Quaternion<TypeParam>::slerp(from, close, TypeParam{ 0.5 })
+                    .equals(this->makeRotation(TypeParam{ 5e-4 }), this->tolerance));
+}
+
+TYPED_TEST(QuaternionTest, BatchInterpolationsMatchSingleOnes)
+{
+    // Eleven elements cover the four-wide body and the remainder, angles reach the opposite hemisphere.
+    Quaternion<TypeParam> from[11];
+    Quaternion<TypeParam> to[11];
+    for (Int32 index = 0; index < 11; ++index)
+    {
+        const TypeParam value = static_cast<TypeParam>(index);
+        from[index] = this->makeRotation(value * TypeParam{ 0.2 });
+        to[index] = Quaternion<TypeParam>::makeFromAxisAngle(
+            Vector3<TypeParam>(TypeParam{ 0.6 }, TypeParam{ 0 }, TypeParam{ 0.8 }),
+            TypeParam{ 6 } - value * TypeParam{ 0.55 }
+        );
+    }
+
+    for (const TypeParam alpha : { TypeParam{ 0 }, TypeParam{ 0.3 }, TypeParam{ 0.5 }, TypeParam{ 1 } })
+    {
+        Quaternion<TypeParam> slerped[11];
+        Quaternion<TypeParam> nlerped[11];
+        Quaternion<TypeParam>::slerp(
+            ConstVectorView<Quaternion<TypeParam>>(from), ConstVectorView<Quaternion<TypeParam>>(to), alpha, slerped
+        );
+        Quaternion<TypeParam>::nlerp(
+            ConstVectorView<Quaternion<TypeParam>>(from), ConstVectorView<Quaternion<TypeParam>>(to), alpha, nlerped
+        );
+        for (Int32 index = 0; index < 11; ++index)
+        {
+            const Quaternion<TypeParam> slerp = Quaternion<TypeParam>::slerp(from[index], to[index], alpha);
+            const Quaternion<TypeParam> nlerp = Quaternion<TypeParam>::nlerp(from[index], to[index], alpha);
+            EXPECT_TRUE(slerped[index].equals(slerp, this->tolerance));
+            EXPECT_TRUE(nlerped[index].equals(nlerp, this->tolerance));
+        }
+    }
+
+    // In place.
+    Quaternion<TypeParam>::slerp(
+        ConstVectorView<Quaternion<TypeParam>>(from), ConstVectorView<Quaternion<TypeParam>>(to), TypeParam{ 1 }, from
+    );
+    EXPECT_TRUE(math::abs(from[10].dot(to[10])) > TypeParam{ 1 } - this->tolerance);
+}
+
+}   // namespace gp::math::tests
@@ -0,0 +1,257 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "maths/simd/VectorRegister.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace gp::simd::tests
+{
+
+namespace
+{
+
+void expectLanes(VectorRegister4f value, Float32 x, Float32 y, Float32 z, Float32 w)
+{
+    alignas(kRegister4Alignment) Float32 lanes[4];
+    store(lanes, value);
+    EXPECT_FLOAT_EQ(lanes[0], x);
+    EXPECT_FLOAT_EQ(lanes[1], y);
+    EXPECT_FLOAT_EQ(lanes[2], z);
+    EXPECT_FLOAT_EQ(lanes[3], w);
+}
+
+void expectLanes(VectorRegister4i value, Int32 x, Int32 y, Int32 z, Int32 w)
+{
+    alignas(kRegister4Alignment) Int32 lanes[4];
+    store(lanes, value);
+    EXPECT_EQ(lanes[0], x);
+    EXPECT_EQ(lanes[1], y);
+    EXPECT_EQ(lanes[2], z);
+    EXPECT_EQ(lanes[3], w);
+}
+
+}   // namespace
+
+TEST(VectorRegisterTest, BackendSelection)
+{
+    EXPECT_EQ(GP_SIMD_SSE + GP_SIMD_NEON + GP_SIMD_SCALAR, 1);
+    EXPECT_EQ(GP_SIMD_AVX2 + GP_SIMD_SSE4_1 + GP_SIMD_SSE2, GP_SIMD_SSE);
+#if defined(GP_SIMD_FORCE_SCALAR)
+    EXPECT_TRUE(GP_SIMD_SCALAR);
+#elif GP_ARCHITECTURE_X64
+    // SSE2 is part of x64: builds without instruction set flags still get registers.
+    EXPECT_TRUE(GP_SIMD_SSE);
+#endif
+}
+
+TEST(VectorRegisterTest, LoadsAndStores)
+{
+    alignas(kRegister8Alignment) Float32 source[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+
+    expectLanes(load4f(source), 1.0f, 2.0f, 3.0f, 4.0f);
+    expectLanes(loadUnaligned4f(source + 1), 2.0f, 3.0f, 4.0f, 5.0f);
+    expectLanes(set4f(1.0f, 2.0f, 3.0f, 4.0f), 1.0f, 2.0f, 3.0f, 4.0f);
+    expectLanes(splat4f(7.0f), 7.0f, 7.0f, 7.0f, 7.0f);
+    expectLanes(zero4f(), 0.0f, 0.0f, 0.0f, 0.0f);
+
+    Float32 unaligned[5] = {};
+    storeUnaligned(unaligned + 1, set4f(1.0f, 2.0f, 3.0f, 4.0f));
+    EXPECT_FLOAT_EQ(unaligned[0], 0.0f);
+    EXPECT_FLOAT_EQ(unaligned[4], 4.0f);
+
+    const VectorRegister4f value = set4f(1.0f, 2.0f, 3.0f, 4.0f);
+    EXPECT_FLOAT_EQ(getLane<0>(value), 1.0f);
+    EXPECT_FLOAT_EQ(getLane<3>(value), 4.0f);
+}
+
+TEST(VectorRegisterTest, Arithmetic)
+{
+    const VectorRegister4f a = set4f(1.0f, -2.0f, 3.0f, -4.0f);
+    const VectorRegister4f b = set4f(2.0f, 4.0f, -8.0f, 16.0f);
+    const VectorRegister4f c = splat4f(1.0f);
+
+    expectLanes(add(a, b), 3.0f, 2.0f, -5.0f, 12.0f);
+    expectLanes(sub(a, b), -1.0f, -6.0f, 11.0f, -20.0f);
+    expectLanes(mul(a, b), 2.0f, -8.0f, -24.0f, -64.0f);
+    expectLanes(div(a, b), 0.5f, -0.5f, -0.375f, -0.25f);
+    expectLanes(madd(a, b, c), 3.0f, -7.0f, -23.0f, -63.0f);
+    expectLanes(nmadd(a, b, c), -1.0f, 9.0f, 25.0f, 65.0f);
+    expectLanes(min(a, b), 1.0f, -2.0f, -8.0f, -4.0f);
+    expectLanes(max(a, b), 2.0f, 4.0f, 3.0f, 16.0f);
+    expectLanes(abs(a), 1.0f, 2.0f, 3.0f, 4.0f);
+    expectLanes(negate(a), -1.0f, 2.0f, -3.0f, 4.0f);
+    expectLanes(sqrt(set4f(1.0f, 4.0f, 9.0f, 16.0f)), 1.0f, 2.0f, 3.0f, 4.0f);
+}
+
+TEST(VectorRegisterTest, Rounding)
+{
+    const VectorRegister4f value = set4f(1.5f, -1.5f, 2.5f, -0.25f);
+
+    expectLanes(floor(value), 1.0f, -2.0f, 2.0f, -1.0f);
+    expectLanes(ceil(value), 2.0f, -1.0f, 3.0f, -0.0f);
+    expectLanes(roundNearest(value), 2.0f, -2.0f, 2.0f, -0.0f);
+
+    // Zeros keep their sign, and values too large to have a fraction stay as they are.
+    const VectorRegister4f edges = set4f(-0.75f, -0.0f, 8388609.0f, -1.0e9f);
+    expectLanes(floor(edges), -1.0f, -0.0f, 8388609.0f, -1.0e9f);
+    expectLanes(ceil(edges), -0.0f, -0.0f, 8388609.0f, -1.0e9f);
+    expectLanes(roundNearest(edges), -1.0f, -0.0f, 8388609.0f, -1.0e9f);
+    EXPECT_TRUE(std::signbit(getLane<0>(ceil(edges))));
+    EXPECT_TRUE(std::signbit(getLane<1>(floor(edges))));
+    EXPECT_TRUE(std::signbit(getLane<0>(roundNearest(set4f(-0.25f, 0.0f, 0.0f, 0.0f)))));
+}
+
+TEST(VectorRegisterTest, ReciprocalEstimatesAreRefined)
+{
+    alignas(kRegister4Alignment) const Float32 inputs[4] = { 0.01f, 1.0f, 3.0f, 12345.0f };
+    alignas(kRegister4Alignment) Float32 rsqrtLanes[4];
+    alignas(kRegister4Alignment) Float32 rcpLanes[4];
+    alignas(kRegister4Alignment) Float32 rsqrtFastLanes[4];
+    store(rsqrtLanes, rsqrt(load4f(inputs)));
+    store(rcpLanes, rcp(load4f(inputs)));
+    store(rsqrtFastLanes, rsqrtFast(load4f(inputs)));
+
+    for (UInt32 index = 0; index < 4; ++index)
+    {
+        const Float32 expectedRsqrt = 1.0f / std::sqrt(inputs[index]);
+        const Float32 expectedRcp = 1.0f / inputs[index];
+        EXPECT_NEAR(rsqrtLanes[index], expectedRsqrt, expectedRsqrt * 1e-6f);
+        EXPECT_NEAR(rcpLanes[index], expectedRcp, expectedRcp * 1e-6f);
+        EXPECT_NEAR(rsqrtFastLanes[index], expectedRsqrt, expectedRsqrt * 4e-3f);
+    }
+}
+
+TEST(VectorRegisterTest, ReciprocalsOfZeroAndInfinity)
+{
+    // The refinement step would turn these lanes into NaN, every backend keeps the exact limit instead.
+    const Float32 infinity = std::numeric_limits<Float32>::infinity();
+    const VectorRegister4f inputs = set4f(0.0f, -0.0f, infinity, 4.0f);
+    expectLanes(rsqrt(inputs), infinity, -infinity, 0.0f, 0.5f);
+    expectLanes(rcp(inputs), infinity, -infinity, 0.0f, 0.25f);
+
+    const VectorRegister8f wide = combine(inputs, inputs);
+    expectLanes(getHigh(rsqrt(wide)), infinity, -infinity, 0.0f, 0.5f);
+    expectLanes(getHigh(rcp(wide)), infinity, -infinity, 0.0f, 0.25f);
+}
+
+TEST(VectorRegisterTest, ComparisonsAndSelect)
+{
+    const VectorRegister4f a = set4f(1.0f, 2.0f, 3.0f, 4.0f);
+    const VectorRegister4f b = set4f(4.0f, 2.0f, 1.0f, 4.0f);
+
+    EXPECT_EQ(moveMask(cmpEq(a, b)), 0b1010u);
+    EXPECT_EQ(moveMask(cmpNe(a, b)), 0b0101u);
+    EXPECT_EQ(moveMask(cmpLt(a, b)), 0b0001u);
+    EXPECT_EQ(moveMask(cmpLe(a, b)), 0b1011u);
+    EXPECT_EQ(moveMask(cmpGt(a, b)), 0b0100u);
+    EXPECT_EQ(moveMask(cmpGe(a, b)), 0b1110u);
+
+    expectLanes(select(cmpLt(a, b), a, b), 1.0f, 2.0f, 1.0f, 4.0f);
+    expectLanes(bitAnd(cmpGt(a, b), a), 0.0f, 0.0f, 3.0f, 0.0f);
+    expectLanes(bitAndNot(a, cmpGt(a, b)), 1.0f, 2.0f, 0.0f, 4.0f);
+    expectLanes(bitXor(bitOr(a, zero4f()), a), 0.0f, 0.0f, 0.0f, 0.0f);
+
+    EXPECT_TRUE(anyTrue(cmpEq(a, b)));
+    EXPECT_FALSE(allTrue(cmpEq(a, b)));
+    EXPECT_TRUE(allTrue(cmpEq(a, a)));
+
+    const VectorRegister4f nan = splat4f(std::numeric_limits<Float32>::quiet_NaN());
+    EXPECT_EQ(moveMask(cmpEq(nan, nan)), 0u);
+    EXPECT_EQ(moveMask(cmpNe(nan, nan)), 0xFu);
+}
+
+TEST(VectorRegisterTest, Shuffles)
+{
+    const VectorRegister4f a = set4f(0.0f, 1.0f, 2.0f, 3.0f);
+    const VectorRegister4f b = set4f(4.0f, 5.0f, 6.0f, 7.0f);
+
+    expectLanes(swizzle<3, 2, 1, 0>(a), 3.0f, 2.0f, 1.0f, 0.0f);
+    expectLanes(swizzle<1, 1, 1, 1>(a), 1.0f, 1.0f, 1.0f, 1.0f);
+    expectLanes(shuffle<0, 2, 1, 3>(a, b), 0.0f, 2.0f, 5.0f, 7.0f);
+    expectLanes(interleaveLow(a, b), 0.0f, 4.0f, 1.0f, 5.0f);
+    expectLanes(interleaveHigh(a, b), 2.0f, 6.0f, 3.0f, 7.0f);
+}
+
+TEST(VectorRegisterTest, Reductions)
+{
+    const VectorRegister4f value = set4f(3.0f, -1.0f, 8.0f, 2.0f);
+
+    EXPECT_FLOAT_EQ(reduceAdd(value), 12.0f);
+    EXPECT_FLOAT_EQ(reduceMin(value), -1.0f);
+    EXPECT_FLOAT_EQ(reduceMax(value), 8.0f);
+    EXPECT_FLOAT_EQ(dot4(value, splat4f(2.0f)), 24.0f);
+}
+
+TEST(VectorRegisterTest, IntegerRegisters)
+{
+    const VectorRegister4i a = set4i(1, -2, 3, -4);
+    const VectorRegister4i b = set4i(5, 6, -7, 8);
+
+    expectLanes(add(a, b), 6, 4, -4, 4);
+    expectLanes(sub(a, b), -4, -8, 10, -12);
+    expectLanes(mul(a, b), 5, -12, -21, -32);
+    expectLanes(min(a, b), 1, -2, -7, -4);
+    expectLanes(max(a, b), 5, 6, 3, 8);
+    expectLanes(select(cmpGt(a, b), a, b), 5, 6, 3, 8);
+    expectLanes(bitAnd(cmpLt(a, b), splat4i(1)), 1, 1, 0, 1);
+    expectLanes(bitAndNot(splat4i(0xFF), splat4i(0x0F)), 0xF0, 0xF0, 0xF0, 0xF0);
+    expectLanes(bitOr(splat4i(1), splat4i(2)), 3, 3, 3, 3);
+    expectLanes(bitXor(splat4i(3), splat4i(1)), 2, 2, 2, 2);
+    expectLanes(cmpEq(a, a), -1, -1, -1, -1);
+    expectLanes(shiftLeft<2>(a), 4, -8, 12, -16);
+    expectLanes(shiftRightArithmetic<1>(a), 0, -1, 1, -2);
+    expectLanes(shiftRightLogical<28>(splat4i(-1)), 15, 15, 15, 15);
+    EXPECT_EQ(getLane<1>(a), -2);
+    EXPECT_EQ(getLane<3>(a), -4);
+
+    // Products keep their low 32 bits, as with scalar wrapping arithmetic.
+    expectLanes(mul(splat4i(0x10001), set4i(0x10001, -1, 0x10000, 3)), 0x20001, -0x10001, 0x10000, 0x30003);
+
+    alignas(kRegister4Alignment) Int32 source[5] = { 1, 2, 3, 4, 5 };
+    expectLanes(load4i(source), 1, 2, 3, 4);
+    expectLanes(loadUnaligned4i(source + 1), 2, 3, 4, 5);
+}
+
+TEST(VectorRegisterTest, Conversions)
+{
+    expectLanes(convertToFloat(set4i(1, -2, 3, 1 << 20)), 1.0f, -2.0f, 3.0f, 1048576.0f);
+    expectLanes(convertToInt(set4f(1.5f, 2.5f, -1.5f, 0.4f)), 2, 2, -2, 0);
+    expectLanes(truncateToInt(set4f(1.9f, -1.9f, 0.5f, -0.5f)), 1, -1, 0, 0);
+    expectLanes(castToInt(set4f(1.0f, -0.0f, 0.0f, 2.0f)), 0x3F800000, Int32(0x80000000), 0, 0x40000000);
+    expectLanes(castToFloat(set4i(0x3F800000, 0, 0x40000000, 0)), 1.0f, 0.0f, 2.0f, 0.0f);
+}
+
+TEST(VectorRegisterTest, WideRegisters)
+{
+    alignas(kRegister8Alignment) Float32 source[8] = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f };
+    const VectorRegister8f value = load8f(source);
+    const VectorRegister8f doubled = madd(value, splat8f(2.0f), zero8f());
+
+    alignas(kRegister8Alignment) Float32 lanes[8];
+    store(lanes, doubled);
+    for (UInt32 index = 0; index < 8; ++index)
+    {
+        EXPECT_FLOAT_EQ(lanes[index], source[index] * 2.0f);
+    }
+
+    EXPECT_FLOAT_EQ(getLane<5>(value), -6.0f);
+    EXPECT_FLOAT_EQ(reduceAdd(value), -4.0f);
+    EXPECT_FLOAT_EQ(reduceMin(value), -8.0f);
+    EXPECT_FLOAT_EQ(reduceMax(value), 7.0f);
+    EXPECT_EQ(moveMask(cmpLt(value, zero8f())), 0b10101010u);
+    EXPECT_TRUE(anyTrue(cmpGt(abs(value), splat8f(7.5f))));
+    EXPECT_FALSE(allTrue(cmpGt(value, zero8f())));
+
+    const VectorRegister8f combined = combine(set4f(1.0f, 2.0f, 3.0f, 4.0f), set4f(5.0f, 6.0f, 7.0f, 8.0f));
+    expectLanes(getHigh(combined), 5.0f, 6.0f, 7.0f, 8.0f);
+    expectLanes(getLow(select(cmpGt(combined, splat8f(2.5f)), combined, negate(combined))), -1.0f, -2.0f, 3.0f, 4.0f);
+
+    const VectorRegister8f estimate = rsqrt(set8f(1.0f, 4.0f, 16.0f, 64.0f, 0.25f, 9.0f, 100.0f, 2.0f));
+    EXPECT_NEAR(getLane<6>(estimate), 0.1f, 1e-6f);
+    EXPECT_NEAR(getLane<7>(rcp(splat8f(4.0f))), 0.25f, 1e-6f);
+}
+
+}   // namespace gp::simd::tests
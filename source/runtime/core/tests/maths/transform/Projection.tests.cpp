@@ -0,0 +1,178 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include <gtest/gtest.h>
+
+#include "maths/transform/Projection.hpp"
+#include "maths/transform/View.hpp"
+
+namespace gp::math::tests
+{
+
+template <typename T>
+class ProjectionTest : public ::testing::Test
+{
+protected:
+    /// @brief Checks that two matrices are equal up to the tolerance, element by element.
+    static ::testing::AssertionResult
+        areNear(const Matrix4x4<T>& lhs, const Matrix4x4<T>& rhs, const T tolerance)
+    {
+        for (Int32 row = 0; row < 4; ++row)
+        {
+            for (Int32 column = 0; column < 4; ++column)
+            {
+                if (std::abs(lhs.m[row][column] - rhs.m[row][column]) > tolerance)
+                {
+                    return ::testing::AssertionFailure() << "element (" << row << ", " << column << ") differs";
+                }
+            }
+        }
+        return ::testing::AssertionSuccess();
+    }
+
+    /// @brief Every kind of projection, with both depth conventions.
+    static std::vector<Projection<T>> makeProjections()
+    {
+        const T fov = T{ 1.2 };
+        const T aspect = T{ 16 } / T{ 9 };
+        std::vector<Projection<T>> projections;
+        for (const ProjectionDepth depth : { ProjectionDepth::Standard, ProjectionDepth::Reversed })
+        {
+            projections.push_back(Projection<T>::makePerspective(fov, aspect, T{ 0.1 }, T{ 100 }, depth));
+            projections.push_back(Projection<T>::makeInfinitePerspective(fov, aspect, T{ 0.1 }, depth));
+            projections.push_back(Projection<T>::makeOrthographic(T{ 8 }, T{ 4.5 }, T{ -5 }, T{ 50 }, depth));
+        }
+        return projections;
+    }
+
+    const T tolerance = T{ 1e-4 };
+};
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(ProjectionTest, FloatingPointTypes);
+
+TYPED_TEST(ProjectionTest, MapsNearAndFarPlanesToDepthRange)
+{
+    using T = TypeParam;
+    const Projection<T> standard =
+        Projection<T>::makePerspective(T{ 1 }, T{ 1 }, T{ 0.5 }, T{ 20 }, ProjectionDepth::Standard);
+    const Projection<T> reversed = Projection<T>::makePerspective(T{ 1 }, T{ 1 }, T{ 0.5 }, T{ 20 });
+    EXPECT_FALSE(standard.isReversed());
+    EXPECT_TRUE(reversed.isReversed());
+    EXPECT_NEAR(standard.projectPoint(Vector3<T>(0, 0, T{ 0.5 })).z, T{ 0 }, this->tolerance);
+    EXPECT_NEAR(standard.projectPoint(Vector3<T>(0, 0, T{ 20 })).z, T{ 1 }, this->tolerance);
+    EXPECT_NEAR(reversed.projectPoint(Vector3<T>(0, 0, T{ 0.5 })).z, T{ 1 }, this->tolerance);
+    EXPECT_NEAR(reversed.projectPoint(Vector3<T>(0, 0, T{ 20 })).z, T{ 0 }, this->tolerance);
+
+    // The field of view spans the clip range vertically, and the aspect ratio horizontally.
+    const Projection<T> wide = Projection<T>::makePerspective(T{ 1 }, T{ 2 }, T{ 0.5 }, T{ 20 });
+    const T halfHeight = std::tan(T{ 0.5 }) * T{ 10 };
+    EXPECT_NEAR(wide.projectPoint(Vector3<T>(T{ 2 } * halfHeight, halfHeight, T{ 10 })).x, T{ 1 }, this->tolerance);
+    EXPECT_NEAR(wide.projectPoint(Vector3<T>(T{ 2 } * halfHeight, halfHeight, T{ 10 })).y, T{ 1 }, this->tolerance);
+
+    // Without far plane, depth tends to 0 with reverse-Z and to 1 otherwise.
+    const Projection<T> infinite = Projection<T>::makeInfinitePerspective(T{ 1 }, T{ 1 }, T{ 0.5 });
+    const Projection<T> infiniteStandard =
+        Projection<T>::makeInfinitePerspective(T{ 1 }, T{ 1 }, T{ 0.5 }, ProjectionDepth::Standard);
+    EXPECT_NEAR(infinite.projectPoint(Vector3<T>(0, 0, T{ 0.5 })).z, T{ 1 }, this->tolerance);
+    EXPECT_NEAR(infinite.projectPoint(Vector3<T>(0, 0, T{ 1e6 })).z, T{ 0 }, this->tolerance);
+    EXPECT_NEAR(infiniteStandard.projectPoint(Vector3<T>(0, 0, T{ 0.5 })).z, T{ 0 }, this->tolerance);
+    EXPECT_NEAR(infiniteStandard.projectPoint(Vector3<T>(0, 0, T{ 1e6 })).z, T{ 1 }, this->tolerance);
+
+    const Projection<T> orthographic = Projection<T>::makeOrthographic(T{ 4 }, T{ 2 }, T{ 1 }, T{ 11 });
+    EXPECT_TRUE(orthographic.projectPoint(Vector3<T>(T{ 2 }, T{ -1 }, T{ 1 })).equals(Vector3<T>(1, -1, 1)));
+    EXPECT_TRUE(orthographic.projectPoint(Vector3<T>(T{ -2 }, T{ 1 }, T{ 11 })).equals(Vector3<T>(-1, 1, 0)));
+}
+
+TYPED_TEST(ProjectionTest, InverseMatchesMatrix)
+{
+    using T = TypeParam;
+    for (const Projection<T>& projection : this->makeProjections())
+    {
+        EXPECT_TRUE(this->areNear(projection.inverseMatrix * projection.matrix, Matrix4x4<T>::identity(), T{ 1e-4 }));
+        EXPECT_TRUE(this->areNear(projection.inverseMatrix, projection.matrix.inverse(), T{ 1e-3 }));
+        EXPECT_TRUE(this->areNear(Projection<T>(projection.matrix).inverseMatrix, projection.inverseMatrix, T{ 1e-3 }));
+    }
+}
+
+TYPED_TEST(ProjectionTest, UnprojectsProjectedPoints)
+{
+    using T = TypeParam;
+    const Vector3<T> point(T{ 0.7 }, T{ -0.4 }, T{ 3 });
+    for (const Projection<T>& projection : this->makeProjections())
+    {
+        const Vector3<T> ndc = projection.projectPoint(point);
+        EXPECT_TRUE(projection.unprojectPoint(ndc).equals(point, this->tolerance));
+        EXPECT_TRUE(projection.getFrustum().contains(point));
+        EXPECT_FALSE(projection.getFrustum().contains(Vector3<T>(0, 0, T{ -10 })));
+    }
+}
+
+TYPED_TEST(ProjectionTest, JittersBySubPixelOffsets)
+{
+    using T = TypeParam;
+
+    // The first elements of the Halton sequences in bases 2 and 3, moved to the center of the pixel.
+    EXPECT_NEAR(Projection<T>::getJitterOffset(0).x, T{ 0 }, this->tolerance);
+    EXPECT_NEAR(Projection<T>::getJitterOffset(0).y, T{ 1 } / T{ 3 } - T{ 0.5 }, this->tolerance);
+    EXPECT_NEAR(Projection<T>::getJitterOffset(1).x, T{ -0.25 }, this->tolerance);
+    EXPECT_NEAR(Projection<T>::getJitterOffset(1).y, T{ 2 } / T{ 3 } - T{ 0.5 }, this->tolerance);
+    EXPECT_EQ(Projection<T>::getJitterOffset(8).x, Projection<T>::getJitterOffset(0).x);
+    EXPECT_EQ(Projection<T>::getJitterOffset(8).y, Projection<T>::getJitterOffset(0).y);
+    for (UInt32 frame = 0; frame < 16; ++frame)
+    {
+        const Vector2<T> offset = Projection<T>::getJitterOffset(frame, 16);
+        EXPECT_TRUE(offset.x >= T{ -0.5 } && offset.x < T{ 0.5 } && offset.y >= T{ -0.5 } && offset.y < T{ 0.5 });
+    }
+
+    // A point moves by the offset on the screen, x right and y down, whatever its depth.
+    const Vector2<T> viewport(T{ 1920 }, T{ 1080 });
+    const Vector2<T> offset(T{ 0.25 }, T{ -0.375 });
+    const Vector3<T> point(T{ 0.7 }, T{ -0.4 }, T{ 3 });
+    for (const Projection<T>& projection : this->makeProjections())
+    {
+        const Projection<T> jittered = projection.jittered(offset, viewport);
+        const Vector3<T> shift = jittered.projectPoint(point) - projection.projectPoint(point);
+        EXPECT_NEAR(shift.x * viewport.x * T{ 0.5 }, offset.x, T{ 1e-3 });
+        EXPECT_NEAR(shift.y * viewport.y * T{ -0.5 }, offset.y, T{ 1e-3 });
+        EXPECT_NEAR(shift.z, T{ 0 }, this->tolerance);
+        EXPECT_TRUE(this->areNear(jittered.inverseMatrix * jittered.matrix, Matrix4x4<T>::identity(), T{ 1e-4 }));
+    }
+}
+
+TYPED_TEST(ProjectionTest, ViewCastsRaysThroughPixels)
+{
+    using T = TypeParam;
+    const Vector3<T> eye(T{ 1 }, T{ 2 }, T{ -3 });
+    const Vector3<T> target(T{ 2 }, T{ 1 }, T{ 4 });
+    const Vector2<T> viewport(T{ 640 }, T{ 360 });
+    for (const Projection<T>& projection : this->makeProjections())
+    {
+        const View<T> view = View<T>::makeLookAt(eye, target, Vector3<T>(0, 1, 0), projection);
+        EXPECT_TRUE(view.getPosition().equals(eye, this->tolerance));
+        EXPECT_TRUE(view.getForward().equals((target - eye).getSafeNormal(), this->tolerance));
+        EXPECT_TRUE(this->areNear(view.inverseViewMatrix, view.viewMatrix.inverse(), T{ 1e-4 }));
+        EXPECT_TRUE(view.getFrustum().contains(target));
+        EXPECT_TRUE(view.unprojectPoint(view.projectPoint(target)).equals(target, T{ 1e-3 }));
+
+        // The ray through the pixel of a point passes through the point.
+        const Vector3<T> ndc = view.projectPoint(target + Vector3<T>(T{ 0.5 }, T{ 0.25 }, 0));
+        const Vector2<T> pixel((ndc.x + T{ 1 }) * T{ 0.5 } * viewport.x, (T{ 1 } - ndc.y) * T{ 0.5 } * viewport.y);
+        const Ray<T> ray = view.getScreenRay(pixel, viewport);
+        const Vector3<T> expected = view.unprojectPoint(ndc);
+        const T distance = (expected - ray.origin).dot(ray.direction);
+        EXPECT_NEAR(ray.direction.length(), T{ 1 }, this->tolerance);
+        EXPECT_GT(distance, T{ 0 });
+        EXPECT_TRUE(ray.getPoint(distance).equals(expected, T{ 1e-3 }));
+        EXPECT_NEAR(view.projectPoint(ray.origin).z, projection.getNearDepth(), this->tolerance);
+
+        const View<T> jittered = view.jittered(Vector2<T>(T{ 0.5 }, T{ 0.5 }), viewport);
+        EXPECT_TRUE(this->areNear(jittered.viewMatrix, view.viewMatrix, T{ 0 }));
+        EXPECT_TRUE(this->areNear(
+            jittered.inverseViewProjection * jittered.viewProjection, Matrix4x4<T>::identity(), T{ 1e-3 }
+        ));
+    }
+}
+
+}   // namespace gp::math::tests
@@ -0,0 +1,128 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include <gtest/gtest.h>
+
+#include "maths/transform/Transform.hpp"
+
+namespace gp::math::tests
+{
+
+template <typename T>
+class TransformTest : public ::testing::Test
+{
+protected:
+    /// @brief A transform built from an index, with a rotation, a translation and the given scale.
+    static Transform<T> makeTransform(const Int32 index, const Vector3<T>& scale)
+    {
+        const T value = static_cast<T>(index);
+        const Vector3<T> axis = Vector3<T>(T{ 1 }, value, T{ -1 }).getSafeNormal();
+        return Transform<T>(
+            Quaternion<T>::makeFromAxisAngle(axis, T{ 0.3 } + value * T{ 0.5 }),
+            Vector3<T>(value, T{ 1 } - value, T{ 2 }),
+            scale
+        );
+    }
+
+    const T tolerance = T{ 1e-4 };
+};
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(TransformTest, FloatingPointTypes);
+
+TYPED_TEST(TransformTest, DefaultIsIdentityAndAligned)
+{
+    constexpr Transform<TypeParam> transform;
+    static_assert(transform == Transform<TypeParam>::identity());
+    static_assert(alignof(Transform<TypeParam>) >= 16);
+
+    EXPECT_EQ(transform.toMatrix(), Matrix4x4<TypeParam>::identity());
+    EXPECT_EQ(transform.transformPoint(Vector3<TypeParam>(1, 2, 3)), Vector3<TypeParam>(1, 2, 3));
+}
+
+TYPED_TEST(TransformTest, TransformsLikeItsMatrix)
+{
+    const Transform<TypeParam> transform =
+        this->makeTransform(2, Vector3<TypeParam>(TypeParam{ 2 }, TypeParam{ 0.5 }, TypeParam{ 3 }));
+    const Matrix4x4<TypeParam> matrix = transform.toMatrix();
+    const Vector3<TypeParam> vec(TypeParam{ -1 }, TypeParam{ 4 }, TypeParam{ 0.5 });
+
+    EXPECT_TRUE(matrix.isAffine());
+    EXPECT_TRUE(transform.transformPoint(vec).equals(matrix.transformPoint(vec), this->tolerance));
+    EXPECT_TRUE(transform.transformVector(vec).equals(matrix.transformVector(vec), this->tolerance));
+}
+
+TYPED_TEST(TransformTest, ComposesAndInverts)
+{
+    // The composition is exact when the outer scale is uniform, whatever the inner one.
+    const Transform<TypeParam> outer = this->makeTransform(1, Vector3<TypeParam>(TypeParam{ 2 }));
+    const Transform<TypeParam> inner =
+        this->makeTransform(4, Vector3<TypeParam>(TypeParam{ 1 }, TypeParam{ 3 }, TypeParam{ 0.5 }));
+    const Vector3<TypeParam> point(TypeParam{ 0.5 }, TypeParam{ -2 }, TypeParam{ 1 });
+
+    const Transform<TypeParam> composed = outer * inner;
+    const Vector3<TypeParam> twice = outer.transformPoint(inner.transformPoint(point));
+    EXPECT_TRUE(composed.transformPoint(point).equals(twice, this->tolerance));
+    EXPECT_TRUE(composed.toMatrix().equals(outer.toMatrix() * inner.toMatrix(), this->tolerance));
+
+    const Transform<TypeParam> inverse = outer.inverse();
+    EXPECT_TRUE(inverse.transformPoint(outer.transformPoint(point)).equals(point, this->tolerance));
+    EXPECT_TRUE(inverse.toMatrix().equals(outer.toMatrix().inverseAffine(), this->tolerance));
+    EXPECT_TRUE((outer * inverse).toMatrix().equals(Matrix4x4<TypeParam>::identity(), this->tolerance));
+
+    // Constant evaluation takes the scalar path.
+    constexpr Transform<TypeParam> shift(Quaternion<TypeParam>(), Vector3<TypeParam>(1, 2, 3), Vector3<TypeParam>(2));
+    static_assert((shift * shift).translation == Vector3<TypeParam>(3, 6, 9));
+    static_assert(shift.inverse().translation == Vector3<TypeParam>(TypeParam{ -0.5 }, -1, TypeParam{ -1.5 }));
+}
+
+TYPED_TEST(TransformTest, PropagatesHierarchiesBySubtree)
+{
+    // Depth-first pre-order: 0 -> { 1 -> { 2, 3 }, 4 -> { 5 } }, 6 -> { 7 }.
+    const Int32 parents[] = { -1, 0, 1, 1, 0, 4, -1, 6 };
+    constexpr Int32 kNodeCount = 8;
+    Transform<TypeParam> locals[kNodeCount];
+    for (Int32 node = 0; node < kNodeCount; ++node)
+    {
+        const TypeParam stretch = static_cast<TypeParam>(node % 3) + TypeParam{ 1 };
+        locals[node] = this->makeTransform(node, Vector3<TypeParam>(TypeParam{ 1 }, stretch, TypeParam{ 0.5 }));
+    }
+
+    Matrix4x4<TypeParam> worlds[kNodeCount];
+    Transform<TypeParam>::localToWorld(
+        ConstVectorView<Transform<TypeParam>>(locals), ConstVectorView<Int32>(parents), worlds
+    );
+    for (Int32 node = 0; node < kNodeCount; ++node)
+    {
+        Matrix4x4<TypeParam> expected = locals[node].toMatrix();
+        for (Int32 ancestor = parents[node]; ancestor >= 0; ancestor = parents[ancestor])
+        {
+            expected = locals[ancestor].toMatrix() * expected;
+        }
+        EXPECT_TRUE(worlds[node].equals(expected, this->tolerance));
+    }
+
+    const ConstVectorView<Int32> parentsView(parents);
+    EXPECT_EQ(Transform<TypeParam>::getSubtreeEnd(parentsView, 0), 6);
+    EXPECT_EQ(Transform<TypeParam>::getSubtreeEnd(parentsView, 1), 4);
+    EXPECT_EQ(Transform<TypeParam>::getSubtreeEnd(parentsView, 2), 3);
+    EXPECT_EQ(Transform<TypeParam>::getSubtreeEnd(parentsView, 4), 6);
+    EXPECT_EQ(Transform<TypeParam>::getSubtreeEnd(parentsView, 6), 8);
+
+    // Once the roots and their children are up to date, the subtrees below them are independent ranges.
+    Matrix4x4<TypeParam> byRange[kNodeCount];
+    const ConstVectorView<Transform<TypeParam>> localsView(locals);
+    Transform<TypeParam>::localToWorld(localsView, parentsView, byRange, 0, 2);
+    Transform<TypeParam>::localToWorld(localsView, parentsView, byRange, 6, 1);
+    Transform<TypeParam>::localToWorld(localsView, parentsView, byRange, 4, 1);
+    Transform<TypeParam>::localToWorld(localsView, parentsView, byRange, 7, 1);
+    Transform<TypeParam>::localToWorld(localsView, parentsView, byRange, 5, 1);
+    Transform<TypeParam>::localToWorld(localsView, parentsView, byRange, 2, 2);
+    for (Int32 node = 0; node < kNodeCount; ++node)
+    {
+        EXPECT_TRUE(byRange[node].equals(worlds[node]));
+    }
+}
+
+}   // namespace gp::math::tests
@@ -0,0 +1,98 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "memory/pointers/RefCountedPtr.hpp"
+#include <gtest/gtest.h>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+class Resource : public RefCountedObject<>
+{
+public:
+    static inline int s_alive = 0;
+
+    Resource()
+    {
+        ++s_alive;
+    }
+
+protected:
+    ~Resource() override
+    {
+        --s_alive;
+    }
+};
+
+class Texture : public Resource
+{};
+
+class LocalResource : public RefCountedObject<RefCountMode::NotThreadSafe>
+{};
+
+}   // namespace
+
+TEST(RefCountedPtrTest, IsASinglePointer)
+{
+    static_assert(sizeof(RefCountedPtr<Resource>) == sizeof(Resource*));
+}
+
+TEST(RefCountedPtrTest, CountsReferences)
+{
+    {
+        RefCountedPtr<Resource> first = makeRefCounted<Resource>();
+        EXPECT_EQ(first->getRefCount(), 1u);
+        {
+            RefCountedPtr<Resource> second = first;
+            EXPECT_EQ(first->getRefCount(), 2u);
+            // The count is intrusive, a new pointer can be built from the raw pointer.
+            RefCountedPtr<Resource> third(first.get());
+            EXPECT_EQ(first->getRefCount(), 3u);
+        }
+        EXPECT_EQ(first->getRefCount(), 1u);
+        EXPECT_EQ(Resource::s_alive, 1);
+    }
+    EXPECT_EQ(Resource::s_alive, 0);
+}
+
+TEST(RefCountedPtrTest, MoveAndConvert)
+{
+    RefCountedPtr<Texture> texture = makeRefCounted<Texture>();
+    RefCountedPtr<Resource> resource = texture;
+    EXPECT_EQ(texture->getRefCount(), 2u);
+    EXPECT_TRUE(resource == texture);
+
+    RefCountedPtr<Resource> moved = std::move(resource);
+    EXPECT_FALSE(resource);
+    EXPECT_EQ(texture->getRefCount(), 2u);
+
+    texture = nullptr;
+    moved.reset();
+    EXPECT_EQ(Resource::s_alive, 0);
+}
+
+TEST(RefCountedPtrTest, DetachAndAdopt)
+{
+    RefCountedPtr<Resource> ptr = makeRefCounted<Resource>();
+    Resource* raw = ptr.detach();
+    EXPECT_FALSE(ptr);
+    EXPECT_EQ(raw->getRefCount(), 1u);
+
+    RefCountedPtr<Resource> adopted = RefCountedPtr<Resource>::adopt(raw);
+    EXPECT_EQ(adopted->getRefCount(), 1u);
+    adopted.reset();
+    EXPECT_EQ(Resource::s_alive, 0);
+}
+
+TEST(RefCountedPtrTest, NotThreadSafeMode)
+{
+    RefCountedPtr<LocalResource> first = makeRefCounted<LocalResource>();
+    RefCountedPtr<LocalResource> second = first;
+    EXPECT_EQ(second->getRefCount(), 2u);
+}
+
+}   // namespace gp::tests
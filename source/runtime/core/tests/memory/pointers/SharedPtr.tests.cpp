@@ -0,0 +1,159 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "memory/pointers/SharedPtr.hpp"
+#include "memory/pointers/WeakPtr.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+struct Tracked
+{
+    static inline int s_alive = 0;
+    int value;
+
+    explicit Tracked(int inValue = 0)
+        : value(inValue)
+    {
+        ++s_alive;
+    }
+
+    virtual ~Tracked()
+    {
+        --s_alive;
+    }
+};
+
+struct DerivedTracked : Tracked
+{
+    using Tracked::Tracked;
+};
+
+}   // namespace
+
+TEST(SharedPtrTest, MakeSharedSharesOwnership)
+{
+    {
+        SharedPtr<Tracked> first = makeShared<Tracked>(5);
+        EXPECT_EQ(first->value, 5);
+        EXPECT_EQ(first.useCount(), 1u);
+        {
+            SharedPtr<Tracked> second = first;
+            EXPECT_EQ(first.useCount(), 2u);
+            EXPECT_TRUE(first == second);
+        }
+        EXPECT_EQ(first.useCount(), 1u);
+        EXPECT_EQ(Tracked::s_alive, 1);
+    }
+    EXPECT_EQ(Tracked::s_alive, 0);
+}
+
+TEST(SharedPtrTest, NotThreadSafeMode)
+{
+    SharedPtr<Tracked, RefCountMode::NotThreadSafe> first = makeShared<Tracked, RefCountMode::NotThreadSafe>(1);
+    SharedPtr<Tracked, RefCountMode::NotThreadSafe> second = first;
+    EXPECT_EQ(second.useCount(), 2u);
+    first.reset();
+    EXPECT_EQ(second.useCount(), 1u);
+    second = nullptr;
+    EXPECT_EQ(Tracked::s_alive, 0);
+}
+
+TEST(SharedPtrTest, AdoptsRawAndUniquePointers)
+{
+    {
+        SharedPtr<Tracked> fromRaw(new DerivedTracked(2));
+        SharedPtr<Tracked> fromUnique = makeUnique<DerivedTracked>(3);
+        EXPECT_EQ(Tracked::s_alive, 2);
+        EXPECT_EQ(fromRaw->value + fromUnique->value, 5);
+    }
+    EXPECT_EQ(Tracked::s_alive, 0);
+
+    int deleted = 0;
+    {
+        SharedPtr<int> custom(new int(4), [&deleted](int* ptr)
+        {
+            ++deleted;
+            delete ptr;
+        });
+        SharedPtr<int> copy = custom;
+    }
+    EXPECT_EQ(deleted, 1);
+}
+
+TEST(SharedPtrTest, ConvertsToBaseAndAliases)
+{
+    SharedPtr<DerivedTracked> derived = makeShared<DerivedTracked>(9);
+    SharedPtr<Tracked> base = derived;
+    EXPECT_EQ(derived.useCount(), 2u);
+
+    SharedPtr<int> member(base, &base->value);
+    EXPECT_EQ(*member, 9);
+    derived.reset();
+    base.reset();
+    EXPECT_EQ(Tracked::s_alive, 1);
+    member.reset();
+    EXPECT_EQ(Tracked::s_alive, 0);
+}
+
+TEST(WeakPtrTest, LocksWhileAlive)
+{
+    WeakPtr<Tracked> weak;
+    EXPECT_TRUE(weak.isExpired());
+    {
+        SharedPtr<Tracked> shared = makeShared<Tracked>(1);
+        weak = shared;
+        EXPECT_FALSE(weak.isExpired());
+
+        SharedPtr<Tracked> locked = weak.lock();
+        ASSERT_TRUE(locked);
+        EXPECT_EQ(locked.useCount(), 2u);
+    }
+    EXPECT_TRUE(weak.isExpired());
+    EXPECT_FALSE(weak.lock());
+    EXPECT_EQ(Tracked::s_alive, 0);
+}
+
+TEST(WeakPtrTest, NotThreadSafeMode)
+{
+    auto shared = makeShared<int, RefCountMode::NotThreadSafe>(3);
+    WeakPtr<int, RefCountMode::NotThreadSafe> weak = shared;
+    EXPECT_EQ(*weak.lock(), 3);
+    shared.reset();
+    EXPECT_TRUE(weak.isExpired());
+}
+
+TEST(SharedPtrTest, ConcurrentCopies)
+{
+    SharedPtr<Tracked> shared = makeShared<Tracked>(0);
+    WeakPtr<Tracked> weak = shared;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&shared, &weak]()
+        {
+            for (int i = 0; i < 10000; ++i)
+            {
+                SharedPtr<Tracked> copy = shared;
+                SharedPtr<Tracked> locked = weak.lock();
+                EXPECT_TRUE(locked);
+            }
+        }
+        );
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(shared.useCount(), 1u);
+}
+
+}   // namespace gp::tests
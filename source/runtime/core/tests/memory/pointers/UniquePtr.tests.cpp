@@ -0,0 +1,99 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "memory/pointers/UniquePtr.hpp"
+#include <gtest/gtest.h>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+struct Base
+{
+    static inline int s_alive = 0;
+
+    Base()
+    {
+        ++s_alive;
+    }
+
+    virtual ~Base()
+    {
+        --s_alive;
+    }
+};
+
+struct Derived : Base
+{
+    int value = 7;
+};
+
+}   // namespace
+
+TEST(UniquePtrTest, StatelessDeletersTakeNoSpace)
+{
+    auto lambdaDeleter = [](int* ptr) { delete ptr; };
+    static_assert(sizeof(UniquePtr<int>) == sizeof(int*));
+    static_assert(sizeof(UniquePtr<int, decltype(lambdaDeleter)>) == sizeof(int*));
+}
+
+TEST(UniquePtrTest, OwnsAndDestroys)
+{
+    {
+        UniquePtr<Base> ptr = makeUnique<Derived>();
+        EXPECT_TRUE(ptr);
+        EXPECT_EQ(Base::s_alive, 1);
+        EXPECT_EQ(static_cast<Derived*>(ptr.get())->value, 7);
+    }
+    EXPECT_EQ(Base::s_alive, 0);
+}
+
+TEST(UniquePtrTest, MoveTransfersOwnership)
+{
+    UniquePtr<int> first = makeUnique<int>(3);
+    UniquePtr<int> second = std::move(first);
+    EXPECT_FALSE(first);
+    EXPECT_TRUE(first == nullptr);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(*second, 3);
+
+    first = std::move(second);
+    EXPECT_EQ(*first, 3);
+    EXPECT_FALSE(second.isValid());
+}
+
+TEST(UniquePtrTest, ResetAndRelease)
+{
+    UniquePtr<Base> ptr(new Base());
+    EXPECT_EQ(Base::s_alive, 1);
+    ptr.reset(new Base());
+    EXPECT_EQ(Base::s_alive, 1);
+
+    Base* raw = ptr.release();
+    EXPECT_FALSE(ptr);
+    EXPECT_EQ(Base::s_alive, 1);
+    delete raw;
+
+    ptr = nullptr;
+    EXPECT_EQ(Base::s_alive, 0);
+}
+
+TEST(UniquePtrTest, CustomDeleter)
+{
+    int deleted = 0;
+    auto deleter = [&deleted](int* ptr)
+    {
+        ++deleted;
+        delete ptr;
+    };
+    {
+        UniquePtr<int, decltype(deleter)> ptr(new int(1), deleter);
+        UniquePtr<int, decltype(deleter)> moved = std::move(ptr);
+    }
+    EXPECT_EQ(deleted, 1);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,140 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "templates/Delegate.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+int twice(int value)
+{
+    return value * 2;
+}
+
+struct Counter
+{
+    int total = 0;
+
+    void add(int value)
+    {
+        total += value;
+    }
+
+    int get() const
+    {
+        return total;
+    }
+};
+
+}   // namespace
+
+TEST(DelegateTest, DefaultIsUnbound)
+{
+    Delegate<void()> delegate;
+    EXPECT_FALSE(delegate.isBound());
+    EXPECT_FALSE(delegate);
+    EXPECT_TRUE(delegate == nullptr);
+    EXPECT_FALSE(delegate.executeIfBound());
+}
+
+TEST(DelegateTest, CallsFreeFunctions)
+{
+    const auto fromPointer = Delegate<int(int)>(&twice);
+    const auto fromTemplate = Delegate<int(int)>::create<&twice>();
+    EXPECT_EQ(fromPointer(4), 8);
+    EXPECT_EQ(fromTemplate(5), 10);
+}
+
+TEST(DelegateTest, CallsLambdas)
+{
+    int calls = 0;
+    Delegate<void(int)> delegate = [&calls](int value) { calls += value; };
+    delegate(3);
+    delegate(4);
+    EXPECT_EQ(calls, 7);
+    EXPECT_TRUE(delegate.executeIfBound(1));
+    EXPECT_EQ(calls, 8);
+}
+
+TEST(DelegateTest, BindsMemberFunctions)
+{
+    Counter counter;
+    auto add = Delegate<void(int)>::bind<&Counter::add>(&counter);
+    auto get = Delegate<int()>::bind<&Counter::get>(static_cast<const Counter*>(&counter));
+    add(5);
+    add(6);
+    EXPECT_EQ(get(), 11);
+}
+
+TEST(DelegateTest, MutableLambdaKeepsState)
+{
+    Delegate<int()> delegate = [count = 0]() mutable { return ++count; };
+    EXPECT_EQ(delegate(), 1);
+    EXPECT_EQ(delegate(), 2);
+
+    Delegate<int()> copy = delegate;
+    EXPECT_EQ(copy(), 3);
+    EXPECT_EQ(delegate(), 3);
+}
+
+TEST(DelegateTest, ManagesNonTrivialCallables)
+{
+    auto tracker = std::make_shared<int>(42);
+    {
+        Delegate<int()> delegate = [tracker]() { return *tracker; };
+        EXPECT_EQ(tracker.use_count(), 2);
+
+        Delegate<int()> copy = delegate;
+        EXPECT_EQ(tracker.use_count(), 3);
+        EXPECT_EQ(copy(), 42);
+
+        Delegate<int()> moved = std::move(copy);
+        EXPECT_FALSE(copy.isBound());
+        EXPECT_EQ(tracker.use_count(), 3);
+
+        moved.reset();
+        EXPECT_EQ(tracker.use_count(), 2);
+
+        delegate = nullptr;
+        EXPECT_EQ(tracker.use_count(), 1);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(DelegateTest, RejectsMoveOnlyCallables)
+{
+    // A copy of the delegate would have nothing to copy the callable with, so it cannot be bound at all.
+    auto owner = [pointer = std::make_unique<int>(1)]() { return *pointer; };
+    static_assert(!std::is_constructible_v<Delegate<int()>, decltype(owner)>);
+    static_assert(!std::is_convertible_v<decltype(owner), Delegate<int()>>);
+    static_assert(std::is_constructible_v<Delegate<int()>, decltype([]() { return 1; })>);
+}
+
+TEST(DelegateTest, ForwardsArgumentsAndReturnValues)
+{
+    Delegate<std::string(const std::string&, std::string&&)> concat =
+        [](const std::string& a, std::string&& b) { return a + std::move(b); };
+    EXPECT_EQ(concat("foo", std::string("bar")), "foobar");
+
+    Delegate<void(int&)> increment = [](int& value) { ++value; };
+    int value = 1;
+    increment(value);
+    EXPECT_EQ(value, 2);
+}
+
+TEST(DelegateTest, LargerInlineStorage)
+{
+    const double a = 1.0, b = 2.0, c = 3.0, d = 4.0, e = 5.0;
+    Delegate<double(), 64> delegate = [a, b, c, d, e]() { return a + b + c + d + e; };
+    EXPECT_DOUBLE_EQ(delegate(), 15.0);
+    static_assert(sizeof(Delegate<void()>) == kDelegateInlineSize + 2 * sizeof(void*));
+}
+
+}   // namespace gp::tests
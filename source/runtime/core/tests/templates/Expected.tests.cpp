@@ -2,6 +2,7 @@
 // For more information, see https://graphical-playground/legal
 // mailto:support AT graphical-playground DOT com
 
+#include "containers/views/StringView.hpp"
 #include "templates/Expected.hpp"
 #include <gtest/gtest.h>
 #include <string>
@@ -566,4 +567,46 @@ TEST(ExpectedTest, MakeExpected)
     EXPECT_EQ(ex.value(), "xxxxx");
 }
 
+TEST(ExpectedTest, NicheStoresErrorBesideIt)
+{
+    enum class ParseError : UInt8
+    {
+        Empty,
+        Truncated
+    };
+
+    using Result = Expected<StringView, ParseError>;
+    static_assert(sizeof(Result) == sizeof(StringView));
+    static_assert(std::is_trivially_copyable_v<Result>);
+    static_assert(sizeof(Expected<int*, ParseError>) > sizeof(int*));
+    static_assert(std::is_trivially_copyable_v<Expected<int*, ParseError>>);
+    static_assert(!std::is_trivially_copyable_v<Expected<int, std::string>>);
+
+    auto parse = [](StringView input) -> Result
+    {
+        if (input.isEmpty())
+        {
+            return makeUnexpected(ParseError::Empty);
+        }
+        return input.substr(0, 2);
+    };
+
+    Result ok = parse("hello");
+    ASSERT_TRUE(ok.hasValue());
+    EXPECT_EQ(*ok, StringView("he"));
+
+    Result failed = parse("");
+    ASSERT_FALSE(failed.hasValue());
+    EXPECT_EQ(failed.error(), ParseError::Empty);
+
+    failed = makeUnexpected(ParseError::Truncated);
+    EXPECT_EQ(failed.error(), ParseError::Truncated);
+    ok.swap(failed);
+    EXPECT_EQ(ok.error(), ParseError::Truncated);
+    EXPECT_EQ(*failed, StringView("he"));
+    ok.emplaceValue(StringView());
+    EXPECT_TRUE(ok.hasValue());
+    EXPECT_TRUE(ok->isEmpty());
+}
+
 }   // namespace gp::tests
@@ -0,0 +1,152 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "templates/MulticastDelegate.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+struct Listener
+{
+    int received = 0;
+
+    void onEvent(int value)
+    {
+        received += value;
+    }
+};
+
+}   // namespace
+
+TEST(MulticastDelegateTest, BroadcastsInOrder)
+{
+    MulticastDelegate<void(int)> event;
+    std::vector<int> order;
+    event.add([&order](int value) { order.push_back(value * 1); });
+    event.add([&order](int value) { order.push_back(value * 2); });
+    event.add([&order](int value) { order.push_back(value * 3); });
+    EXPECT_EQ(event.size(), 3u);
+
+    event.broadcast(1);
+    EXPECT_EQ(order, (std::vector<int>{ 1, 2, 3 }));
+}
+
+TEST(MulticastDelegateTest, BindAndRemove)
+{
+    MulticastDelegate<void(int)> event;
+    Listener a;
+    Listener b;
+    const DelegateHandle handleA = event.bind<&Listener::onEvent>(&a);
+    const DelegateHandle handleB = event.bind<&Listener::onEvent>(&b);
+
+    event.broadcast(2);
+    EXPECT_TRUE(event.remove(handleA));
+    EXPECT_FALSE(event.remove(handleA));
+    EXPECT_FALSE(event.contains(handleA));
+    EXPECT_TRUE(event.contains(handleB));
+    event.broadcast(3);
+
+    EXPECT_EQ(a.received, 2);
+    EXPECT_EQ(b.received, 5);
+    EXPECT_EQ(event.size(), 1u);
+}
+
+TEST(MulticastDelegateTest, CallbackCanRemoveItself)
+{
+    MulticastDelegate<void()> event;
+    int firstCalls = 0;
+    int secondCalls = 0;
+    DelegateHandle self;
+    self = event.add(
+        [&]()
+    {
+        ++firstCalls;
+        event.remove(self);
+    }
+    );
+    event.add([&]() { ++secondCalls; });
+
+    event.broadcast();
+    EXPECT_TRUE(event.isEmpty() == false);
+    EXPECT_EQ(event.size(), 1u);
+    event.broadcast();
+    EXPECT_EQ(firstCalls, 1);
+    EXPECT_EQ(secondCalls, 2);
+}
+
+TEST(MulticastDelegateTest, RemovalDuringBroadcastSkipsLaterCallbacks)
+{
+    MulticastDelegate<void()> event;
+    int laterCalls = 0;
+    DelegateHandle later;
+    event.add([&]() { event.remove(later); });
+    later = event.add([&]() { ++laterCalls; });
+
+    event.broadcast();
+    EXPECT_EQ(laterCalls, 0);
+    EXPECT_EQ(event.size(), 1u);
+}
+
+TEST(MulticastDelegateTest, AdditionDuringBroadcastIsDeferred)
+{
+    MulticastDelegate<void()> event;
+    int addedCalls = 0;
+    bool added = false;
+    event.add(
+        [&]()
+    {
+        if (!added)
+        {
+            added = true;
+            for (int i = 0; i < 16; ++i)
+            {
+                event.add([&]() { ++addedCalls; });
+            }
+        }
+    }
+    );
+
+    event.broadcast();
+    EXPECT_EQ(addedCalls, 0);
+    EXPECT_EQ(event.size(), 17u);
+    event.broadcast();
+    EXPECT_EQ(addedCalls, 16);
+}
+
+TEST(MulticastDelegateTest, NestedBroadcastAndClear)
+{
+    MulticastDelegate<void(int)> event;
+    int calls = 0;
+    event.add(
+        [&](int depth)
+    {
+        ++calls;
+        if (depth > 0)
+        {
+            event.broadcast(depth - 1);
+        }
+        else
+        {
+            event.clear();
+        }
+    }
+    );
+    event.add([&](int) { ++calls; });
+
+    event.broadcast(1);
+    EXPECT_TRUE(event.isEmpty());
+    EXPECT_FALSE(event.isBroadcasting());
+    // Outer first callback, inner first callback (which clears), then nothing else runs.
+    EXPECT_EQ(calls, 2);
+
+    event.broadcast(0);
+    EXPECT_EQ(calls, 2);
+}
+
+}   // namespace gp::tests
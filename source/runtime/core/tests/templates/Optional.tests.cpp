@@ -2,9 +2,12 @@
 // For more information, see https://graphical-playground/legal
 // mailto:support AT graphical-playground DOT com
 
+#include "containers/pools/SlotMap.hpp"
+#include "containers/views/StringView.hpp"
 #include "templates/Optional.hpp"
 #include <gtest/gtest.h>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 namespace gp::tests
@@ -336,4 +339,80 @@ TEST(OptionalTest, MakeOptional)
     EXPECT_EQ(opt.value(), "xxxxx");
 }
 
+namespace
+{
+
+enum class NicheColor : UInt8
+{
+    Red,
+    Green,
+    Blue
+};
+
+}   // namespace
+
+}   // namespace gp::tests
+
+GP_ENABLE_ENUM_NICHE(gp::tests::NicheColor, 0xFF);
+
+namespace gp::tests
+{
+
+TEST(OptionalTest, NicheTypesNeedNoFlag)
+{
+    static_assert(sizeof(Optional<int*>) == sizeof(int*));
+    static_assert(sizeof(Optional<bool>) == sizeof(bool));
+    static_assert(sizeof(Optional<NicheColor>) == sizeof(NicheColor));
+    static_assert(sizeof(Optional<SlotMapHandle32>) == sizeof(SlotMapHandle32));
+    static_assert(sizeof(Optional<StringView>) == sizeof(StringView));
+    static_assert(sizeof(Optional<int>) > sizeof(int));
+}
+
+TEST(OptionalTest, TriviallyCopyableWhenValueIs)
+{
+    static_assert(std::is_trivially_copyable_v<Optional<int>>);
+    static_assert(std::is_trivially_copyable_v<Optional<StringView>>);
+    static_assert(!std::is_trivially_copyable_v<Optional<std::string>>);
+    static_assert(!std::is_trivially_copyable_v<Optional<OptionalTracker>>);
+}
+
+TEST(OptionalTest, NicheStatesRoundTrip)
+{
+    int value = 0;
+    Optional<int*> pointer;
+    EXPECT_FALSE(pointer.hasValue());
+    pointer = &value;
+    EXPECT_EQ(*pointer, &value);
+    pointer = nullptr;
+    // A null pointer is a value, not the empty state.
+    EXPECT_TRUE(pointer.hasValue());
+    EXPECT_EQ(*pointer, nullptr);
+    pointer.reset();
+    EXPECT_FALSE(pointer.hasValue());
+
+    Optional<bool> flag(false);
+    EXPECT_TRUE(flag.hasValue());
+    EXPECT_FALSE(*flag);
+    flag = nullopt;
+    EXPECT_TRUE(flag == nullopt);
+
+    Optional<NicheColor> color;
+    EXPECT_FALSE(color);
+    color.emplace(NicheColor::Blue);
+    EXPECT_EQ(*color, NicheColor::Blue);
+
+    Optional<SlotMapHandle32> handle(SlotMapHandle32{});
+    EXPECT_TRUE(handle.hasValue());
+    EXPECT_FALSE(handle->isValid());
+
+    Optional<StringView> view(StringView("niche"));
+    Optional<StringView> copy = view;
+    EXPECT_EQ(copy->size(), 5u);
+    Optional<StringView> empty;
+    copy.swap(empty);
+    EXPECT_FALSE(copy.hasValue());
+    EXPECT_EQ(*empty, StringView("niche"));
+    EXPECT_TRUE(Optional<StringView>(StringView()).hasValue());
+}
+
 }   // namespace gp::tests
@@ -0,0 +1,130 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "templates/Tuple.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace gp::tests
+{
+
+struct TupleEmptyTag
+{};
+
+struct TupleOtherEmptyTag
+{};
+
+static_assert(sizeof(Tuple<int, TupleEmptyTag>) == sizeof(int));
+static_assert(sizeof(Tuple<TupleEmptyTag, int, TupleOtherEmptyTag>) == sizeof(int));
+static_assert(std::is_empty_v<Tuple<TupleEmptyTag, TupleOtherEmptyTag>>);
+static_assert(std::is_trivially_copyable_v<Tuple<int, float, TupleEmptyTag>>);
+static_assert(!std::is_trivially_copyable_v<Tuple<int, std::string>>);
+static_assert(std::tuple_size_v<Tuple<int, float>> == 2);
+static_assert(std::is_same_v<std::tuple_element_t<1, Tuple<int, float>>, float>);
+
+TEST(TupleTest, DefaultConstructionValueInitializes)
+{
+    Tuple<int, float> t;
+    EXPECT_EQ(t.get<0>(), 0);
+    EXPECT_EQ(t.get<1>(), 0.0f);
+}
+
+TEST(TupleTest, ValueConstruction)
+{
+    Tuple<int, std::string, double> t(1, "two", 3.0);
+    EXPECT_EQ(t.get<0>(), 1);
+    EXPECT_EQ(t.get<1>(), "two");
+    EXPECT_EQ(t.get<2>(), 3.0);
+}
+
+TEST(TupleTest, GetByType)
+{
+    Tuple<int, std::string> t(7, "seven");
+    EXPECT_EQ(t.get<int>(), 7);
+    EXPECT_EQ(t.get<std::string>(), "seven");
+
+    t.get<int>() = 8;
+    EXPECT_EQ(t.get<0>(), 8);
+}
+
+TEST(TupleTest, DuplicateTypesStayDistinct)
+{
+    Tuple<int, int, int> t(1, 2, 3);
+    EXPECT_EQ(t.get<0>(), 1);
+    EXPECT_EQ(t.get<1>(), 2);
+    EXPECT_EQ(t.get<2>(), 3);
+    EXPECT_EQ(sizeof(t), 3 * sizeof(int));
+}
+
+TEST(TupleTest, RvalueGetMoves)
+{
+    Tuple<std::string> t(std::string("moved"));
+    std::string s = std::move(t).get<0>();
+    EXPECT_EQ(s, "moved");
+}
+
+TEST(TupleTest, StructuredBindings)
+{
+    auto t = makeTuple(1, std::string("a"), 2.5f);
+    auto& [i, s, f] = t;
+    EXPECT_EQ(i, 1);
+    EXPECT_EQ(s, "a");
+    EXPECT_EQ(f, 2.5f);
+
+    i = 10;
+    EXPECT_EQ(t.get<0>(), 10);
+}
+
+TEST(TupleTest, TieAssignsFromTuple)
+{
+    int a = 0;
+    std::string b;
+    gp::tie(a, b) = makeTuple(42, std::string("answer"));
+    EXPECT_EQ(a, 42);
+    EXPECT_EQ(b, "answer");
+}
+
+TEST(TupleTest, Apply)
+{
+    Tuple<int, int> t(3, 4);
+    EXPECT_EQ(apply([](int x, int y) { return x * y; }, t), 12);
+}
+
+TEST(TupleTest, ApplyOverTiedReferences)
+{
+    // The temporary tuple of references is forwarded as an rvalue, its elements must stay lvalue references.
+    int a = 1;
+    int b = 2;
+    apply([](int& x, int& y) { std::swap(x, y); }, gp::tie(a, b));
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 1);
+
+    static_assert(std::is_same_v<decltype(gp::tie(a, b).get<0>()), int&>);
+    std::string text;
+    static_assert(std::is_same_v<decltype(gp::tie(a, text).get<std::string&>()), std::string&>);
+    static_assert(std::is_same_v<decltype(Tuple<int>(1).get<0>()), int&&>);
+}
+
+TEST(TupleTest, EqualityAndSwap)
+{
+    Tuple<int, std::string> a(1, "a");
+    Tuple<int, std::string> b(2, "b");
+    EXPECT_FALSE(a == b);
+
+    a.swap(b);
+    EXPECT_EQ(a.get<0>(), 2);
+    EXPECT_EQ(b.get<1>(), "a");
+    EXPECT_TRUE((a == Tuple<int, std::string>(2, "b")));
+}
+
+TEST(TupleTest, DeductionGuide)
+{
+    Tuple t(1, 2.0);
+    static_assert(std::is_same_v<decltype(t), Tuple<int, double>>);
+    EXPECT_EQ(t.get<1>(), 2.0);
+}
+
+}   // namespace gp::tests
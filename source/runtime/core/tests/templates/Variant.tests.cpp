@@ -0,0 +1,197 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "templates/Variant.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace gp::tests
+{
+
+// Dummy struct to track the lifetime of a non-trivial alternative
+struct VariantTracker
+{
+    static int alive;
+
+    int value;
+
+    VariantTracker(int v = 0)
+        : value(v)
+    {
+        ++alive;
+    }
+
+    VariantTracker(const VariantTracker& other)
+        : value(other.value)
+    {
+        ++alive;
+    }
+
+    VariantTracker(VariantTracker&& other) noexcept
+        : value(other.value)
+    {
+        other.value = -1;
+        ++alive;
+    }
+
+    VariantTracker& operator=(const VariantTracker&) = default;
+    VariantTracker& operator=(VariantTracker&&) noexcept = default;
+
+    ~VariantTracker()
+    {
+        --alive;
+    }
+
+    bool operator==(const VariantTracker& other) const = default;
+};
+
+int VariantTracker::alive = 0;
+
+template <USize I>
+struct VariantIndexed
+{
+    int value = static_cast<int>(I);
+};
+
+template <USize... Is>
+auto makeWideVariant(std::index_sequence<Is...>) -> Variant<VariantIndexed<Is>...>;
+
+using WideVariant = decltype(makeWideVariant(std::make_index_sequence<40>{}));
+
+static_assert(sizeof(Variant<UInt8, UInt16>) == 4);
+static_assert(sizeof(Variant<UInt32, float>) == 8);
+static_assert(std::is_same_v<Variant<int, float>::IndexType, UInt8>);
+static_assert(std::is_trivially_copyable_v<Variant<int, float, double>>);
+static_assert(std::is_trivially_destructible_v<Variant<int, float, double>>);
+static_assert(!std::is_trivially_copyable_v<Variant<int, std::string>>);
+
+TEST(VariantTest, DefaultConstructsFirstAlternative)
+{
+    Variant<int, std::string> v;
+    EXPECT_EQ(v.index(), 0u);
+    EXPECT_EQ(v.get<0>(), 0);
+}
+
+TEST(VariantTest, ConvertingConstruction)
+{
+    Variant<int, std::string> v(std::string("hello"));
+    EXPECT_EQ(v.index(), 1u);
+    EXPECT_TRUE(v.holdsAlternative<std::string>());
+    EXPECT_EQ(v.get<std::string>(), "hello");
+}
+
+TEST(VariantTest, InPlaceConstruction)
+{
+    Variant<int, std::string> byIndex(std::in_place_index<1>, 3u, 'x');
+    EXPECT_EQ(byIndex.get<1>(), "xxx");
+
+    Variant<int, std::string> byType(std::in_place_type<std::string>, "abc");
+    EXPECT_EQ(byType.get<std::string>(), "abc");
+}
+
+TEST(VariantTest, TryGet)
+{
+    Variant<int, float> v(2.5f);
+    EXPECT_EQ(v.tryGet<int>(), nullptr);
+    ASSERT_NE(v.tryGet<float>(), nullptr);
+    EXPECT_EQ(*v.tryGet<float>(), 2.5f);
+}
+
+TEST(VariantTest, EmplaceAndAssignment)
+{
+    Variant<int, std::string> v(1);
+    v.emplace<std::string>("text");
+    EXPECT_EQ(v.get<std::string>(), "text");
+
+    v = 5;
+    EXPECT_EQ(v.index(), 0u);
+    EXPECT_EQ(v.get<int>(), 5);
+}
+
+TEST(VariantTest, NonTrivialLifetime)
+{
+    VariantTracker::alive = 0;
+    {
+        Variant<int, VariantTracker> a(VariantTracker(4));
+        EXPECT_EQ(VariantTracker::alive, 1);
+
+        Variant<int, VariantTracker> b(a);
+        EXPECT_EQ(VariantTracker::alive, 2);
+        EXPECT_TRUE(a == b);
+
+        Variant<int, VariantTracker> c(std::move(b));
+        EXPECT_EQ(c.get<VariantTracker>().value, 4);
+        EXPECT_EQ(VariantTracker::alive, 3);
+
+        a = 1;
+        EXPECT_EQ(VariantTracker::alive, 2);
+
+        a = c;
+        EXPECT_EQ(VariantTracker::alive, 3);
+        EXPECT_EQ(a.get<VariantTracker>().value, 4);
+    }
+    EXPECT_EQ(VariantTracker::alive, 0);
+}
+
+TEST(VariantTest, Equality)
+{
+    Variant<int, float> a(1);
+    Variant<int, float> b(1.0f);
+    Variant<int, float> c(1);
+    EXPECT_FALSE(a == b);
+    EXPECT_TRUE(a == c);
+}
+
+TEST(VariantTest, VisitSingle)
+{
+    Variant<int, std::string> v(std::string("four"));
+    const USize size = visit(
+        [](const auto& value) -> USize
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, int>)
+            {
+                return 0;
+            }
+            else
+            {
+                return value.size();
+            }
+        },
+        v
+    );
+    EXPECT_EQ(size, 4u);
+}
+
+TEST(VariantTest, VisitMutates)
+{
+    Variant<int, float> v(1);
+    visit([](auto& value) { value += 1; }, v);
+    EXPECT_EQ(v.get<int>(), 2);
+}
+
+TEST(VariantTest, VisitMultiple)
+{
+    Variant<int, double> a(2);
+    Variant<int, double, float> b(0.5f);
+    const double result = visit([](auto x, auto y) { return static_cast<double>(x) * static_cast<double>(y); }, a, b);
+    EXPECT_EQ(result, 1.0);
+
+    a = 3.0;
+    b = 4;
+    EXPECT_EQ(visit([](auto x, auto y) { return static_cast<double>(x) + static_cast<double>(y); }, a, b), 7.0);
+}
+
+TEST(VariantTest, VisitBeyondSixteenAlternatives)
+{
+    WideVariant v(std::in_place_index<37>);
+    EXPECT_EQ(v.index(), 37u);
+    EXPECT_EQ(visit([](const auto& value) { return value.value; }, v), 37);
+
+    v.emplace<17>();
+    EXPECT_EQ(visit([](const auto& value) { return value.value; }, v), 17);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,60 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "threading/ManualResetEvent.hpp"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace gp::tests
+{
+
+TEST(ManualResetEventTest, StaysSetUntilReset)
+{
+    ManualResetEvent event;
+    EXPECT_FALSE(event.isSet());
+    event.set();
+    EXPECT_TRUE(event.isSet());
+    event.wait();
+    event.wait();
+    event.reset();
+    EXPECT_FALSE(event.isSet());
+
+    ManualResetEvent initiallySet(true);
+    EXPECT_TRUE(initiallySet.isSet());
+    initiallySet.wait();
+}
+
+TEST(ManualResetEventTest, ReleasesEveryWaiter)
+{
+    constexpr UInt32 kThreadCount = 8;
+
+    ManualResetEvent event;
+    std::atomic<UInt32> releasedCount{ 0 };
+    std::thread threads[kThreadCount];
+    for (std::thread& thread: threads)
+    {
+        thread = std::thread(
+            [&]()
+        {
+            event.wait();
+            releasedCount.fetch_add(1);
+        }
+        );
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(releasedCount.load(), 0u);
+
+    // Waiters that went to sleep are released even if the event is reset right away.
+    event.set();
+    event.reset();
+    for (std::thread& thread: threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(releasedCount.load(), kThreadCount);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,136 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "profiling/Profiler.hpp"
+#include "threading/Mutex.hpp"
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+/// @brief Increments @p counter under @p mutex from several threads, through the lockable of the profiler.
+UInt64 countUnderLock(GP_LOCKABLE_BASE(Mutex)& mutex)
+{
+    constexpr UInt32 kThreadCount = 4;
+    constexpr UInt32 kIterationCount = 10000;
+
+    UInt64 counter = 0;
+    std::thread threads[kThreadCount];
+    for (std::thread& thread: threads)
+    {
+        thread = std::thread(
+            [&]()
+        {
+            for (UInt32 iteration = 0; iteration < kIterationCount; ++iteration)
+            {
+                std::scoped_lock lock(mutex);
+                ++counter;
+            }
+        }
+        );
+    }
+    for (std::thread& thread: threads)
+    {
+        thread.join();
+    }
+    return counter;
+}
+
+}   // namespace
+
+TEST(MutexTest, TryLockFailsWhileHeld)
+{
+    Mutex mutex;
+    EXPECT_TRUE(mutex.try_lock());
+    EXPECT_FALSE(mutex.try_lock());
+    mutex.unlock();
+    EXPECT_TRUE(mutex.try_lock());
+    mutex.unlock();
+}
+
+TEST(MutexTest, SerializesThreads)
+{
+    constexpr UInt32 kThreadCount = 8;
+    constexpr UInt32 kIterationCount = 20000;
+
+    Mutex mutex;
+    UInt64 counter = 0;
+    std::thread threads[kThreadCount];
+    for (std::thread& thread: threads)
+    {
+        thread = std::thread(
+            [&]()
+        {
+            for (UInt32 iteration = 0; iteration < kIterationCount; ++iteration)
+            {
+                std::scoped_lock lock(mutex);
+                ++counter;
+            }
+        }
+        );
+    }
+    for (std::thread& thread: threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(counter, static_cast<UInt64>(kThreadCount) * kIterationCount);
+}
+
+TEST(MutexTest, WakesSleepingWaiter)
+{
+    Mutex mutex;
+    bool hasRun = false;
+    mutex.lock();
+    std::thread waiter(
+        [&]()
+    {
+        std::scoped_lock lock(mutex);
+        hasRun = true;
+    }
+    );
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(hasRun);
+    mutex.unlock();
+    waiter.join();
+    EXPECT_TRUE(hasRun);
+}
+
+TEST(MutexTest, SleepingAcquisitionsDecaySpinEstimate)
+{
+    // Each waiter runs out of spins while the section lasts: failed spin phases must not raise the next bound.
+    Mutex mutex;
+    for (UInt32 round = 0; round < 5; ++round)
+    {
+        mutex.lock();
+        std::thread waiter(
+            [&]()
+        {
+            mutex.lock();
+            mutex.unlock();
+        }
+        );
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        mutex.unlock();
+        waiter.join();
+    }
+    EXPECT_EQ(mutex.getSpinEstimate(), 0u);
+}
+
+TEST(MutexTest, WorksAsProfilerLockable)
+{
+    GP_LOCKABLE(Mutex, mutex);
+    GP_LOCKABLE_N(Mutex, namedMutex, "Named test mutex");
+    EXPECT_EQ(countUnderLock(mutex), 40000u);
+    EXPECT_EQ(countUnderLock(namedMutex), 40000u);
+    EXPECT_TRUE(mutex.try_lock());
+    mutex.unlock();
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,65 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "threading/Semaphore.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace gp::tests
+{
+
+TEST(SemaphoreTest, CountsUnits)
+{
+    Semaphore semaphore(2);
+    EXPECT_EQ(semaphore.getCount(), 2u);
+    EXPECT_TRUE(semaphore.tryAcquire());
+    semaphore.acquire();
+    EXPECT_FALSE(semaphore.tryAcquire());
+    semaphore.release(3);
+    EXPECT_EQ(semaphore.getCount(), 3u);
+}
+
+TEST(SemaphoreTest, HandsUnitsToWaiters)
+{
+    constexpr UInt32 kConsumerCount = 4;
+    constexpr UInt32 kItemCount = 10000;
+
+    Semaphore semaphore;
+    std::atomic<UInt32> consumedCount{ 0 };
+    std::thread consumers[kConsumerCount];
+    for (std::thread& consumer: consumers)
+    {
+        consumer = std::thread(
+            [&]()
+        {
+            for (UInt32 index = 0; index < kItemCount / kConsumerCount; ++index)
+            {
+                semaphore.acquire();
+                consumedCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        );
+    }
+    for (UInt32 index = 0; index < kItemCount; index += 2)
+    {
+        if (index % 4 == 0)
+        {
+            semaphore.release(2);
+        }
+        else
+        {
+            semaphore.release();
+            semaphore.release();
+        }
+    }
+    for (std::thread& consumer: consumers)
+    {
+        consumer.join();
+    }
+    EXPECT_EQ(consumedCount.load(), kItemCount);
+    EXPECT_EQ(semaphore.getCount(), 0u);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,141 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "profiling/Profiler.hpp"
+#include "threading/SharedMutex.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+namespace gp::tests
+{
+
+TEST(SharedMutexTest, ReadersShareWritersExclude)
+{
+    SharedMutex mutex;
+    EXPECT_TRUE(mutex.try_lock_shared());
+    EXPECT_TRUE(mutex.try_lock_shared());
+    EXPECT_FALSE(mutex.try_lock());
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+
+    EXPECT_TRUE(mutex.try_lock());
+    EXPECT_FALSE(mutex.try_lock_shared());
+    EXPECT_FALSE(mutex.try_lock());
+    mutex.unlock();
+    EXPECT_TRUE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+}
+
+TEST(SharedMutexTest, WaitingWriterBlocksNewReaders)
+{
+    SharedMutex mutex;
+    std::atomic<bool> hasWritten{ false };
+    mutex.lock_shared();
+
+    std::thread writer(
+        [&]()
+    {
+        std::scoped_lock lock(mutex);
+        hasWritten.store(true);
+    }
+    );
+    while (mutex.try_lock_shared())
+    {
+        mutex.unlock_shared();
+        std::this_thread::yield();
+    }
+
+    // The writer now waits for the reader inside, and new readers wait for the writer.
+    EXPECT_FALSE(hasWritten.load());
+    mutex.unlock_shared();
+    writer.join();
+    EXPECT_TRUE(hasWritten.load());
+}
+
+TEST(SharedMutexTest, KeepsDataConsistent)
+{
+    constexpr UInt32 kReaderCount = 6;
+    constexpr UInt32 kWriterCount = 2;
+    constexpr UInt32 kIterationCount = 5000;
+
+    SharedMutex mutex;
+    UInt64 values[2]{};
+    std::atomic<UInt32> mismatchCount{ 0 };
+    std::thread threads[kReaderCount + kWriterCount];
+    for (UInt32 index = 0; index < kReaderCount + kWriterCount; ++index)
+    {
+        const bool isWriter = index < kWriterCount;
+        threads[index] = std::thread(
+            [&, isWriter]()
+        {
+            for (UInt32 iteration = 0; iteration < kIterationCount; ++iteration)
+            {
+                if (isWriter)
+                {
+                    std::scoped_lock lock(mutex);
+                    ++values[0];
+                    ++values[1];
+                }
+                else
+                {
+                    std::shared_lock lock(mutex);
+                    if (values[0] != values[1])
+                    {
+                        mismatchCount.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+        );
+    }
+    for (std::thread& thread: threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(mismatchCount.load(), 0u);
+    EXPECT_EQ(values[0], static_cast<UInt64>(kWriterCount) * kIterationCount);
+}
+
+TEST(SharedMutexTest, WorksAsProfilerSharedLockable)
+{
+    GP_SHARED_LOCKABLE_N(SharedMutex, mutex, "Shared test mutex");
+    GP_SHARED_LOCKABLE_BASE(SharedMutex)& base = mutex;
+    UInt64 value = 0;
+    std::atomic<bool> isTorn{ false };
+
+    std::thread writer(
+        [&]()
+    {
+        for (UInt32 iteration = 0; iteration < 10000; ++iteration)
+        {
+            std::scoped_lock lock(base);
+            ++value;
+            ++value;
+        }
+    }
+    );
+    std::thread reader(
+        [&]()
+    {
+        for (UInt32 iteration = 0; iteration < 10000; ++iteration)
+        {
+            std::shared_lock lock(base);
+            if (value % 2 != 0)
+            {
+                isTorn.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+    );
+    writer.join();
+    reader.join();
+
+    EXPECT_FALSE(isTorn.load());
+    EXPECT_EQ(value, 20000u);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,52 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "threading/SpinLock.hpp"
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+
+namespace gp::tests
+{
+
+TEST(SpinLockTest, TryLockFailsWhileHeld)
+{
+    SpinLock lock;
+    EXPECT_FALSE(lock.isLocked());
+    EXPECT_TRUE(lock.try_lock());
+    EXPECT_TRUE(lock.isLocked());
+    EXPECT_FALSE(lock.try_lock());
+    lock.unlock();
+    EXPECT_FALSE(lock.isLocked());
+}
+
+TEST(SpinLockTest, SerializesThreads)
+{
+    constexpr UInt32 kThreadCount = 8;
+    constexpr UInt32 kIterationCount = 20000;
+
+    SpinLock spinLock;
+    UInt64 counter = 0;
+    std::thread threads[kThreadCount];
+    for (std::thread& thread: threads)
+    {
+        thread = std::thread(
+            [&]()
+        {
+            for (UInt32 iteration = 0; iteration < kIterationCount; ++iteration)
+            {
+                std::scoped_lock lock(spinLock);
+                ++counter;
+            }
+        }
+        );
+    }
+    for (std::thread& thread: threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(counter, static_cast<UInt64>(kThreadCount) * kIterationCount);
+}
+
+}   // namespace gp::tests
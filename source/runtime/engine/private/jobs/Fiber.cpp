@@ -0,0 +1,300 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/Fiber.hpp"
+#include "maths/base/Scalar.hpp"
+#include "platforms/base/PlatformMemory.hpp"
+
+#if GP_PLATFORM_WINDOWS
+    #include <Windows.h>
+#endif
+
+#if defined(__SANITIZE_THREAD__)
+    #define GP_FIBER_SANITIZE_THREAD GP_TRUE
+#elif defined(__has_feature)
+    #if __has_feature(thread_sanitizer)
+        #define GP_FIBER_SANITIZE_THREAD GP_TRUE
+    #endif
+#endif
+#ifndef GP_FIBER_SANITIZE_THREAD
+    #define GP_FIBER_SANITIZE_THREAD GP_FALSE
+#endif
+
+#if GP_FIBER_SANITIZE_THREAD
+    #include <sanitizer/tsan_interface.h>
+#endif
+
+#if GP_JOBS_SUPPORTS_FIBERS && !GP_PLATFORM_WINDOWS
+
+    #if GP_PLATFORM_APPLE
+        #define GP_FIBER_SYMBOL(name) "_" #name
+        #define GP_FIBER_HIDDEN(name) ".private_extern _" #name "\n"
+    #else
+        #define GP_FIBER_SYMBOL(name) #name
+        #define GP_FIBER_HIDDEN(name) ".hidden " #name "\n"
+    #endif
+
+// Saves the callee-saved registers of the running fiber on its own stack, stores its stack pointer to *fromContext,
+// then loads toContext as the stack pointer and restores the registers saved there. Everything else is caller-saved,
+// the compiler already spilled it around the call.
+extern "C" void gpSwitchFiberContext(void** fromContext, void* toContext) noexcept;
+
+// First code a fiber runs: calls its entry point with the user data, both restored from its initial frame.
+extern "C" void gpFiberTrampoline() noexcept;
+
+    #if GP_ARCHITECTURE_X64
+
+// clang-format off
+__asm__(
+    ".text\n"
+    ".globl " GP_FIBER_SYMBOL(gpSwitchFiberContext) "\n"
+    GP_FIBER_HIDDEN(gpSwitchFiberContext)
+    ".p2align 4\n"
+    GP_FIBER_SYMBOL(gpSwitchFiberContext) ":\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    subq $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq $8, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+    ".globl " GP_FIBER_SYMBOL(gpFiberTrampoline) "\n"
+    GP_FIBER_HIDDEN(gpFiberTrampoline)
+    ".p2align 4\n"
+    GP_FIBER_SYMBOL(gpFiberTrampoline) ":\n"
+    "    movq %r13, %rdi\n"
+    "    callq *%r12\n"
+    "    ud2\n"
+);
+// clang-format on
+
+    #elif GP_ARCHITECTURE_ARM64
+
+// clang-format off
+__asm__(
+    ".text\n"
+    ".globl " GP_FIBER_SYMBOL(gpSwitchFiberContext) "\n"
+    GP_FIBER_HIDDEN(gpSwitchFiberContext)
+    ".p2align 4\n"
+    GP_FIBER_SYMBOL(gpSwitchFiberContext) ":\n"
+    "    sub sp, sp, #0xa0\n"
+    "    stp x19, x20, [sp, #0x00]\n"
+    "    stp x21, x22, [sp, #0x10]\n"
+    "    stp x23, x24, [sp, #0x20]\n"
+    "    stp x25, x26, [sp, #0x30]\n"
+    "    stp x27, x28, [sp, #0x40]\n"
+    "    stp x29, x30, [sp, #0x50]\n"
+    "    stp d8, d9, [sp, #0x60]\n"
+    "    stp d10, d11, [sp, #0x70]\n"
+    "    stp d12, d13, [sp, #0x80]\n"
+    "    stp d14, d15, [sp, #0x90]\n"
+    "    mov x9, sp\n"
+    "    str x9, [x0]\n"
+    "    mov sp, x1\n"
+    "    ldp x19, x20, [sp, #0x00]\n"
+    "    ldp x21, x22, [sp, #0x10]\n"
+    "    ldp x23, x24, [sp, #0x20]\n"
+    "    ldp x25, x26, [sp, #0x30]\n"
+    "    ldp x27, x28, [sp, #0x40]\n"
+    "    ldp x29, x30, [sp, #0x50]\n"
+    "    ldp d8, d9, [sp, #0x60]\n"
+    "    ldp d10, d11, [sp, #0x70]\n"
+    "    ldp d12, d13, [sp, #0x80]\n"
+    "    ldp d14, d15, [sp, #0x90]\n"
+    "    add sp, sp, #0xa0\n"
+    "    ret\n"
+    ".globl " GP_FIBER_SYMBOL(gpFiberTrampoline) "\n"
+    GP_FIBER_HIDDEN(gpFiberTrampoline)
+    ".p2align 4\n"
+    GP_FIBER_SYMBOL(gpFiberTrampoline) ":\n"
+    "    mov x0, x20\n"
+    "    blr x19\n"
+    "    brk #0\n"
+);
+// clang-format on
+
+    #endif
+
+#endif
+
+namespace gp::jobs
+{
+
+#if GP_JOBS_SUPPORTS_FIBERS && !GP_PLATFORM_WINDOWS
+
+namespace
+{
+
+/// @brief Builds the frame gpSwitchFiberContext() restores on the first switch to a fiber, so that it "returns" into
+/// gpFiberTrampoline() with the entry point and the user data in callee-saved registers.
+/// @return The initial stack pointer of the fiber.
+void* makeInitialFrame(const FiberStack& stack, Fiber::EntryPoint entryPoint, void* userData) noexcept
+{
+    const UIntPtr top = reinterpret_cast<UIntPtr>(stack.base + stack.size) & ~UIntPtr{ 15 };
+
+    #if GP_ARCHITECTURE_X64
+    // [mxcsr | x87 control word], r15, r14, r13, r12, rbx, rbp, return address, then 16 bytes of padding so that the
+    // trampoline calls the entry point with an aligned stack.
+    UInt64* frame = reinterpret_cast<UInt64*>(top - 80);
+    frame[0] = (UInt64{ 0x037F } << 32) | UInt64{ 0x1F80 };
+    frame[1] = 0;
+    frame[2] = 0;
+    frame[3] = reinterpret_cast<UInt64>(userData);
+    frame[4] = reinterpret_cast<UInt64>(entryPoint);
+    frame[5] = 0;
+    frame[6] = 0;
+    frame[7] = reinterpret_cast<UInt64>(&gpFiberTrampoline);
+    frame[8] = 0;
+    frame[9] = 0;
+    #else
+    // x19 - x28, x29, x30, then d8 - d15.
+    UInt64* frame = reinterpret_cast<UInt64*>(top - 0xA0);
+    for (UInt32 index = 0; index < 20; ++index)
+    {
+        frame[index] = 0;
+    }
+    frame[0] = reinterpret_cast<UInt64>(entryPoint);
+    frame[1] = reinterpret_cast<UInt64>(userData);
+    frame[11] = reinterpret_cast<UInt64>(&gpFiberTrampoline);
+    #endif
+
+    return frame;
+}
+
+}   // namespace
+
+#endif
+
+FiberStackPool::FiberStackPool(UInt32 stackCount, USize stackSize)
+    : m_stackCount(stackCount)
+{
+    const USize platformPageSize = platform::Memory::getPlatformConstants().standardPageSize;
+    const USize pageSize = platformPageSize != 0 ? platformPageSize : 4096;
+    m_stackSize = (math::max(stackSize, pageSize) + pageSize - 1) & ~(pageSize - 1);
+
+#if !GP_PLATFORM_WINDOWS
+    m_guardSize = pageSize;
+    m_allocationSize = static_cast<USize>(stackCount) * (m_guardSize + m_stackSize);
+    m_memory = static_cast<Byte*>(platform::Memory::allocatePages(m_allocationSize));
+    GP_ASSERT(m_memory != nullptr, "Failed to allocate the fiber stacks");
+
+    for (UInt32 index = 0; index < stackCount; ++index)
+    {
+        // Without memory protection, the guard page is left as plain padding between the stacks.
+        Byte* guard = m_memory + index * (m_guardSize + m_stackSize);
+        const bool isGuarded = platform::Memory::guardPages(guard, m_guardSize);
+        GP_ASSERT(isGuarded || !GP_PLATFORM_UNIX, "Failed to protect the guard page of a fiber stack");
+        (void)isGuarded;
+    }
+#endif
+}
+
+FiberStackPool::~FiberStackPool()
+{
+    if (m_memory != nullptr)
+    {
+        platform::Memory::freePages(m_memory, m_allocationSize);
+    }
+}
+
+FiberStack FiberStackPool::getStack(UInt32 index) const noexcept
+{
+    GP_ASSERT(index < m_stackCount);
+    if (m_memory == nullptr)
+    {
+        return { nullptr, m_stackSize };
+    }
+    return { m_memory + index * (m_guardSize + m_stackSize) + m_guardSize, m_stackSize };
+}
+
+Fiber::Fiber()
+    : m_isThread(true)
+{
+#if GP_PLATFORM_WINDOWS
+    GP_ASSERT(!::IsThreadAFiber(), "The thread already is a fiber");
+    m_context = ::ConvertThreadToFiberEx(nullptr, FIBER_FLAG_FLOAT_SWITCH);
+#endif
+#if GP_FIBER_SANITIZE_THREAD
+    m_sanitizerContext = __tsan_get_current_fiber();
+#endif
+}
+
+Fiber::Fiber(const FiberStack& stack, EntryPoint entryPoint, void* userData)
+{
+#if GP_PLATFORM_WINDOWS
+    m_entryPoint = entryPoint;
+    m_userData = userData;
+    m_context = ::CreateFiberEx(stack.size, stack.size, FIBER_FLAG_FLOAT_SWITCH, &Fiber::startNativeFiber, this);
+#elif GP_JOBS_SUPPORTS_FIBERS
+    m_context = makeInitialFrame(stack, entryPoint, userData);
+#else
+    (void)stack;
+    (void)entryPoint;
+    (void)userData;
+    GP_ASSERT(false, "Fibers are not supported on this platform");
+#endif
+#if GP_FIBER_SANITIZE_THREAD
+    m_sanitizerContext = __tsan_create_fiber(0);
+#endif
+}
+
+Fiber::~Fiber()
+{
+#if GP_PLATFORM_WINDOWS
+    if (m_isThread)
+    {
+        ::ConvertFiberToThread();
+    }
+    else
+    {
+        ::DeleteFiber(m_context);
+    }
+#endif
+#if GP_FIBER_SANITIZE_THREAD
+    if (!m_isThread)
+    {
+        __tsan_destroy_fiber(m_sanitizerContext);
+    }
+#endif
+}
+
+void Fiber::switchTo(Fiber& from, Fiber& to) noexcept
+{
+#if GP_FIBER_SANITIZE_THREAD
+    __tsan_switch_to_fiber(to.m_sanitizerContext, 0);
+#endif
+#if GP_PLATFORM_WINDOWS
+    (void)from;
+    ::SwitchToFiber(to.m_context);
+#elif GP_JOBS_SUPPORTS_FIBERS
+    gpSwitchFiberContext(&from.m_context, to.m_context);
+#else
+    (void)from;
+    (void)to;
+#endif
+}
+
+#if GP_PLATFORM_WINDOWS
+void GP_STDCALL Fiber::startNativeFiber(void* fiber)
+{
+    const Fiber* self = static_cast<const Fiber*>(fiber);
+    self->m_entryPoint(self->m_userData);
+}
+#endif
+
+}   // namespace gp::jobs
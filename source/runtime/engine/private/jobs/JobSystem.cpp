@@ -0,0 +1,602 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/JobSystem.hpp"
+#include "containers/queues/MPMCQueue.hpp"
+#include "containers/queues/WorkStealingDeque.hpp"
+#include "maths/base/Scalar.hpp"
+#include "profiling/Profiler.hpp"
+#include <cstdio>
+#include <utility>
+
+#if GP_PLATFORM_WINDOWS
+    #include <Windows.h>
+#elif GP_PLATFORM_LINUX
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace gp::jobs
+{
+
+namespace detail
+{
+
+/// @brief What the thread does with the fiber it just switched away from, once it runs on the next one.
+/// @details
+/// A fiber cannot publish itself before the switch: another thread could resume it while it still runs on its stack.
+/// The handoff is recorded in the thread context instead, and completed by the fiber switched to.
+enum class FiberHandoff : UInt8
+{
+    None,      //<! Nothing to do.
+    Release,   //<! Returns the fiber to the free list.
+    Park,      //<! Resumes the fiber once a counter reaches zero.
+    Requeue    //<! Resumes the fiber as soon as a worker is free.
+};
+
+/// @brief Per-thread state: the work-stealing deque of the thread and the ring its jobs are recycled from.
+struct JobThreadContext
+{
+    WorkStealingDeque<Job*, JobSystem::kDequeCapacity> deque;
+    Job jobPool[JobSystem::kJobPoolSize];
+    USize nextJob{ 0 };
+    UInt32 index{ 0 };
+    UInt32 randomState{ 0 };
+    Fiber* threadFiber{ nullptr };    //<! Fiber of the thread itself, null if the thread does not use fibers.
+    Fiber* currentFiber{ nullptr };   //<! Fiber running on the thread.
+    FiberHandoff handoff{ FiberHandoff::None };
+    Fiber* handoffFiber{ nullptr };
+    const JobCounter* handoffCounter{ nullptr };
+};
+
+/// @brief State shared by the threads that do not belong to the system.
+struct JobSharedState
+{
+    MPMCQueue<Job*, JobSystem::kInjectionQueueCapacity> injectionQueue;
+    Job jobPool[JobSystem::kJobPoolSize];
+    std::atomic<USize> nextJob{ 0 };
+
+    MPMCQueue<Job*, JobSystem::kMaxFiberCount> resumeQueue;   //<! Suspended fibers ready to resume.
+    MPMCQueue<Fiber*, JobSystem::kMaxFiberCount> freeFibers;
+    UniquePtr<FiberStackPool> fiberStacks;
+    UniquePtr<Fiber> fibers[JobSystem::kMaxFiberCount];
+};
+
+}   // namespace detail
+
+namespace
+{
+
+/// @brief Number of failed attempts to find a job before a worker goes to sleep, or a waiting thread yields.
+constexpr UInt32 kSpinCount = 64;
+
+thread_local const JobSystem* tlsSystem = nullptr;
+thread_local detail::JobThreadContext* tlsContext = nullptr;
+
+/// @brief Xorshift32 step, cheap enough to pick a random victim on every steal attempt.
+UInt32 nextRandom(UInt32& state) noexcept
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+void pinThreadToCore(std::thread& thread, UInt32 core) noexcept
+{
+#if GP_PLATFORM_WINDOWS
+    ::SetThreadAffinityMask(thread.native_handle(), DWORD_PTR{ 1 } << core);
+#elif GP_PLATFORM_LINUX
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(core, &cpuSet);
+    ::pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet);
+#else
+    // macOS only offers affinity hints through thread_policy_set, the scheduler already keeps threads on their core.
+    (void)thread;
+    (void)core;
+#endif
+}
+
+}   // namespace
+
+JobSystem::JobSystem(const hal::CPUInfo& cpuInfo, const JobSystemDesc& desc)
+    : m_shared(makeUnique<detail::JobSharedState>())
+{
+    const UInt32 workerCount = desc.workerCount != 0 ? math::min(desc.workerCount, kMaxThreads - 1)
+                                                     : computeWorkerCount(cpuInfo, desc.useLogicalCores);
+    m_threadCount = workerCount + 1;
+
+    // Every worker holds a fiber at all times, at least one more is needed for any of them to suspend.
+    if (GP_JOBS_SUPPORTS_FIBERS && desc.fiberCount != 0)
+    {
+        m_fiberCount = math::clamp(desc.fiberCount, workerCount + 1, kMaxFiberCount);
+        m_shared->fiberStacks = makeUnique<FiberStackPool>(m_fiberCount, desc.fiberStackSize);
+        for (UInt32 index = 0; index < m_fiberCount; ++index)
+        {
+            m_shared->fibers[index] =
+                makeUnique<Fiber>(m_shared->fiberStacks->getStack(index), &JobSystem::fiberMain, this);
+            (void)m_shared->freeFibers.tryPush(m_shared->fibers[index].get());
+        }
+    }
+
+    for (UInt32 index = 0; index < m_threadCount; ++index)
+    {
+        m_contexts[index] = makeUnique<detail::JobThreadContext>();
+        m_contexts[index]->index = index;
+        m_contexts[index]->randomState = 0x9E3779B9u * (index + 1);
+    }
+
+    tlsSystem = this;
+    tlsContext = m_contexts[0].get();
+
+    // Windows numbers the hyper-threads of a core consecutively, Linux enumerates one thread per core first.
+    const UInt32 logicalCoreCount = math::max(cpuInfo.logicalCoreCount, 1u);
+    const UInt32 physicalCoreCount = math::max(cpuInfo.physicalCoreCount, 1u);
+    const UInt32 coreStride =
+        (GP_PLATFORM_WINDOWS && !desc.useLogicalCores) ? math::max(logicalCoreCount / physicalCoreCount, 1u) : 1u;
+
+    for (UInt32 index = 1; index < m_threadCount; ++index)
+    {
+        m_workers[index] = std::thread(&JobSystem::workerMain, this, index);
+        if (desc.pinWorkers && logicalCoreCount > 1)
+        {
+            pinThreadToCore(m_workers[index], (index * coreStride) % logicalCoreCount);
+        }
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    m_isStopping.store(true, std::memory_order_seq_cst);
+    m_wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+    m_wakeEpoch.notify_all();
+
+    for (UInt32 index = 1; index < m_threadCount; ++index)
+    {
+        m_workers[index].join();
+    }
+
+    if (tlsSystem == this)
+    {
+        tlsSystem = nullptr;
+        tlsContext = nullptr;
+    }
+}
+
+UInt32 JobSystem::computeWorkerCount(const hal::CPUInfo& cpuInfo, bool useLogicalCores) noexcept
+{
+    const UInt32 coreCount = useLogicalCores ? cpuInfo.logicalCoreCount : cpuInfo.physicalCoreCount;
+    return math::clamp(coreCount, 2u, kMaxThreads) - 1;
+}
+
+void JobSystem::run(JobFunction function, JobCounter* counter)
+{
+    Job* job = allocateJob(getCurrentContext());
+    job->function = std::move(function);
+    job->counter = counter;
+    job->next = nullptr;
+    job->fiber = nullptr;
+
+    if (counter != nullptr)
+    {
+        increment(*counter);
+    }
+    submit(job);
+}
+
+void JobSystem::runAfter(JobCounter& dependency, JobFunction function, JobCounter* counter)
+{
+    Job* job = allocateJob(getCurrentContext());
+    job->function = std::move(function);
+    job->counter = counter;
+    job->fiber = nullptr;
+
+    if (counter != nullptr)
+    {
+        increment(*counter);
+    }
+    defer(dependency, job);
+}
+
+void JobSystem::increment(JobCounter& counter) noexcept
+{
+    // Reopens the list of continuations of a counter back from zero. The counter cannot release it again before the
+    // job counted here finishes, which is scheduled after this returns.
+    if (counter.m_value.fetch_add(1, std::memory_order_relaxed) == 0)
+    {
+        counter.m_continuations.store(nullptr, std::memory_order_release);
+    }
+}
+
+void JobSystem::decrement(JobCounter& counter)
+{
+    signal(counter);
+}
+
+void JobSystem::wait(const JobCounter& counter)
+{
+    detail::JobThreadContext* context = getCurrentContext();
+    UInt32 failedAttempts = 0;
+    while (!counter.isDone())
+    {
+        const bool isOnFiber = isRunningOnFiber(context);
+
+        // The value reads zero while the last job releases the continuations: too late to park, spin instead.
+        if (isOnFiber && counter.getValue() != 0 && trySuspend(context, counter))
+        {
+            context = getCurrentContext();
+            failedAttempts = 0;
+        }
+        else if (Job* job = findJob(context, isOnFiber))
+        {
+            if (job->fiber != nullptr)
+            {
+                // Every fiber is in use: hand this one over to a resumable fiber rather than leaving that one stuck.
+                switchToFiber(context, job->fiber, detail::FiberHandoff::Requeue);
+                context = getCurrentContext();
+            }
+            else
+            {
+                execute(job);
+            }
+            failedAttempts = 0;
+        }
+        else if (++failedAttempts < kSpinCount)
+        {
+            GP_PLATFORM_CPU_PAUSE();
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+UInt32 JobSystem::getCurrentThreadIndex() const noexcept
+{
+    const detail::JobThreadContext* context = getCurrentContext();
+    return context != nullptr ? context->index : kInvalidThreadIndex;
+}
+
+void JobSystem::fiberMain(void* system)
+{
+    JobSystem* self = static_cast<JobSystem*>(system);
+    self->completeFiberSwitch();
+    for (;;)
+    {
+        self->workerLoop();
+
+        // The system is stopping: give the thread back to its own fiber. Fibers are never resumed past this point.
+        detail::JobThreadContext* context = self->getCurrentContext();
+        self->switchToFiber(context, context->threadFiber, detail::FiberHandoff::Release);
+    }
+}
+
+void JobSystem::workerMain(UInt32 index)
+{
+    char threadName[32];
+    std::snprintf(threadName, sizeof(threadName), "Job Worker %u", index);
+    GP_SET_THREAD_NAME(threadName);
+
+    tlsSystem = this;
+    tlsContext = m_contexts[index].get();
+
+    Fiber* fiber = nullptr;
+    if (m_fiberCount != 0 && m_shared->freeFibers.tryPop(fiber))
+    {
+        Fiber threadFiber;
+        tlsContext->threadFiber = &threadFiber;
+        tlsContext->currentFiber = &threadFiber;
+        switchToFiber(tlsContext, fiber, detail::FiberHandoff::None);
+        tlsContext->threadFiber = nullptr;
+        tlsContext->currentFiber = nullptr;
+    }
+    else
+    {
+        workerLoop();
+    }
+
+    tlsSystem = nullptr;
+    tlsContext = nullptr;
+}
+
+void JobSystem::workerLoop()
+{
+    UInt32 failedAttempts = 0;
+    while (!m_isStopping.load(std::memory_order_acquire))
+    {
+        // Read again on every iteration, the fiber may have been suspended and resumed on another thread.
+        detail::JobThreadContext* context = getCurrentContext();
+        if (Job* job = findJob(context, isRunningOnFiber(context)))
+        {
+            process(context, job);
+            failedAttempts = 0;
+        }
+        else if (++failedAttempts < kSpinCount)
+        {
+            GP_PLATFORM_CPU_PAUSE();
+        }
+        else
+        {
+            sleepWorker(context);
+            failedAttempts = 0;
+        }
+    }
+}
+
+// Never inlined: a fiber may resume on another thread, and the compiler could otherwise reuse the address of the
+// thread-local variables it computed before the switch.
+GP_FORCENOINLINE detail::JobThreadContext* JobSystem::getCurrentContext() const noexcept
+{
+    return tlsSystem == this ? tlsContext : nullptr;
+}
+
+Job* JobSystem::allocateJob(detail::JobThreadContext* context) noexcept
+{
+    if (context != nullptr)
+    {
+        return &context->jobPool[context->nextJob++ & (kJobPoolSize - 1)];
+    }
+    const USize slot = m_shared->nextJob.fetch_add(1, std::memory_order_relaxed);
+    return &m_shared->jobPool[slot & (kJobPoolSize - 1)];
+}
+
+Job* JobSystem::findJob(detail::JobThreadContext* context, bool canResumeFibers) noexcept
+{
+    Job* job = nullptr;
+    // Suspended fibers come first: they hold stacks, and their jobs are already halfway through.
+    if (canResumeFibers && m_shared->resumeQueue.tryPop(job))
+    {
+        return job;
+    }
+    if (context != nullptr && context->deque.tryPop(job))
+    {
+        return job;
+    }
+    if (m_shared->injectionQueue.tryPop(job))
+    {
+        return job;
+    }
+
+    const UInt32 start = context != nullptr ? nextRandom(context->randomState) % m_threadCount : 0;
+    for (UInt32 offset = 0; offset < m_threadCount; ++offset)
+    {
+        const UInt32 victim = (start + offset) % m_threadCount;
+        if (context != nullptr && victim == context->index)
+        {
+            continue;
+        }
+        if (m_contexts[victim]->deque.trySteal(job))
+        {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::submit(Job* job)
+{
+    if (job->fiber != nullptr)
+    {
+        // Never full: it holds at most one job per fiber.
+        (void)m_shared->resumeQueue.tryPush(job);
+        wakeWorker();
+        return;
+    }
+
+    detail::JobThreadContext* context = getCurrentContext();
+    if ((context != nullptr && context->deque.tryPush(job)) || m_shared->injectionQueue.tryPush(job))
+    {
+        wakeWorker();
+        return;
+    }
+
+    // Every queue is full: running the job right away beats dropping it or blocking on a free slot.
+    execute(job);
+}
+
+void JobSystem::execute(Job* job)
+{
+    job->function();
+    job->function.reset();
+
+    if (JobCounter* counter = job->counter)
+    {
+        signal(*counter);
+    }
+}
+
+void JobSystem::process(detail::JobThreadContext* context, Job* job)
+{
+    if (job->fiber != nullptr)
+    {
+        // The current fiber sits in the worker loop, any other worker can pick the loop up where it left off.
+        switchToFiber(context, job->fiber, detail::FiberHandoff::Release);
+    }
+    else
+    {
+        execute(job);
+    }
+}
+
+void JobSystem::defer(const JobCounter& dependency, Job* job)
+{
+    // Pushing the job is the last access to the dependency: the job may run as soon as the counter reaches zero, and
+    // its waiter destroy the counter. A counter that released its list already closed it, the job runs right away.
+    Job* head = dependency.m_continuations.load(std::memory_order_acquire);
+    do
+    {
+        if (head == JobCounter::getReleasedList())
+        {
+            job->next = nullptr;
+            submit(job);
+            return;
+        }
+        job->next = head;
+    }
+    while (!dependency.m_continuations.compare_exchange_weak(
+        head, job, std::memory_order_seq_cst, std::memory_order_acquire
+    ));
+}
+
+void JobSystem::signal(JobCounter& counter)
+{
+    UInt32 value = counter.m_value.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        if (value != 1)
+        {
+            if (counter.m_value.compare_exchange_weak(
+                    value, value - 1, std::memory_order_seq_cst, std::memory_order_relaxed
+                ))
+            {
+                return;
+            }
+        }
+        else if (counter.m_value.compare_exchange_weak(
+                     value, JobCounter::kReleasingFlag, std::memory_order_seq_cst, std::memory_order_relaxed
+                 ))
+        {
+            // Last job: the counter only reads as done once the continuations are out, and clearing the flag is the
+            // last access to it, waiters may destroy it right after.
+            finishCounter(counter);
+            return;
+        }
+    }
+}
+
+void JobSystem::finishCounter(JobCounter& counter)
+{
+    for (;;)
+    {
+        releaseContinuations(counter);
+        UInt32 value = JobCounter::kReleasingFlag;
+        if (counter.m_value.compare_exchange_strong(
+                value, 0, std::memory_order_seq_cst, std::memory_order_relaxed
+            ))
+        {
+            return;
+        }
+
+        // Jobs were counted during the release: reopen the list for their continuations and hand the counter over
+        // to them, unless they finished meanwhile and the new continuations need releasing in turn.
+        counter.m_continuations.store(nullptr, std::memory_order_seq_cst);
+        while (value != JobCounter::kReleasingFlag)
+        {
+            if (counter.m_value.compare_exchange_weak(
+                    value, value & ~JobCounter::kReleasingFlag, std::memory_order_seq_cst, std::memory_order_relaxed
+                ))
+            {
+                return;
+            }
+        }
+    }
+}
+
+void JobSystem::releaseContinuations(const JobCounter& counter)
+{
+    Job* job = counter.m_continuations.exchange(JobCounter::getReleasedList(), std::memory_order_seq_cst);
+    while (job != nullptr)
+    {
+        Job* next = job->next;
+        job->next = nullptr;
+        submit(job);
+        job = next;
+    }
+}
+
+bool JobSystem::isRunningOnFiber(const detail::JobThreadContext* context) const noexcept
+{
+    return context != nullptr && context->currentFiber != nullptr && context->currentFiber != context->threadFiber;
+}
+
+bool JobSystem::trySuspend(detail::JobThreadContext* context, const JobCounter& counter)
+{
+    Fiber* fiber = nullptr;
+    if (!m_shared->freeFibers.tryPop(fiber))
+    {
+        return false;
+    }
+    switchToFiber(context, fiber, detail::FiberHandoff::Park, &counter);
+    return true;
+}
+
+void JobSystem::switchToFiber(
+    detail::JobThreadContext* context, Fiber* fiber, detail::FiberHandoff handoff, const JobCounter* counter
+)
+{
+    Fiber* current = context->currentFiber;
+    context->handoff = handoff;
+    context->handoffFiber = current;
+    context->handoffCounter = counter;
+    context->currentFiber = fiber;
+    Fiber::switchTo(*current, *fiber);
+
+    // Resumed, possibly on another thread: complete the handoff of the fiber that switched back to this one.
+    completeFiberSwitch();
+}
+
+void JobSystem::completeFiberSwitch()
+{
+    detail::JobThreadContext* context = getCurrentContext();
+    Fiber* fiber = context->handoffFiber;
+    const detail::FiberHandoff handoff = std::exchange(context->handoff, detail::FiberHandoff::None);
+    switch (handoff)
+    {
+        case detail::FiberHandoff::None:
+            break;
+        case detail::FiberHandoff::Release:
+            (void)m_shared->freeFibers.tryPush(fiber);
+            break;
+        case detail::FiberHandoff::Park:
+        case detail::FiberHandoff::Requeue:
+        {
+            Job* job = allocateJob(context);
+            job->counter = nullptr;
+            job->next = nullptr;
+            job->fiber = fiber;
+            if (handoff == detail::FiberHandoff::Park)
+            {
+                defer(*context->handoffCounter, job);
+            }
+            else
+            {
+                submit(job);
+            }
+            break;
+        }
+    }
+}
+
+void JobSystem::wakeWorker() noexcept
+{
+    m_wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleepingCount.load(std::memory_order_seq_cst) != 0)
+    {
+        m_wakeEpoch.notify_one();
+    }
+}
+
+void JobSystem::sleepWorker(detail::JobThreadContext* context)
+{
+    // Jobs are published before the epoch moves, so a job scheduled after this load either shows up in the check
+    // below or changes the epoch, which makes the wait return immediately.
+    const UInt32 epoch = m_wakeEpoch.load(std::memory_order_seq_cst);
+    m_sleepingCount.fetch_add(1, std::memory_order_seq_cst);
+
+    if (Job* job = findJob(context, isRunningOnFiber(context)))
+    {
+        m_sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+        process(context, job);
+        return;
+    }
+    if (!m_isStopping.load(std::memory_order_acquire))
+    {
+        m_wakeEpoch.wait(epoch, std::memory_order_seq_cst);
+    }
+    m_sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+}   // namespace gp::jobs
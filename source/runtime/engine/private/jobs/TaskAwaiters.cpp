@@ -0,0 +1,79 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/TaskAwaiters.hpp"
+#include <cstdio>
+
+namespace gp::jobs
+{
+
+namespace
+{
+
+Expected<USize, FileReadError> readFileBlocking(const char* path, Byte* buffer, USize size, UInt64 offset) noexcept
+{
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr)
+    {
+        return makeUnexpected(FileReadError::OpenFailed);
+    }
+
+#if GP_PLATFORM_WINDOWS
+    const bool hasSeeked = ::_fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+    const bool hasSeeked = ::fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+    if (!hasSeeked)
+    {
+        std::fclose(file);
+        return makeUnexpected(FileReadError::SeekFailed);
+    }
+
+    const USize readCount = std::fread(buffer, 1, size, file);
+    const bool hasFailed = std::ferror(file) != 0;
+    std::fclose(file);
+    if (hasFailed)
+    {
+        return makeUnexpected(FileReadError::ReadFailed);
+    }
+    return readCount;
+}
+
+}   // namespace
+
+void FileReadAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    m_system.run(
+        [this, handle]()
+    {
+        m_result = readFileBlocking(m_path, m_buffer, m_size, m_offset);
+        handle.resume();
+    }
+    );
+}
+
+void FrameBoundary::Awaiter::await_suspend(std::coroutine_handle<> handle) noexcept
+{
+    m_handle = handle;
+    m_next = m_owner.m_waiters.load(std::memory_order_relaxed);
+    while (!m_owner.m_waiters.compare_exchange_weak(m_next, this, std::memory_order_release, std::memory_order_relaxed))
+    {}
+}
+
+void FrameBoundary::signal()
+{
+    const UInt64 frameIndex = m_frameIndex.fetch_add(1, std::memory_order_acq_rel) + 1;
+    Awaiter* waiter = m_waiters.exchange(nullptr, std::memory_order_acquire);
+    while (waiter != nullptr)
+    {
+        // The coroutine may resume, and destroy its awaiter, as soon as it is scheduled.
+        Awaiter* next = waiter->m_next;
+        const std::coroutine_handle<> handle = waiter->m_handle;
+        waiter->m_frameIndex = frameIndex;
+        m_system.run([handle]() { handle.resume(); });
+        waiter = next;
+    }
+}
+
+}   // namespace gp::jobs
@@ -0,0 +1,146 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/TaskFrameAllocator.hpp"
+#include "containers/queues/MPMCQueue.hpp"
+#include "memory/GlobalMemory.hpp"
+#include "profiling/Profiler.hpp"
+#include "threading/Mutex.hpp"
+#include <mutex>
+
+namespace gp::jobs
+{
+
+namespace
+{
+
+/// @brief Bytes in front of every frame, recording the class it came from. Keeps the frame at the default new
+/// alignment.
+constexpr USize kHeaderSize = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+constexpr UInt32 kClassCount = 6;
+constexpr UInt8 kHeapClass = 0xFF;
+
+static_assert(TaskFrameAllocator::kMinClassSize << (kClassCount - 1) == TaskFrameAllocator::kMaxClassSize);
+
+/// @brief Frames of one size class, header included.
+struct FrameClass
+{
+    static constexpr USize kMaxSlabCount = TaskFrameAllocator::kMaxFramesPerClass / TaskFrameAllocator::kSlabFrameCount;
+
+    MPMCQueue<Byte*, TaskFrameAllocator::kMaxFramesPerClass> freeFrames;
+    GP_LOCKABLE_N(Mutex, growMutex, "Task frame class growth");
+    Byte* slabs[kMaxSlabCount]{};
+    USize slabCount{ 0 };
+};
+
+class FramePool
+{
+private:
+    FrameClass m_classes[kClassCount];
+
+public:
+    ~FramePool()
+    {
+        for (FrameClass& frameClass: m_classes)
+        {
+            for (USize index = 0; index < frameClass.slabCount; ++index)
+            {
+                memory::getGlobalMalloc()->deallocate(frameClass.slabs[index]);
+            }
+        }
+    }
+
+public:
+    static FramePool& get()
+    {
+        static FramePool instance;
+        return instance;
+    }
+
+    /// @brief Returns a free block of @p classIndex, header included, or nullptr once the class is full.
+    Byte* acquire(UInt32 classIndex)
+    {
+        FrameClass& frameClass = m_classes[classIndex];
+        Byte* block = nullptr;
+        if (frameClass.freeFrames.tryPop(block))
+        {
+            return block;
+        }
+
+        std::scoped_lock lock(frameClass.growMutex);
+        if (frameClass.freeFrames.tryPop(block))
+        {
+            return block;
+        }
+        if (frameClass.slabCount == FrameClass::kMaxSlabCount)
+        {
+            return nullptr;
+        }
+
+        const USize blockSize = TaskFrameAllocator::kMinClassSize << classIndex;
+        Byte* slab = static_cast<Byte*>(memory::getGlobalMalloc()->allocate(
+            blockSize * TaskFrameAllocator::kSlabFrameCount, __STDCPP_DEFAULT_NEW_ALIGNMENT__
+        ));
+        frameClass.slabs[frameClass.slabCount++] = slab;
+        for (USize index = 1; index < TaskFrameAllocator::kSlabFrameCount; ++index)
+        {
+            (void)frameClass.freeFrames.tryPush(slab + index * blockSize);
+        }
+        return slab;
+    }
+
+    /// @brief Returns a block to its class. Never fails: a class never holds more blocks than its queue capacity.
+    void release(UInt32 classIndex, Byte* block) noexcept
+    {
+        (void)m_classes[classIndex].freeFrames.tryPush(block);
+    }
+};
+
+[[nodiscard]] constexpr UInt32 getClassIndex(USize blockSize) noexcept
+{
+    UInt32 classIndex = 0;
+    while ((TaskFrameAllocator::kMinClassSize << classIndex) < blockSize)
+    {
+        ++classIndex;
+    }
+    return classIndex;
+}
+
+}   // namespace
+
+void* TaskFrameAllocator::allocate(USize size)
+{
+    const USize blockSize = size + kHeaderSize;
+    Byte* block = nullptr;
+    UInt8 classIndex = kHeapClass;
+    if (blockSize <= kMaxClassSize)
+    {
+        classIndex = static_cast<UInt8>(getClassIndex(blockSize));
+        block = FramePool::get().acquire(classIndex);
+    }
+    if (block == nullptr)
+    {
+        classIndex = kHeapClass;
+        block = static_cast<Byte*>(memory::getGlobalMalloc()->allocate(blockSize, __STDCPP_DEFAULT_NEW_ALIGNMENT__));
+    }
+
+    *reinterpret_cast<UInt8*>(block) = classIndex;
+    return block + kHeaderSize;
+}
+
+void TaskFrameAllocator::deallocate(void* frame) noexcept
+{
+    Byte* block = static_cast<Byte*>(frame) - kHeaderSize;
+    const UInt8 classIndex = *reinterpret_cast<const UInt8*>(block);
+    if (classIndex == kHeapClass)
+    {
+        memory::getGlobalMalloc()->deallocate(block);
+    }
+    else
+    {
+        FramePool::get().release(classIndex, block);
+    }
+}
+
+}   // namespace gp::jobs
@@ -0,0 +1,318 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/TaskGraph.hpp"
+#include "maths/base/Scalar.hpp"
+#include "profiling/Profiler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+namespace gp::jobs
+{
+
+namespace detail
+{
+
+struct TaskGraphNodeState
+{
+    const char* name{ nullptr };
+    UInt32 nameLength{ 0 };
+    JobFunction function;
+    UInt64 costHint{ 1 };
+    UInt64 priority{ 0 };                    //<! Cost of the longest chain starting with the node.
+    UInt32 predecessorCount{ 0 };
+    UInt32 firstSuccessor{ 0 };              //<! Index of the first successor in TaskGraphState::successors.
+    UInt32 successorCount{ 0 };
+    std::atomic<UInt32> pendingCount{ 0 };   //<! Predecessors left to finish during the current execution.
+    std::atomic<UInt64> duration{ 0 };       //<! Duration of the last execution, in nanoseconds.
+};
+
+struct TaskGraphEdge
+{
+    UInt32 before;
+    UInt32 after;
+};
+
+struct TaskGraphState
+{
+    TaskGraphNodeState nodes[TaskGraph::kMaxNodes];
+    UInt32 nodeCount{ 0 };
+    TaskGraphEdge edges[TaskGraph::kMaxEdges];
+    UInt32 edgeCount{ 0 };
+
+    UInt32 successors[TaskGraph::kMaxEdges];   //<! Successors of every node, each range sorted by priority.
+    UInt32 order[TaskGraph::kMaxNodes];        //<! Nodes in topological order.
+    UInt32 roots[TaskGraph::kMaxNodes];        //<! Nodes without predecessors, sorted by priority.
+    UInt32 rootCount{ 0 };
+    UInt64 criticalPathCost{ 0 };
+
+    JobSystem* system{ nullptr };   //<! Job system of the current execution.
+    JobCounter counter;             //<! Counts the nodes scheduled during the current execution.
+};
+
+}   // namespace detail
+
+namespace
+{
+
+void sortByPriority(const detail::TaskGraphState& state, UInt32* first, UInt32 count)
+{
+    std::sort(
+        first,
+        first + count,
+        [&state](UInt32 left, UInt32 right)
+    {
+        const UInt64 leftPriority = state.nodes[left].priority;
+        const UInt64 rightPriority = state.nodes[right].priority;
+        return leftPriority != rightPriority ? leftPriority > rightPriority : left < right;
+    }
+    );
+}
+
+/// @brief Ranks every node by its critical path, then sorts the successor lists and the roots accordingly.
+void computePriorities(detail::TaskGraphState& state, bool useDurations)
+{
+    state.criticalPathCost = 0;
+    for (UInt32 position = state.nodeCount; position-- > 0;)
+    {
+        detail::TaskGraphNodeState& node = state.nodes[state.order[position]];
+        const UInt64 duration = node.duration.load(std::memory_order_relaxed);
+        UInt64 successorPriority = 0;
+        for (UInt32 index = 0; index < node.successorCount; ++index)
+        {
+            successorPriority =
+                math::max(successorPriority, state.nodes[state.successors[node.firstSuccessor + index]].priority);
+        }
+        node.priority = ((useDurations && duration != 0) ? duration : node.costHint) + successorPriority;
+        state.criticalPathCost = math::max(state.criticalPathCost, node.priority);
+    }
+
+    for (UInt32 index = 0; index < state.nodeCount; ++index)
+    {
+        const detail::TaskGraphNodeState& node = state.nodes[index];
+        sortByPriority(state, state.successors + node.firstSuccessor, node.successorCount);
+    }
+    sortByPriority(state, state.roots, state.rootCount);
+}
+
+void runNode(detail::TaskGraphState* state, UInt32 index);
+
+void scheduleNode(detail::TaskGraphState* state, UInt32 index)
+{
+    state->system->run([state, index]() { runNode(state, index); }, &state->counter);
+}
+
+/// @brief Runs a node, then the chain of its most critical successors that it releases.
+void runNode(detail::TaskGraphState* state, UInt32 index)
+{
+    while (index != TaskGraphNode::kInvalidIndex)
+    {
+        detail::TaskGraphNodeState& node = state->nodes[index];
+        {
+            GP_PROFILE_SCOPE_N("TaskGraph::runNode");
+            GP_PROFILE_ZONE_NAME(node.name, node.nameLength);
+            const auto start = std::chrono::steady_clock::now();
+            node.function();
+            const auto duration = std::chrono::steady_clock::now() - start;
+            node.duration.store(
+                static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()),
+                std::memory_order_relaxed
+            );
+        }
+
+        // Successors are sorted by priority: the first one released continues here, the others are scheduled from
+        // the most critical down, the oldest jobs of a deque being the first stolen.
+        UInt32 next = TaskGraphNode::kInvalidIndex;
+        for (UInt32 position = 0; position < node.successorCount; ++position)
+        {
+            const UInt32 successor = state->successors[node.firstSuccessor + position];
+            if (state->nodes[successor].pendingCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                continue;
+            }
+            if (next == TaskGraphNode::kInvalidIndex)
+            {
+                next = successor;
+            }
+            else
+            {
+                scheduleNode(state, successor);
+            }
+        }
+        index = next;
+    }
+}
+
+}   // namespace
+
+TaskGraph::TaskGraph(UniquePtr<detail::TaskGraphState> state) noexcept
+    : m_state(std::move(state))
+{}
+
+TaskGraph::TaskGraph(TaskGraph&& other) noexcept = default;
+
+TaskGraph& TaskGraph::operator=(TaskGraph&& other) noexcept = default;
+
+TaskGraph::~TaskGraph() = default;
+
+void TaskGraph::execute(JobSystem& system)
+{
+    GP_PROFILE_SCOPE_N("TaskGraph::execute");
+    detail::TaskGraphState* state = m_state.get();
+    for (UInt32 index = 0; index < state->nodeCount; ++index)
+    {
+        state->nodes[index].pendingCount.store(state->nodes[index].predecessorCount, std::memory_order_relaxed);
+    }
+
+    state->system = &system;
+    for (UInt32 index = 0; index < state->rootCount; ++index)
+    {
+        scheduleNode(state, state->roots[index]);
+    }
+    system.wait(state->counter);
+    state->system = nullptr;
+}
+
+void TaskGraph::updatePriorities()
+{
+    computePriorities(*m_state, true);
+}
+
+UInt32 TaskGraph::getNodeCount() const noexcept
+{
+    return m_state->nodeCount;
+}
+
+const char* TaskGraph::getNodeName(TaskGraphNode node) const noexcept
+{
+    GP_ASSERT(node.index < m_state->nodeCount, "Invalid task graph node");
+    return m_state->nodes[node.index].name;
+}
+
+UInt64 TaskGraph::getNodeDuration(TaskGraphNode node) const noexcept
+{
+    GP_ASSERT(node.index < m_state->nodeCount, "Invalid task graph node");
+    return m_state->nodes[node.index].duration.load(std::memory_order_relaxed);
+}
+
+UInt64 TaskGraph::getNodePriority(TaskGraphNode node) const noexcept
+{
+    GP_ASSERT(node.index < m_state->nodeCount, "Invalid task graph node");
+    return m_state->nodes[node.index].priority;
+}
+
+UInt64 TaskGraph::getCriticalPathCost() const noexcept
+{
+    return m_state->criticalPathCost;
+}
+
+TaskGraphBuilder::TaskGraphBuilder()
+    : m_state(makeUnique<detail::TaskGraphState>())
+{}
+
+TaskGraphBuilder::~TaskGraphBuilder() = default;
+
+TaskGraphNode TaskGraphBuilder::addNode(const char* name, JobFunction function, UInt64 costHint)
+{
+    if (m_state->nodeCount == TaskGraph::kMaxNodes)
+    {
+        if (!m_error.hasValue())
+        {
+            m_error.emplace(TaskGraphError::TooManyNodes);
+        }
+        return {};
+    }
+
+    const UInt32 index = m_state->nodeCount++;
+    detail::TaskGraphNodeState& node = m_state->nodes[index];
+    node.name = name;
+    node.nameLength = static_cast<UInt32>(std::strlen(name));
+    node.function = std::move(function);
+    node.costHint = math::max(costHint, static_cast<UInt64>(1));
+    return { index };
+}
+
+void TaskGraphBuilder::addDependency(TaskGraphNode before, TaskGraphNode after)
+{
+    if (m_error.hasValue())
+    {
+        return;
+    }
+    if (before.index >= m_state->nodeCount || after.index >= m_state->nodeCount)
+    {
+        m_error.emplace(TaskGraphError::InvalidNode);
+        return;
+    }
+    if (m_state->edgeCount == TaskGraph::kMaxEdges)
+    {
+        m_error.emplace(TaskGraphError::TooManyEdges);
+        return;
+    }
+    m_state->edges[m_state->edgeCount++] = { before.index, after.index };
+}
+
+Expected<TaskGraph, TaskGraphError> TaskGraphBuilder::compile()
+{
+    UniquePtr<detail::TaskGraphState> state = std::exchange(m_state, makeUnique<detail::TaskGraphState>());
+    if (m_error.hasValue())
+    {
+        const TaskGraphError error = *m_error;
+        m_error.reset();
+        return makeUnexpected(error);
+    }
+
+    // Groups the successors of every node, in the order the dependencies were added.
+    for (UInt32 index = 0; index < state->edgeCount; ++index)
+    {
+        ++state->nodes[state->edges[index].before].successorCount;
+        ++state->nodes[state->edges[index].after].predecessorCount;
+    }
+    UInt32 offset = 0;
+    for (UInt32 index = 0; index < state->nodeCount; ++index)
+    {
+        state->nodes[index].firstSuccessor = offset;
+        offset += state->nodes[index].successorCount;
+        state->nodes[index].successorCount = 0;
+    }
+    for (UInt32 index = 0; index < state->edgeCount; ++index)
+    {
+        detail::TaskGraphNodeState& before = state->nodes[state->edges[index].before];
+        state->successors[before.firstSuccessor + before.successorCount++] = state->edges[index].after;
+    }
+
+    // Kahn's algorithm, the order array doubling as its queue.
+    UInt32 orderCount = 0;
+    for (UInt32 index = 0; index < state->nodeCount; ++index)
+    {
+        state->nodes[index].pendingCount.store(state->nodes[index].predecessorCount, std::memory_order_relaxed);
+        if (state->nodes[index].predecessorCount == 0)
+        {
+            state->roots[state->rootCount++] = index;
+            state->order[orderCount++] = index;
+        }
+    }
+    for (UInt32 position = 0; position < orderCount; ++position)
+    {
+        const detail::TaskGraphNodeState& node = state->nodes[state->order[position]];
+        for (UInt32 index = 0; index < node.successorCount; ++index)
+        {
+            const UInt32 successor = state->successors[node.firstSuccessor + index];
+            if (state->nodes[successor].pendingCount.fetch_sub(1, std::memory_order_relaxed) == 1)
+            {
+                state->order[orderCount++] = successor;
+            }
+        }
+    }
+    if (orderCount != state->nodeCount)
+    {
+        return makeUnexpected(TaskGraphError::Cycle);
+    }
+
+    computePriorities(*state, false);
+    return TaskGraph(std::move(state));
+}
+
+}   // namespace gp::jobs
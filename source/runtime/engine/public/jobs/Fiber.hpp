@@ -0,0 +1,130 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+
+/// @brief Whether fibers are available: hand-written context switches for x64 and ARM64 on GCC and Clang, or the
+/// native fiber API on Windows.
+#if GP_PLATFORM_WINDOWS
+    #define GP_JOBS_SUPPORTS_FIBERS GP_TRUE
+#elif (GP_COMPILER_GCC || GP_COMPILER_CLANG) && (GP_ARCHITECTURE_X64 || GP_ARCHITECTURE_ARM64)
+    #define GP_JOBS_SUPPORTS_FIBERS GP_TRUE
+#else
+    #define GP_JOBS_SUPPORTS_FIBERS GP_FALSE
+#endif
+
+namespace gp::jobs
+{
+
+/// @brief A region of memory a fiber runs on.
+struct FiberStack
+{
+    Byte* base{ nullptr };   //<! Lowest usable address, stacks grow downward from base + size.
+    USize size{ 0 };         //<! Usable size in bytes.
+};
+
+/// @brief A fixed set of fiber stacks carved from a single page allocation.
+/// @details
+/// Every stack is preceded by a guard page made inaccessible through platform::Memory::guardPages(): a stack overflow
+/// faults right away instead of silently corrupting the stack below it. Platforms that cannot protect memory keep the
+/// guard page as padding only.
+/// @note On Windows, the native fiber API allocates the stacks, with guard pages of its own: the pool only records
+///       their size and getStack() returns no memory.
+class FiberStackPool
+{
+private:
+    Byte* m_memory{ nullptr };
+    USize m_allocationSize{ 0 };
+    USize m_stackSize{ 0 };
+    USize m_guardSize{ 0 };
+    UInt32 m_stackCount{ 0 };
+
+public:
+    /// @brief Allocates the stacks.
+    /// @param[in] stackCount Number of stacks.
+    /// @param[in] stackSize Usable size of each stack, rounded up to the page size.
+    FiberStackPool(UInt32 stackCount, USize stackSize);
+
+    /// @brief Frees the stacks. No fiber may still be running on them.
+    ~FiberStackPool();
+
+    FiberStackPool(const FiberStackPool&) = delete;
+    FiberStackPool& operator=(const FiberStackPool&) = delete;
+    FiberStackPool(FiberStackPool&&) = delete;
+    FiberStackPool& operator=(FiberStackPool&&) = delete;
+
+public:
+    /// @brief Returns the stack at @p index, in [0, getStackCount()).
+    [[nodiscard]] FiberStack getStack(UInt32 index) const noexcept;
+
+    /// @brief Returns the number of stacks.
+    [[nodiscard]] UInt32 getStackCount() const noexcept
+    {
+        return m_stackCount;
+    }
+
+    /// @brief Returns the usable size of each stack.
+    [[nodiscard]] USize getStackSize() const noexcept
+    {
+        return m_stackSize;
+    }
+};
+
+/// @brief An execution context with its own stack, switched to cooperatively.
+/// @details
+/// A default-constructed fiber stands for the calling thread itself: it is the context a thread switches away from when
+/// it first enters a fiber, and switches back to when it is done with fibers. Other fibers start at their entry point
+/// on the first switch to them, and resume where they left off afterwards. A fiber is not bound to a thread: it may be
+/// suspended on one thread and resumed on another, as long as it only runs on one thread at a time.
+/// @note Thread-local variables must be read again after a switch, the fiber may have moved to another thread.
+class Fiber
+{
+public:
+    /// @brief Function a fiber starts at. It must never return, the fiber has nowhere to return to.
+    using EntryPoint = void (*)(void* userData);
+
+private:
+    void* m_context{ nullptr };            //<! Saved stack pointer, or the native fiber handle on Windows.
+    void* m_sanitizerContext{ nullptr };   //<! Fiber handle of ThreadSanitizer, when enabled.
+    bool m_isThread{ false };
+#if GP_PLATFORM_WINDOWS
+    EntryPoint m_entryPoint{ nullptr };
+    void* m_userData{ nullptr };
+#endif
+
+public:
+    /// @brief Makes a fiber of the calling thread, which must be destroyed on that same thread.
+    /// @note On Windows, the calling thread must not already be a fiber.
+    Fiber();
+
+    /// @brief Makes a fiber starting at @p entryPoint on the first switch to it.
+    /// @param[in] stack Stack the fiber runs on, which must outlive it.
+    /// @param[in] entryPoint Function the fiber starts at.
+    /// @param[in] userData Argument passed to @p entryPoint.
+    Fiber(const FiberStack& stack, EntryPoint entryPoint, void* userData);
+
+    /// @brief Releases the fiber, which must not be running.
+    ~Fiber();
+
+    Fiber(const Fiber&) = delete;
+    Fiber& operator=(const Fiber&) = delete;
+    Fiber(Fiber&&) = delete;
+    Fiber& operator=(Fiber&&) = delete;
+
+public:
+    /// @brief Suspends @p from, the fiber running on the calling thread, and resumes @p to.
+    /// @details Returns once another thread, or this one, switches back to @p from.
+    /// @param[in,out] from Fiber running on the calling thread, saves where it left off.
+    /// @param[in] to Fiber to resume.
+    static void switchTo(Fiber& from, Fiber& to) noexcept;
+
+private:
+#if GP_PLATFORM_WINDOWS
+    static void GP_STDCALL startNativeFiber(void* fiber);
+#endif
+};
+
+}   // namespace gp::jobs
@@ -0,0 +1,68 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include <atomic>
+
+namespace gp::jobs
+{
+
+struct Job;
+class JobSystem;
+
+/// @brief Atomic count of unfinished jobs, used to wait for a group of jobs and to express dependencies.
+/// @details
+/// Every job run with a counter increments it when scheduled and decrements it when it finishes. A counter at zero is
+/// done: JobSystem::wait() returns and the jobs scheduled with JobSystem::runAfter() on it are released. Counters can
+/// be reused once they reached zero.
+/// @note Counters are pinned in memory, jobs reference them by address.
+class JobCounter
+{
+    friend class JobSystem;
+
+private:
+    /// @brief Set in the value while the thread finishing the last job releases the continuations: the counter is not
+    /// done until that thread stopped touching it, so a waiter can safely destroy it as soon as it reads zero.
+    static constexpr UInt32 kReleasingFlag = 1u << 31;
+
+private:
+    std::atomic<UInt32> m_value{ 0 };
+    /// @brief Intrusive stack of jobs waiting for the counter to reach zero, or getReleasedList() once the counter
+    /// released them: jobs deferred on a released list run right away instead of being pushed. Mutable since fibers
+    /// waiting on a const counter park themselves there.
+    mutable std::atomic<Job*> m_continuations{ getReleasedList() };
+
+public:
+    /// @brief Constructs a counter at zero.
+    JobCounter() noexcept = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+    JobCounter(JobCounter&&) = delete;
+    JobCounter& operator=(JobCounter&&) = delete;
+
+public:
+    /// @brief Returns the number of unfinished jobs.
+    [[nodiscard]] UInt32 getValue() const noexcept
+    {
+        return m_value.load(std::memory_order_acquire) & ~kReleasingFlag;
+    }
+
+    /// @brief Checks whether every job of the counter finished and its continuations were released.
+    [[nodiscard]] bool isDone() const noexcept
+    {
+        return m_value.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    /// @brief Returns the marker of a list of continuations closed by the last job, never a valid job address.
+    [[nodiscard]] static Job* getReleasedList() noexcept
+    {
+        return reinterpret_cast<Job*>(UIntPtr{ 1 });
+    }
+};
+
+}   // namespace gp::jobs
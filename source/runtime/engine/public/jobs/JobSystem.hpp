@@ -0,0 +1,194 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include "hardware/CPUInfo.hpp"
+#include "jobs/Fiber.hpp"
+#include "jobs/JobCounter.hpp"
+#include "memory/pointers/UniquePtr.hpp"
+#include "templates/Delegate.hpp"
+#include <atomic>
+#include <thread>
+
+namespace gp::jobs
+{
+
+/// @brief Callable executed by a job. Captures must fit in the inline storage of the delegate.
+using JobFunction = Delegate<void()>;
+
+/// @brief A unit of work scheduled on the job system.
+/// @note Jobs are recycled from fixed-size pools owned by the job system and are never allocated by the user.
+struct Job
+{
+    JobFunction function;              //<! Work to execute.
+    JobCounter* counter{ nullptr };    //<! Counter decremented once the function returned, may be null.
+    Job* next{ nullptr };              //<! Link in the continuation list of a JobCounter.
+    Fiber* fiber{ nullptr };           //<! Suspended fiber to resume instead of calling the function, may be null.
+};
+
+namespace detail
+{
+
+struct JobThreadContext;
+struct JobSharedState;
+enum class FiberHandoff : UInt8;
+
+}   // namespace detail
+
+/// @brief Settings of a JobSystem.
+struct JobSystemDesc
+{
+    /// @brief Number of worker threads to spawn, or 0 to derive it from the CPU information.
+    UInt32 workerCount{ 0 };
+
+    /// @brief Whether the derived worker count includes hyper-threads, or only counts physical cores.
+    bool useLogicalCores{ false };
+
+    /// @brief Whether each worker is pinned to its own core, which keeps its caches warm across frames.
+    bool pinWorkers{ true };
+
+    /// @brief Number of fibers the workers run jobs on, at least one more than the worker count, or 0 to run jobs on
+    /// the worker threads directly. Ignored where GP_JOBS_SUPPORTS_FIBERS is false.
+    UInt32 fiberCount{ 128 };
+
+    /// @brief Stack size of each fiber, in bytes.
+    USize fiberStackSize{ 128 * 1024 };
+};
+
+/// @brief Work-stealing job scheduler.
+/// @details
+/// Every thread of the system owns a Chase-Lev deque: jobs it schedules are pushed there and popped back in LIFO order
+/// while they are still hot in its caches. An idle thread steals the oldest job of a randomly chosen victim, so the
+/// load spreads out without any central queue on the hot path. Threads outside of the system schedule through a
+/// bounded lock-free injection queue instead.
+/// The thread constructing the system becomes thread 0: it does not get a worker thread of its own but executes jobs
+/// whenever it calls wait(). Workers spin briefly when they run out of work, then sleep on an atomic wait until new
+/// jobs are scheduled.
+/// Dependencies are expressed with JobCounter: wait() helps executing jobs until a counter reaches zero, and
+/// runAfter() parks a job on a counter until it does, without occupying any thread in the meantime.
+/// Workers run jobs on fibers taken from a pool. A job that calls wait() on a fiber does not block its worker: the
+/// fiber parks itself on the counter and the worker carries on with a fresh fiber. Once the counter reaches zero, the
+/// fiber is resumed by whichever worker is free first. The owner thread and threads outside of the system have no
+/// fiber, they wait by helping executing jobs.
+/// @note Each thread recycles jobs from a ring of kJobPoolSize entries: a thread must not have more than kJobPoolSize
+///       jobs scheduled and unfinished at any time.
+class JobSystem
+{
+public:
+    static constexpr UInt32 kMaxThreads = 64;
+    static constexpr UInt32 kInvalidThreadIndex = ~0u;
+    static constexpr USize kJobPoolSize = 4096;
+    static constexpr USize kDequeCapacity = 4096;
+    static constexpr USize kInjectionQueueCapacity = 4096;
+    static constexpr UInt32 kMaxFiberCount = 1024;
+
+private:
+    UniquePtr<detail::JobSharedState> m_shared;
+    UniquePtr<detail::JobThreadContext> m_contexts[kMaxThreads];
+    std::thread m_workers[kMaxThreads];   //<! Index 0 is left empty, it stands for the owner thread.
+    UInt32 m_threadCount{ 1 };
+    UInt32 m_fiberCount{ 0 };
+    std::atomic<UInt32> m_wakeEpoch{ 0 };
+    std::atomic<UInt32> m_sleepingCount{ 0 };
+    std::atomic<bool> m_isStopping{ false };
+
+public:
+    /// @brief Spawns the worker threads and registers the calling thread as thread 0.
+    /// @param[in] cpuInfo Information about the CPU, used to size and pin the workers.
+    /// @param[in] desc Settings of the job system.
+    explicit JobSystem(const hal::CPUInfo& cpuInfo, const JobSystemDesc& desc = {});
+
+    /// @brief Stops and joins the worker threads.
+    /// @note Every scheduled job must have finished, wait() on their counters first.
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+    JobSystem& operator=(JobSystem&&) = delete;
+
+public:
+    /// @brief Returns the number of workers to spawn on a CPU, leaving one core to the thread owning the system.
+    /// @param[in] cpuInfo Information about the CPU.
+    /// @param[in] useLogicalCores Whether to count hyper-threads as cores.
+    /// @return The number of worker threads, at least 1 and at most kMaxThreads - 1.
+    [[nodiscard]] static UInt32 computeWorkerCount(const hal::CPUInfo& cpuInfo, bool useLogicalCores) noexcept;
+
+    /// @brief Schedules a job.
+    /// @param[in] function Work to execute.
+    /// @param[in] counter Counter to increment now and to decrement once the job finished, may be null.
+    void run(JobFunction function, JobCounter* counter = nullptr);
+
+    /// @brief Schedules a job once @p dependency reaches zero.
+    /// @param[in] dependency Counter the job waits for.
+    /// @param[in] function Work to execute.
+    /// @param[in] counter Counter to increment now and to decrement once the job finished, may be null.
+    void runAfter(JobCounter& dependency, JobFunction function, JobCounter* counter = nullptr);
+
+    /// @brief Counts a unit of work that is not a job, such as a suspended coroutine, on @p counter.
+    /// @param[in] counter Counter to increment now, decrement() it once the work finished.
+    void increment(JobCounter& counter) noexcept;
+
+    /// @brief Marks a unit of work counted with increment() as finished.
+    /// @details Releases the continuations of @p counter if it reaches zero, after which it may be destroyed.
+    /// @param[in] counter Counter to decrement.
+    void decrement(JobCounter& counter);
+
+    /// @brief Waits for @p counter to reach zero.
+    /// @details
+    /// On a fiber, the fiber is suspended until then and the worker executes other jobs, the fiber may resume on
+    /// another worker. Otherwise, or if every fiber is in use, the calling thread executes jobs until then.
+    /// @param[in] counter Counter to wait for.
+    void wait(const JobCounter& counter);
+
+    /// @brief Returns the number of worker threads.
+    [[nodiscard]] UInt32 getWorkerCount() const noexcept
+    {
+        return m_threadCount - 1;
+    }
+
+    /// @brief Returns the number of threads executing jobs: the workers and the thread owning the system.
+    [[nodiscard]] UInt32 getThreadCount() const noexcept
+    {
+        return m_threadCount;
+    }
+
+    /// @brief Returns the number of fibers the workers run jobs on, 0 if they run jobs on their threads directly.
+    [[nodiscard]] UInt32 getFiberCount() const noexcept
+    {
+        return m_fiberCount;
+    }
+
+    /// @brief Returns the index of the calling thread in the system, 0 being the owner thread.
+    /// @return The thread index, or kInvalidThreadIndex if the calling thread does not belong to the system.
+    [[nodiscard]] UInt32 getCurrentThreadIndex() const noexcept;
+
+private:
+    static void fiberMain(void* system);
+    void workerMain(UInt32 index);
+    void workerLoop();
+    [[nodiscard]] detail::JobThreadContext* getCurrentContext() const noexcept;
+    [[nodiscard]] Job* allocateJob(detail::JobThreadContext* context) noexcept;
+    [[nodiscard]] Job* findJob(detail::JobThreadContext* context, bool canResumeFibers) noexcept;
+    void submit(Job* job);
+    void execute(Job* job);
+    void process(detail::JobThreadContext* context, Job* job);
+    void defer(const JobCounter& dependency, Job* job);
+    void signal(JobCounter& counter);
+    void finishCounter(JobCounter& counter);
+    void releaseContinuations(const JobCounter& counter);
+    [[nodiscard]] bool isRunningOnFiber(const detail::JobThreadContext* context) const noexcept;
+    [[nodiscard]] bool trySuspend(detail::JobThreadContext* context, const JobCounter& counter);
+    void switchToFiber(
+        detail::JobThreadContext* context, Fiber* fiber, detail::FiberHandoff handoff,
+        const JobCounter* counter = nullptr
+    );
+    void completeFiberSwitch();
+    void wakeWorker() noexcept;
+    void sleepWorker(detail::JobThreadContext* context);
+};
+
+}   // namespace gp::jobs
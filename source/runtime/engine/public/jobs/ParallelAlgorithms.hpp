@@ -0,0 +1,328 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "containers/ContainerForward.hpp"
+#include "CoreMinimal.hpp"
+#include "containers/views/VectorView.hpp"
+#include "jobs/JobCounter.hpp"
+#include "jobs/JobSystem.hpp"
+#include "maths/base/Scalar.hpp"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <new>
+#include <utility>
+
+#if GP_PLATFORM_SUPPORTS_TBB
+    #include <tbb/blocked_range.h>
+    #include <tbb/parallel_for.h>
+    #include <tbb/parallel_reduce.h>
+    #include <tbb/parallel_sort.h>
+#endif
+
+namespace gp::jobs
+{
+
+/// @brief Maximum number of partial results of parallelReduce(), which bounds its stack usage.
+inline constexpr USize kMaxReduceChunks = 256;
+
+/// @brief Below this number of elements, parallelSort() sorts on the calling thread.
+inline constexpr USize kParallelSortThreshold = 4096;
+
+namespace detail
+{
+
+/// @brief Guided self-scheduling over [begin, end).
+/// @details
+/// Threads claim chunks with a CAS on a shared cursor. Each chunk covers half of the remaining iterations divided by
+/// the thread count, never less than the grain size: the first chunks are large, which keeps the number of claims
+/// logarithmic, and the last ones are small, which evens out the finishing times when iterations have uneven costs.
+/// @tparam Index Integer type of the iteration space.
+template <concepts::IsIntegral Index>
+class GuidedRange
+{
+private:
+    std::atomic<Index> m_cursor;
+    Index m_end;
+    Index m_grainSize;
+    Index m_divisor;
+
+public:
+    GuidedRange(Index begin, Index end, Index grainSize, UInt32 threadCount) noexcept
+        : m_cursor(begin)
+        , m_end(end)
+        , m_grainSize(grainSize)
+        , m_divisor(static_cast<Index>(2 * threadCount))
+    {}
+
+    /// @brief Claims the next chunk.
+    /// @param[out] outFirst First iteration of the chunk.
+    /// @param[out] outLast Iteration past the last one of the chunk.
+    /// @return False once every iteration was claimed.
+    [[nodiscard]] bool claim(Index& outFirst, Index& outLast) noexcept
+    {
+        Index cursor = m_cursor.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if (cursor >= m_end)
+            {
+                return false;
+            }
+            const Index remaining = m_end - cursor;
+            const Index size = math::min(remaining, math::max(m_grainSize, static_cast<Index>(remaining / m_divisor)));
+            if (m_cursor.compare_exchange_weak(cursor, cursor + size, std::memory_order_relaxed))
+            {
+                outFirst = cursor;
+                outLast = cursor + size;
+                return true;
+            }
+        }
+    }
+};
+
+/// @brief Returns the grain size to use for @p count iterations: @p grainSize if set, otherwise a size giving every
+/// thread about 64 chunks, enough to balance the load while keeping the claims cheap.
+template <concepts::IsIntegral Index>
+[[nodiscard]] constexpr Index resolveGrainSize(Index count, UInt32 threadCount, Index grainSize) noexcept
+{
+    return grainSize > 0 ? grainSize : math::max(Index{ 1 }, static_cast<Index>(count / (threadCount * 64)));
+}
+
+/// @brief Runs @p body on @p jobCount threads, the calling one included, and returns once every run finished.
+template <typename Body>
+void runOnThreads(JobSystem& system, UInt32 jobCount, Body& body)
+{
+    JobCounter counter;
+    for (UInt32 job = 1; job < jobCount; ++job)
+    {
+        system.run([&body]() { body(); }, &counter);
+    }
+    body();
+    system.wait(counter);
+}
+
+}   // namespace detail
+
+/// @brief Calls @p func(first, last) on chunks covering [begin, end), in parallel.
+/// @details
+/// Chunks are claimed dynamically with guided scheduling, see detail::GuidedRange, and the calling thread takes part in
+/// the work. With GP_PLATFORM_SUPPORTS_TBB the loop is handed to tbb::parallel_for instead.
+/// @param[in] system Job system running the chunks.
+/// @param[in] begin First iteration.
+/// @param[in] end Iteration past the last one.
+/// @param[in] func Callable invoked as func(Index first, Index last), concurrently from several threads.
+/// @param[in] grainSize Minimum number of iterations per chunk, 0 to pick one from the iteration count.
+template <concepts::IsIntegral Index, typename F>
+requires concepts::IsInvocable<F&, Index, Index>
+void parallelForRange(JobSystem& system, Index begin, Index end, F&& func, Index grainSize = 0)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    const Index count = end - begin;
+    const UInt32 threadCount = system.getThreadCount();
+    const Index grain = detail::resolveGrainSize(count, threadCount, grainSize);
+    if (threadCount == 1 || count <= grain)
+    {
+        func(begin, end);
+        return;
+    }
+
+#if GP_PLATFORM_SUPPORTS_TBB
+    tbb::parallel_for(
+        tbb::blocked_range<Index>(begin, end, static_cast<USize>(grain)),
+        [&func](const tbb::blocked_range<Index>& range) { func(range.begin(), range.end()); }
+    );
+#else
+    detail::GuidedRange<Index> range(begin, end, grain, threadCount);
+    auto body = [&range, &func]()
+    {
+        Index first;
+        Index last;
+        while (range.claim(first, last))
+        {
+            func(first, last);
+        }
+    };
+    const Index chunkCount = (count + grain - 1) / grain;
+    detail::runOnThreads(system, static_cast<UInt32>(math::min(static_cast<Index>(threadCount), chunkCount)), body);
+#endif
+}
+
+/// @brief Calls @p func(index) for every index of [begin, end), in parallel.
+/// @param[in] system Job system running the iterations.
+/// @param[in] begin First index.
+/// @param[in] end Index past the last one.
+/// @param[in] func Callable invoked as func(Index index), concurrently from several threads.
+/// @param[in] grainSize Minimum number of iterations per chunk, 0 to pick one from the iteration count.
+template <concepts::IsIntegral Index, typename F>
+requires concepts::IsInvocable<F&, Index>
+void parallelFor(JobSystem& system, Index begin, Index end, F&& func, Index grainSize = 0)
+{
+    parallelForRange(
+        system, begin, end,
+        [&func](Index first, Index last)
+    {
+        for (Index index = first; index < last; ++index)
+        {
+            func(index);
+        }
+    },
+        grainSize
+    );
+}
+
+/// @brief Calls @p func(element) for every element of @p view, in parallel.
+/// @param[in] system Job system running the iterations.
+/// @param[in] view Elements to visit.
+/// @param[in] func Callable invoked as func(T& element), concurrently from several threads.
+/// @param[in] grainSize Minimum number of elements per chunk, 0 to pick one from the element count.
+template <typename T, typename SizeType, typename F>
+requires concepts::IsInvocable<F&, T&>
+void parallelForEach(JobSystem& system, VectorView<T, SizeType> view, F&& func, SizeType grainSize = 0)
+{
+    T* const data = view.data();
+    parallelForRange(
+        system, SizeType{ 0 }, view.size(),
+        [data, &func](SizeType first, SizeType last)
+    {
+        for (SizeType index = first; index < last; ++index)
+        {
+            func(data[index]);
+        }
+    },
+        grainSize
+    );
+}
+
+/// @brief Reduces [begin, end) in parallel.
+/// @details
+/// The range is cut into at most kMaxReduceChunks chunks of equal size. Each chunk is reduced from a copy of
+/// @p identity, and the partial results are combined in chunk order on the calling thread. Chunk boundaries only depend
+/// on the iteration count, so the result is deterministic even for non-associative operations such as floating-point
+/// sums. With GP_PLATFORM_SUPPORTS_TBB the reduction uses tbb::parallel_deterministic_reduce instead.
+/// @param[in] system Job system running the chunks.
+/// @param[in] begin First iteration.
+/// @param[in] end Iteration past the last one.
+/// @param[in] identity Neutral element of @p combine.
+/// @param[in] reduce Callable invoked as reduce(Index first, Index last, T accumulator) -> T.
+/// @param[in] combine Callable invoked as combine(T left, T right) -> T.
+/// @param[in] grainSize Minimum number of iterations per chunk, 0 to pick one from the iteration count.
+/// @return The combination of every partial result, or @p identity for an empty range.
+template <concepts::IsIntegral Index, concepts::IsCopyConstructible T, typename Reduce, typename Combine>
+requires(std::is_invocable_r_v<T, Reduce&, Index, Index, T> && std::is_invocable_r_v<T, Combine&, T, T>)
+[[nodiscard]] T parallelReduce(
+    JobSystem& system, Index begin, Index end, T identity, Reduce&& reduce, Combine&& combine, Index grainSize = 0
+)
+{
+    if (begin >= end)
+    {
+        return identity;
+    }
+
+    const Index count = end - begin;
+    const UInt32 threadCount = system.getThreadCount();
+    const Index grain = detail::resolveGrainSize(count, threadCount, grainSize);
+    if (threadCount == 1 || count <= grain)
+    {
+        return reduce(begin, end, std::move(identity));
+    }
+
+#if GP_PLATFORM_SUPPORTS_TBB
+    return tbb::parallel_deterministic_reduce(
+        tbb::blocked_range<Index>(begin, end, static_cast<USize>(grain)), identity,
+        [&reduce](const tbb::blocked_range<Index>& range, T accumulator)
+    { return reduce(range.begin(), range.end(), std::move(accumulator)); },
+        combine
+    );
+#else
+    const Index maxChunks = math::min(static_cast<Index>(kMaxReduceChunks), (count + grain - 1) / grain);
+    const Index chunkSize = (count + maxChunks - 1) / maxChunks;
+    const Index chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    alignas(T) Byte partialStorage[kMaxReduceChunks * sizeof(T)];
+    T* const partials = reinterpret_cast<T*>(partialStorage);
+
+    std::atomic<Index> nextChunk{ 0 };
+    auto body = [&]()
+    {
+        for (Index chunk = nextChunk.fetch_add(1, std::memory_order_relaxed); chunk < chunkCount;
+             chunk = nextChunk.fetch_add(1, std::memory_order_relaxed))
+        {
+            const Index first = begin + chunk * chunkSize;
+            const Index last = math::min(first + chunkSize, end);
+            ::new (static_cast<void*>(partials + chunk)) T(reduce(first, last, identity));
+        }
+    };
+    detail::runOnThreads(system, static_cast<UInt32>(math::min(static_cast<Index>(threadCount), chunkCount)), body);
+
+    T result = std::move(*std::launder(partials));
+    std::destroy_at(std::launder(partials));
+    for (Index chunk = 1; chunk < chunkCount; ++chunk)
+    {
+        T* const partial = std::launder(partials + chunk);
+        result = combine(std::move(result), std::move(*partial));
+        std::destroy_at(partial);
+    }
+    return result;
+#endif
+}
+
+/// @brief Sorts @p view in parallel.
+/// @details
+/// The view is cut into a power-of-two number of blocks, about one per thread, which are sorted concurrently and then
+/// merged pairwise in log2(blocks) parallel rounds. Views under kParallelSortThreshold elements are sorted on the
+/// calling thread. With GP_PLATFORM_SUPPORTS_TBB the sort is handed to tbb::parallel_sort instead.
+/// @note The sort is not stable.
+/// @param[in] system Job system running the sort.
+/// @param[in,out] view Elements to sort.
+/// @param[in] compare Strict weak ordering, invoked concurrently from several threads.
+template <typename T, typename SizeType, typename Compare = std::less<>>
+requires concepts::IsPredicate<Compare&, const T&, const T&>
+void parallelSort(JobSystem& system, VectorView<T, SizeType> view, Compare compare = {})
+{
+    T* const data = view.data();
+    const USize count = static_cast<USize>(view.size());
+    const UInt32 threadCount = system.getThreadCount();
+    if (threadCount == 1 || count < kParallelSortThreshold)
+    {
+        std::sort(data, data + count, compare);
+        return;
+    }
+
+#if GP_PLATFORM_SUPPORTS_TBB
+    tbb::parallel_sort(data, data + count, compare);
+#else
+    UInt32 blockCount = 1;
+    while (blockCount < threadCount && count / (blockCount * 2) >= kParallelSortThreshold / 2)
+    {
+        blockCount *= 2;
+    }
+    const auto blockBegin = [data, count, blockCount](UInt32 block) { return data + count * block / blockCount; };
+
+    parallelFor(
+        system, 0u, blockCount, [&](UInt32 block) { std::sort(blockBegin(block), blockBegin(block + 1), compare); }, 1u
+    );
+
+    for (UInt32 width = 1; width < blockCount; width *= 2)
+    {
+        parallelFor(
+            system, 0u, blockCount / (2 * width),
+            [&](UInt32 pair)
+        {
+            const UInt32 first = pair * 2 * width;
+            std::inplace_merge(blockBegin(first), blockBegin(first + width), blockBegin(first + 2 * width), compare);
+        },
+            1u
+        );
+    }
+#endif
+}
+
+}   // namespace gp::jobs
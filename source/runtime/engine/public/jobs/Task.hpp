@@ -0,0 +1,378 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "concepts/Concepts.hpp"
+#include "CoreMinimal.hpp"
+#include "jobs/JobCounter.hpp"
+#include "jobs/JobSystem.hpp"
+#include "jobs/TaskFrameAllocator.hpp"
+#include "templates/Optional.hpp"
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace gp::jobs
+{
+
+template <typename T = void>
+class Task;
+
+namespace detail
+{
+
+/// @brief Part of the promise shared by every task: pooled frames, lazy start, and symmetric transfer to the awaiting
+/// coroutine on completion.
+struct TaskPromiseBase
+{
+    /// @brief Resumes the awaiting coroutine straight from the final suspension point, without growing the stack.
+    struct FinalAwaiter
+    {
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <typename Promise>
+        [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+        {
+            return handle.promise().continuation;
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::coroutine_handle<> continuation{ std::noop_coroutine() };   //<! Coroutine awaiting the task.
+
+    [[nodiscard]] static void* operator new(USize size)
+    {
+        return TaskFrameAllocator::allocate(size);
+    }
+
+    static void operator delete(void* frame) noexcept
+    {
+        TaskFrameAllocator::deallocate(frame);
+    }
+
+    [[nodiscard]] std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    [[nodiscard]] FinalAwaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    /// @brief Errors travel as Expected values, an exception escaping a task is a bug.
+    [[noreturn]] void unhandled_exception() const noexcept
+    {
+        std::terminate();
+    }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase
+{
+    Optional<T> result;
+
+    [[nodiscard]] Task<T> get_return_object() noexcept;
+
+    template <typename U = T>
+    requires concepts::IsConstructibleWith<T, U&&>
+    void return_value(U&& value)
+    {
+        result.emplace(std::forward<U>(value));
+    }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase
+{
+    [[nodiscard]] Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+};
+
+}   // namespace detail
+
+/// @brief Lazily started coroutine producing a value of type T.
+/// @details
+/// A task starts running when it is awaited, on the thread awaiting it, and resumes its awaiter directly when it
+/// completes. Where a task runs afterwards is chosen by what it awaits: resumeOn() moves it to a worker of a
+/// JobSystem, waitFor() resumes it once a JobCounter reaches zero, readFile() once a read completed, and
+/// FrameBoundary::next() at the next frame. Root tasks are started with spawn(), or with syncWait() to block until
+/// they finish.
+/// Frames come from TaskFrameAllocator, and every awaiter lives in the frame of its coroutine: awaiting does not
+/// allocate.
+/// @note Exceptions are not supported: failures are returned as values, typically with Task<Expected<T, E>>.
+/// @code
+///   Task<Expected<Mesh, LoadError>> loadMesh(JobSystem& system, const char* path, VectorView<Byte, USize> buffer)
+///   {
+///       Expected<USize, FileReadError> size = co_await readFile(system, path, buffer);
+///       if (!size)
+///       {
+///           co_return makeUnexpected(LoadError::FileNotFound);
+///       }
+///       co_return parseMesh(buffer.data(), *size);
+///   }
+/// @endcode
+/// @tparam T Type of the result, void for none.
+template <typename T>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = detail::TaskPromise<T>;
+    using ValueType = T;
+
+private:
+    /// @brief Starts the task, with the awaiting coroutine as its continuation.
+    class Awaiter
+    {
+    private:
+        std::coroutine_handle<promise_type> m_handle;
+
+    public:
+        explicit Awaiter(std::coroutine_handle<promise_type> handle) noexcept
+            : m_handle(handle)
+        {}
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return m_handle.done();
+        }
+
+        [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept
+        {
+            m_handle.promise().continuation = awaiting;
+            return m_handle;
+        }
+
+        T await_resume() const noexcept
+        {
+            if constexpr (!concepts::IsSameAs<T, void>)
+            {
+                return std::move(*m_handle.promise().result);
+            }
+        }
+    };
+
+private:
+    std::coroutine_handle<promise_type> m_handle;
+
+public:
+    /// @brief Constructs an empty task.
+    Task() noexcept = default;
+
+    /// @brief Takes ownership of a coroutine.
+    /// @param[in] handle Coroutine, suspended at its initial suspension point.
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+        : m_handle(handle)
+    {}
+
+    Task(Task&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, {}))
+    {}
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+            m_handle = std::exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    /// @brief Destroys the coroutine, which must not be running.
+    ~Task()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+public:
+    /// @brief Checks whether the task holds a coroutine.
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return static_cast<bool>(m_handle);
+    }
+
+    /// @brief Checks whether the coroutine ran to completion.
+    [[nodiscard]] bool isDone() const noexcept
+    {
+        return m_handle && m_handle.done();
+    }
+
+    /// @brief Runs the task until it completes, then returns its result. The task must be valid and awaited once.
+    [[nodiscard]] Awaiter operator co_await() const noexcept
+    {
+        GP_ASSERT(m_handle, "Awaiting an empty task");
+        return Awaiter(m_handle);
+    }
+};
+
+namespace detail
+{
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+/// @brief Coroutine owning a root task: started by a job, it destroys its own frame once the task completed.
+struct DetachedTask
+{
+    struct promise_type : TaskPromiseBase
+    {
+        [[nodiscard]] DetachedTask get_return_object() noexcept
+        {
+            return { std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+
+        [[nodiscard]] std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept {}
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+inline DetachedTask runDetached(JobSystem& system, Task<void> task, JobCounter* counter)
+{
+    co_await task;
+    if (counter != nullptr)
+    {
+        system.decrement(*counter);
+    }
+}
+
+template <typename T>
+Task<void> storeResult(Task<T> task, Optional<T>& result)
+{
+    result.emplace(co_await task);
+}
+
+}   // namespace detail
+
+/// @brief Awaiter moving the awaiting coroutine to a worker of a job system.
+class ResumeOnAwaiter
+{
+private:
+    JobSystem& m_system;
+
+public:
+    explicit ResumeOnAwaiter(JobSystem& system) noexcept
+        : m_system(system)
+    {}
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const
+    {
+        m_system.run([handle]() { handle.resume(); });
+    }
+
+    void await_resume() const noexcept {}
+};
+
+/// @brief Awaiter resuming the awaiting coroutine once a counter reaches zero, on the worker releasing it.
+class CounterAwaiter
+{
+private:
+    JobSystem& m_system;
+    JobCounter& m_counter;
+
+public:
+    CounterAwaiter(JobSystem& system, JobCounter& counter) noexcept
+        : m_system(system)
+        , m_counter(counter)
+    {}
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return m_counter.isDone();
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const
+    {
+        m_system.runAfter(m_counter, [handle]() { handle.resume(); });
+    }
+
+    void await_resume() const noexcept {}
+};
+
+/// @brief Continues the awaiting coroutine as a job of @p system.
+/// @param[in] system Job system to run on.
+[[nodiscard]] inline ResumeOnAwaiter resumeOn(JobSystem& system) noexcept
+{
+    return ResumeOnAwaiter(system);
+}
+
+/// @brief Suspends the awaiting coroutine until @p counter reaches zero, without occupying any thread.
+/// @param[in] system Job system resuming the coroutine.
+/// @param[in] counter Counter to wait for.
+[[nodiscard]] inline CounterAwaiter waitFor(JobSystem& system, JobCounter& counter) noexcept
+{
+    return CounterAwaiter(system, counter);
+}
+
+/// @brief Starts @p task on a worker of @p system, without waiting for it.
+/// @param[in] system Job system starting the task.
+/// @param[in] task Task to run, owned by the job system until it completes.
+/// @param[in] counter Counter incremented now and decremented once the task completed, may be null.
+inline void spawn(JobSystem& system, Task<void> task, JobCounter* counter = nullptr)
+{
+    if (counter != nullptr)
+    {
+        system.increment(*counter);
+    }
+    const std::coroutine_handle<> handle = detail::runDetached(system, std::move(task), counter).handle;
+    system.run([handle]() { handle.resume(); });
+}
+
+/// @brief Runs @p task on @p system and waits for its result, executing jobs in the meantime.
+/// @param[in] system Job system running the task.
+/// @param[in] task Task to run.
+/// @return The result of the task.
+template <typename T>
+T syncWait(JobSystem& system, Task<T> task)
+{
+    JobCounter counter;
+    if constexpr (concepts::IsSameAs<T, void>)
+    {
+        spawn(system, std::move(task), &counter);
+        system.wait(counter);
+    }
+    else
+    {
+        Optional<T> result;
+        spawn(system, detail::storeResult(std::move(task), result), &counter);
+        system.wait(counter);
+        return std::move(*result);
+    }
+}
+
+}   // namespace gp::jobs
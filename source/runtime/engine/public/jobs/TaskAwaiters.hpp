@@ -0,0 +1,151 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include "containers/views/VectorView.hpp"
+#include "jobs/JobSystem.hpp"
+#include "templates/Expected.hpp"
+#include <atomic>
+#include <coroutine>
+
+namespace gp::jobs
+{
+
+/// @brief Reasons a readFile() can fail.
+enum class FileReadError : UInt8
+{
+    OpenFailed,   //<! The file does not exist or cannot be opened for reading.
+    SeekFailed,   //<! The offset is past the end of the file.
+    ReadFailed    //<! The operating system reported an error while reading.
+};
+
+/// @brief Awaiter reading a file on a worker of a job system, then resuming the awaiting coroutine on that worker.
+/// @note The read blocks the worker it runs on.
+class FileReadAwaiter
+{
+private:
+    JobSystem& m_system;
+    const char* m_path;
+    Byte* m_buffer;
+    USize m_size;
+    UInt64 m_offset;
+    Expected<USize, FileReadError> m_result;
+
+public:
+    FileReadAwaiter(JobSystem& system, const char* path, VectorView<Byte, USize> buffer, UInt64 offset) noexcept
+        : m_system(system)
+        , m_path(path)
+        , m_buffer(buffer.data())
+        , m_size(buffer.size())
+        , m_offset(offset)
+    {}
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle);
+
+    [[nodiscard]] Expected<USize, FileReadError> await_resume() const noexcept
+    {
+        return m_result;
+    }
+};
+
+/// @brief Reads up to @p buffer.size() bytes of a file, starting at @p offset.
+/// @param[in] system Job system running the read.
+/// @param[in] path Null-terminated path of the file, which must stay valid until the read completed.
+/// @param[out] buffer Destination of the bytes read.
+/// @param[in] offset Offset of the first byte to read, in bytes.
+/// @return An awaiter producing the number of bytes read, less than the buffer size at the end of the file.
+[[nodiscard]] inline FileReadAwaiter
+    readFile(JobSystem& system, const char* path, VectorView<Byte, USize> buffer, UInt64 offset = 0) noexcept
+{
+    return FileReadAwaiter(system, path, buffer, offset);
+}
+
+/// @brief Point of the frame loop coroutines can wait for.
+/// @details
+/// Coroutines awaiting next() are pushed on a lock-free intrusive list, their awaiters living in their frames. The
+/// frame loop calls signal() once per frame, which schedules every waiting coroutine as a job.
+/// @code
+///   for (;;)
+///   {
+///       const UInt64 frameIndex = co_await endOfFrame.next();
+///       streamNextChunk(frameIndex);
+///   }
+/// @endcode
+class FrameBoundary
+{
+public:
+    /// @brief Awaiter resuming the awaiting coroutine at the next call to signal().
+    class Awaiter
+    {
+        friend class FrameBoundary;
+
+    private:
+        FrameBoundary& m_owner;
+        Awaiter* m_next{ nullptr };
+        std::coroutine_handle<> m_handle;
+        UInt64 m_frameIndex{ 0 };
+
+    public:
+        explicit Awaiter(FrameBoundary& owner) noexcept
+            : m_owner(owner)
+        {}
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept;
+
+        /// @brief Returns the index of the frame the boundary was signaled for.
+        [[nodiscard]] UInt64 await_resume() const noexcept
+        {
+            return m_frameIndex;
+        }
+    };
+
+private:
+    JobSystem& m_system;
+    std::atomic<Awaiter*> m_waiters{ nullptr };
+    std::atomic<UInt64> m_frameIndex{ 0 };
+
+public:
+    /// @brief Constructs a boundary resuming its waiters on @p system.
+    explicit FrameBoundary(JobSystem& system) noexcept
+        : m_system(system)
+    {}
+
+    /// @brief No coroutine may still be waiting.
+    ~FrameBoundary() = default;
+
+    FrameBoundary(const FrameBoundary&) = delete;
+    FrameBoundary& operator=(const FrameBoundary&) = delete;
+    FrameBoundary(FrameBoundary&&) = delete;
+    FrameBoundary& operator=(FrameBoundary&&) = delete;
+
+public:
+    /// @brief Returns an awaiter suspending the awaiting coroutine until the next signal().
+    [[nodiscard]] Awaiter next() noexcept
+    {
+        return Awaiter(*this);
+    }
+
+    /// @brief Ends the current frame: resumes the coroutines waiting for the boundary.
+    void signal();
+
+    /// @brief Returns the number of frames signaled so far.
+    [[nodiscard]] UInt64 getFrameIndex() const noexcept
+    {
+        return m_frameIndex.load(std::memory_order_acquire);
+    }
+};
+
+}   // namespace gp::jobs
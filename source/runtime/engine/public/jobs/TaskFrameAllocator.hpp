@@ -0,0 +1,44 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+
+namespace gp::jobs
+{
+
+/// @brief Pooled allocator for coroutine frames.
+/// @details
+/// Frames are served from power-of-two size classes, from kMinClassSize to kMaxClassSize bytes. Each class recycles
+/// its frames through a lock-free queue, so a frame allocated on one thread can be freed on any other, and grows by
+/// slabs of kSlabFrameCount frames taken from the global allocator. Frames larger than the biggest class, or
+/// allocated once a class holds kMaxFramesPerClass frames, fall back to the global allocator.
+class TaskFrameAllocator
+{
+public:
+    static constexpr USize kMinClassSize = 128;
+    static constexpr USize kMaxClassSize = 4096;
+    static constexpr USize kSlabFrameCount = 64;
+    static constexpr USize kMaxFramesPerClass = 4096;
+
+private:
+    /// @brief Deleted constructor prevent instantiation of the TaskFrameAllocator class, as it is intended to be used.
+    TaskFrameAllocator() = delete;
+
+    /// @brief Deleted destructor prevent instantiation of the TaskFrameAllocator class, as it is intended to be used.
+    ~TaskFrameAllocator() = delete;
+
+public:
+    /// @brief Allocates a coroutine frame.
+    /// @param[in] size Size of the frame, in bytes.
+    /// @return The frame, aligned to __STDCPP_DEFAULT_NEW_ALIGNMENT__.
+    [[nodiscard]] static void* allocate(USize size);
+
+    /// @brief Frees a frame returned by allocate(), from any thread.
+    /// @param[in] frame Frame to free.
+    static void deallocate(void* frame) noexcept;
+};
+
+}   // namespace gp::jobs
@@ -0,0 +1,150 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#pragma once
+
+#include "CoreMinimal.hpp"
+#include "jobs/JobSystem.hpp"
+#include "memory/pointers/UniquePtr.hpp"
+#include "templates/Expected.hpp"
+#include "templates/Optional.hpp"
+
+namespace gp::jobs
+{
+
+namespace detail
+{
+
+struct TaskGraphState;
+
+}   // namespace detail
+
+/// @brief Reasons a TaskGraphBuilder can fail to compile its graph.
+enum class TaskGraphError : UInt8
+{
+    TooManyNodes,   //<! More than TaskGraph::kMaxNodes nodes were added.
+    TooManyEdges,   //<! More than TaskGraph::kMaxEdges dependencies were added.
+    InvalidNode,    //<! A dependency references a node of another builder, or a node that failed to be added.
+    Cycle           //<! The dependencies form a cycle.
+};
+
+/// @brief Handle to a node of a TaskGraphBuilder, also identifying it in the compiled TaskGraph.
+struct TaskGraphNode
+{
+    static constexpr UInt32 kInvalidIndex = ~0u;
+
+    UInt32 index{ kInvalidIndex };
+
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return index != kInvalidIndex;
+    }
+};
+
+/// @brief Directed acyclic graph of named jobs, compiled once and executed every frame.
+/// @details
+/// Each node is ranked by its critical path: its own cost plus the longest chain of costs among its successors. When
+/// nodes become ready, the most critical one continues on the thread that released it, without going through a
+/// queue, and the others are scheduled from the most to the least critical, so idle workers steal the most critical
+/// first. The frame is then bounded by its longest chain rather than by the order the nodes were declared in.
+/// Costs start from the hints given to the builder. Each execution records the duration of every node, in a
+/// GP_PROFILE_SCOPE_N zone named after the node and in getNodeDuration(), and updatePriorities() ranks the nodes by
+/// these measures instead.
+/// @code
+///   TaskGraphBuilder builder;
+///   const TaskGraphNode input = builder.addNode("Input", [&]() { pollInput(); });
+///   const TaskGraphNode physics = builder.addNode("Physics", [&]() { stepPhysics(); }, 4);
+///   const TaskGraphNode culling = builder.addNode("Culling", [&]() { cullScene(); }, 2);
+///   builder.addDependency(input, physics);
+///   builder.addDependency(physics, culling);
+///   Expected<TaskGraph, TaskGraphError> frameGraph = builder.compile();
+///   ...
+///   frameGraph->execute(jobSystem);
+///   frameGraph->updatePriorities();
+/// @endcode
+/// @note A graph executes on one thread at a time, and node functions must not capture more than a JobFunction holds.
+class TaskGraph
+{
+    friend class TaskGraphBuilder;
+
+public:
+    static constexpr UInt32 kMaxNodes = 256;
+    static constexpr UInt32 kMaxEdges = 1024;
+
+private:
+    UniquePtr<detail::TaskGraphState> m_state;
+
+private:
+    explicit TaskGraph(UniquePtr<detail::TaskGraphState> state) noexcept;
+
+public:
+    TaskGraph(TaskGraph&& other) noexcept;
+    TaskGraph& operator=(TaskGraph&& other) noexcept;
+    ~TaskGraph();
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+public:
+    /// @brief Runs every node once, each after its dependencies, and returns once all of them finished.
+    /// @details The calling thread executes jobs while waiting, see JobSystem::wait().
+    /// @param[in] system Job system running the nodes.
+    void execute(JobSystem& system);
+
+    /// @brief Ranks the nodes by the durations measured during the last execution.
+    /// @details Nodes that never ran keep their cost hint. Must not be called while the graph executes.
+    void updatePriorities();
+
+    /// @brief Returns the number of nodes.
+    [[nodiscard]] UInt32 getNodeCount() const noexcept;
+
+    /// @brief Returns the name given to a node.
+    [[nodiscard]] const char* getNodeName(TaskGraphNode node) const noexcept;
+
+    /// @brief Returns the duration of a node during the last execution, in nanoseconds, 0 if it never ran.
+    [[nodiscard]] UInt64 getNodeDuration(TaskGraphNode node) const noexcept;
+
+    /// @brief Returns the critical path of a node: its cost plus the longest chain of costs among its successors.
+    [[nodiscard]] UInt64 getNodePriority(TaskGraphNode node) const noexcept;
+
+    /// @brief Returns the cost of the longest chain of the graph, the lower bound of an execution.
+    [[nodiscard]] UInt64 getCriticalPathCost() const noexcept;
+};
+
+/// @brief Declares the nodes and dependencies of a TaskGraph.
+/// @details Errors are recorded as they happen and reported by compile().
+class TaskGraphBuilder
+{
+private:
+    UniquePtr<detail::TaskGraphState> m_state;
+    Optional<TaskGraphError> m_error;
+
+public:
+    TaskGraphBuilder();
+    ~TaskGraphBuilder();
+
+    TaskGraphBuilder(const TaskGraphBuilder&) = delete;
+    TaskGraphBuilder& operator=(const TaskGraphBuilder&) = delete;
+    TaskGraphBuilder(TaskGraphBuilder&&) = delete;
+    TaskGraphBuilder& operator=(TaskGraphBuilder&&) = delete;
+
+public:
+    /// @brief Adds a node.
+    /// @param[in] name Name of the node, shown in the profiler. Must outlive the compiled graph.
+    /// @param[in] function Work of the node, executed once per execution of the graph.
+    /// @param[in] costHint Expected cost of the node relative to the others, used until updatePriorities().
+    /// @return The node, invalid if the graph is full.
+    TaskGraphNode addNode(const char* name, JobFunction function, UInt64 costHint = 1);
+
+    /// @brief Makes @p after wait for @p before to finish.
+    /// @param[in] before Node running first.
+    /// @param[in] after Node running once @p before finished.
+    void addDependency(TaskGraphNode before, TaskGraphNode after);
+
+    /// @brief Checks the graph and orders its nodes. The builder is left empty.
+    /// @return The graph, or the first error met while building it.
+    [[nodiscard]] Expected<TaskGraph, TaskGraphError> compile();
+};
+
+}   // namespace gp::jobs
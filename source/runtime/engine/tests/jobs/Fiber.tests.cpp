@@ -0,0 +1,123 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/Fiber.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+#if GP_JOBS_SUPPORTS_FIBERS
+
+namespace gp::tests
+{
+
+namespace
+{
+
+struct PingPong
+{
+    jobs::Fiber* caller{ nullptr };
+    jobs::Fiber* self{ nullptr };
+    UInt32 steps{ 0 };
+    double accumulator{ 1.0 };
+};
+
+void pingPongMain(void* userData)
+{
+    PingPong& state = *static_cast<PingPong*>(userData);
+    for (;;)
+    {
+        ++state.steps;
+        state.accumulator *= 1.5;
+        jobs::Fiber::switchTo(*state.self, *state.caller);
+    }
+}
+
+}   // namespace
+
+TEST(FiberTest, StackPoolHandsOutDisjointPageAlignedStacks)
+{
+    jobs::FiberStackPool pool(4, 10000);
+
+    ASSERT_EQ(pool.getStackCount(), 4u);
+    EXPECT_GE(pool.getStackSize(), 10000u);
+    for (UInt32 index = 0; index < pool.getStackCount(); ++index)
+    {
+        const jobs::FiberStack stack = pool.getStack(index);
+        EXPECT_EQ(stack.size, pool.getStackSize());
+        if (stack.base == nullptr)
+        {
+            continue;
+        }
+        EXPECT_EQ(reinterpret_cast<UIntPtr>(stack.base) % 4096, 0u);
+        stack.base[0] = Byte{ 1 };
+        stack.base[stack.size - 1] = Byte{ 2 };
+        if (index > 0)
+        {
+            EXPECT_GT(stack.base, pool.getStack(index - 1).base + pool.getStackSize());
+        }
+    }
+}
+
+    #if !GP_PLATFORM_WINDOWS
+TEST(FiberTest, StackOverflowHitsGuardPage)
+{
+    jobs::FiberStackPool pool(2, 4096);
+    volatile Byte* pastTheEnd = pool.getStack(1).base - 1;
+
+    EXPECT_DEATH(*pastTheEnd = Byte{ 0 }, "");
+}
+    #endif
+
+TEST(FiberTest, SwitchesBackAndForth)
+{
+    jobs::FiberStackPool pool(1, 64 * 1024);
+    jobs::Fiber thread;
+    PingPong state;
+    jobs::Fiber fiber(pool.getStack(0), &pingPongMain, &state);
+    state.caller = &thread;
+    state.self = &fiber;
+
+    double expected = 1.0;
+    for (UInt32 step = 1; step <= 100; ++step)
+    {
+        const double local = step * 0.25;
+        jobs::Fiber::switchTo(thread, fiber);
+        expected *= 1.5;
+        ASSERT_EQ(state.steps, step);
+        ASSERT_EQ(local, step * 0.25);
+    }
+    EXPECT_EQ(state.accumulator, expected);
+}
+
+TEST(FiberTest, ResumesOnAnotherThread)
+{
+    jobs::FiberStackPool pool(1, 64 * 1024);
+    jobs::Fiber mainThread;
+    PingPong state;
+    jobs::Fiber fiber(pool.getStack(0), &pingPongMain, &state);
+    state.self = &fiber;
+
+    state.caller = &mainThread;
+    jobs::Fiber::switchTo(mainThread, fiber);
+    EXPECT_EQ(state.steps, 1u);
+
+    std::thread other(
+        [&]()
+    {
+        jobs::Fiber otherThread;
+        state.caller = &otherThread;
+        jobs::Fiber::switchTo(otherThread, fiber);
+    }
+    );
+    other.join();
+    EXPECT_EQ(state.steps, 2u);
+
+    state.caller = &mainThread;
+    jobs::Fiber::switchTo(mainThread, fiber);
+    EXPECT_EQ(state.steps, 3u);
+}
+
+}   // namespace gp::tests
+
+#endif
@@ -0,0 +1,295 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/JobSystem.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+hal::CPUInfo makeCPUInfo(UInt32 physicalCoreCount, UInt32 logicalCoreCount)
+{
+    hal::CPUInfo cpuInfo;
+    cpuInfo.physicalCoreCount = physicalCoreCount;
+    cpuInfo.logicalCoreCount = logicalCoreCount;
+    return cpuInfo;
+}
+
+/// @brief Counts the leaves of a binary tree of jobs, each node waiting for its two children.
+UInt32 countLeaves(jobs::JobSystem& system, UInt32 depth)
+{
+    if (depth == 0)
+    {
+        return 1;
+    }
+
+    jobs::JobCounter counter;
+    UInt32 left = 0;
+    UInt32 right = 0;
+    system.run([&system, &left, depth]() { left = countLeaves(system, depth - 1); }, &counter);
+    system.run([&system, &right, depth]() { right = countLeaves(system, depth - 1); }, &counter);
+    system.wait(counter);
+    return left + right;
+}
+
+}   // namespace
+
+TEST(JobSystemTest, WorkerCountFollowsCoreCount)
+{
+    EXPECT_EQ(jobs::JobSystem::computeWorkerCount(makeCPUInfo(8, 16), false), 7u);
+    EXPECT_EQ(jobs::JobSystem::computeWorkerCount(makeCPUInfo(8, 16), true), 15u);
+    EXPECT_EQ(jobs::JobSystem::computeWorkerCount(makeCPUInfo(1, 1), false), 1u);
+    EXPECT_EQ(jobs::JobSystem::computeWorkerCount(makeCPUInfo(256, 512), true), jobs::JobSystem::kMaxThreads - 1);
+
+    jobs::JobSystem system(makeCPUInfo(4, 8), { .pinWorkers = false });
+    EXPECT_EQ(system.getWorkerCount(), 3u);
+    EXPECT_EQ(system.getThreadCount(), 4u);
+    EXPECT_EQ(system.getCurrentThreadIndex(), 0u);
+}
+
+TEST(JobSystemTest, RunsEveryJob)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    std::atomic<UInt32> sum{ 0 };
+    jobs::JobCounter counter;
+
+    for (UInt32 i = 1; i <= 1000; ++i)
+    {
+        system.run([&sum, i]() { sum.fetch_add(i, std::memory_order_relaxed); }, &counter);
+    }
+    system.wait(counter);
+
+    EXPECT_TRUE(counter.isDone());
+    EXPECT_EQ(sum.load(), 1000u * 1001u / 2u);
+}
+
+TEST(JobSystemTest, JobsSpawnNestedJobs)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    std::atomic<UInt32> leafCount{ 0 };
+    jobs::JobCounter counter;
+
+    for (UInt32 i = 0; i < 64; ++i)
+    {
+        system.run(
+            [&]()
+        {
+            for (UInt32 j = 0; j < 16; ++j)
+            {
+                system.run([&leafCount]() { leafCount.fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+        },
+            &counter
+        );
+    }
+    system.wait(counter);
+
+    EXPECT_EQ(leafCount.load(), 64u * 16u);
+}
+
+TEST(JobSystemTest, WorkersStealFromOwnerThread)
+{
+    jobs::JobSystem system(makeCPUInfo(2, 2), { .pinWorkers = false });
+    std::atomic<UInt32> executingThread{ jobs::JobSystem::kInvalidThreadIndex };
+    jobs::JobCounter counter;
+
+    system.run([&]() { executingThread.store(system.getCurrentThreadIndex(), std::memory_order_release); }, &counter);
+
+    // Spin without helping: only a worker stealing from the owner deque can run the job.
+    while (!counter.isDone())
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(executingThread.load(std::memory_order_acquire), 1u);
+}
+
+TEST(JobSystemTest, RunAfterWaitsForDependency)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    std::atomic<UInt32> firstStage{ 0 };
+    std::atomic<UInt32> observed{ 0 };
+    jobs::JobCounter stage1;
+    jobs::JobCounter stage2;
+
+    for (UInt32 i = 0; i < 100; ++i)
+    {
+        system.run([&firstStage]() { firstStage.fetch_add(1, std::memory_order_relaxed); }, &stage1);
+    }
+    system.runAfter(
+        stage1, [&]() { observed.store(firstStage.load(std::memory_order_relaxed), std::memory_order_relaxed); },
+        &stage2
+    );
+    system.wait(stage2);
+
+    EXPECT_EQ(observed.load(), 100u);
+}
+
+TEST(JobSystemTest, RunAfterDoneCounterRunsImmediately)
+{
+    jobs::JobSystem system(makeCPUInfo(2, 2), { .pinWorkers = false });
+    jobs::JobCounter done;
+    jobs::JobCounter counter;
+    bool ran = false;
+
+    system.runAfter(done, [&ran]() { ran = true; }, &counter);
+    system.wait(counter);
+
+    EXPECT_TRUE(ran);
+}
+
+TEST(JobSystemTest, ReusedCounterHoldsContinuationsAgain)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    jobs::JobCounter dependency;
+    std::atomic<UInt32> firstStage{ 0 };
+
+    for (UInt32 round = 1; round <= 50; ++round)
+    {
+        // Back from zero, the counter holds its continuations until the jobs of the round finish.
+        jobs::JobCounter counter;
+        std::atomic<UInt32> observed{ 0 };
+        for (UInt32 i = 0; i < 4; ++i)
+        {
+            system.run([&firstStage]() { firstStage.fetch_add(1, std::memory_order_relaxed); }, &dependency);
+        }
+        system.runAfter(
+            dependency,
+            [&]() { observed.store(firstStage.load(std::memory_order_relaxed), std::memory_order_relaxed); },
+            &counter
+        );
+        system.wait(counter);
+        system.wait(dependency);
+
+        EXPECT_EQ(observed.load(), round * 4);
+    }
+}
+
+TEST(JobSystemTest, ForeignThreadsCanScheduleAndWait)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    std::atomic<UInt32> sum{ 0 };
+
+    std::thread foreign(
+        [&]()
+    {
+        EXPECT_EQ(system.getCurrentThreadIndex(), jobs::JobSystem::kInvalidThreadIndex);
+        jobs::JobCounter counter;
+        for (UInt32 i = 0; i < 500; ++i)
+        {
+            system.run([&sum]() { sum.fetch_add(1, std::memory_order_relaxed); }, &counter);
+        }
+        system.wait(counter);
+    }
+    );
+    foreign.join();
+
+    EXPECT_EQ(sum.load(), 500u);
+}
+
+TEST(JobSystemTest, ChainedDependenciesUnderContention)
+{
+    jobs::JobSystem system(makeCPUInfo(8, 8), { .pinWorkers = false });
+    constexpr UInt32 kStages = 32;
+    jobs::JobCounter counters[kStages];
+    std::atomic<UInt32> completed[kStages] = {};
+    std::atomic<bool> orderViolated{ false };
+
+    for (UInt32 stage = 0; stage < kStages; ++stage)
+    {
+        for (UInt32 i = 0; i < 8; ++i)
+        {
+            auto work = [&, stage]()
+            {
+                if (stage > 0 && completed[stage - 1].load(std::memory_order_relaxed) != 8)
+                {
+                    orderViolated.store(true, std::memory_order_relaxed);
+                }
+                completed[stage].fetch_add(1, std::memory_order_relaxed);
+            };
+            if (stage == 0)
+            {
+                system.run(work, &counters[stage]);
+            }
+            else
+            {
+                system.runAfter(counters[stage - 1], work, &counters[stage]);
+            }
+        }
+    }
+    system.wait(counters[kStages - 1]);
+
+    EXPECT_FALSE(orderViolated.load());
+    EXPECT_EQ(completed[kStages - 1].load(), 8u);
+}
+
+TEST(JobSystemTest, JobsWaitInsideJobs)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    EXPECT_EQ(system.getFiberCount(), GP_JOBS_SUPPORTS_FIBERS ? 128u : 0u);
+
+    EXPECT_EQ(countLeaves(system, 10), 1024u);
+}
+
+TEST(JobSystemTest, JobsWaitInsideJobsWithFewFibers)
+{
+    // Clamped to one fiber more than the workers: most waits find no free fiber to suspend to.
+    jobs::JobSystem system(makeCPUInfo(3, 3), { .pinWorkers = false, .fiberCount = 1 });
+    EXPECT_EQ(system.getFiberCount(), GP_JOBS_SUPPORTS_FIBERS ? 3u : 0u);
+
+    EXPECT_EQ(countLeaves(system, 10), 1024u);
+}
+
+TEST(JobSystemTest, JobsWaitInsideJobsWithoutFibers)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false, .fiberCount = 0 });
+    EXPECT_EQ(system.getFiberCount(), 0u);
+
+    EXPECT_EQ(countLeaves(system, 10), 1024u);
+}
+
+TEST(JobSystemTest, SuspendedJobsResumeAfterRunAfterContinuations)
+{
+    jobs::JobSystem system(makeCPUInfo(3, 3), { .pinWorkers = false });
+    jobs::JobCounter gate;
+    jobs::JobCounter waiters;
+    jobs::JobCounter released;
+    std::atomic<UInt32> resumed{ 0 };
+    std::atomic<bool> isOpen{ false };
+
+    // Holds the gate closed until the waiters are all scheduled.
+    system.run(
+        [&isOpen]()
+    {
+        while (!isOpen.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+    },
+        &gate
+    );
+    for (UInt32 i = 0; i < 32; ++i)
+    {
+        system.run(
+            [&]()
+        {
+            system.wait(gate);
+            resumed.fetch_add(1, std::memory_order_relaxed);
+        },
+            &waiters
+        );
+    }
+    system.runAfter(gate, []() {}, &released);
+    isOpen.store(true, std::memory_order_release);
+    system.wait(waiters);
+    system.wait(released);
+
+    EXPECT_EQ(resumed.load(), 32u);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,188 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/ParallelAlgorithms.hpp"
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+jobs::JobSystem& getJobSystem()
+{
+    static jobs::JobSystem system(
+        [] {
+            hal::CPUInfo cpuInfo;
+            cpuInfo.physicalCoreCount = 4;
+            cpuInfo.logicalCoreCount = 4;
+            return cpuInfo;
+        }(),
+        { .pinWorkers = false }
+    );
+    return system;
+}
+
+}   // namespace
+
+TEST(ParallelAlgorithmsTest, ParallelForVisitsEveryIndexOnce)
+{
+    constexpr Int32 kCount = 100'000;
+    std::vector<std::atomic<UInt32>> visits(kCount);
+
+    jobs::parallelFor(
+        getJobSystem(), 0, kCount, [&visits](Int32 index) { visits[index].fetch_add(1, std::memory_order_relaxed); }
+    );
+
+    for (const auto& visit: visits)
+    {
+        ASSERT_EQ(visit.load(), 1u);
+    }
+}
+
+TEST(ParallelAlgorithmsTest, ParallelForRangeHonoursGrainSize)
+{
+    std::atomic<UInt32> smallestChunk{ ~0u };
+    std::atomic<UInt64> sum{ 0 };
+
+    jobs::parallelForRange(
+        getJobSystem(), 10u, 10'010u,
+        [&](UInt32 first, UInt32 last)
+    {
+        UInt32 size = last - first;
+        if (last != 10'010u)
+        {
+            UInt32 current = smallestChunk.load();
+            while (size < current && !smallestChunk.compare_exchange_weak(current, size)) {}
+        }
+        UInt64 partial = 0;
+        for (UInt32 index = first; index < last; ++index)
+        {
+            partial += index;
+        }
+        sum.fetch_add(partial);
+    },
+        100u
+    );
+
+    EXPECT_GE(smallestChunk.load(), 100u);
+    EXPECT_EQ(sum.load(), (10ull + 10'009ull) * 10'000ull / 2);
+}
+
+TEST(ParallelAlgorithmsTest, ParallelForHandlesEmptyAndTinyRanges)
+{
+    UInt32 calls = 0;
+    jobs::parallelFor(getJobSystem(), 5, 5, [&calls](Int32) { ++calls; });
+    EXPECT_EQ(calls, 0u);
+
+    jobs::parallelFor(getJobSystem(), 0, 3, [&calls](Int32) { ++calls; }, 16);
+    EXPECT_EQ(calls, 3u);
+}
+
+TEST(ParallelAlgorithmsTest, ParallelForEachUpdatesEveryElement)
+{
+    std::vector<Int32> values(50'000);
+    for (USize index = 0; index < values.size(); ++index)
+    {
+        values[index] = static_cast<Int32>(index);
+    }
+
+    jobs::parallelForEach(getJobSystem(), VectorView<Int32>(values), [](Int32& value) { value *= 2; });
+
+    for (USize index = 0; index < values.size(); ++index)
+    {
+        ASSERT_EQ(values[index], static_cast<Int32>(index * 2));
+    }
+}
+
+TEST(ParallelAlgorithmsTest, ParallelReduceMatchesSerialResult)
+{
+    std::vector<double> values(123'457);
+    std::mt19937 random(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (double& value: values)
+    {
+        value = distribution(random);
+    }
+
+    auto reduce = [&values](USize first, USize last, double accumulator)
+    {
+        for (USize index = first; index < last; ++index)
+        {
+            accumulator += values[index];
+        }
+        return accumulator;
+    };
+    auto combine = [](double left, double right) { return left + right; };
+
+    const double first = jobs::parallelReduce(getJobSystem(), USize{ 0 }, values.size(), 0.0, reduce, combine);
+    const double second = jobs::parallelReduce(getJobSystem(), USize{ 0 }, values.size(), 0.0, reduce, combine);
+    EXPECT_EQ(first, second);
+    EXPECT_NEAR(first, reduce(0, values.size(), 0.0), 1e-9);
+
+    const double empty = jobs::parallelReduce(getJobSystem(), USize{ 3 }, USize{ 3 }, 7.0, reduce, combine);
+    EXPECT_EQ(empty, 7.0);
+}
+
+TEST(ParallelAlgorithmsTest, ParallelReduceCombinesInOrder)
+{
+    // Concatenating digits is not commutative: any out-of-order combine shows in the result.
+    auto reduce = [](Int32 first, Int32 last, UInt64 accumulator)
+    {
+        for (Int32 index = first; index < last; ++index)
+        {
+            accumulator = accumulator * 10 + static_cast<UInt64>(index % 10);
+        }
+        return accumulator;
+    };
+    auto combine = [](UInt64 left, UInt64 right)
+    {
+        UInt64 scale = 1;
+        for (UInt64 digits = right; digits != 0; digits /= 10)
+        {
+            scale *= 10;
+        }
+        return left * scale + right;
+    };
+
+    EXPECT_EQ(jobs::parallelReduce(getJobSystem(), 1, 10, UInt64{ 0 }, reduce, combine, 1), 123456789ull);
+}
+
+TEST(ParallelAlgorithmsTest, ParallelSortMatchesSerialSort)
+{
+    std::vector<Int32> values(100'000);
+    std::mt19937 random(7);
+    for (Int32& value: values)
+    {
+        value = static_cast<Int32>(random());
+    }
+    std::vector<Int32> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    jobs::parallelSort(getJobSystem(), VectorView<Int32>(values));
+
+    EXPECT_EQ(values, expected);
+}
+
+TEST(ParallelAlgorithmsTest, ParallelSortUsesComparator)
+{
+    std::vector<UInt32> values(30'001);
+    for (USize index = 0; index < values.size(); ++index)
+    {
+        values[index] = static_cast<UInt32>((index * 7919) % values.size());
+    }
+
+    jobs::parallelSort(getJobSystem(), VectorView<UInt32>(values), std::greater<>{});
+
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>{}));
+    EXPECT_EQ(values.front(), values.size() - 1);
+    EXPECT_EQ(values.back(), 0u);
+}
+
+}   // namespace gp::tests
@@ -0,0 +1,235 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/Task.hpp"
+#include "jobs/TaskAwaiters.hpp"
+#include "jobs/TaskFrameAllocator.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+enum class ParseError : UInt8
+{
+    Negative
+};
+
+hal::CPUInfo makeCPUInfo(UInt32 physicalCoreCount, UInt32 logicalCoreCount)
+{
+    hal::CPUInfo cpuInfo;
+    cpuInfo.physicalCoreCount = physicalCoreCount;
+    cpuInfo.logicalCoreCount = logicalCoreCount;
+    return cpuInfo;
+}
+
+jobs::Task<Int32> square(Int32 value)
+{
+    co_return value * value;
+}
+
+jobs::Task<Expected<Int32, ParseError>> checkedSquare(Int32 value)
+{
+    if (value < 0)
+    {
+        co_return makeUnexpected(ParseError::Negative);
+    }
+    co_return co_await square(value);
+}
+
+jobs::Task<Expected<Int32, ParseError>> sumOfSquares(Int32 first, Int32 second)
+{
+    Expected<Int32, ParseError> left = co_await checkedSquare(first);
+    if (!left)
+    {
+        co_return makeUnexpected(left.error());
+    }
+    Expected<Int32, ParseError> right = co_await checkedSquare(second);
+    if (!right)
+    {
+        co_return makeUnexpected(right.error());
+    }
+    co_return *left + *right;
+}
+
+jobs::Task<UInt32> sumOnWorkers(jobs::JobSystem& system, UInt32 depth)
+{
+    co_await jobs::resumeOn(system);
+    if (depth == 0)
+    {
+        co_return 1;
+    }
+    const UInt32 left = co_await sumOnWorkers(system, depth - 1);
+    const UInt32 right = co_await sumOnWorkers(system, depth - 1);
+    co_return left + right;
+}
+
+}   // namespace
+
+TEST(TaskTest, ChainsValuesAndErrors)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+
+    const Expected<Int32, ParseError> sum = jobs::syncWait(system, sumOfSquares(3, 4));
+    ASSERT_TRUE(sum.hasValue());
+    EXPECT_EQ(*sum, 25);
+
+    const Expected<Int32, ParseError> failure = jobs::syncWait(system, sumOfSquares(3, -4));
+    ASSERT_FALSE(failure.hasValue());
+    EXPECT_EQ(failure.error(), ParseError::Negative);
+}
+
+TEST(TaskTest, IsLazyAndOwnsItsFrame)
+{
+    bool hasRun = false;
+    auto makeTask = [](bool& flag) -> jobs::Task<void>
+    {
+        flag = true;
+        co_return;
+    };
+
+    {
+        jobs::Task<void> task = makeTask(hasRun);
+        EXPECT_TRUE(task.isValid());
+        EXPECT_FALSE(task.isDone());
+        jobs::Task<void> moved = std::move(task);
+        EXPECT_FALSE(task.isValid());
+        EXPECT_TRUE(moved.isValid());
+    }
+    EXPECT_FALSE(hasRun);
+}
+
+TEST(TaskTest, ResumesOnWorkers)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    EXPECT_EQ(jobs::syncWait(system, sumOnWorkers(system, 8)), 256u);
+
+    auto threadIndex = [](jobs::JobSystem& jobSystem) -> jobs::Task<UInt32>
+    {
+        co_await jobs::resumeOn(jobSystem);
+        co_return jobSystem.getCurrentThreadIndex();
+    };
+    EXPECT_LT(jobs::syncWait(system, threadIndex(system)), system.getThreadCount());
+}
+
+TEST(TaskTest, SpawnSignalsCounter)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    std::atomic<UInt32> sum{ 0 };
+    jobs::JobCounter counter;
+
+    auto add = [](jobs::JobSystem& jobSystem, std::atomic<UInt32>& total, UInt32 value) -> jobs::Task<void>
+    {
+        co_await jobs::resumeOn(jobSystem);
+        total.fetch_add(value, std::memory_order_relaxed);
+    };
+    for (UInt32 index = 1; index <= 100; ++index)
+    {
+        jobs::spawn(system, add(system, sum, index), &counter);
+    }
+    system.wait(counter);
+    EXPECT_EQ(sum.load(), 5050u);
+}
+
+TEST(TaskTest, WaitsForCounter)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+
+    auto gather = [](jobs::JobSystem& jobSystem) -> jobs::Task<UInt32>
+    {
+        std::atomic<UInt32> sum{ 0 };
+        jobs::JobCounter counter;
+        for (UInt32 index = 0; index < 64; ++index)
+        {
+            jobSystem.run([&sum]() { sum.fetch_add(1, std::memory_order_relaxed); }, &counter);
+        }
+        co_await jobs::waitFor(jobSystem, counter);
+        co_return sum.load(std::memory_order_relaxed);
+    };
+    EXPECT_EQ(jobs::syncWait(system, gather(system)), 64u);
+}
+
+TEST(TaskTest, ReadsFiles)
+{
+    jobs::JobSystem system(makeCPUInfo(2, 2), { .pinWorkers = false });
+    const std::string path = (std::filesystem::temp_directory_path() / "gp_task_read.bin").string();
+    {
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        std::fputs("graphical playground", file);
+        std::fclose(file);
+    }
+
+    auto read = [](jobs::JobSystem& jobSystem, const char* filePath, VectorView<Byte, USize> buffer, UInt64 offset)
+        -> jobs::Task<Expected<USize, jobs::FileReadError>>
+    {
+        co_return co_await jobs::readFile(jobSystem, filePath, buffer, offset);
+    };
+
+    Byte buffer[32]{};
+    const Expected<USize, jobs::FileReadError> size =
+        jobs::syncWait(system, read(system, path.c_str(), VectorView<Byte, USize>(buffer, 32), 10));
+    ASSERT_TRUE(size.hasValue());
+    EXPECT_EQ(*size, 10u);
+    EXPECT_EQ(std::memcmp(buffer, "playground", 10), 0);
+
+    const Expected<USize, jobs::FileReadError> missing =
+        jobs::syncWait(system, read(system, "gp_task_missing.bin", VectorView<Byte, USize>(buffer, 32), 0));
+    ASSERT_FALSE(missing.hasValue());
+    EXPECT_EQ(missing.error(), jobs::FileReadError::OpenFailed);
+
+    std::filesystem::remove(path);
+}
+
+TEST(TaskTest, ResumesAtFrameBoundary)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    jobs::FrameBoundary endOfFrame(system);
+    std::atomic<UInt32> frameSum{ 0 };
+    jobs::JobCounter counter;
+
+    auto waitFrames = [](jobs::FrameBoundary& boundary, std::atomic<UInt32>& sum) -> jobs::Task<void>
+    {
+        for (UInt32 frame = 0; frame < 3; ++frame)
+        {
+            sum.fetch_add(static_cast<UInt32>(co_await boundary.next()), std::memory_order_relaxed);
+        }
+    };
+    for (UInt32 index = 0; index < 8; ++index)
+    {
+        jobs::spawn(system, waitFrames(endOfFrame, frameSum), &counter);
+    }
+
+    while (!counter.isDone())
+    {
+        endOfFrame.signal();
+        std::this_thread::yield();
+    }
+    EXPECT_GE(endOfFrame.getFrameIndex(), 3u);
+    EXPECT_GE(frameSum.load(), 8u * (1u + 2u + 3u));
+}
+
+TEST(TaskFrameAllocatorTest, RecyclesFrames)
+{
+    void* first = jobs::TaskFrameAllocator::allocate(200);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(reinterpret_cast<UIntPtr>(first) % __STDCPP_DEFAULT_NEW_ALIGNMENT__, 0u);
+    std::memset(first, 0xAB, 200);
+    jobs::TaskFrameAllocator::deallocate(first);
+
+    void* large = jobs::TaskFrameAllocator::allocate(jobs::TaskFrameAllocator::kMaxClassSize * 4);
+    ASSERT_NE(large, nullptr);
+    std::memset(large, 0xCD, jobs::TaskFrameAllocator::kMaxClassSize * 4);
+    jobs::TaskFrameAllocator::deallocate(large);
+}
+
+}   // namespace gp::tests
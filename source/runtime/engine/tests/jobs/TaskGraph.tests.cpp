@@ -0,0 +1,155 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "jobs/TaskGraph.hpp"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace gp::tests
+{
+
+namespace
+{
+
+hal::CPUInfo makeCPUInfo(UInt32 physicalCoreCount, UInt32 logicalCoreCount)
+{
+    hal::CPUInfo cpuInfo;
+    cpuInfo.physicalCoreCount = physicalCoreCount;
+    cpuInfo.logicalCoreCount = logicalCoreCount;
+    return cpuInfo;
+}
+
+}   // namespace
+
+TEST(TaskGraphTest, RunsNodesAfterTheirDependencies)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+
+    // Diamond: input -> { physics, animation } -> culling -> submit.
+    std::atomic<UInt32> sequence{ 0 };
+    UInt32 steps[5]{};
+    jobs::TaskGraphBuilder builder;
+    const jobs::TaskGraphNode input =
+        builder.addNode("Input", [&]() { steps[0] = sequence.fetch_add(1, std::memory_order_relaxed); });
+    const jobs::TaskGraphNode physics =
+        builder.addNode("Physics", [&]() { steps[1] = sequence.fetch_add(1, std::memory_order_relaxed); }, 4);
+    const jobs::TaskGraphNode animation =
+        builder.addNode("Animation", [&]() { steps[2] = sequence.fetch_add(1, std::memory_order_relaxed); }, 2);
+    const jobs::TaskGraphNode culling =
+        builder.addNode("Culling", [&]() { steps[3] = sequence.fetch_add(1, std::memory_order_relaxed); });
+    const jobs::TaskGraphNode submit =
+        builder.addNode("Submit", [&]() { steps[4] = sequence.fetch_add(1, std::memory_order_relaxed); });
+    builder.addDependency(input, physics);
+    builder.addDependency(input, animation);
+    builder.addDependency(physics, culling);
+    builder.addDependency(animation, culling);
+    builder.addDependency(culling, submit);
+
+    Expected<jobs::TaskGraph, jobs::TaskGraphError> graph = builder.compile();
+    ASSERT_TRUE(graph.hasValue());
+    EXPECT_EQ(graph->getNodeCount(), 5u);
+    EXPECT_STREQ(graph->getNodeName(physics), "Physics");
+    EXPECT_EQ(graph->getNodePriority(submit), 1u);
+    EXPECT_EQ(graph->getNodePriority(physics), 6u);
+    EXPECT_EQ(graph->getNodePriority(animation), 4u);
+    EXPECT_EQ(graph->getCriticalPathCost(), 7u);
+
+    for (UInt32 frame = 0; frame < 100; ++frame)
+    {
+        sequence.store(0);
+        graph->execute(system);
+        EXPECT_EQ(sequence.load(), 5u);
+        EXPECT_EQ(steps[0], 0u);
+        EXPECT_LT(steps[1], steps[3]);
+        EXPECT_LT(steps[2], steps[3]);
+        EXPECT_EQ(steps[4], 4u);
+    }
+}
+
+TEST(TaskGraphTest, RunsWideGraphs)
+{
+    jobs::JobSystem system(makeCPUInfo(4, 4), { .pinWorkers = false });
+    std::atomic<UInt32> sum{ 0 };
+    std::atomic<UInt32> sumAtEnd{ 0 };
+
+    jobs::TaskGraphBuilder builder;
+    const jobs::TaskGraphNode begin = builder.addNode("Begin", []() {});
+    const jobs::TaskGraphNode end =
+        builder.addNode("End", [&]() { sumAtEnd.store(sum.load(std::memory_order_relaxed)); });
+    for (UInt32 index = 0; index < 200; ++index)
+    {
+        const jobs::TaskGraphNode node =
+            builder.addNode("Leaf", [&sum]() { sum.fetch_add(1, std::memory_order_relaxed); });
+        builder.addDependency(begin, node);
+        builder.addDependency(node, end);
+    }
+
+    Expected<jobs::TaskGraph, jobs::TaskGraphError> graph = builder.compile();
+    ASSERT_TRUE(graph.hasValue());
+    for (UInt32 frame = 1; frame <= 20; ++frame)
+    {
+        graph->execute(system);
+        EXPECT_EQ(sumAtEnd.load(), 200u * frame);
+    }
+}
+
+TEST(TaskGraphTest, ReportsErrors)
+{
+    {
+        jobs::TaskGraphBuilder builder;
+        const jobs::TaskGraphNode first = builder.addNode("First", []() {});
+        const jobs::TaskGraphNode second = builder.addNode("Second", []() {});
+        builder.addDependency(first, second);
+        builder.addDependency(second, first);
+        Expected<jobs::TaskGraph, jobs::TaskGraphError> graph = builder.compile();
+        ASSERT_FALSE(graph.hasValue());
+        EXPECT_EQ(graph.error(), jobs::TaskGraphError::Cycle);
+
+        // The builder starts over after compiling.
+        builder.addNode("Third", []() {});
+        EXPECT_TRUE(builder.compile().hasValue());
+    }
+    {
+        jobs::TaskGraphBuilder builder;
+        const jobs::TaskGraphNode node = builder.addNode("Node", []() {});
+        builder.addDependency(node, jobs::TaskGraphNode{});
+        Expected<jobs::TaskGraph, jobs::TaskGraphError> graph = builder.compile();
+        ASSERT_FALSE(graph.hasValue());
+        EXPECT_EQ(graph.error(), jobs::TaskGraphError::InvalidNode);
+    }
+    {
+        jobs::TaskGraphBuilder builder;
+        for (UInt32 index = 0; index <= jobs::TaskGraph::kMaxNodes; ++index)
+        {
+            (void)builder.addNode("Node", []() {});
+        }
+        Expected<jobs::TaskGraph, jobs::TaskGraphError> graph = builder.compile();
+        ASSERT_FALSE(graph.hasValue());
+        EXPECT_EQ(graph.error(), jobs::TaskGraphError::TooManyNodes);
+    }
+}
+
+TEST(TaskGraphTest, RanksNodesByMeasuredDurations)
+{
+    jobs::JobSystem system(makeCPUInfo(2, 2), { .pinWorkers = false });
+
+    jobs::TaskGraphBuilder builder;
+    const jobs::TaskGraphNode fast = builder.addNode("Fast", []() {}, 100);
+    const jobs::TaskGraphNode slow =
+        builder.addNode("Slow", []() { std::this_thread::sleep_for(std::chrono::milliseconds(2)); }, 1);
+    Expected<jobs::TaskGraph, jobs::TaskGraphError> graph = builder.compile();
+    ASSERT_TRUE(graph.hasValue());
+    EXPECT_GT(graph->getNodePriority(fast), graph->getNodePriority(slow));
+    EXPECT_EQ(graph->getNodeDuration(slow), 0u);
+
+    graph->execute(system);
+    EXPECT_GE(graph->getNodeDuration(slow), 2'000'000u);
+    graph->updatePriorities();
+    EXPECT_GT(graph->getNodePriority(slow), graph->getNodePriority(fast));
+    EXPECT_EQ(graph->getCriticalPathCost(), graph->getNodePriority(slow));
+}
+
+}   // namespace gp::tests
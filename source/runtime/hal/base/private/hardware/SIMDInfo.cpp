@@ -0,0 +1,118 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "hardware/SIMDInfo.hpp"
+
+#if GP_ARCHITECTURE_X86 || GP_ARCHITECTURE_X64
+    #if GP_COMPILER_MSVC
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace gp::hal
+{
+
+#if GP_ARCHITECTURE_X86 || GP_ARCHITECTURE_X64
+
+namespace
+{
+
+struct CPUIDRegisters
+{
+    UInt32 eax;
+    UInt32 ebx;
+    UInt32 ecx;
+    UInt32 edx;
+};
+
+CPUIDRegisters cpuid(UInt32 leaf, UInt32 subleaf) noexcept
+{
+    CPUIDRegisters registers{};
+    #if GP_COMPILER_MSVC
+    int values[4];
+    __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+    registers = { static_cast<UInt32>(values[0]),
+                  static_cast<UInt32>(values[1]),
+                  static_cast<UInt32>(values[2]),
+                  static_cast<UInt32>(values[3]) };
+    #else
+    __cpuid_count(leaf, subleaf, registers.eax, registers.ebx, registers.ecx, registers.edx);
+    #endif
+    return registers;
+}
+
+/// @brief Reads XCR0, the register state the OS saves on context switches.
+UInt64 readExtendedControlRegister() noexcept
+{
+    #if GP_COMPILER_MSVC
+    return _xgetbv(0);
+    #else
+    UInt32 low = 0;
+    UInt32 high = 0;
+    __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    return (static_cast<UInt64>(high) << 32) | low;
+    #endif
+}
+
+constexpr bool hasBit(UInt32 value, UInt32 bit) noexcept
+{
+    return (value & (1u << bit)) != 0;
+}
+
+}   // namespace
+
+SIMDInfo SIMDInfo::query() noexcept
+{
+    SIMDInfo info;
+    const UInt32 maxLeaf = cpuid(0, 0).eax;
+    if (maxLeaf < 1)
+    {
+        return info;
+    }
+
+    const CPUIDRegisters features = cpuid(1, 0);
+    info.hasSSE = hasBit(features.edx, 25);
+    info.hasSSE2 = hasBit(features.edx, 26);
+    info.hasSSE3 = hasBit(features.ecx, 0);
+    info.hasSSSE3 = hasBit(features.ecx, 9);
+    info.hasSSE41 = hasBit(features.ecx, 19);
+    info.hasSSE42 = hasBit(features.ecx, 20);
+
+    // AVX registers are only usable when the OS saves them: XMM and YMM state for AVX, plus the opmask and ZMM state
+    // for AVX-512.
+    const bool hasOSXSave = hasBit(features.ecx, 27);
+    const UInt64 savedState = hasOSXSave ? readExtendedControlRegister() : 0;
+    const bool osSavesYmm = (savedState & 0x06u) == 0x06u;
+    const bool osSavesZmm = (savedState & 0xE6u) == 0xE6u;
+
+    info.hasAVX = osSavesYmm && hasBit(features.ecx, 28);
+    info.hasFMA3 = info.hasAVX && hasBit(features.ecx, 12);
+    if (maxLeaf >= 7)
+    {
+        const CPUIDRegisters extendedFeatures = cpuid(7, 0);
+        info.hasAVX2 = info.hasAVX && hasBit(extendedFeatures.ebx, 5);
+        info.hasAVX512F = osSavesZmm && hasBit(extendedFeatures.ebx, 16);
+    }
+    return info;
+}
+
+#else
+
+SIMDInfo SIMDInfo::query() noexcept
+{
+    SIMDInfo info;
+    #if GP_ARCHITECTURE_ARM64
+    // Advanced SIMD is mandatory on AArch64.
+    info.hasNEON = true;
+    #elif defined(__ARM_NEON)
+    info.hasNEON = true;
+    #endif
+    return info;
+}
+
+#endif
+
+}   // namespace gp::hal
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include "CoreMinimal.hpp"
+#include "kernels/Kernels.hpp"
+
 namespace gp::hal
 {
 
@@ -21,6 +24,29 @@ struct SIMDInfo
     bool hasAVX2{ false };
     bool hasAVX512F{ false };
     bool hasNEON{ false };
+
+    /// @brief Queries the SIMD capabilities of the CPU running the program.
+    /// @details On x86, the AVX and AVX-512 flags are only set when the OS also saves the matching register state.
+    /// @return The capabilities, all false on architectures the query does not know.
+    [[nodiscard]] static SIMDInfo query() noexcept;
+
+    /// @brief Returns the best kernel ISA level these capabilities can run, to pass to Kernels::initialize().
+    [[nodiscard]] ISALevel getKernelLevel() const noexcept
+    {
+        if (hasAVX2 && hasFMA3)
+        {
+            return ISALevel::AVX2;
+        }
+        if (hasSSE42)
+        {
+            return ISALevel::SSE4_2;
+        }
+        if (hasNEON)
+        {
+            return ISALevel::NEON;
+        }
+        return ISALevel::Scalar;
+    }
 };
 
 }   // namespace gp::hal
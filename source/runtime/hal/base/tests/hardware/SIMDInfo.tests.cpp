@@ -0,0 +1,53 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "hardware/SIMDInfo.hpp"
+#include <gtest/gtest.h>
+
+namespace gp::hal::tests
+{
+
+TEST(SIMDInfoTest, QueryMatchesCompilerCPUDetection)
+{
+#if (GP_ARCHITECTURE_X86 || GP_ARCHITECTURE_X64) && (GP_COMPILER_GCC || GP_COMPILER_CLANG)
+    // The compiler runtime reads the same CPUID and XCR0 bits, including the OS support of the AVX register state.
+    const SIMDInfo info = SIMDInfo::query();
+    EXPECT_EQ(info.hasSSE, __builtin_cpu_supports("sse") != 0);
+    EXPECT_EQ(info.hasSSE2, __builtin_cpu_supports("sse2") != 0);
+    EXPECT_EQ(info.hasSSE3, __builtin_cpu_supports("sse3") != 0);
+    EXPECT_EQ(info.hasSSSE3, __builtin_cpu_supports("ssse3") != 0);
+    EXPECT_EQ(info.hasSSE41, __builtin_cpu_supports("sse4.1") != 0);
+    EXPECT_EQ(info.hasSSE42, __builtin_cpu_supports("sse4.2") != 0);
+    EXPECT_EQ(info.hasAVX, __builtin_cpu_supports("avx") != 0);
+    EXPECT_EQ(info.hasFMA3, __builtin_cpu_supports("fma") != 0);
+    EXPECT_EQ(info.hasAVX2, __builtin_cpu_supports("avx2") != 0);
+    EXPECT_EQ(info.hasAVX512F, __builtin_cpu_supports("avx512f") != 0);
+    EXPECT_FALSE(info.hasNEON);
+#elif GP_ARCHITECTURE_ARM64
+    EXPECT_TRUE(SIMDInfo::query().hasNEON);
+#else
+    GTEST_SKIP() << "No CPU detection to compare with on this target";
+#endif
+}
+
+TEST(SIMDInfoTest, KernelLevelFollowsCapabilities)
+{
+    SIMDInfo info;
+    EXPECT_EQ(info.getKernelLevel(), ISALevel::Scalar);
+
+    info.hasSSE42 = true;
+    EXPECT_EQ(info.getKernelLevel(), ISALevel::SSE4_2);
+
+    // AVX2 kernels also use FMA: AVX2 alone stays on SSE4.2.
+    info.hasAVX2 = true;
+    EXPECT_EQ(info.getKernelLevel(), ISALevel::SSE4_2);
+    info.hasFMA3 = true;
+    EXPECT_EQ(info.getKernelLevel(), ISALevel::AVX2);
+
+    SIMDInfo arm;
+    arm.hasNEON = true;
+    EXPECT_EQ(arm.getKernelLevel(), ISALevel::NEON);
+}
+
+}   // namespace gp::hal::tests
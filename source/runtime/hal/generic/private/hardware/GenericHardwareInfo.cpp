@@ -3,12 +3,16 @@
 // mailto:support AT graphical-playground DOT com
 
 #include "hardware/GenericHardwareInfo.hpp"
+#include "kernels/Kernels.hpp"
 
 namespace gp::hal::generic
 {
 
 [[nodiscard]] bool HardwareInfo::initialize() noexcept
 {
+    m_cpuInfo.simd = SIMDInfo::query();
+    Kernels::initialize(m_cpuInfo.simd.getKernelLevel());
+    m_initialized = true;
     return m_initialized;
 }
 
@@ -20,6 +20,7 @@ private:
 
 public:
     /// @brief Initializes the hardware info system. Must be called before any other methods.
+    /// @details Also selects the kernels matching the SIMD capabilities of the CPU, see Kernels::initialize().
     /// @return True if initialization succeeded, false otherwise.
     [[nodiscard]] virtual bool initialize() noexcept override;
 
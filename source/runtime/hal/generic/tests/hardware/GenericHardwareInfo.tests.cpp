@@ -0,0 +1,24 @@
+// Copyright (c) - Graphical Playground. All rights reserved.
+// For more information, see https://graphical-playground/legal
+// mailto:support AT graphical-playground DOT com
+
+#include "hardware/GenericHardwareInfo.hpp"
+#include "kernels/Kernels.hpp"
+#include <gtest/gtest.h>
+
+namespace gp::hal::generic::tests
+{
+
+TEST(GenericHardwareInfoTest, InitializeSelectsKernels)
+{
+    Kernels::initialize(ISALevel::Scalar);
+
+    HardwareInfo hardwareInfo;
+    ASSERT_TRUE(hardwareInfo.initialize());
+    const ISALevel level = hardwareInfo.getCPUInfo().simd.getKernelLevel();
+    EXPECT_EQ(Kernels::getLevel(), Kernels::getTable(level).level);
+
+    Kernels::initialize(ISALevel::Scalar);
+}
+
+}   // namespace gp::hal::generic::tests